@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file       main.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Host stand-in for the CubeMX main header (pin map)
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+/* Includes */
+#include "stm32l0xx_hal.h"
+
+/* Typedefinitions */
+
+// The pins follow the CubeMX project of the TX board, PA for the radio side,
+// PB for the RSL10 and the LEDs
+
+#define GPO_TCXO_EN_Pin                 GPIO_PIN_0
+#define GPO_TCXO_EN_GPIO_Port           GPIOA
+#define GPO_BUTTON_PULL_Pin             GPIO_PIN_1
+#define GPO_BUTTON_PULL_GPIO_Port       GPIOA
+#define GPO_T20_GATE_Pin                GPIO_PIN_4
+#define GPO_T20_GATE_GPIO_Port          GPIOA
+#define GPO_XTAL_EN_Pin                 GPIO_PIN_5
+#define GPO_XTAL_EN_GPIO_Port           GPIOA
+#define GPI_TEST_MODE_Pin               GPIO_PIN_6
+#define GPI_TEST_MODE_GPIO_Port         GPIOA
+#define GPO_LED_RED_Pin                 GPIO_PIN_8
+#define GPO_LED_RED_GPIO_Port           GPIOA
+#define USART1_TX_RSL10_Pin             GPIO_PIN_9
+#define USART1_TX_RSL10_GPIO_Port       GPIOA
+#define USART1_RX_RSL10_Pin             GPIO_PIN_10
+#define USART1_RX_RSL10_GPIO_Port       GPIOA
+#define GPO_2_S2LP_Pin                  GPIO_PIN_11
+#define GPO_2_S2LP_GPIO_Port            GPIOA
+#define GPO_1_S2LP_Pin                  GPIO_PIN_12
+#define GPO_1_S2LP_GPIO_Port            GPIOA
+#define GPO_S2LP_CS_Pin                 GPIO_PIN_15
+#define GPO_S2LP_CS_GPIO_Port           GPIOA
+
+#define GPO_RSL_WAKE_UP_Pin             GPIO_PIN_0
+#define GPO_RSL_WAKE_UP_GPIO_Port       GPIOB
+#define GPO_S2LP_SHDWN_Pin              GPIO_PIN_1
+#define GPO_S2LP_SHDWN_GPIO_Port        GPIOB
+#define GPO_RSL_RESET_Pin               GPIO_PIN_2
+#define GPO_RSL_RESET_GPIO_Port         GPIOB
+#define SPI1_SCK_S2LP_Pin               GPIO_PIN_3
+#define SPI1_SCK_S2LP_GPIO_Port         GPIOB
+#define SPI1_MISO_S2LP_Pin              GPIO_PIN_4
+#define SPI1_MISO_S2LP_GPIO_Port        GPIOB
+#define SPI1_MOSI_S2LP_Pin              GPIO_PIN_5
+#define SPI1_MOSI_S2LP_GPIO_Port        GPIOB
+#define GPO_LED_GREEN_Pin               GPIO_PIN_6
+#define GPO_LED_GREEN_GPIO_Port         GPIOB
+#define GPO_LED_BLUE_Pin                GPIO_PIN_7
+#define GPO_LED_BLUE_GPIO_Port          GPIOB
+
+/* Variables */
+
+/* Function definitions */
+void Error_Handler(void);
+
+#endif
@@ -0,0 +1,397 @@
+/**
+  ******************************************************************************
+  * @file       stm32l051xx.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Host stand-in for the STM32L051 device header
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | ADC CFGR1/CFGR2 bits                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 003       | 2026-10-18    | Tim Steinberg         | EXTI registers                                |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 004       | 2026-10-18    | Tim Steinberg         | LPTIM1 registers                              |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __STM32L051XX_H
+#define __STM32L051XX_H
+
+/* Includes */
+#include <stdint.h>
+
+/* Typedefinitions */
+
+// Only the registers the firmware touches directly exist here. The instances
+// are plain variables of the simulation, HAL_Sim.c brings them to life.
+
+#define __I     volatile const
+#define __O     volatile
+#define __IO    volatile
+
+/** *@brief The interrupt numbers of the STM32L051 */
+typedef enum
+{
+  NonMaskableInt_IRQn         = -14,
+  HardFault_IRQn              = -13,
+  SVC_IRQn                    = -5,
+  PendSV_IRQn                 = -2,
+  SysTick_IRQn                = -1,
+  WWDG_IRQn                   = 0,
+  PVD_IRQn                    = 1,
+  RTC_IRQn                    = 2,
+  FLASH_IRQn                  = 3,
+  RCC_IRQn                    = 4,
+  EXTI0_1_IRQn                = 5,
+  EXTI2_3_IRQn                = 6,
+  EXTI4_15_IRQn               = 7,
+  DMA1_Channel1_IRQn          = 9,
+  DMA1_Channel2_3_IRQn        = 10,
+  DMA1_Channel4_5_6_7_IRQn    = 11,
+  ADC1_COMP_IRQn              = 12,
+  LPTIM1_IRQn                 = 13,
+  TIM2_IRQn                   = 15,
+  TIM21_IRQn                  = 20,
+  TIM22_IRQn                  = 22,
+  I2C1_IRQn                   = 23,
+  I2C2_IRQn                   = 24,
+  SPI1_IRQn                   = 25,
+  SPI2_IRQn                   = 26,
+  USART1_IRQn                 = 27,
+  USART2_IRQn                 = 28,
+  LPUART1_IRQn                = 29,
+} IRQn_Type;
+
+#define HAL_SIM_IRQ_COUNT       32
+
+typedef struct
+{
+  __IO uint32_t MODER;
+  __IO uint32_t OTYPER;
+  __IO uint32_t OSPEEDR;
+  __IO uint32_t PUPDR;
+  __IO uint32_t IDR;
+  __IO uint32_t ODR;
+  __IO uint32_t BSRR;
+  __IO uint32_t LCKR;
+  __IO uint32_t AFR[2];
+  __IO uint32_t BRR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR1;
+  __IO uint32_t CR2;
+  __IO uint32_t CR3;
+  __IO uint32_t BRR;
+  __IO uint32_t GTPR;
+  __IO uint32_t RTOR;
+  __IO uint32_t RQR;
+  __IO uint32_t ISR;
+  __IO uint32_t ICR;
+  __IO uint32_t RDR;
+  __IO uint32_t TDR;
+} USART_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR1;
+  __IO uint32_t CR2;
+  __IO uint32_t SR;
+  __IO uint32_t DR;
+  __IO uint32_t CRCPR;
+  __IO uint32_t RXCRCR;
+  __IO uint32_t TXCRCR;
+  __IO uint32_t I2SCFGR;
+  __IO uint32_t I2SPR;
+} SPI_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CCR;
+  __IO uint32_t CNDTR;
+  __IO uint32_t CPAR;
+  __IO uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t ISR;
+  __IO uint32_t IFCR;
+} DMA_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CSELR;
+} DMA_Request_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR1;
+  __IO uint32_t CR2;
+  __IO uint32_t SMCR;
+  __IO uint32_t DIER;
+  __IO uint32_t SR;
+  __IO uint32_t EGR;
+  __IO uint32_t CCMR1;
+  __IO uint32_t CCMR2;
+  __IO uint32_t CCER;
+  __IO uint32_t CNT;
+  __IO uint32_t PSC;
+  __IO uint32_t ARR;
+} TIM_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t ISR;
+  __IO uint32_t IER;
+  __IO uint32_t CR;
+  __IO uint32_t CFGR1;
+  __IO uint32_t CFGR2;
+  __IO uint32_t SMPR;
+  __IO uint32_t TR;
+  __IO uint32_t CHSELR;
+  __IO uint32_t DR;
+  __IO uint32_t CALFACT;
+} ADC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t DR;
+  __IO uint8_t  IDR;
+  __IO uint32_t CR;
+  __IO uint32_t INIT;
+  __IO uint32_t POL;
+} CRC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t ISR;
+  __IO uint32_t PRER;
+  __IO uint32_t WUTR;
+  __IO uint32_t CR;
+  __IO uint32_t BKP[5];
+} RTC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t ISR;
+  __IO uint32_t ICR;
+  __IO uint32_t IER;
+  __IO uint32_t CFGR;
+  __IO uint32_t CR;
+  __IO uint32_t CMP;
+  __IO uint32_t ARR;
+  __IO uint32_t CNT;
+} LPTIM_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t KR;
+  __IO uint32_t PR;
+  __IO uint32_t RLR;
+  __IO uint32_t SR;
+  __IO uint32_t WINR;
+} IWDG_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t ICSCR;
+  __IO uint32_t CRRCR;
+  __IO uint32_t CFGR;
+  __IO uint32_t CIER;
+  __IO uint32_t CIFR;
+  __IO uint32_t CICR;
+  __IO uint32_t CSR;
+} RCC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t CSR;
+} PWR_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t IMR;
+  __IO uint32_t EMR;
+  __IO uint32_t RTSR;
+  __IO uint32_t FTSR;
+  __IO uint32_t SWIER;
+  __IO uint32_t PR;
+} EXTI_TypeDef;
+
+/* Memory map */
+#define FLASH_BASE              0x08000000U
+#define FLASH_SIZE              0x00010000U
+#define DATA_EEPROM_BASE        0x08080000U
+#define DATA_EEPROM_END         0x080807FFU
+#define SRAM_BASE               0x20000000U
+#define UID_BASE                0x1FF80050U
+#define VREFINT_CAL_ADDR        0x1FF80078U
+
+/* Instances */
+extern GPIO_TypeDef             halSimGpioA;
+extern GPIO_TypeDef             halSimGpioB;
+extern GPIO_TypeDef             halSimGpioC;
+extern GPIO_TypeDef             halSimGpioD;
+extern GPIO_TypeDef             halSimGpioH;
+extern USART_TypeDef            halSimUsart1;
+extern USART_TypeDef            halSimUsart2;
+extern SPI_TypeDef              halSimSpi1;
+extern DMA_TypeDef              halSimDma1;
+extern DMA_Request_TypeDef      halSimDma1Csel;
+extern DMA_Channel_TypeDef      halSimDma1Channel[7];
+extern TIM_TypeDef              halSimTim2;
+extern ADC_TypeDef              halSimAdc1;
+extern CRC_TypeDef              halSimCrc;
+extern RTC_TypeDef              halSimRtc;
+extern LPTIM_TypeDef            halSimLptim1;
+extern IWDG_TypeDef             halSimIwdg;
+extern RCC_TypeDef              halSimRcc;
+extern PWR_TypeDef              halSimPwr;
+extern EXTI_TypeDef             halSimExti;
+
+#define GPIOA                   (&halSimGpioA)
+#define GPIOB                   (&halSimGpioB)
+#define GPIOC                   (&halSimGpioC)
+#define GPIOD                   (&halSimGpioD)
+#define GPIOH                   (&halSimGpioH)
+#define USART1                  (&halSimUsart1)
+#define USART2                  (&halSimUsart2)
+#define SPI1                    (&halSimSpi1)
+#define DMA1                    (&halSimDma1)
+#define DMA1_CSELR              (&halSimDma1Csel)
+#define DMA1_Channel1           (&halSimDma1Channel[0])
+#define DMA1_Channel2           (&halSimDma1Channel[1])
+#define DMA1_Channel3           (&halSimDma1Channel[2])
+#define DMA1_Channel4           (&halSimDma1Channel[3])
+#define DMA1_Channel5           (&halSimDma1Channel[4])
+#define DMA1_Channel6           (&halSimDma1Channel[5])
+#define DMA1_Channel7           (&halSimDma1Channel[6])
+#define TIM2                    (&halSimTim2)
+#define ADC1                    (&halSimAdc1)
+#define CRC                     (&halSimCrc)
+#define RTC                     (&halSimRtc)
+#define LPTIM1                  (&halSimLptim1)
+#define IWDG                    (&halSimIwdg)
+#define RCC                     (&halSimRcc)
+#define PWR                     (&halSimPwr)
+#define EXTI                    (&halSimExti)
+
+/* Register bits */
+#define USART_CR1_UE            (0x1U << 0)
+#define USART_CR1_RE            (0x1U << 2)
+#define USART_CR1_TE            (0x1U << 3)
+#define USART_CR1_IDLEIE        (0x1U << 4)
+#define USART_CR1_RXNEIE        (0x1U << 5)
+#define USART_CR1_TCIE          (0x1U << 6)
+#define USART_CR1_TXEIE         (0x1U << 7)
+#define USART_CR1_PEIE          (0x1U << 8)
+#define USART_CR3_EIE           (0x1U << 0)
+#define USART_CR3_DMAR          (0x1U << 6)
+#define USART_CR3_DMAT          (0x1U << 7)
+#define USART_ISR_PE            (0x1U << 0)
+#define USART_ISR_FE            (0x1U << 1)
+#define USART_ISR_NE            (0x1U << 2)
+#define USART_ISR_ORE           (0x1U << 3)
+#define USART_ISR_IDLE          (0x1U << 4)
+#define USART_ISR_RXNE          (0x1U << 5)
+#define USART_ISR_TC            (0x1U << 6)
+#define USART_ISR_TXE           (0x1U << 7)
+
+#define DMA_CCR_EN              (0x1U << 0)
+#define DMA_CCR_TCIE            (0x1U << 1)
+#define DMA_CCR_HTIE            (0x1U << 2)
+#define DMA_CCR_TEIE            (0x1U << 3)
+#define DMA_CCR_DIR             (0x1U << 4)
+#define DMA_CCR_CIRC            (0x1U << 5)
+#define DMA_CCR_PINC            (0x1U << 6)
+#define DMA_CCR_MINC            (0x1U << 7)
+#define DMA_CCR_PSIZE_Pos       8U
+#define DMA_CCR_MSIZE_Pos       10U
+#define DMA_CCR_PL_Pos          12U
+#define DMA_ISR_GIF1            (0x1U << 0)
+#define DMA_ISR_TCIF1           (0x1U << 1)
+#define DMA_ISR_HTIF1           (0x1U << 2)
+#define DMA_ISR_TEIF1           (0x1U << 3)
+
+#define TIM_CR1_CEN             (0x1U << 0)
+#define TIM_DIER_UIE            (0x1U << 0)
+#define TIM_DIER_UDE            (0x1U << 8)
+#define TIM_SR_UIF              (0x1U << 0)
+#define TIM_EGR_UG              (0x1U << 0)
+
+#define ADC_CHSELR_CHSEL0       (0x1U << 0)
+#define ADC_CHSELR_CHSEL1       (0x1U << 1)
+#define ADC_CHSELR_CHSEL17      (0x1U << 17)
+#define ADC_CHSELR_CHSEL18      (0x1U << 18)
+#define ADC_ISR_EOC             (0x1U << 2)
+#define ADC_ISR_EOS             (0x1U << 3)
+#define ADC_CR_ADEN             (0x1U << 0)
+#define ADC_CR_ADSTART          (0x1U << 2)
+#define ADC_CFGR1_DMAEN         (0x1U << 0)
+#define ADC_CFGR1_OVRMOD        (0x1U << 12)
+#define ADC_CFGR1_CONT          (0x1U << 13)
+#define ADC_CFGR1_AUTOFF        (0x1U << 15)
+#define ADC_CFGR2_OVSE          (0x1U << 0)
+#define ADC_CFGR2_OVSR_Pos      2U
+#define ADC_CFGR2_OVSR          (0x7U << ADC_CFGR2_OVSR_Pos)
+#define ADC_CFGR2_OVSS_Pos      5U
+#define ADC_CFGR2_OVSS          (0xFU << ADC_CFGR2_OVSS_Pos)
+#define ADC_CFGR2_TOVS          (0x1U << 9)
+
+#define CRC_CR_RESET            (0x1U << 0)
+#define CRC_CR_POLYSIZE_Pos     3U
+#define CRC_CR_REV_IN_Pos       5U
+#define CRC_CR_REV_OUT          (0x1U << 7)
+
+#define RTC_CR_WUTE             (0x1U << 10)
+#define RTC_CR_WUTIE            (0x1U << 14)
+#define RTC_ISR_WUTF            (0x1U << 10)
+
+#define LPTIM_ISR_CMPM          (0x1U << 0)
+#define LPTIM_ISR_ARRM          (0x1U << 1)
+#define LPTIM_ICR_CMPMCF        (0x1U << 0)
+#define LPTIM_ICR_ARRMCF        (0x1U << 1)
+#define LPTIM_IER_CMPMIE        (0x1U << 0)
+#define LPTIM_IER_ARRMIE        (0x1U << 1)
+#define LPTIM_CFGR_PRESC_Pos    9U
+#define LPTIM_CFGR_PRESC        (0x7U << LPTIM_CFGR_PRESC_Pos)
+#define LPTIM_CFGR_TIMOUT       (0x1U << 19)
+#define LPTIM_CR_ENABLE         (0x1U << 0)
+#define LPTIM_CR_CNTSTRT        (0x1U << 2)
+
+#define RCC_CSR_RMVF            (0x1U << 23)
+#define RCC_CSR_IWDGRSTF        (0x1U << 29)
+
+#define PWR_CSR_WUF             (0x1U << 0)
+
+/* Variables */
+
+/* Function definitions */
+
+#endif
@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file       stm32l0xx.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Host stand-in for the STM32L0xx device family header
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | PRIMASK intrinsics                            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __STM32L0XX_H
+#define __STM32L0XX_H
+
+/* Includes */
+#include <stdint.h>
+#include "stm32l051xx.h"
+
+/* Typedefinitions */
+typedef enum
+{
+  RESET = 0,
+  SET = !RESET
+} FlagStatus, ITStatus;
+
+typedef enum
+{
+  DISABLE = 0,
+  ENABLE = !DISABLE
+} FunctionalState;
+
+typedef enum
+{
+  SUCCESS = 0,
+  ERROR = !SUCCESS
+} ErrorStatus;
+
+#define SET_BIT(REG, BIT)       ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)     ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)      ((REG) & (BIT))
+#define WRITE_REG(REG, VAL)     ((REG) = (VAL))
+#define READ_REG(REG)           ((REG))
+
+// The core intrinsics end up in the simulation, it is the one that knows
+// about pending interrupts and the virtual time
+#define __disable_irq()         halSim_disableIrq()
+#define __enable_irq()          halSim_enableIrq()
+#define __get_PRIMASK()         halSim_getPrimask()
+#define __set_PRIMASK(mask)     halSim_setPrimask(mask)
+#define __WFI()                 halSim_waitForInterrupt()
+#define __NOP()                 do{}while(0)
+#define NVIC_SystemReset()      halSim_systemReset()
+
+/* Variables */
+extern uint32_t SystemCoreClock;
+
+/* Function definitions */
+void halSim_disableIrq(void);
+void halSim_enableIrq(void);
+uint32_t halSim_getPrimask(void);
+void halSim_setPrimask(uint32_t mask);
+void halSim_waitForInterrupt(void);
+void halSim_systemReset(void);
+
+#endif
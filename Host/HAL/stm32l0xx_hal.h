@@ -0,0 +1,1003 @@
+/**
+  ******************************************************************************
+  * @file       stm32l0xx_hal.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Host stand-in for the STM32L0xx HAL driver
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | ADC oversampling and DMA                      |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 003       | 2026-10-18    | Tim Steinberg         | Interrupt driven UART transmission            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 004       | 2026-10-18    | Tim Steinberg         | EXTI modes, macros and IRQ handler            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 005       | 2026-10-18    | Tim Steinberg         | Added HAL_SPI_Transmit                        |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Added HAL_RCC_GetClockConfig                  |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | LPTIM timeout mode                            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __STM32L0XX_HAL_H
+#define __STM32L0XX_HAL_H
+
+/* Includes */
+#include <stdint.h>
+#include <stddef.h>
+#include "stm32l0xx.h"
+
+/* Typedefinitions */
+
+// The handles and constants follow the names of the STM32CubeL0 HAL, so the
+// firmware compiles unchanged. The values only need to be consistent with
+// HAL_Sim.c, they are not the encodings of the real HAL.
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  HAL_UNLOCKED = 0x00U,
+  HAL_LOCKED   = 0x01U
+} HAL_LockTypeDef;
+
+#define HAL_MAX_DELAY           0xFFFFFFFFU
+#define UNUSED(X)               (void)X
+
+/* ---------------------------------------------------------------- GPIO --- */
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0U,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+#define GPIO_PIN_0              ((uint16_t)0x0001U)
+#define GPIO_PIN_1              ((uint16_t)0x0002U)
+#define GPIO_PIN_2              ((uint16_t)0x0004U)
+#define GPIO_PIN_3              ((uint16_t)0x0008U)
+#define GPIO_PIN_4              ((uint16_t)0x0010U)
+#define GPIO_PIN_5              ((uint16_t)0x0020U)
+#define GPIO_PIN_6              ((uint16_t)0x0040U)
+#define GPIO_PIN_7              ((uint16_t)0x0080U)
+#define GPIO_PIN_8              ((uint16_t)0x0100U)
+#define GPIO_PIN_9              ((uint16_t)0x0200U)
+#define GPIO_PIN_10             ((uint16_t)0x0400U)
+#define GPIO_PIN_11             ((uint16_t)0x0800U)
+#define GPIO_PIN_12             ((uint16_t)0x1000U)
+#define GPIO_PIN_13             ((uint16_t)0x2000U)
+#define GPIO_PIN_14             ((uint16_t)0x4000U)
+#define GPIO_PIN_15             ((uint16_t)0x8000U)
+#define GPIO_PIN_All            ((uint16_t)0xFFFFU)
+
+#define GPIO_MODE_INPUT         0x00000000U
+#define GPIO_MODE_OUTPUT_PP     0x00000001U
+#define GPIO_MODE_OUTPUT_OD     0x00000011U
+#define GPIO_MODE_AF_PP         0x00000002U
+#define GPIO_MODE_AF_OD         0x00000012U
+#define GPIO_MODE_ANALOG        0x00000003U
+#define GPIO_MODE_IT_RISING     0x10110000U
+#define GPIO_MODE_IT_FALLING    0x10210000U
+#define GPIO_MODE_IT_RISING_FALLING 0x10310000U
+
+// The EXTI part of the mode, the pin itself is an input
+#define GPIO_MODE_EXTI          0x10000000U
+#define GPIO_MODE_EXTI_RISING   0x00100000U
+#define GPIO_MODE_EXTI_FALLING  0x00200000U
+
+// The target clears by writing 1, the register block here is plain memory
+#define __HAL_GPIO_EXTI_GET_IT(__EXTI_LINE__)   (EXTI->PR & (__EXTI_LINE__))
+#define __HAL_GPIO_EXTI_CLEAR_IT(__EXTI_LINE__) (EXTI->PR &= ~((uint32_t) (__EXTI_LINE__)))
+
+#define GPIO_NOPULL             0x00000000U
+#define GPIO_PULLUP             0x00000001U
+#define GPIO_PULLDOWN           0x00000002U
+
+#define GPIO_SPEED_FREQ_LOW     0x00000000U
+#define GPIO_SPEED_FREQ_MEDIUM  0x00000001U
+#define GPIO_SPEED_FREQ_HIGH    0x00000002U
+#define GPIO_SPEED_FREQ_VERY_HIGH 0x00000003U
+
+#define GPIO_AF0_SPI1           0x00U
+#define GPIO_AF4_USART1         0x04U
+#define GPIO_AF4_USART2         0x04U
+
+/* ----------------------------------------------------------------- DMA --- */
+typedef struct
+{
+  uint32_t Request;
+  uint32_t Direction;
+  uint32_t PeriphInc;
+  uint32_t MemInc;
+  uint32_t PeriphDataAlignment;
+  uint32_t MemDataAlignment;
+  uint32_t Mode;
+  uint32_t Priority;
+} DMA_InitTypeDef;
+
+typedef enum
+{
+  HAL_DMA_STATE_RESET   = 0x00U,
+  HAL_DMA_STATE_READY   = 0x01U,
+  HAL_DMA_STATE_BUSY    = 0x02U,
+  HAL_DMA_STATE_TIMEOUT = 0x03U
+} HAL_DMA_StateTypeDef;
+
+typedef struct __DMA_HandleTypeDef
+{
+  DMA_Channel_TypeDef           *Instance;
+  DMA_InitTypeDef               Init;
+  HAL_LockTypeDef               Lock;
+  __IO HAL_DMA_StateTypeDef     State;
+  void                          *Parent;
+  void                          (* XferCpltCallback)(struct __DMA_HandleTypeDef * hdma);
+  void                          (* XferHalfCpltCallback)(struct __DMA_HandleTypeDef * hdma);
+  void                          (* XferErrorCallback)(struct __DMA_HandleTypeDef * hdma);
+  void                          (* XferAbortCallback)(struct __DMA_HandleTypeDef * hdma);
+  __IO uint32_t                 ErrorCode;
+} DMA_HandleTypeDef;
+
+#define DMA_REQUEST_0           0U
+#define DMA_REQUEST_1           1U
+#define DMA_REQUEST_3           3U
+#define DMA_REQUEST_8           8U
+
+#define DMA_PERIPH_TO_MEMORY    0x00000000U
+#define DMA_MEMORY_TO_PERIPH    DMA_CCR_DIR
+#define DMA_PINC_ENABLE         DMA_CCR_PINC
+#define DMA_PINC_DISABLE        0x00000000U
+#define DMA_MINC_ENABLE         DMA_CCR_MINC
+#define DMA_MINC_DISABLE        0x00000000U
+#define DMA_PDATAALIGN_BYTE     (0x0U << DMA_CCR_PSIZE_Pos)
+#define DMA_PDATAALIGN_HALFWORD (0x1U << DMA_CCR_PSIZE_Pos)
+#define DMA_PDATAALIGN_WORD     (0x2U << DMA_CCR_PSIZE_Pos)
+#define DMA_MDATAALIGN_BYTE     (0x0U << DMA_CCR_MSIZE_Pos)
+#define DMA_MDATAALIGN_HALFWORD (0x1U << DMA_CCR_MSIZE_Pos)
+#define DMA_MDATAALIGN_WORD     (0x2U << DMA_CCR_MSIZE_Pos)
+#define DMA_NORMAL              0x00000000U
+#define DMA_CIRCULAR            DMA_CCR_CIRC
+#define DMA_PRIORITY_LOW        (0x0U << DMA_CCR_PL_Pos)
+#define DMA_PRIORITY_MEDIUM     (0x1U << DMA_CCR_PL_Pos)
+#define DMA_PRIORITY_HIGH       (0x2U << DMA_CCR_PL_Pos)
+#define DMA_PRIORITY_VERY_HIGH  (0x3U << DMA_CCR_PL_Pos)
+
+#define __HAL_DMA_GET_COUNTER(__HANDLE__)       ((__HANDLE__)->Instance->CNDTR)
+#define __HAL_LINKDMA(__HANDLE__, __PPP_DMA_FIELD__, __DMA_HANDLE__) \
+  do{ \
+    (__HANDLE__)->__PPP_DMA_FIELD__ = &(__DMA_HANDLE__); \
+    (__DMA_HANDLE__).Parent = (__HANDLE__); \
+  }while(0U)
+
+/* ---------------------------------------------------------------- UART --- */
+typedef struct
+{
+  uint32_t BaudRate;
+  uint32_t WordLength;
+  uint32_t StopBits;
+  uint32_t Parity;
+  uint32_t Mode;
+  uint32_t HwFlowCtl;
+  uint32_t OverSampling;
+  uint32_t OneBitSampling;
+} UART_InitTypeDef;
+
+typedef struct
+{
+  uint32_t AdvFeatureInit;
+  uint32_t TxPinLevelInvert;
+  uint32_t RxPinLevelInvert;
+  uint32_t DataInvert;
+  uint32_t Swap;
+  uint32_t OverrunDisable;
+  uint32_t DMADisableonRxError;
+  uint32_t AutoBaudRateEnable;
+  uint32_t AutoBaudRateMode;
+  uint32_t MSBFirst;
+} UART_AdvFeatureInitTypeDef;
+
+typedef enum
+{
+  HAL_UART_STATE_RESET      = 0x00U,
+  HAL_UART_STATE_READY      = 0x20U,
+  HAL_UART_STATE_BUSY       = 0x24U,
+  HAL_UART_STATE_BUSY_TX    = 0x21U,
+  HAL_UART_STATE_BUSY_RX    = 0x22U,
+  HAL_UART_STATE_BUSY_TX_RX = 0x23U,
+  HAL_UART_STATE_TIMEOUT    = 0xA0U,
+  HAL_UART_STATE_ERROR      = 0xE0U
+} HAL_UART_StateTypeDef;
+
+typedef struct __UART_HandleTypeDef
+{
+  USART_TypeDef                 *Instance;
+  UART_InitTypeDef              Init;
+  UART_AdvFeatureInitTypeDef    AdvancedInit;
+  uint8_t                       *pTxBuffPtr;
+  uint16_t                      TxXferSize;
+  __IO uint16_t                 TxXferCount;
+  uint8_t                       *pRxBuffPtr;
+  uint16_t                      RxXferSize;
+  __IO uint16_t                 RxXferCount;
+  DMA_HandleTypeDef             *hdmatx;
+  DMA_HandleTypeDef             *hdmarx;
+  HAL_LockTypeDef               Lock;
+  __IO HAL_UART_StateTypeDef    gState;
+  __IO HAL_UART_StateTypeDef    RxState;
+  __IO uint32_t                 ErrorCode;
+} UART_HandleTypeDef;
+
+#define UART_WORDLENGTH_7B      0x10000000U
+#define UART_WORDLENGTH_8B      0x00000000U
+#define UART_WORDLENGTH_9B      0x00001000U
+#define UART_STOPBITS_1         0x00000000U
+#define UART_STOPBITS_2         0x00002000U
+#define UART_PARITY_NONE        0x00000000U
+#define UART_PARITY_EVEN        0x00000400U
+#define UART_PARITY_ODD         0x00000600U
+#define UART_MODE_RX            0x00000004U
+#define UART_MODE_TX            0x00000008U
+#define UART_MODE_TX_RX         0x0000000CU
+#define UART_HWCONTROL_NONE     0x00000000U
+#define UART_OVERSAMPLING_16    0x00000000U
+#define UART_OVERSAMPLING_8     0x00008000U
+#define UART_ONE_BIT_SAMPLE_DISABLE 0x00000000U
+#define UART_ONE_BIT_SAMPLE_ENABLE  0x00000800U
+
+#define UART_ADVFEATURE_NO_INIT                 0x00000000U
+#define UART_ADVFEATURE_SWAP_INIT               0x00000008U
+#define UART_ADVFEATURE_AUTOBAUDRATE_INIT       0x00000040U
+#define UART_ADVFEATURE_SWAP_ENABLE             0x00008000U
+#define UART_ADVFEATURE_AUTOBAUDRATE_ENABLE     0x00100000U
+#define UART_ADVFEATURE_AUTOBAUDRATE_ONSTARTBIT 0x00000000U
+
+#define HAL_UART_ERROR_NONE     0x00000000U
+#define HAL_UART_ERROR_NE       0x00000002U
+#define HAL_UART_ERROR_FE       0x00000004U
+#define HAL_UART_ERROR_ORE      0x00000008U
+
+// Only interrupts of CR1 are used, so the sources are the CR1 bits
+#define UART_IT_IDLE            USART_CR1_IDLEIE
+#define UART_IT_RXNE            USART_CR1_RXNEIE
+#define UART_IT_TC              USART_CR1_TCIE
+#define UART_FLAG_IDLE          USART_ISR_IDLE
+#define UART_FLAG_RXNE          USART_ISR_RXNE
+#define UART_FLAG_TC            USART_ISR_TC
+#define UART_FLAG_TXE           USART_ISR_TXE
+
+#define __HAL_UART_ENABLE_IT(__HANDLE__, __INTERRUPT__)         ((__HANDLE__)->Instance->CR1 |= (__INTERRUPT__))
+#define __HAL_UART_DISABLE_IT(__HANDLE__, __INTERRUPT__)        ((__HANDLE__)->Instance->CR1 &= ~(__INTERRUPT__))
+#define __HAL_UART_GET_IT_SOURCE(__HANDLE__, __INTERRUPT__)     ((((__HANDLE__)->Instance->CR1 & (__INTERRUPT__)) != 0U) ? SET : RESET)
+#define __HAL_UART_GET_FLAG(__HANDLE__, __FLAG__)               ((((__HANDLE__)->Instance->ISR & (__FLAG__)) == (__FLAG__)) ? SET : RESET)
+#define __HAL_UART_CLEAR_FLAG(__HANDLE__, __FLAG__)             ((__HANDLE__)->Instance->ISR &= ~(__FLAG__))
+#define __HAL_UART_CLEAR_IDLEFLAG(__HANDLE__)                   __HAL_UART_CLEAR_FLAG((__HANDLE__), USART_ISR_IDLE)
+
+/* ----------------------------------------------------------------- SPI --- */
+typedef struct
+{
+  uint32_t Mode;
+  uint32_t Direction;
+  uint32_t DataSize;
+  uint32_t CLKPolarity;
+  uint32_t CLKPhase;
+  uint32_t NSS;
+  uint32_t BaudRatePrescaler;
+  uint32_t FirstBit;
+  uint32_t TIMode;
+  uint32_t CRCCalculation;
+  uint32_t CRCPolynomial;
+} SPI_InitTypeDef;
+
+typedef enum
+{
+  HAL_SPI_STATE_RESET   = 0x00U,
+  HAL_SPI_STATE_READY   = 0x01U,
+  HAL_SPI_STATE_BUSY    = 0x02U
+} HAL_SPI_StateTypeDef;
+
+typedef struct __SPI_HandleTypeDef
+{
+  SPI_TypeDef                   *Instance;
+  SPI_InitTypeDef               Init;
+  HAL_LockTypeDef               Lock;
+  __IO HAL_SPI_StateTypeDef     State;
+  __IO uint32_t                 ErrorCode;
+} SPI_HandleTypeDef;
+
+#define SPI_MODE_SLAVE          0x00000000U
+#define SPI_MODE_MASTER         0x00000104U
+#define SPI_DIRECTION_2LINES    0x00000000U
+#define SPI_DATASIZE_8BIT       0x00000000U
+#define SPI_POLARITY_LOW        0x00000000U
+#define SPI_POLARITY_HIGH       0x00000002U
+#define SPI_PHASE_1EDGE         0x00000000U
+#define SPI_PHASE_2EDGE         0x00000001U
+#define SPI_NSS_SOFT            0x00000200U
+#define SPI_BAUDRATEPRESCALER_2   0x00000000U
+#define SPI_BAUDRATEPRESCALER_4   0x00000008U
+#define SPI_BAUDRATEPRESCALER_8   0x00000010U
+#define SPI_BAUDRATEPRESCALER_16  0x00000018U
+#define SPI_BAUDRATEPRESCALER_32  0x00000020U
+#define SPI_BAUDRATEPRESCALER_64  0x00000028U
+#define SPI_BAUDRATEPRESCALER_128 0x00000030U
+#define SPI_BAUDRATEPRESCALER_256 0x00000038U
+#define SPI_FIRSTBIT_MSB        0x00000000U
+#define SPI_TIMODE_DISABLE      0x00000000U
+#define SPI_CRCCALCULATION_DISABLE 0x00000000U
+
+/* ----------------------------------------------------------------- TIM --- */
+typedef struct
+{
+  uint32_t Prescaler;
+  uint32_t CounterMode;
+  uint32_t Period;
+  uint32_t ClockDivision;
+  uint32_t RepetitionCounter;
+  uint32_t AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef enum
+{
+  HAL_TIM_STATE_RESET   = 0x00U,
+  HAL_TIM_STATE_READY   = 0x01U,
+  HAL_TIM_STATE_BUSY    = 0x02U
+} HAL_TIM_StateTypeDef;
+
+typedef struct
+{
+  TIM_TypeDef                   *Instance;
+  TIM_Base_InitTypeDef          Init;
+  HAL_LockTypeDef               Lock;
+  __IO HAL_TIM_StateTypeDef     State;
+} TIM_HandleTypeDef;
+
+#define TIM_COUNTERMODE_UP      0x00000000U
+#define TIM_CLOCKDIVISION_DIV1  0x00000000U
+#define TIM_IT_UPDATE           TIM_DIER_UIE
+#define TIM_DMA_UPDATE          TIM_DIER_UDE
+#define TIM_FLAG_UPDATE         TIM_SR_UIF
+
+#define __HAL_TIM_ENABLE(__HANDLE__)                    ((__HANDLE__)->Instance->CR1 |= TIM_CR1_CEN)
+#define __HAL_TIM_DISABLE(__HANDLE__)                   ((__HANDLE__)->Instance->CR1 &= ~TIM_CR1_CEN)
+#define __HAL_TIM_ENABLE_IT(__HANDLE__, __INTERRUPT__)  ((__HANDLE__)->Instance->DIER |= (__INTERRUPT__))
+#define __HAL_TIM_DISABLE_IT(__HANDLE__, __INTERRUPT__) ((__HANDLE__)->Instance->DIER &= ~(__INTERRUPT__))
+#define __HAL_TIM_ENABLE_DMA(__HANDLE__, __DMA__)       ((__HANDLE__)->Instance->DIER |= (__DMA__))
+#define __HAL_TIM_DISABLE_DMA(__HANDLE__, __DMA__)      ((__HANDLE__)->Instance->DIER &= ~(__DMA__))
+#define __HAL_TIM_GET_FLAG(__HANDLE__, __FLAG__)        (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+#define __HAL_TIM_CLEAR_IT(__HANDLE__, __INTERRUPT__)   ((__HANDLE__)->Instance->SR = ~(__INTERRUPT__))
+#define __HAL_TIM_GET_IT_SOURCE(__HANDLE__, __INTERRUPT__) ((((__HANDLE__)->Instance->DIER & (__INTERRUPT__)) == (__INTERRUPT__)) ? SET : RESET)
+#define __HAL_TIM_SET_COUNTER(__HANDLE__, __COUNTER__)  ((__HANDLE__)->Instance->CNT = (__COUNTER__))
+
+/* ----------------------------------------------------------------- ADC --- */
+typedef struct
+{
+  uint32_t Ratio;
+  uint32_t RightBitShift;
+  uint32_t TriggeredMode;
+} ADC_OversamplingTypeDef;
+
+typedef struct
+{
+  uint32_t ClockPrescaler;
+  uint32_t Resolution;
+  uint32_t DataAlign;
+  uint32_t ScanConvMode;
+  uint32_t EOCSelection;
+  uint32_t LowPowerAutoWait;
+  uint32_t LowPowerAutoPowerOff;
+  uint32_t ContinuousConvMode;
+  uint32_t DiscontinuousConvMode;
+  uint32_t ExternalTrigConv;
+  uint32_t ExternalTrigConvEdge;
+  uint32_t DMAContinuousRequests;
+  uint32_t Overrun;
+  uint32_t LowPowerFrequencyMode;
+  uint32_t SamplingTime;
+  uint32_t OversamplingMode;
+  ADC_OversamplingTypeDef Oversample;
+} ADC_InitTypeDef;
+
+typedef struct
+{
+  uint32_t Channel;
+  uint32_t Rank;
+} ADC_ChannelConfTypeDef;
+
+typedef struct
+{
+  ADC_TypeDef                   *Instance;
+  ADC_InitTypeDef               Init;
+  DMA_HandleTypeDef             *DMA_Handle;
+  HAL_LockTypeDef               Lock;
+  __IO uint32_t                 State;
+  __IO uint32_t                 ErrorCode;
+} ADC_HandleTypeDef;
+
+// Channel = CHSELR bit | channel number in the upper bits, like the real HAL
+#define ADC_CHANNEL_NUMBER_Pos  26U
+#define ADC_CHANNEL_0           (ADC_CHSELR_CHSEL0)
+#define ADC_CHANNEL_1           (ADC_CHSELR_CHSEL1 | (1U << ADC_CHANNEL_NUMBER_Pos))
+#define ADC_CHANNEL_VREFINT     (ADC_CHSELR_CHSEL17 | (17U << ADC_CHANNEL_NUMBER_Pos))
+#define ADC_CHANNEL_TEMPSENSOR  (ADC_CHSELR_CHSEL18 | (18U << ADC_CHANNEL_NUMBER_Pos))
+#define ADC_CHANNEL_MASK        0x0007FFFFU
+#define ADC_CHANNEL_AWD_MASK    0x7C000000U
+#define ADC_RANK_CHANNEL_NUMBER 0x00001000U
+#define ADC_RANK_NONE           0x00001001U
+
+#define ADC_CLOCK_SYNC_PCLK_DIV1 0xC0000000U
+#define ADC_CLOCK_SYNC_PCLK_DIV2 0x40000000U
+#define ADC_RESOLUTION_12B      0x00000000U
+#define ADC_DATAALIGN_RIGHT     0x00000000U
+#define ADC_SCAN_DIRECTION_FORWARD 0x00000001U
+#define ADC_EOC_SINGLE_CONV     0x00000004U
+#define ADC_EXTERNALTRIGCONVEDGE_NONE 0x00000000U
+#define ADC_SOFTWARE_START      0x00000010U
+#define ADC_OVR_DATA_PRESERVED  0x00000000U
+#define ADC_OVR_DATA_OVERWRITTEN 0x00001000U
+#define ADC_SAMPLETIME_1CYCLE_5   0x00000000U
+#define ADC_SAMPLETIME_160CYCLES_5 0x00000007U
+#define ADC_SINGLE_ENDED        0x00000000U
+#define ADC_OVERSAMPLING_RATIO_2   (0x0U << ADC_CFGR2_OVSR_Pos)
+#define ADC_OVERSAMPLING_RATIO_4   (0x1U << ADC_CFGR2_OVSR_Pos)
+#define ADC_OVERSAMPLING_RATIO_8   (0x2U << ADC_CFGR2_OVSR_Pos)
+#define ADC_OVERSAMPLING_RATIO_16  (0x3U << ADC_CFGR2_OVSR_Pos)
+#define ADC_OVERSAMPLING_RATIO_32  (0x4U << ADC_CFGR2_OVSR_Pos)
+#define ADC_OVERSAMPLING_RATIO_64  (0x5U << ADC_CFGR2_OVSR_Pos)
+#define ADC_OVERSAMPLING_RATIO_128 (0x6U << ADC_CFGR2_OVSR_Pos)
+#define ADC_OVERSAMPLING_RATIO_256 (0x7U << ADC_CFGR2_OVSR_Pos)
+#define ADC_RIGHTBITSHIFT_NONE  (0x0U << ADC_CFGR2_OVSS_Pos)
+#define ADC_RIGHTBITSHIFT_1     (0x1U << ADC_CFGR2_OVSS_Pos)
+#define ADC_RIGHTBITSHIFT_2     (0x2U << ADC_CFGR2_OVSS_Pos)
+#define ADC_RIGHTBITSHIFT_3     (0x3U << ADC_CFGR2_OVSS_Pos)
+#define ADC_RIGHTBITSHIFT_4     (0x4U << ADC_CFGR2_OVSS_Pos)
+#define ADC_RIGHTBITSHIFT_5     (0x5U << ADC_CFGR2_OVSS_Pos)
+#define ADC_RIGHTBITSHIFT_6     (0x6U << ADC_CFGR2_OVSS_Pos)
+#define ADC_RIGHTBITSHIFT_7     (0x7U << ADC_CFGR2_OVSS_Pos)
+#define ADC_RIGHTBITSHIFT_8     (0x8U << ADC_CFGR2_OVSS_Pos)
+#define ADC_TRIGGEREDMODE_SINGLE_TRIGGER 0x00000000U
+#define ADC_TRIGGEREDMODE_MULTI_TRIGGER  ADC_CFGR2_TOVS
+
+/* ----------------------------------------------------------------- CRC --- */
+typedef struct
+{
+  uint8_t  DefaultPolynomialUse;
+  uint8_t  DefaultInitValueUse;
+  uint32_t GeneratingPolynomial;
+  uint32_t CRCLength;
+  uint32_t InitValue;
+  uint32_t InputDataInversionMode;
+  uint32_t OutputDataInversionMode;
+} CRC_InitTypeDef;
+
+typedef enum
+{
+  HAL_CRC_STATE_RESET   = 0x00U,
+  HAL_CRC_STATE_READY   = 0x01U,
+  HAL_CRC_STATE_BUSY    = 0x02U
+} HAL_CRC_StateTypeDef;
+
+typedef struct
+{
+  CRC_TypeDef                   *Instance;
+  CRC_InitTypeDef               Init;
+  HAL_LockTypeDef               Lock;
+  __IO HAL_CRC_StateTypeDef     State;
+  uint32_t                      InputDataFormat;
+} CRC_HandleTypeDef;
+
+#define DEFAULT_POLYNOMIAL_ENABLE       ((uint8_t)0x00U)
+#define DEFAULT_POLYNOMIAL_DISABLE      ((uint8_t)0x01U)
+#define DEFAULT_INIT_VALUE_ENABLE       ((uint8_t)0x00U)
+#define DEFAULT_INIT_VALUE_DISABLE      ((uint8_t)0x01U)
+#define DEFAULT_CRC32_POLY              0x04C11DB7U
+#define DEFAULT_CRC_INITVALUE           0xFFFFFFFFU
+#define CRC_POLYLENGTH_32B              0x00000000U
+#define CRC_POLYLENGTH_16B              0x00000008U
+#define CRC_POLYLENGTH_8B               0x00000010U
+#define CRC_POLYLENGTH_7B               0x00000018U
+#define CRC_INPUTDATA_INVERSION_NONE    0x00000000U
+#define CRC_INPUTDATA_INVERSION_BYTE    0x00000020U
+#define CRC_INPUTDATA_INVERSION_HALFWORD 0x00000040U
+#define CRC_INPUTDATA_INVERSION_WORD    0x00000060U
+#define CRC_OUTPUTDATA_INVERSION_DISABLE 0x00000000U
+#define CRC_OUTPUTDATA_INVERSION_ENABLE CRC_CR_REV_OUT
+#define CRC_INPUTDATA_FORMAT_BYTES      0x00000001U
+#define CRC_INPUTDATA_FORMAT_HALFWORDS  0x00000002U
+#define CRC_INPUTDATA_FORMAT_WORDS      0x00000003U
+
+/* ----------------------------------------------------------------- RTC --- */
+typedef struct
+{
+  uint32_t HourFormat;
+  uint32_t AsynchPrediv;
+  uint32_t SynchPrediv;
+  uint32_t OutPut;
+  uint32_t OutPutRemap;
+  uint32_t OutPutPolarity;
+  uint32_t OutPutType;
+} RTC_InitTypeDef;
+
+typedef enum
+{
+  HAL_RTC_STATE_RESET   = 0x00U,
+  HAL_RTC_STATE_READY   = 0x01U,
+  HAL_RTC_STATE_BUSY    = 0x02U
+} HAL_RTCStateTypeDef;
+
+typedef struct
+{
+  RTC_TypeDef                   *Instance;
+  RTC_InitTypeDef               Init;
+  HAL_LockTypeDef               Lock;
+  __IO HAL_RTCStateTypeDef      State;
+} RTC_HandleTypeDef;
+
+#define RTC_HOURFORMAT_24               0x00000000U
+#define RTC_OUTPUT_DISABLE              0x00000000U
+#define RTC_OUTPUT_REMAP_NONE           0x00000000U
+#define RTC_OUTPUT_POLARITY_HIGH        0x00000000U
+#define RTC_OUTPUT_TYPE_OPENDRAIN       0x00000000U
+#define RTC_WAKEUPCLOCK_RTCCLK_DIV16    0x00000000U
+#define RTC_WAKEUPCLOCK_RTCCLK_DIV8     0x00000001U
+#define RTC_WAKEUPCLOCK_RTCCLK_DIV4     0x00000002U
+#define RTC_WAKEUPCLOCK_RTCCLK_DIV2     0x00000003U
+#define RTC_WAKEUPCLOCK_CK_SPRE_16BITS  0x00000004U
+#define RTC_BKP_DR0                     0x00000000U
+
+/* --------------------------------------------------------------- LPTIM --- */
+typedef struct
+{
+  uint32_t Source;
+  uint32_t Prescaler;
+} LPTIM_ClockConfigTypeDef;
+
+typedef struct
+{
+  uint32_t Source;
+  uint32_t ActiveEdge;
+  uint32_t SampleTime;
+} LPTIM_TriggerConfigTypeDef;
+
+typedef struct
+{
+  LPTIM_ClockConfigTypeDef      Clock;
+  LPTIM_TriggerConfigTypeDef    Trigger;
+  uint32_t                      OutputPolarity;
+  uint32_t                      UpdateMode;
+  uint32_t                      CounterSource;
+} LPTIM_InitTypeDef;
+
+typedef enum
+{
+  HAL_LPTIM_STATE_RESET = 0x00U,
+  HAL_LPTIM_STATE_READY = 0x01U,
+  HAL_LPTIM_STATE_BUSY  = 0x02U
+} HAL_LPTIM_StateTypeDef;
+
+typedef struct
+{
+  LPTIM_TypeDef                 *Instance;
+  LPTIM_InitTypeDef             Init;
+  HAL_LockTypeDef               Lock;
+  __IO HAL_LPTIM_StateTypeDef   State;
+} LPTIM_HandleTypeDef;
+
+#define LPTIM_CLOCKSOURCE_APBCLOCK_LPOSC        0x00000000U
+#define LPTIM_PRESCALER_DIV1                    0x00000000U
+#define LPTIM_PRESCALER_DIV2                    0x00000200U
+#define LPTIM_PRESCALER_DIV4                    0x00000400U
+#define LPTIM_PRESCALER_DIV8                    0x00000600U
+#define LPTIM_PRESCALER_DIV16                   0x00000800U
+#define LPTIM_PRESCALER_DIV32                   0x00000A00U
+#define LPTIM_PRESCALER_DIV64                   0x00000C00U
+#define LPTIM_PRESCALER_DIV128                  0x00000E00U
+#define LPTIM_TRIGSOURCE_SOFTWARE               0x0000FFFFU
+#define LPTIM_OUTPUTPOLARITY_HIGH               0x00000000U
+#define LPTIM_UPDATE_IMMEDIATE                  0x00000000U
+#define LPTIM_COUNTERSOURCE_INTERNAL            0x00000000U
+#define LPTIM_FLAG_CMPM                         LPTIM_ISR_CMPM
+#define LPTIM_IT_CMPM                           LPTIM_IER_CMPMIE
+
+/* ---------------------------------------------------------------- IWDG --- */
+typedef struct
+{
+  uint32_t Prescaler;
+  uint32_t Reload;
+  uint32_t Window;
+} IWDG_InitTypeDef;
+
+typedef struct
+{
+  IWDG_TypeDef                  *Instance;
+  IWDG_InitTypeDef              Init;
+} IWDG_HandleTypeDef;
+
+// The prescalers are the dividers themselves
+#define IWDG_PRESCALER_4        4U
+#define IWDG_PRESCALER_8        8U
+#define IWDG_PRESCALER_16       16U
+#define IWDG_PRESCALER_32       32U
+#define IWDG_PRESCALER_64       64U
+#define IWDG_PRESCALER_128      128U
+#define IWDG_PRESCALER_256      256U
+
+/* ----------------------------------------------------------------- RCC --- */
+typedef struct
+{
+  uint32_t PLLState;
+  uint32_t PLLSource;
+  uint32_t PLLMUL;
+  uint32_t PLLDIV;
+} RCC_PLLInitTypeDef;
+
+typedef struct
+{
+  uint32_t OscillatorType;
+  uint32_t HSEState;
+  uint32_t LSEState;
+  uint32_t HSIState;
+  uint32_t HSICalibrationValue;
+  uint32_t LSIState;
+  uint32_t MSIState;
+  uint32_t MSICalibrationValue;
+  uint32_t MSIClockRange;
+  RCC_PLLInitTypeDef PLL;
+} RCC_OscInitTypeDef;
+
+typedef struct
+{
+  uint32_t ClockType;
+  uint32_t SYSCLKSource;
+  uint32_t AHBCLKDivider;
+  uint32_t APB1CLKDivider;
+  uint32_t APB2CLKDivider;
+} RCC_ClkInitTypeDef;
+
+typedef struct
+{
+  uint32_t PeriphClockSelection;
+  uint32_t Usart1ClockSelection;
+  uint32_t Usart2ClockSelection;
+  uint32_t Lpuart1ClockSelection;
+  uint32_t I2c1ClockSelection;
+  uint32_t RTCClockSelection;
+  uint32_t LptimClockSelection;
+} RCC_PeriphCLKInitTypeDef;
+
+#define RCC_OSCILLATORTYPE_NONE 0x00000000U
+#define RCC_OSCILLATORTYPE_HSE  0x00000001U
+#define RCC_OSCILLATORTYPE_HSI  0x00000002U
+#define RCC_OSCILLATORTYPE_LSE  0x00000004U
+#define RCC_OSCILLATORTYPE_LSI  0x00000008U
+#define RCC_OSCILLATORTYPE_MSI  0x00000010U
+#define RCC_HSE_OFF             0x00000000U
+#define RCC_LSE_OFF             0x00000000U
+#define RCC_HSI_OFF             0x00000000U
+#define RCC_HSI_ON              0x00000001U
+#define RCC_HSI_DIV4            0x00000009U
+#define RCC_HSICALIBRATION_DEFAULT 0x10U
+#define RCC_LSI_OFF             0x00000000U
+#define RCC_LSI_ON              0x00000001U
+#define RCC_MSI_OFF             0x00000000U
+#define RCC_MSI_ON              0x00000001U
+// The MSI ranges are numbered like the real ones, range 0 is 65.536 kHz
+#define RCC_MSIRANGE_0          0U
+#define RCC_MSIRANGE_1          1U
+#define RCC_MSIRANGE_2          2U
+#define RCC_MSIRANGE_3          3U
+#define RCC_MSIRANGE_4          4U
+#define RCC_MSIRANGE_5          5U
+#define RCC_MSIRANGE_6          6U
+#define RCC_PLL_NONE            0x00000000U
+#define RCC_PLL_OFF             0x00000001U
+#define RCC_PLL_ON              0x00000002U
+#define RCC_PLLSOURCE_HSI       0x00000000U
+#define RCC_PLLSOURCE_HSE       0x00000001U
+// The multipliers and dividers are the factors themselves
+#define RCC_PLLMUL_3            3U
+#define RCC_PLLMUL_4            4U
+#define RCC_PLLMUL_6            6U
+#define RCC_PLLMUL_8            8U
+#define RCC_PLLDIV_2            2U
+#define RCC_PLLDIV_3            3U
+#define RCC_PLLDIV_4            4U
+
+#define RCC_CLOCKTYPE_SYSCLK    0x00000001U
+#define RCC_CLOCKTYPE_HCLK      0x00000002U
+#define RCC_CLOCKTYPE_PCLK1     0x00000004U
+#define RCC_CLOCKTYPE_PCLK2     0x00000008U
+#define RCC_SYSCLKSOURCE_MSI    0x00000000U
+#define RCC_SYSCLKSOURCE_HSI    0x00000001U
+#define RCC_SYSCLKSOURCE_HSE    0x00000002U
+#define RCC_SYSCLKSOURCE_PLLCLK 0x00000003U
+#define RCC_SYSCLK_DIV1         1U
+#define RCC_SYSCLK_DIV2         2U
+#define RCC_SYSCLK_DIV4         4U
+#define RCC_SYSCLK_DIV8         8U
+#define RCC_SYSCLK_DIV16        16U
+#define RCC_SYSCLK_DIV64        64U
+#define RCC_SYSCLK_DIV128       128U
+#define RCC_SYSCLK_DIV256       256U
+#define RCC_SYSCLK_DIV512       512U
+#define RCC_HCLK_DIV1           1U
+#define RCC_HCLK_DIV2           2U
+#define RCC_HCLK_DIV4           4U
+#define RCC_HCLK_DIV8           8U
+#define RCC_HCLK_DIV16          16U
+#define FLASH_LATENCY_0         0U
+#define FLASH_LATENCY_1         1U
+
+#define RCC_PERIPHCLK_USART1    0x00000001U
+#define RCC_PERIPHCLK_USART2    0x00000002U
+#define RCC_PERIPHCLK_RTC       0x00000020U
+#define RCC_PERIPHCLK_LPTIM1    0x00000080U
+#define RCC_USART1CLKSOURCE_PCLK2  0x00000000U
+#define RCC_USART1CLKSOURCE_SYSCLK 0x00000001U
+#define RCC_USART2CLKSOURCE_PCLK1  0x00000000U
+#define RCC_USART2CLKSOURCE_SYSCLK 0x00000004U
+#define RCC_RTCCLKSOURCE_LSI    0x00020000U
+#define RCC_LPTIM1CLKSOURCE_LSI 0x00040000U
+#define RCC_STOP_WAKEUPCLOCK_MSI 0x00000000U
+#define RCC_STOP_WAKEUPCLOCK_HSI 0x00008000U
+
+#define RCC_FLAG_PINRST         (0x1U << 26)
+#define RCC_FLAG_PORRST         (0x1U << 27)
+#define RCC_FLAG_SFTRST         (0x1U << 28)
+#define RCC_FLAG_IWDGRST        RCC_CSR_IWDGRSTF
+
+#define __HAL_RCC_GET_FLAG(__FLAG__)            (((RCC->CSR & (__FLAG__)) != 0U) ? 1U : 0U)
+#define __HAL_RCC_CLEAR_RESET_FLAGS()           (RCC->CSR |= RCC_CSR_RMVF)
+#define __HAL_RCC_WAKEUPSTOP_CLK_CONFIG(__X__)  do{ (void)(__X__); }while(0U)
+#define __HAL_RCC_HSI_DISABLE()                 do{}while(0U)
+
+// Clock gating has no effect on the simulated peripherals
+#define HAL_SIM_RCC_NO_EFFECT()                 do{}while(0U)
+#define __HAL_RCC_ADC1_CLK_ENABLE()             HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_ADC1_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_CRC_CLK_ENABLE()              HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_CRC_CLK_DISABLE()             HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_CRC_CLK_SLEEP_DISABLE()       HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_DBGMCU_CLK_DISABLE()          HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_DBGMCU_CLK_SLEEP_DISABLE()    HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_DMA1_CLK_ENABLE()             HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_DMA1_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_DMA1_CLK_SLEEP_DISABLE()      HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_FIREWALL_CLK_DISABLE()        HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOA_CLK_ENABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOA_CLK_DISABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOA_CLK_SLEEP_DISABLE()     HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOB_CLK_ENABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOB_CLK_DISABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOB_CLK_SLEEP_DISABLE()     HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOC_CLK_ENABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOC_CLK_DISABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOC_CLK_SLEEP_DISABLE()     HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOD_CLK_ENABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOD_CLK_DISABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOD_CLK_SLEEP_DISABLE()     HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOH_CLK_ENABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOH_CLK_DISABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_GPIOH_CLK_SLEEP_DISABLE()     HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_I2C1_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_I2C2_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_LPTIM1_CLK_ENABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_LPTIM1_CLK_DISABLE()          HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_LPUART1_CLK_DISABLE()         HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_MIF_CLK_DISABLE()             HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_MIF_CLK_SLEEP_DISABLE()       HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_PWR_CLK_ENABLE()              HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_PWR_CLK_SLEEP_DISABLE()       HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_RTC_ENABLE()                  HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_RTC_DISABLE()                 HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_SPI1_CLK_ENABLE()             HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_SPI1_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_SPI2_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_SRAM_CLK_SLEEP_DISABLE()      HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_SYSCFG_CLK_ENABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_SYSCFG_CLK_DISABLE()          HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_SYSCFG_CLK_SLEEP_DISABLE()    HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_TIM2_CLK_ENABLE()             HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_TIM2_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_TIM6_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_USART1_CLK_ENABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_USART1_CLK_DISABLE()          HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_USART2_CLK_ENABLE()           HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_USART2_CLK_DISABLE()          HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_WWDG_CLK_DISABLE()            HAL_SIM_RCC_NO_EFFECT()
+#define __HAL_RCC_WWDG_CLK_SLEEP_DISABLE()      HAL_SIM_RCC_NO_EFFECT()
+
+/* ----------------------------------------------------------------- PWR --- */
+#define PWR_MAINREGULATOR_ON            0x00000000U
+#define PWR_LOWPOWERREGULATOR_ON        0x00000001U
+#define PWR_SLEEPENTRY_WFI              0x01U
+#define PWR_SLEEPENTRY_WFE              0x02U
+#define PWR_STOPENTRY_WFI               0x01U
+#define PWR_STOPENTRY_WFE               0x02U
+#define PWR_REGULATOR_VOLTAGE_SCALE1    0x00000800U
+#define PWR_REGULATOR_VOLTAGE_SCALE2    0x00001000U
+#define PWR_REGULATOR_VOLTAGE_SCALE3    0x00001800U
+#define PWR_FLAG_WU                     PWR_CSR_WUF
+
+#define __HAL_PWR_CLEAR_FLAG(__FLAG__)                  (PWR->CSR &= ~(__FLAG__))
+#define __HAL_PWR_VOLTAGESCALING_CONFIG(__REGULATOR__)  (PWR->CR = (__REGULATOR__))
+
+/* --------------------------------------------------------------- FLASH --- */
+#define FLASH_TYPEPROGRAMDATA_BYTE      0x00000000U
+#define FLASH_TYPEPROGRAMDATA_HALFWORD  0x00000001U
+#define FLASH_TYPEPROGRAMDATA_WORD      0x00000002U
+
+/* Variables */
+
+/* Function definitions */
+
+/* Generic */
+HAL_StatusTypeDef               HAL_Init(void);
+void                            HAL_IncTick(void);
+uint32_t                        HAL_GetTick(void);
+void                            HAL_Delay(uint32_t Delay);
+void                            HAL_SuspendTick(void);
+void                            HAL_ResumeTick(void);
+void                            HAL_MspInit(void);
+
+/* NVIC */
+void                            HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void                            HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void                            HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+/* GPIO */
+void                            HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void                            HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+GPIO_PinState                   HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void                            HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void                            HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void                            HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin);
+void                            HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+/* DMA */
+HAL_StatusTypeDef               HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef               HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef               HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+HAL_StatusTypeDef               HAL_DMA_Abort(DMA_HandleTypeDef *hdma);
+void                            HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+
+/* UART */
+HAL_StatusTypeDef               HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef               HAL_UART_DeInit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef               HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef               HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef               HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef               HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef               HAL_UART_Abort(UART_HandleTypeDef *huart);
+void                            HAL_UART_IRQHandler(UART_HandleTypeDef *huart);
+void                            HAL_UART_MspInit(UART_HandleTypeDef *huart);
+void                            HAL_UART_MspDeInit(UART_HandleTypeDef *huart);
+void                            HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void                            HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+void                            HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart);
+void                            HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+
+/* SPI */
+HAL_StatusTypeDef               HAL_SPI_Init(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef               HAL_SPI_DeInit(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef               HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef               HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint32_t Timeout);
+void                            HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi);
+void                            HAL_SPI_MspInit(SPI_HandleTypeDef *hspi);
+void                            HAL_SPI_MspDeInit(SPI_HandleTypeDef *hspi);
+
+/* TIM */
+HAL_StatusTypeDef               HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef               HAL_TIM_Base_DeInit(TIM_HandleTypeDef *htim);
+void                            HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim);
+void                            HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef *htim);
+
+/* ADC */
+HAL_StatusTypeDef               HAL_ADC_Init(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef               HAL_ADC_DeInit(ADC_HandleTypeDef *hadc);
+void                            HAL_ADC_MspInit(ADC_HandleTypeDef *hadc);
+void                            HAL_ADC_MspDeInit(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef               HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *sConfig);
+HAL_StatusTypeDef               HAL_ADC_Start(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef               HAL_ADC_Stop(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef               HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout);
+HAL_StatusTypeDef               HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length);
+HAL_StatusTypeDef               HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc);
+void                            HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc);
+uint32_t                        HAL_ADC_GetValue(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef               HAL_ADCEx_Calibration_Start(ADC_HandleTypeDef *hadc, uint32_t SingleDiff);
+uint32_t                        HAL_ADCEx_Calibration_GetValue(ADC_HandleTypeDef *hadc, uint32_t SingleDiff);
+HAL_StatusTypeDef               HAL_ADCEx_Calibration_SetValue(ADC_HandleTypeDef *hadc, uint32_t SingleDiff, uint32_t CalibrationFactor);
+
+/* CRC */
+HAL_StatusTypeDef               HAL_CRC_Init(CRC_HandleTypeDef *hcrc);
+HAL_StatusTypeDef               HAL_CRC_DeInit(CRC_HandleTypeDef *hcrc);
+void                            HAL_CRC_MspInit(CRC_HandleTypeDef *hcrc);
+void                            HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc);
+uint32_t                        HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+uint32_t                        HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+
+/* RTC */
+HAL_StatusTypeDef               HAL_RTC_Init(RTC_HandleTypeDef *hrtc);
+void                            HAL_RTC_MspInit(RTC_HandleTypeDef *hrtc);
+void                            HAL_RTC_MspDeInit(RTC_HandleTypeDef *hrtc);
+HAL_StatusTypeDef               HAL_RTCEx_SetWakeUpTimer_IT(RTC_HandleTypeDef *hrtc, uint32_t WakeUpCounter, uint32_t WakeUpClock);
+uint32_t                        HAL_RTCEx_DeactivateWakeUpTimer(RTC_HandleTypeDef *hrtc);
+void                            HAL_RTCEx_WakeUpTimerIRQHandler(RTC_HandleTypeDef *hrtc);
+void                            HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc);
+void                            HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister, uint32_t Data);
+uint32_t                        HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister);
+
+/* LPTIM */
+HAL_StatusTypeDef               HAL_LPTIM_Init(LPTIM_HandleTypeDef *hlptim);
+HAL_StatusTypeDef               HAL_LPTIM_DeInit(LPTIM_HandleTypeDef *hlptim);
+void                            HAL_LPTIM_MspInit(LPTIM_HandleTypeDef *hlptim);
+void                            HAL_LPTIM_MspDeInit(LPTIM_HandleTypeDef *hlptim);
+HAL_StatusTypeDef               HAL_LPTIM_TimeOut_Start_IT(LPTIM_HandleTypeDef *hlptim, uint32_t Period, uint32_t Timeout);
+HAL_StatusTypeDef               HAL_LPTIM_TimeOut_Stop_IT(LPTIM_HandleTypeDef *hlptim);
+uint32_t                        HAL_LPTIM_ReadCounter(LPTIM_HandleTypeDef *hlptim);
+void                            HAL_LPTIM_IRQHandler(LPTIM_HandleTypeDef *hlptim);
+void                            HAL_LPTIM_CompareMatchCallback(LPTIM_HandleTypeDef *hlptim);
+
+/* IWDG */
+HAL_StatusTypeDef               HAL_IWDG_Init(IWDG_HandleTypeDef *hiwdg);
+HAL_StatusTypeDef               HAL_IWDG_Refresh(IWDG_HandleTypeDef *hiwdg);
+
+/* RCC */
+HAL_StatusTypeDef               HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
+HAL_StatusTypeDef               HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency);
+void                            HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t *pFLatency);
+HAL_StatusTypeDef               HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit);
+uint32_t                        HAL_RCC_GetSysClockFreq(void);
+uint32_t                        HAL_RCC_GetHCLKFreq(void);
+uint32_t                        HAL_RCC_GetPCLK1Freq(void);
+uint32_t                        HAL_RCC_GetPCLK2Freq(void);
+
+/* PWR */
+void                            HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry);
+void                            HAL_PWR_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry);
+void                            HAL_PWREx_EnableUltraLowPower(void);
+void                            HAL_PWREx_DisableUltraLowPower(void);
+void                            HAL_PWREx_EnableFastWakeUp(void);
+void                            HAL_PWREx_DisableFastWakeUp(void);
+
+/* FLASH */
+HAL_StatusTypeDef               HAL_FLASHEx_DATAEEPROM_Unlock(void);
+HAL_StatusTypeDef               HAL_FLASHEx_DATAEEPROM_Lock(void);
+HAL_StatusTypeDef               HAL_FLASHEx_DATAEEPROM_Erase(uint32_t Address);
+HAL_StatusTypeDef               HAL_FLASHEx_DATAEEPROM_Program(uint32_t TypeProgram, uint32_t Address, uint32_t Data);
+
+#endif
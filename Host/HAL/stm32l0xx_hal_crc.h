@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file       stm32l0xx_hal_crc.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Host stand-in for the STM32L0xx HAL CRC driver
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __STM32L0XX_HAL_CRC_H
+#define __STM32L0XX_HAL_CRC_H
+
+/* Includes */
+// The CRC driver lives in the common stand-in header
+#include "stm32l0xx_hal.h"
+
+/* Typedefinitions */
+
+/* Variables */
+
+/* Function definitions */
+
+#endif
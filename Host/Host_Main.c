@@ -0,0 +1,148 @@
+/**
+  ******************************************************************************
+  * @file       Host_Main.c
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Entry point of the host build, replaces main.c
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | Transmission complete callback                |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include "main.h"
+#include "HAL_Sim.h"
+#include "S2LP_Sim.h"
+#include "App.h"
+#include "DebugMain.h"
+#include "UserMethods_UART.h"
+#include "Tx_Interpreter.h"
+
+/* Typedefinitions / Prototypes */
+
+// Virtual run time of the firmware build, the device runs forever
+#ifndef HOST_FIRMWARE_RUNTIME_MS
+  #define HOST_FIRMWARE_RUNTIME_MS      60000
+#endif
+
+/* Variables */
+
+// The handles main.c defines on the target
+ADC_HandleTypeDef hadc;
+CRC_HandleTypeDef hcrc;
+IWDG_HandleTypeDef hiwdg;
+RTC_HandleTypeDef hrtc;
+SPI_HandleTypeDef hspi1;
+UART_HandleTypeDef huart1;
+UART_HandleTypeDef huart2;
+
+/* Function definitions */
+
+void Error_Handler(void){
+  printf("HOST: ERROR HANDLER\r\n");
+  exit(EXIT_FAILURE);
+}
+
+// The callbacks of main.c, USER CODE 4
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart){
+  if (huart == &huart1){
+    userMethods_uartError(HAL_GetTick());
+  }
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart){
+  if (huart == &huart1){
+    userMethods_uartTransmissionCallback(HAL_GetTick());
+  }
+}
+
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart){
+  if (huart == &huart1){
+    userMethods_uartReceptionCallback(HAL_GetTick());
+  }
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart){
+  if (huart == &huart1){
+    userMethods_uartReceptionCallback(HAL_GetTick());
+  }
+  if (huart == &huart2){
+    txInterpreter_uartReceptionCallback();
+  }
+}
+
+#if HOST_RUN_TESTS >= 1
+
+static int host_runTests(void){
+  debugMain();
+  return 0;
+}
+
+#else
+
+static void host_endOfRuntime(void *context){
+  HAL_SIM_STATISTICS_STRUCT_TYPEDEF statistics;
+  
+  (void) context;
+  halSim_getStatistics(&statistics);
+  printf("HOST: END OF RUNTIME, RUN %llu MS, SLEEP %llu MS, STOP %llu MS\r\n",
+         (unsigned long long) (statistics.powerModeTimeNs[HAL_SIM_POWER_MODE_RUN] / 1000000ULL),
+         (unsigned long long) (statistics.powerModeTimeNs[HAL_SIM_POWER_MODE_SLEEP] / 1000000ULL),
+         (unsigned long long) (statistics.powerModeTimeNs[HAL_SIM_POWER_MODE_STOP] / 1000000ULL));
+  exit(EXIT_SUCCESS);
+}
+
+static int host_runFirmware(void){
+  halSim_scheduleCallback((uint64_t) HOST_FIRMWARE_RUNTIME_MS * 1000000ULL, host_endOfRuntime, NULL);
+  app_TXV2_boot();
+  while (1){
+    app_TXV2_main();
+  }
+  return 0;
+}
+
+#endif
+
+int main(void){
+  int retVal;
+  
+  // The target has no buffering on its trace output either
+  setvbuf(stdout, NULL, _IONBF, 0);
+  halSim_init();
+  s2lpSim_attach();
+#if HOST_RUN_TESTS >= 1
+  retVal = halSim_runOnFirmwareStack(host_runTests);
+#else
+  retVal = halSim_runOnFirmwareStack(host_runFirmware);
+#endif
+  return retVal;
+}
@@ -0,0 +1,2811 @@
+/**
+  ******************************************************************************
+  * @file       HAL_Sim.c
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Simulated STM32L051 peripherals behind the HAL stand-in
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | ADC oversampling, scan and DMA                |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 003       | 2026-10-18    | Tim Steinberg         | Interrupt driven UART transmission            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 004       | 2026-10-18    | Tim Steinberg         | PRIMASK read and write                        |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 005       | 2026-10-18    | Tim Steinberg         | EXTI edge detection and interrupt             |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Added HAL_SPI_Transmit                        |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Current model and power state timeline        |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 008       | 2026-10-18    | Tim Steinberg         | Added HAL_RCC_GetClockConfig                  |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 009       | 2026-10-18    | Tim Steinberg         | LPTIM1 on the LSI, HAL_IncTick advances tick  |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+/* Includes */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <malloc.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include "stm32l0xx_hal.h"
+#include "stm32l0xx_it.h"
+#include "HAL_Sim.h"
+
+/* Typedefinitions / Prototypes */
+
+#define HAL_SIM_NEVER                   UINT64_MAX
+#define HAL_SIM_NS_PER_MS               1000000ULL
+#define HAL_SIM_NS_PER_S                1000000000ULL
+
+// Every HAL_GetTick costs the time of a short polling loop, so a loop that
+// waits for the tick terminates
+#define HAL_SIM_TICK_READ_COST_NS       10000ULL
+
+// Typical values of the L051 datasheet
+#define HAL_SIM_LSI_DEFAULT_HZ          37000UL
+#define HAL_SIM_HSI_HZ                  16000000UL
+#define HAL_SIM_MSI_RANGE0_HZ           65536UL
+#define HAL_SIM_MSI_RESET_RANGE         RCC_MSIRANGE_5
+#define HAL_SIM_EEPROM_PROGRAM_NS       (3200ULL * 1000ULL)
+#define HAL_SIM_ADC_CONVERSION_NS       (20ULL * 1000ULL)
+#define HAL_SIM_VREFINT_CAL             1671U
+#define HAL_SIM_ADC_CALIBRATION         0x44U
+#define HAL_SIM_SYSTEM_MEMORY_BASE      0x1FF80000UL
+#define HAL_SIM_SYSTEM_MEMORY_SIZE      0x1000UL
+#define HAL_SIM_FIRMWARE_STACK_SIZE     (1024UL * 1024UL)
+// Supply current of the core at 3 V, dynamic part per MHz HCLK in range 1,
+// STOP with the LSI, RTC and IWDG running
+#define HAL_SIM_RUN_NA_PER_MHZ          140000UL
+#define HAL_SIM_SLEEP_NA_PER_MHZ        40000UL
+#define HAL_SIM_STOP_NA                 800UL
+
+// The spin watch runs every 10 ms of process CPU time, three quiet periods in
+// a row mean the core waits for an interrupt without calling the HAL
+#define HAL_SIM_SPIN_WATCH_PERIOD_US    10000
+#define HAL_SIM_SPIN_WATCH_QUIET_COUNT  3
+
+#define HAL_SIM_UART_COUNT              2
+#define HAL_SIM_UART_RX_QUEUE_SIZE      4096
+#define HAL_SIM_PIN_WATCHER_COUNT       16
+#define HAL_SIM_CALLBACK_COUNT          16
+#define HAL_SIM_GPIO_PORT_COUNT         5
+#define HAL_SIM_DMA_CHANNEL_COUNT       7
+#define HAL_SIM_ADC_CHANNEL_COUNT       19
+
+/** *@brief The sources of timed events */
+typedef enum HAL_SIM_EVENT_SOURCE_VALUES {
+  HAL_SIM_EVENT_SOURCE_NONE             = 0x00, /**< No event */
+  HAL_SIM_EVENT_SOURCE_UART_RX          = 0x01, /**< Next byte on a RX line */
+  HAL_SIM_EVENT_SOURCE_UART_IDLE        = 0x02, /**< RX line went idle */
+  HAL_SIM_EVENT_SOURCE_RTC_WAKEUP       = 0x03, /**< RTC wakeup timer */
+  HAL_SIM_EVENT_SOURCE_TIM2_UPDATE      = 0x04, /**< TIM2 update */
+  HAL_SIM_EVENT_SOURCE_IWDG             = 0x05, /**< IWDG expiry */
+  HAL_SIM_EVENT_SOURCE_CALLBACK         = 0x06, /**< Scheduled callback */
+  HAL_SIM_EVENT_SOURCE_UART_TX          = 0x07, /**< Byte left a TX line */
+  HAL_SIM_EVENT_SOURCE_LPTIM_COMPARE    = 0x08, /**< LPTIM1 compare match */
+} HAL_SIM_EVENT_SOURCE_VALUES_TYPEDEF;
+
+typedef struct HAL_SIM_UART_STRUCT {
+  USART_TypeDef                         *instance;
+  UART_HandleTypeDef                    *handle;
+  IRQn_Type                             irq;
+  uint8_t                               rxQueue[HAL_SIM_UART_RX_QUEUE_SIZE];
+  uint32_t                              rxHead;
+  uint32_t                              rxCount;
+  uint64_t                              rxDueNs;
+  uint64_t                              idleDueNs;
+  uint64_t                              txDueNs;
+  HAL_SIM_UART_TX_HOOK_TYPEDEF          txHook;
+  void                                  *txHookContext;
+} HAL_SIM_UART_STRUCT_TYPEDEF;
+
+typedef struct HAL_SIM_PIN_WATCHER_STRUCT {
+  GPIO_TypeDef                          *port;
+  uint16_t                              pin;
+  GPIO_PinState                         level;
+  HAL_SIM_PIN_WATCHER_TYPEDEF           watcher;
+  void                                  *context;
+} HAL_SIM_PIN_WATCHER_STRUCT_TYPEDEF;
+
+typedef struct HAL_SIM_CALLBACK_STRUCT {
+  uint64_t                              dueNs;
+  HAL_SIM_TIMED_CALLBACK_TYPEDEF        callback;
+  void                                  *context;
+} HAL_SIM_CALLBACK_STRUCT_TYPEDEF;
+
+typedef struct HAL_SIM_SPI_BUS_STRUCT {
+  const HAL_SIM_SPI_DEVICE_STRUCT_TYPEDEF *device;
+  int                                   selected;
+} HAL_SIM_SPI_BUS_STRUCT_TYPEDEF;
+
+static void halSim_dispatchIrqs(void);
+static void halSim_syncRegisters(void);
+static void halSim_runUntil(uint64_t targetNs);
+
+/* Variables */
+
+// Register blocks, the device header maps the instances onto them
+GPIO_TypeDef            halSimGpioA;
+GPIO_TypeDef            halSimGpioB;
+GPIO_TypeDef            halSimGpioC;
+GPIO_TypeDef            halSimGpioD;
+GPIO_TypeDef            halSimGpioH;
+USART_TypeDef           halSimUsart1;
+USART_TypeDef           halSimUsart2;
+SPI_TypeDef             halSimSpi1;
+DMA_TypeDef             halSimDma1;
+DMA_Request_TypeDef     halSimDma1Csel;
+DMA_Channel_TypeDef     halSimDma1Channel[HAL_SIM_DMA_CHANNEL_COUNT];
+TIM_TypeDef             halSimTim2;
+ADC_TypeDef             halSimAdc1;
+CRC_TypeDef             halSimCrc;
+RTC_TypeDef             halSimRtc;
+LPTIM_TypeDef           halSimLptim1;
+IWDG_TypeDef            halSimIwdg;
+RCC_TypeDef             halSimRcc;
+PWR_TypeDef             halSimPwr;
+EXTI_TypeDef            halSimExti;
+
+uint32_t SystemCoreClock;
+
+static GPIO_TypeDef * const simGpioPorts[HAL_SIM_GPIO_PORT_COUNT] = {GPIOA, GPIOB, GPIOC, GPIOD, GPIOH};
+static uint32_t simGpioDriven[HAL_SIM_GPIO_PORT_COUNT];
+static uint32_t simGpioDrivenLevel[HAL_SIM_GPIO_PORT_COUNT];
+static uint32_t simGpioPreviousIdr[HAL_SIM_GPIO_PORT_COUNT];
+// The port every EXTI line is connected to (SYSCFG_EXTICR)
+static uint8_t simExtiPort[16];
+static HAL_SIM_PIN_WATCHER_STRUCT_TYPEDEF simPinWatchers[HAL_SIM_PIN_WATCHER_COUNT];
+
+static uint64_t simTimeNs;
+static uint64_t simTickNs;
+static int simTickSuspended;
+static HAL_SIM_POWER_MODE_VALUES_TYPEDEF simPowerMode;
+static HAL_SIM_STATISTICS_STRUCT_TYPEDEF simStatistics;
+static HAL_SIM_POWER_STATE_STRUCT_TYPEDEF simPowerTimeline[HAL_SIM_POWER_TIMELINE_LENGTH];
+static uint32_t simPowerTimelineCount;
+
+static volatile sig_atomic_t simPrimask;
+static volatile sig_atomic_t simInIsr;
+static volatile sig_atomic_t simBusy;
+static volatile sig_atomic_t simEntries;
+static volatile sig_atomic_t simSpinWatchLastEntries;
+static volatile sig_atomic_t simSpinWatchQuietPeriods;
+static uint8_t simNvicEnabled[HAL_SIM_IRQ_COUNT];
+static uint8_t simNvicPending[HAL_SIM_IRQ_COUNT];
+
+static HAL_SIM_CALLBACK_STRUCT_TYPEDEF simCallbacks[HAL_SIM_CALLBACK_COUNT];
+
+static HAL_SIM_UART_STRUCT_TYPEDEF simUart[HAL_SIM_UART_COUNT];
+
+static HAL_SIM_SPI_BUS_STRUCT_TYPEDEF simSpi1Bus;
+
+static DMA_HandleTypeDef *simDmaHandles[HAL_SIM_DMA_CHANNEL_COUNT];
+static uint32_t simDmaReload[HAL_SIM_DMA_CHANNEL_COUNT];
+
+static uint32_t simTim2LastCr1;
+static uint64_t simTim2DueNs;
+
+static uint64_t simRtcDueNs;
+static uint64_t simRtcPeriodNs;
+
+static uint64_t simLptimStartNs;
+static uint64_t simLptimDueNs;
+static uint32_t simLptimMatches;
+
+static uint64_t simIwdgDueNs;
+static uint64_t simIwdgTimeoutNs;
+
+static uint16_t simAdcChannelValue[HAL_SIM_ADC_CHANNEL_COUNT];
+static ADC_HandleTypeDef *simAdcDmaHandle;
+static uint32_t simAdcDmaRun;
+static uint32_t simAdcScanChannel;
+
+static uint32_t simLsiHz;
+static uint32_t simMsiRange;
+static uint32_t simPllMul;
+static uint32_t simPllDiv;
+static uint32_t simSysclkSource;
+static uint32_t simAhbDivider;
+static uint32_t simApb1Divider;
+static uint32_t simApb2Divider;
+
+static int simEepromUnlocked;
+static uint32_t simEepromWordWrites[(DATA_EEPROM_END - DATA_EEPROM_BASE + 1) / 4];
+
+static ucontext_t simHostContext;
+static ucontext_t simFirmwareContext;
+static int (*simFirmwareEntry)(void);
+static int simFirmwareResult;
+
+/* Function definitions */
+
+/* ------------------------------------------------------ Time and events --- */
+
+/** @brief Marks the entry of the core into the HAL. The spin watch leaves
+ *         the core alone as long as it does this.
+ *  @return Nothing.
+ */
+static void halSim_enter(void){
+  simBusy++;
+  simEntries++;
+  halSim_syncRegisters();
+}
+
+static void halSim_leave(void){
+  simBusy--;
+}
+
+/** @brief Gives the modelled supply current of the core in the power mode
+ *         and at the clock it is in right now
+ *  @return The current in nA.
+ */
+static uint32_t halSim_currentNa(void){
+  switch(simPowerMode){
+    case HAL_SIM_POWER_MODE_STOP:
+      return HAL_SIM_STOP_NA;
+    case HAL_SIM_POWER_MODE_SLEEP:
+      return (uint32_t) (((uint64_t) SystemCoreClock * HAL_SIM_SLEEP_NA_PER_MHZ) / 1000000ULL);
+    default:
+      return (uint32_t) (((uint64_t) SystemCoreClock * HAL_SIM_RUN_NA_PER_MHZ) / 1000000ULL);
+  }
+}
+
+/** @brief Adds the current power state to the timeline, if it changed.
+ *  @return Nothing.
+ */
+static void halSim_logPowerState(void){
+  HAL_SIM_POWER_STATE_STRUCT_TYPEDEF *last;
+  uint32_t hclk;
+  
+  hclk = (simPowerMode == HAL_SIM_POWER_MODE_STOP) ? 0 : SystemCoreClock;
+  // Did anything change?
+  if (simPowerTimelineCount > 0){
+    last = &simPowerTimeline[simPowerTimelineCount - 1];
+    if ((last->mode == simPowerMode) && (last->hclkHz == hclk)){
+      // No
+      return;
+    }
+    // Did it change at the same time again?
+    if (last->timeNs == simTimeNs){
+      // Yes, only the last state counts
+      last->mode = simPowerMode;
+      last->hclkHz = hclk;
+      last->currentNa = halSim_currentNa();
+      return;
+    }
+  }
+  // Is there space left?
+  if (simPowerTimelineCount >= HAL_SIM_POWER_TIMELINE_LENGTH){
+    // No
+    simStatistics.powerStatesLost++;
+    return;
+  }
+  simPowerTimeline[simPowerTimelineCount].timeNs = simTimeNs;
+  simPowerTimeline[simPowerTimelineCount].mode = simPowerMode;
+  simPowerTimeline[simPowerTimelineCount].hclkHz = hclk;
+  simPowerTimeline[simPowerTimelineCount].currentNa = halSim_currentNa();
+  simPowerTimelineCount++;
+}
+
+/** @brief Moves the clock forward, no events are handled.
+ *  @param toNs The new time
+ *  @return Nothing.
+ */
+static void halSim_passTime(uint64_t toNs){
+  uint64_t delta;
+  
+  if (toNs <= simTimeNs){
+    return;
+  }
+  delta = toNs - simTimeNs;
+  simStatistics.powerModeTimeNs[simPowerMode] += delta;
+  // nA * ns = 10^-18 C
+  simStatistics.powerModeChargePc[simPowerMode] += ((uint64_t) halSim_currentNa() * delta) / 1000000ULL;
+  // SysTick stops with the HCLK in STOP and when the firmware suspends it
+  if ((simTickSuspended == 0) && (simPowerMode != HAL_SIM_POWER_MODE_STOP)){
+    simTickNs += delta;
+  }
+  simTimeNs = toNs;
+}
+
+static uint64_t halSim_uartByteTimeNs(HAL_SIM_UART_STRUCT_TYPEDEF *uart){
+  uint32_t baudRate = 9600;
+  
+  if ((uart->handle != NULL) && (uart->handle->Init.BaudRate != 0)){
+    baudRate = uart->handle->Init.BaudRate;
+  }
+  // Start bit, 8 data bits, stop bit
+  return (10ULL * HAL_SIM_NS_PER_S) / baudRate;
+}
+
+/** @brief Finds the next timed event.
+ *  @param *source Where to put the source
+ *  @param *index Where to put the index within the source
+ *  @return The time of the event, HAL_SIM_NEVER if there is none.
+ */
+static uint64_t halSim_nextEvent(HAL_SIM_EVENT_SOURCE_VALUES_TYPEDEF *source, uint32_t *index){
+  uint64_t next = HAL_SIM_NEVER;
+  uint32_t i;
+  
+  *source = HAL_SIM_EVENT_SOURCE_NONE;
+  *index = 0;
+  for (i = 0; i < HAL_SIM_UART_COUNT; i++){
+    if (simUart[i].rxDueNs < next){
+      next = simUart[i].rxDueNs;
+      *source = HAL_SIM_EVENT_SOURCE_UART_RX;
+      *index = i;
+    }
+    if (simUart[i].idleDueNs < next){
+      next = simUart[i].idleDueNs;
+      *source = HAL_SIM_EVENT_SOURCE_UART_IDLE;
+      *index = i;
+    }
+    if (simUart[i].txDueNs < next){
+      next = simUart[i].txDueNs;
+      *source = HAL_SIM_EVENT_SOURCE_UART_TX;
+      *index = i;
+    }
+  }
+  if (simRtcDueNs < next){
+    next = simRtcDueNs;
+    *source = HAL_SIM_EVENT_SOURCE_RTC_WAKEUP;
+  }
+  if (simLptimDueNs < next){
+    next = simLptimDueNs;
+    *source = HAL_SIM_EVENT_SOURCE_LPTIM_COMPARE;
+  }
+  if (simTim2DueNs < next){
+    next = simTim2DueNs;
+    *source = HAL_SIM_EVENT_SOURCE_TIM2_UPDATE;
+  }
+  if (simIwdgDueNs < next){
+    next = simIwdgDueNs;
+    *source = HAL_SIM_EVENT_SOURCE_IWDG;
+  }
+  for (i = 0; i < HAL_SIM_CALLBACK_COUNT; i++){
+    if ((simCallbacks[i].callback != NULL) && (simCallbacks[i].dueNs < next)){
+      next = simCallbacks[i].dueNs;
+      *source = HAL_SIM_EVENT_SOURCE_CALLBACK;
+      *index = i;
+    }
+  }
+  return next;
+}
+
+static void halSim_raiseIrq(IRQn_Type irq){
+  simNvicPending[irq] = 1;
+  halSim_dispatchIrqs();
+}
+
+static int halSim_isIrqPending(void){
+  uint32_t i;
+  
+  for (i = 0; i < HAL_SIM_IRQ_COUNT; i++){
+    if ((simNvicPending[i] != 0) && (simNvicEnabled[i] != 0)){
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void halSim_callIrqHandler(IRQn_Type irq){
+  switch(irq){
+    case RTC_IRQn:
+      RTC_IRQHandler();
+      break;
+    case LPTIM1_IRQn:
+      LPTIM1_IRQHandler();
+      break;
+    case EXTI4_15_IRQn:
+      EXTI4_15_IRQHandler();
+      break;
+    case DMA1_Channel1_IRQn:
+      DMA1_Channel1_IRQHandler();
+      break;
+    case DMA1_Channel2_3_IRQn:
+      DMA1_Channel2_3_IRQHandler();
+      break;
+    case TIM2_IRQn:
+      TIM2_IRQHandler();
+      break;
+    case SPI1_IRQn:
+      SPI1_IRQHandler();
+      break;
+    case USART1_IRQn:
+      USART1_IRQHandler();
+      break;
+    case USART2_IRQn:
+      USART2_IRQHandler();
+      break;
+    default:
+      // The firmware has no handler, the default one would spin forever
+      printf("HAL SIM: UNHANDLED IRQ %i\r\n", (int) irq);
+      exit(EXIT_FAILURE);
+  }
+}
+
+/** @brief Executes the pending interrupts, if the core may take them. All
+ *         interrupts run on the same priority, so they never nest.
+ *  @return Nothing.
+ */
+static void halSim_dispatchIrqs(void){
+  uint32_t i;
+  
+  if ((simPrimask != 0) || (simInIsr != 0) || (simPowerMode != HAL_SIM_POWER_MODE_RUN)){
+    return;
+  }
+  i = 0;
+  while (i < HAL_SIM_IRQ_COUNT){
+    if ((simNvicPending[i] != 0) && (simNvicEnabled[i] != 0)){
+      simNvicPending[i] = 0;
+      simInIsr = 1;
+      simStatistics.interrupts++;
+      halSim_callIrqHandler((IRQn_Type) i);
+      simInIsr = 0;
+      // Lower numbers first, a handler may have raised one of them
+      i = 0;
+      continue;
+    }
+    i++;
+  }
+}
+
+static void halSim_fireUartRx(HAL_SIM_UART_STRUCT_TYPEDEF *uart);
+static void halSim_fireUartIdle(HAL_SIM_UART_STRUCT_TYPEDEF *uart);
+static void halSim_fireUartTx(HAL_SIM_UART_STRUCT_TYPEDEF *uart);
+static void halSim_fireRtcWakeUp(void);
+static void halSim_fireLptimCompare(void);
+static void halSim_fireTim2Update(void);
+static void halSim_fireIwdg(void);
+
+static void halSim_fireEvent(HAL_SIM_EVENT_SOURCE_VALUES_TYPEDEF source, uint32_t index){
+  HAL_SIM_TIMED_CALLBACK_TYPEDEF callback;
+  
+  switch(source){
+    case HAL_SIM_EVENT_SOURCE_UART_RX:
+      halSim_fireUartRx(&simUart[index]);
+      break;
+    case HAL_SIM_EVENT_SOURCE_UART_IDLE:
+      halSim_fireUartIdle(&simUart[index]);
+      break;
+    case HAL_SIM_EVENT_SOURCE_UART_TX:
+      halSim_fireUartTx(&simUart[index]);
+      break;
+    case HAL_SIM_EVENT_SOURCE_RTC_WAKEUP:
+      halSim_fireRtcWakeUp();
+      break;
+    case HAL_SIM_EVENT_SOURCE_LPTIM_COMPARE:
+      halSim_fireLptimCompare();
+      break;
+    case HAL_SIM_EVENT_SOURCE_TIM2_UPDATE:
+      halSim_fireTim2Update();
+      break;
+    case HAL_SIM_EVENT_SOURCE_IWDG:
+      halSim_fireIwdg();
+      break;
+    case HAL_SIM_EVENT_SOURCE_CALLBACK:
+      callback = simCallbacks[index].callback;
+      simCallbacks[index].callback = NULL;
+      callback(simCallbacks[index].context);
+      break;
+    default:
+      break;
+  }
+}
+
+/** @brief Lets the time pass up to targetNs with the core running, every
+ *         event and interrupt on the way is handled at its time.
+ *  @param targetNs The time to reach
+ *  @return Nothing.
+ */
+static void halSim_runUntil(uint64_t targetNs){
+  HAL_SIM_EVENT_SOURCE_VALUES_TYPEDEF source;
+  uint32_t index;
+  uint64_t next;
+  
+  for(;;){
+    next = halSim_nextEvent(&source, &index);
+    if ((next == HAL_SIM_NEVER) || (next > targetNs)){
+      break;
+    }
+    halSim_passTime(next);
+    halSim_fireEvent(source, index);
+    halSim_dispatchIrqs();
+  }
+  halSim_passTime(targetNs);
+}
+
+/** @brief Waits in a low power mode until an enabled interrupt is pending.
+ *         Masked interrupts wake the core up as well, like the WFI does.
+ *  @param mode SLEEP or STOP
+ *  @return Nothing.
+ */
+static void halSim_waitForWakeUp(HAL_SIM_POWER_MODE_VALUES_TYPEDEF mode){
+  HAL_SIM_EVENT_SOURCE_VALUES_TYPEDEF source;
+  uint32_t index;
+  uint64_t next;
+  uint64_t nextTickNs;
+  
+  simPowerMode = mode;
+  halSim_logPowerState();
+  while (halSim_isIrqPending() == 0){
+    next = halSim_nextEvent(&source, &index);
+    // Does the SysTick wake the core up first?
+    if ((mode == HAL_SIM_POWER_MODE_SLEEP) && (simTickSuspended == 0)){
+      // Yes, if it comes before the next event
+      nextTickNs = simTimeNs + (HAL_SIM_NS_PER_MS - (simTickNs % HAL_SIM_NS_PER_MS));
+      if (nextTickNs <= next){
+        halSim_passTime(nextTickNs);
+        break;
+      }
+    }
+    if (next == HAL_SIM_NEVER){
+      // Nothing will ever wake the device, skip a millisecond to keep going
+      printf("HAL SIM: LOW POWER MODE WITHOUT WAKEUP SOURCE\r\n");
+      halSim_passTime(simTimeNs + HAL_SIM_NS_PER_MS);
+      break;
+    }
+    halSim_passTime(next);
+    halSim_fireEvent(source, index);
+  }
+  simStatistics.wakeUps++;
+  simPowerMode = HAL_SIM_POWER_MODE_RUN;
+  halSim_logPowerState();
+  halSim_dispatchIrqs();
+}
+
+/** @brief Runs when the firmware used up CPU time without any call into the
+ *         HAL. Such a loop waits for an interrupt, so let the next one come.
+ *  @param signalNumber Unused
+ *  @return Nothing.
+ */
+static void halSim_spinWatch(int signalNumber){
+  HAL_SIM_EVENT_SOURCE_VALUES_TYPEDEF source;
+  uint32_t index;
+  uint64_t next;
+  
+  (void) signalNumber;
+  if ((simBusy != 0) || (simInIsr != 0) || (simPrimask != 0) || (simEntries != simSpinWatchLastEntries)){
+    simSpinWatchLastEntries = simEntries;
+    simSpinWatchQuietPeriods = 0;
+    return;
+  }
+  simSpinWatchQuietPeriods++;
+  if (simSpinWatchQuietPeriods < HAL_SIM_SPIN_WATCH_QUIET_COUNT){
+    return;
+  }
+  simSpinWatchQuietPeriods = 0;
+  simBusy++;
+  next = halSim_nextEvent(&source, &index);
+  if (next != HAL_SIM_NEVER){
+    halSim_runUntil(next);
+  }
+  simBusy--;
+}
+
+uint64_t halSim_getTimeNs(void){
+  return simTimeNs;
+}
+
+void halSim_advanceNs(uint64_t durationNs){
+  halSim_enter();
+  halSim_runUntil(simTimeNs + durationNs);
+  halSim_leave();
+}
+
+int halSim_scheduleCallback(uint64_t delayNs, HAL_SIM_TIMED_CALLBACK_TYPEDEF callback, void *context){
+  uint32_t i;
+  
+  for (i = 0; i < HAL_SIM_CALLBACK_COUNT; i++){
+    if (simCallbacks[i].callback == NULL){
+      simCallbacks[i].dueNs = simTimeNs + delayNs;
+      simCallbacks[i].callback = callback;
+      simCallbacks[i].context = context;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void halSim_getStatistics(HAL_SIM_STATISTICS_STRUCT_TYPEDEF *statistics){
+  *statistics = simStatistics;
+}
+
+void halSim_resetStatistics(void){
+  memset(&simStatistics, 0, sizeof(simStatistics));
+  simPowerTimelineCount = 0;
+  halSim_logPowerState();
+}
+
+uint32_t halSim_getPowerTimeline(const HAL_SIM_POWER_STATE_STRUCT_TYPEDEF **entries){
+  *entries = simPowerTimeline;
+  return simPowerTimelineCount;
+}
+
+HAL_SIM_POWER_MODE_VALUES_TYPEDEF halSim_getPowerMode(void){
+  return simPowerMode;
+}
+
+/* ------------------------------------------------------------ Core/NVIC --- */
+
+void halSim_disableIrq(void){
+  simPrimask = 1;
+}
+
+void halSim_enableIrq(void){
+  simPrimask = 0;
+  halSim_enter();
+  halSim_dispatchIrqs();
+  halSim_leave();
+}
+
+uint32_t halSim_getPrimask(void){
+  return (uint32_t) simPrimask;
+}
+
+void halSim_setPrimask(uint32_t mask){
+  // Is the mask lifted?
+  if ((mask & 0x01) == 0){
+    // Yes, this is the same as enabling the interrupts
+    halSim_enableIrq();
+  }else{
+    // No
+    halSim_disableIrq();
+  }
+}
+
+void halSim_waitForInterrupt(void){
+  halSim_enter();
+  halSim_waitForWakeUp(HAL_SIM_POWER_MODE_SLEEP);
+  halSim_leave();
+}
+
+void halSim_systemReset(void){
+  // There is nothing to restart on the host, the run ends here
+  printf("HAL SIM: SYSTEM RESET AFTER %llu MS\r\n", (unsigned long long) (simTimeNs / HAL_SIM_NS_PER_MS));
+  fflush(stdout);
+  exit(EXIT_SUCCESS);
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority){
+  (void) IRQn;
+  (void) PreemptPriority;
+  (void) SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn){
+  if ((IRQn < 0) || (IRQn >= HAL_SIM_IRQ_COUNT)){
+    return;
+  }
+  halSim_enter();
+  simNvicEnabled[IRQn] = 1;
+  halSim_dispatchIrqs();
+  halSim_leave();
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn){
+  if ((IRQn < 0) || (IRQn >= HAL_SIM_IRQ_COUNT)){
+    return;
+  }
+  simNvicEnabled[IRQn] = 0;
+}
+
+/* -------------------------------------------------------------- Generic --- */
+
+HAL_StatusTypeDef HAL_Init(void){
+  HAL_MspInit();
+  return HAL_OK;
+}
+
+// The CubeMX MSP file overrides these, like in the HAL
+__attribute__((weak)) void HAL_MspInit(void){
+}
+
+void HAL_IncTick(void){
+  // The tick follows the virtual time and the SysTick handler never runs. A
+  // firmware that suspended the tick makes up for the time with this call.
+  halSim_enter();
+  simTickNs += HAL_SIM_NS_PER_MS;
+  halSim_leave();
+}
+
+uint32_t HAL_GetTick(void){
+  uint32_t tick;
+  
+  halSim_enter();
+  halSim_runUntil(simTimeNs + HAL_SIM_TICK_READ_COST_NS);
+  tick = (uint32_t) (simTickNs / HAL_SIM_NS_PER_MS);
+  halSim_leave();
+  return tick;
+}
+
+void HAL_Delay(uint32_t Delay){
+  uint64_t targetTickNs;
+  
+  halSim_enter();
+  // Like the HAL, wait at least the given time
+  if (Delay < HAL_MAX_DELAY){
+    Delay++;
+  }
+  targetTickNs = ((simTickNs / HAL_SIM_NS_PER_MS) + Delay) * HAL_SIM_NS_PER_MS;
+  halSim_runUntil(simTimeNs + (targetTickNs - simTickNs));
+  halSim_leave();
+}
+
+void HAL_SuspendTick(void){
+  halSim_enter();
+  simTickSuspended = 1;
+  halSim_leave();
+}
+
+void HAL_ResumeTick(void){
+  halSim_enter();
+  simTickSuspended = 0;
+  halSim_leave();
+}
+
+/* ----------------------------------------------------------------- GPIO --- */
+
+static uint32_t halSim_gpio_portIndex(GPIO_TypeDef *port){
+  uint32_t i;
+  
+  for (i = 0; i < HAL_SIM_GPIO_PORT_COUNT; i++){
+    if (simGpioPorts[i] == port){
+      return i;
+    }
+  }
+  printf("HAL SIM: UNKNOWN GPIO PORT\r\n");
+  exit(EXIT_FAILURE);
+}
+
+static uint32_t halSim_gpio_pinNumber(uint16_t pin){
+  uint32_t i;
+  
+  for (i = 0; i < 16; i++){
+    if ((pin & (1U << i)) != 0){
+      return i;
+    }
+  }
+  return 0;
+}
+
+/** @brief The level a pin shows to the outside world: the output register in
+ *         output mode, else the pull or the level something drives on it.
+ *  @return The level.
+ */
+static GPIO_PinState halSim_gpio_externalLevel(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState previous){
+  uint32_t portIndex = halSim_gpio_portIndex(port);
+  uint32_t pinNumber = halSim_gpio_pinNumber(pin);
+  uint32_t mode = (port->MODER >> (pinNumber * 2)) & 0x03;
+  uint32_t pull = (port->PUPDR >> (pinNumber * 2)) & 0x03;
+  
+  if (mode == GPIO_MODE_OUTPUT_PP){
+    return ((port->ODR & pin) != 0) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+  }
+  if ((simGpioDriven[portIndex] & pin) != 0){
+    return ((simGpioDrivenLevel[portIndex] & pin) != 0) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+  }
+  if (pull == GPIO_PULLUP){
+    return GPIO_PIN_SET;
+  }
+  if (pull == GPIO_PULLDOWN){
+    return GPIO_PIN_RESET;
+  }
+  // Floating, the line keeps its charge
+  return previous;
+}
+
+/** @brief Sets the pending bits of the EXTI lines that saw their edge on the
+ *         port.
+ *  @param portIndex The index of the port
+ *  @param idr The new input levels of the port
+ *  @return Nothing.
+ */
+static void halSim_gpio_edges(uint32_t portIndex, uint32_t idr){
+  uint32_t rising = idr & ~simGpioPreviousIdr[portIndex];
+  uint32_t falling = ~idr & simGpioPreviousIdr[portIndex];
+  uint32_t line;
+  
+  simGpioPreviousIdr[portIndex] = idr;
+  for (line = 0; line < 16; line++){
+    if ((simExtiPort[line] != portIndex) || ((halSimExti.IMR & (1U << line)) == 0)){
+      continue;
+    }
+    if (((rising & halSimExti.RTSR) | (falling & halSimExti.FTSR)) & (1U << line)){
+      halSimExti.PR |= (1U << line);
+    }
+  }
+}
+
+/** @brief Raises the interrupts of the pending EXTI lines, they share three
+ *         vectors.
+ *  @return Nothing.
+ */
+static void halSim_exti_raise(void){
+  uint32_t pending = halSimExti.PR & halSimExti.IMR;
+  
+  if ((pending & 0x0003) != 0){
+    halSim_raiseIrq(EXTI0_1_IRQn);
+  }
+  if ((pending & 0x000C) != 0){
+    halSim_raiseIrq(EXTI2_3_IRQn);
+  }
+  if ((pending & 0xFFF0) != 0){
+    halSim_raiseIrq(EXTI4_15_IRQn);
+  }
+}
+
+/** @brief Applies BSRR/BRR writes of the firmware or the DMA, refreshes IDR and
+ *         tells the watchers about changed pins.
+ *  @return Nothing.
+ */
+static void halSim_gpio_sync(void){
+  GPIO_TypeDef *port;
+  GPIO_PinState level;
+  uint32_t i;
+  uint32_t pinNumber;
+  uint32_t mode;
+  uint32_t idr;
+  
+  for (i = 0; i < HAL_SIM_GPIO_PORT_COUNT; i++){
+    port = simGpioPorts[i];
+    if ((port->BSRR != 0) || (port->BRR != 0)){
+      port->ODR = (port->ODR | (port->BSRR & 0xFFFF)) & ~(port->BSRR >> 16) & ~(port->BRR & 0xFFFF);
+      port->BSRR = 0;
+      port->BRR = 0;
+    }
+    idr = 0;
+    for (pinNumber = 0; pinNumber < 16; pinNumber++){
+      mode = (port->MODER >> (pinNumber * 2)) & 0x03;
+      if (mode == GPIO_MODE_OUTPUT_PP){
+        idr |= port->ODR & (1U << pinNumber);
+      }else if (halSim_gpio_externalLevel(port, (uint16_t) (1U << pinNumber), GPIO_PIN_RESET) == GPIO_PIN_SET){
+        idr |= (1U << pinNumber);
+      }
+    }
+    port->IDR = idr;
+    halSim_gpio_edges(i, idr);
+  }
+  for (i = 0; i < HAL_SIM_PIN_WATCHER_COUNT; i++){
+    if (simPinWatchers[i].watcher == NULL){
+      continue;
+    }
+    level = halSim_gpio_externalLevel(simPinWatchers[i].port, simPinWatchers[i].pin, simPinWatchers[i].level);
+    if (level != simPinWatchers[i].level){
+      simPinWatchers[i].level = level;
+      simPinWatchers[i].watcher(simPinWatchers[i].context, level);
+    }
+  }
+  halSim_exti_raise();
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init){
+  uint32_t pinNumber;
+  uint32_t mode = GPIO_Init->Mode & 0x03;
+  
+  halSim_enter();
+  for (pinNumber = 0; pinNumber < 16; pinNumber++){
+    if ((GPIO_Init->Pin & (1U << pinNumber)) == 0){
+      continue;
+    }
+    GPIOx->MODER = (GPIOx->MODER & ~(0x03U << (pinNumber * 2))) | (mode << (pinNumber * 2));
+    GPIOx->PUPDR = (GPIOx->PUPDR & ~(0x03U << (pinNumber * 2))) | ((GPIO_Init->Pull & 0x03) << (pinNumber * 2));
+    GPIOx->OSPEEDR = (GPIOx->OSPEEDR & ~(0x03U << (pinNumber * 2))) | ((GPIO_Init->Speed & 0x03) << (pinNumber * 2));
+    // Is it an interrupt pin?
+    if ((GPIO_Init->Mode & GPIO_MODE_EXTI) != 0){
+      // Yes, connect the line to the port
+      simExtiPort[pinNumber] = (uint8_t) halSim_gpio_portIndex(GPIOx);
+      halSimExti.IMR |= (1U << pinNumber);
+      if ((GPIO_Init->Mode & GPIO_MODE_EXTI_RISING) != 0){
+        halSimExti.RTSR |= (1U << pinNumber);
+      }else{
+        halSimExti.RTSR &= ~(1U << pinNumber);
+      }
+      if ((GPIO_Init->Mode & GPIO_MODE_EXTI_FALLING) != 0){
+        halSimExti.FTSR |= (1U << pinNumber);
+      }else{
+        halSimExti.FTSR &= ~(1U << pinNumber);
+      }
+    }
+  }
+  halSim_gpio_sync();
+  halSim_leave();
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin){
+  uint32_t pinNumber;
+  
+  halSim_enter();
+  for (pinNumber = 0; pinNumber < 16; pinNumber++){
+    if ((GPIO_Pin & (1U << pinNumber)) == 0){
+      continue;
+    }
+    GPIOx->MODER |= (0x03U << (pinNumber * 2));
+    GPIOx->PUPDR &= ~(0x03U << (pinNumber * 2));
+    // Does the line belong to this port?
+    if (simExtiPort[pinNumber] == halSim_gpio_portIndex(GPIOx)){
+      // Yes, disconnect it
+      halSimExti.IMR &= ~(1U << pinNumber);
+      halSimExti.RTSR &= ~(1U << pinNumber);
+      halSimExti.FTSR &= ~(1U << pinNumber);
+      halSimExti.PR &= ~(1U << pinNumber);
+    }
+  }
+  halSim_gpio_sync();
+  halSim_leave();
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin){
+  GPIO_PinState level;
+  
+  halSim_enter();
+  level = ((GPIOx->IDR & GPIO_Pin) != 0) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+  halSim_leave();
+  return level;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState){
+  halSim_enter();
+  if (PinState != GPIO_PIN_RESET){
+    GPIOx->ODR |= GPIO_Pin;
+  }else{
+    GPIOx->ODR &= ~((uint32_t) GPIO_Pin);
+  }
+  halSim_gpio_sync();
+  halSim_leave();
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin){
+  halSim_enter();
+  GPIOx->ODR ^= GPIO_Pin;
+  halSim_gpio_sync();
+  halSim_leave();
+}
+
+void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin){
+  // Is the line pending?
+  if (__HAL_GPIO_EXTI_GET_IT(GPIO_Pin) != 0){
+    // Yes, clear it and tell the firmware
+    __HAL_GPIO_EXTI_CLEAR_IT(GPIO_Pin);
+    HAL_GPIO_EXTI_Callback(GPIO_Pin);
+  }
+}
+
+__attribute__((weak)) void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin){
+  (void) GPIO_Pin;
+}
+
+void halSim_gpio_driveInput(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState level){
+  uint32_t portIndex = halSim_gpio_portIndex(port);
+  
+  halSim_enter();
+  simGpioDriven[portIndex] |= pin;
+  if (level != GPIO_PIN_RESET){
+    simGpioDrivenLevel[portIndex] |= pin;
+  }else{
+    simGpioDrivenLevel[portIndex] &= ~((uint32_t) pin);
+  }
+  halSim_gpio_sync();
+  halSim_leave();
+}
+
+GPIO_PinState halSim_gpio_getOutput(GPIO_TypeDef *port, uint16_t pin){
+  halSim_syncRegisters();
+  return halSim_gpio_externalLevel(port, pin, GPIO_PIN_RESET);
+}
+
+int halSim_gpio_watchPin(GPIO_TypeDef *port, uint16_t pin, HAL_SIM_PIN_WATCHER_TYPEDEF watcher, void *context){
+  uint32_t i;
+  
+  for (i = 0; i < HAL_SIM_PIN_WATCHER_COUNT; i++){
+    if (simPinWatchers[i].watcher == NULL){
+      simPinWatchers[i].port = port;
+      simPinWatchers[i].pin = pin;
+      simPinWatchers[i].level = halSim_gpio_externalLevel(port, pin, GPIO_PIN_SET);
+      simPinWatchers[i].context = context;
+      simPinWatchers[i].watcher = watcher;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* ------------------------------------------------------------------ DMA --- */
+
+static uint32_t halSim_dma_channelIndex(DMA_Channel_TypeDef *channel){
+  return (uint32_t) (channel - halSimDma1Channel);
+}
+
+static IRQn_Type halSim_dma_irq(uint32_t channelIndex){
+  if (channelIndex == 0){
+    return DMA1_Channel1_IRQn;
+  }
+  if (channelIndex <= 2){
+    return DMA1_Channel2_3_IRQn;
+  }
+  return DMA1_Channel4_5_6_7_IRQn;
+}
+
+static uint32_t halSim_dma_unitSize(uint32_t sizeBits){
+  return 1U << (sizeBits & 0x03);
+}
+
+static uint32_t halSim_dma_read(uint32_t address, uint32_t size){
+  switch(size){
+    case 1:
+      return *((volatile uint8_t*) (uintptr_t) address);
+    case 2:
+      return *((volatile uint16_t*) (uintptr_t) address);
+    default:
+      return *((volatile uint32_t*) (uintptr_t) address);
+  }
+}
+
+static void halSim_dma_write(uint32_t address, uint32_t size, uint32_t value){
+  switch(size){
+    case 1:
+      *((volatile uint8_t*) (uintptr_t) address) = (uint8_t) value;
+      break;
+    case 2:
+      *((volatile uint16_t*) (uintptr_t) address) = (uint16_t) value;
+      break;
+    default:
+      *((volatile uint32_t*) (uintptr_t) address) = value;
+      break;
+  }
+}
+
+/** @brief One request of a peripheral to a DMA channel.
+ *  @param channelIndex 0 for channel 1
+ *  @param *value In: the data the peripheral delivers (peripheral to memory),
+ *                out: the data the DMA fetched (memory to peripheral)
+ *  @return 1 if the channel served the request, 0 if it is not running.
+ */
+static int halSim_dma_request(uint32_t channelIndex, uint32_t *value){
+  DMA_Channel_TypeDef *channel = &halSimDma1Channel[channelIndex];
+  uint32_t ccr = channel->CCR;
+  uint32_t peripheralSize = halSim_dma_unitSize(ccr >> DMA_CCR_PSIZE_Pos);
+  uint32_t memorySize = halSim_dma_unitSize(ccr >> DMA_CCR_MSIZE_Pos);
+  uint32_t done;
+  uint32_t memoryAddress;
+  uint32_t flags = 0;
+  
+  if (((ccr & DMA_CCR_EN) == 0) || (channel->CNDTR == 0)){
+    return 0;
+  }
+  done = simDmaReload[channelIndex] - channel->CNDTR;
+  memoryAddress = channel->CMAR + (((ccr & DMA_CCR_MINC) != 0) ? (done * memorySize) : 0);
+  if ((ccr & DMA_CCR_DIR) != 0){
+    *value = halSim_dma_read(memoryAddress, memorySize);
+    halSim_dma_write(channel->CPAR, peripheralSize, *value);
+  }else{
+    halSim_dma_write(memoryAddress, memorySize, *value);
+  }
+  simStatistics.dmaTransfers++;
+  channel->CNDTR--;
+  if (channel->CNDTR == (simDmaReload[channelIndex] / 2)){
+    flags |= DMA_ISR_HTIF1;
+  }
+  if (channel->CNDTR == 0){
+    flags |= DMA_ISR_TCIF1;
+    if ((ccr & DMA_CCR_CIRC) != 0){
+      channel->CNDTR = simDmaReload[channelIndex];
+    }
+  }
+  if (flags != 0){
+    halSimDma1.ISR |= (flags | DMA_ISR_GIF1) << (channelIndex * 4);
+    if ((((flags & DMA_ISR_HTIF1) != 0) && ((ccr & DMA_CCR_HTIE) != 0)) || (((flags & DMA_ISR_TCIF1) != 0) && ((ccr & DMA_CCR_TCIE) != 0))){
+      halSim_raiseIrq(halSim_dma_irq(channelIndex));
+    }
+  }
+  return 1;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma){
+  uint32_t channelIndex;
+  
+  if (hdma == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  channelIndex = halSim_dma_channelIndex(hdma->Instance);
+  hdma->Instance->CCR = hdma->Init.Direction | hdma->Init.PeriphInc | hdma->Init.MemInc | hdma->Init.PeriphDataAlignment | hdma->Init.MemDataAlignment | hdma->Init.Mode | hdma->Init.Priority;
+  halSimDma1Csel.CSELR = (halSimDma1Csel.CSELR & ~(0x0FU << (channelIndex * 4))) | ((hdma->Init.Request & 0x0F) << (channelIndex * 4));
+  simDmaHandles[channelIndex] = hdma;
+  hdma->XferCpltCallback = NULL;
+  hdma->XferHalfCpltCallback = NULL;
+  hdma->XferErrorCallback = NULL;
+  hdma->XferAbortCallback = NULL;
+  hdma->ErrorCode = 0;
+  hdma->State = HAL_DMA_STATE_READY;
+  hdma->Lock = HAL_UNLOCKED;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma){
+  uint32_t channelIndex;
+  
+  if (hdma == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  channelIndex = halSim_dma_channelIndex(hdma->Instance);
+  hdma->Instance->CCR = 0;
+  hdma->Instance->CNDTR = 0;
+  hdma->Instance->CPAR = 0;
+  hdma->Instance->CMAR = 0;
+  halSimDma1.ISR &= ~(0x0FU << (channelIndex * 4));
+  halSimDma1Csel.CSELR &= ~(0x0FU << (channelIndex * 4));
+  simDmaHandles[channelIndex] = NULL;
+  hdma->State = HAL_DMA_STATE_RESET;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength){
+  uint32_t channelIndex;
+  uint32_t ccr;
+  
+  halSim_enter();
+  if (hdma->State != HAL_DMA_STATE_READY){
+    halSim_leave();
+    return HAL_BUSY;
+  }
+  hdma->State = HAL_DMA_STATE_BUSY;
+  hdma->ErrorCode = 0;
+  channelIndex = halSim_dma_channelIndex(hdma->Instance);
+  ccr = hdma->Instance->CCR & ~(DMA_CCR_EN | DMA_CCR_TCIE | DMA_CCR_HTIE | DMA_CCR_TEIE);
+  halSimDma1.ISR &= ~(0x0FU << (channelIndex * 4));
+  hdma->Instance->CNDTR = DataLength;
+  simDmaReload[channelIndex] = DataLength;
+  if ((ccr & DMA_CCR_DIR) != 0){
+    hdma->Instance->CPAR = DstAddress;
+    hdma->Instance->CMAR = SrcAddress;
+  }else{
+    hdma->Instance->CPAR = SrcAddress;
+    hdma->Instance->CMAR = DstAddress;
+  }
+  ccr |= DMA_CCR_TCIE | DMA_CCR_TEIE;
+  if (hdma->XferHalfCpltCallback != NULL){
+    ccr |= DMA_CCR_HTIE;
+  }
+  hdma->Instance->CCR = ccr | DMA_CCR_EN;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma){
+  uint32_t channelIndex;
+  
+  halSim_enter();
+  channelIndex = halSim_dma_channelIndex(hdma->Instance);
+  hdma->Instance->CCR &= ~(DMA_CCR_EN | DMA_CCR_TCIE | DMA_CCR_HTIE | DMA_CCR_TEIE);
+  halSimDma1.ISR &= ~(0x0FU << (channelIndex * 4));
+  hdma->State = HAL_DMA_STATE_READY;
+  halSim_leave();
+  return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma){
+  uint32_t channelIndex;
+  uint32_t flags;
+  uint32_t ccr;
+  
+  if ((hdma == NULL) || (hdma->Instance == NULL)){
+    return;
+  }
+  halSim_enter();
+  channelIndex = halSim_dma_channelIndex(hdma->Instance);
+  flags = (halSimDma1.ISR >> (channelIndex * 4)) & 0x0F;
+  ccr = hdma->Instance->CCR;
+  if (((flags & DMA_ISR_HTIF1) != 0) && ((ccr & DMA_CCR_HTIE) != 0)){
+    if ((ccr & DMA_CCR_CIRC) == 0){
+      hdma->Instance->CCR &= ~DMA_CCR_HTIE;
+    }
+    halSimDma1.ISR &= ~(DMA_ISR_HTIF1 << (channelIndex * 4));
+    if (hdma->XferHalfCpltCallback != NULL){
+      hdma->XferHalfCpltCallback(hdma);
+    }
+  }else if (((flags & DMA_ISR_TCIF1) != 0) && ((ccr & DMA_CCR_TCIE) != 0)){
+    if ((ccr & DMA_CCR_CIRC) == 0){
+      hdma->Instance->CCR &= ~(DMA_CCR_TEIE | DMA_CCR_HTIE | DMA_CCR_TCIE);
+      hdma->State = HAL_DMA_STATE_READY;
+    }
+    halSimDma1.ISR &= ~((DMA_ISR_TCIF1 | DMA_ISR_GIF1) << (channelIndex * 4));
+    if (hdma->XferCpltCallback != NULL){
+      hdma->XferCpltCallback(hdma);
+    }
+  }
+  halSim_leave();
+}
+
+/* ----------------------------------------------------------------- UART --- */
+
+static HAL_SIM_UART_STRUCT_TYPEDEF *halSim_uart_get(USART_TypeDef *instance){
+  uint32_t i;
+  
+  for (i = 0; i < HAL_SIM_UART_COUNT; i++){
+    if (simUart[i].instance == instance){
+      return &simUart[i];
+    }
+  }
+  printf("HAL SIM: UNKNOWN UART\r\n");
+  exit(EXIT_FAILURE);
+}
+
+static void halSim_uart_dmaRxHalfComplete(DMA_HandleTypeDef *hdma){
+  HAL_UART_RxHalfCpltCallback((UART_HandleTypeDef*) hdma->Parent);
+}
+
+static void halSim_uart_dmaRxComplete(DMA_HandleTypeDef *hdma){
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef*) hdma->Parent;
+  
+  if ((hdma->Instance->CCR & DMA_CCR_CIRC) == 0){
+    huart->Instance->CR3 &= ~USART_CR3_DMAR;
+    huart->RxState = HAL_UART_STATE_READY;
+  }
+  HAL_UART_RxCpltCallback(huart);
+}
+
+static void halSim_fireUartRx(HAL_SIM_UART_STRUCT_TYPEDEF *uart){
+  USART_TypeDef *instance = uart->instance;
+  uint32_t uartIndex = (uint32_t) (uart - simUart);
+  uint32_t value;
+  uint64_t byteTimeNs = halSim_uartByteTimeNs(uart);
+  
+  value = uart->rxQueue[uart->rxHead];
+  uart->rxHead = (uart->rxHead + 1) % HAL_SIM_UART_RX_QUEUE_SIZE;
+  uart->rxCount--;
+  if (uart->rxCount > 0){
+    uart->rxDueNs += byteTimeNs;
+  }else{
+    uart->rxDueNs = HAL_SIM_NEVER;
+    uart->idleDueNs = simTimeNs + byteTimeNs;
+  }
+  // Is the receiver able to take the byte?
+  if ((simPowerMode == HAL_SIM_POWER_MODE_STOP) || ((instance->CR1 & (USART_CR1_UE | USART_CR1_RE)) != (USART_CR1_UE | USART_CR1_RE))){
+    // No, the byte is lost
+    simStatistics.uartRxBytesLost[uartIndex]++;
+    return;
+  }
+  simStatistics.uartRxBytes[uartIndex]++;
+  // Does a DMA take it?
+  if (((instance->CR3 & USART_CR3_DMAR) != 0) && (uart->handle != NULL) && (uart->handle->hdmarx != NULL)){
+    // Yes
+    if (halSim_dma_request(halSim_dma_channelIndex(uart->handle->hdmarx->Instance), &value) != 0){
+      return;
+    }
+  }
+  // No, the core has to read RDR in time
+  if ((instance->ISR & USART_ISR_RXNE) != 0){
+    instance->ISR |= USART_ISR_ORE;
+    simStatistics.uartRxBytesLost[uartIndex]++;
+  }else{
+    instance->RDR = value;
+    instance->ISR |= USART_ISR_RXNE;
+  }
+  if ((instance->CR1 & USART_CR1_RXNEIE) != 0){
+    halSim_raiseIrq(uart->irq);
+  }
+}
+
+static void halSim_fireUartIdle(HAL_SIM_UART_STRUCT_TYPEDEF *uart){
+  uart->idleDueNs = HAL_SIM_NEVER;
+  if (simPowerMode == HAL_SIM_POWER_MODE_STOP){
+    return;
+  }
+  uart->instance->ISR |= USART_ISR_IDLE;
+  if ((uart->instance->CR1 & USART_CR1_IDLEIE) != 0){
+    halSim_raiseIrq(uart->irq);
+  }
+}
+
+/** @brief The byte in the shift register is on the line. Without a buffered
+ *         byte behind it, TXE and TC come at the same time.
+ *  @param *uart The UART
+ *  @return Nothing.
+ */
+static void halSim_fireUartTx(HAL_SIM_UART_STRUCT_TYPEDEF *uart){
+  uart->txDueNs = HAL_SIM_NEVER;
+  simStatistics.uartTxBytes[uart - simUart]++;
+  if (uart->txHook != NULL){
+    uart->txHook(uart->txHookContext, (uint8_t) uart->instance->TDR);
+  }
+  uart->instance->ISR |= USART_ISR_TXE | USART_ISR_TC;
+  if ((uart->instance->CR1 & (USART_CR1_TXEIE | USART_CR1_TCIE)) != 0){
+    halSim_raiseIrq(uart->irq);
+  }
+}
+
+void halSim_uart_receive(USART_TypeDef *instance, const uint8_t *data, uint32_t length){
+  HAL_SIM_UART_STRUCT_TYPEDEF *uart = halSim_uart_get(instance);
+  uint32_t i;
+  
+  for (i = 0; i < length; i++){
+    if (uart->rxCount >= HAL_SIM_UART_RX_QUEUE_SIZE){
+      printf("HAL SIM: UART RX QUEUE FULL\r\n");
+      exit(EXIT_FAILURE);
+    }
+    uart->rxQueue[(uart->rxHead + uart->rxCount) % HAL_SIM_UART_RX_QUEUE_SIZE] = data[i];
+    uart->rxCount++;
+  }
+  // Is the line idle?
+  if ((uart->rxDueNs == HAL_SIM_NEVER) && (uart->rxCount > 0)){
+    // Yes, the first byte is complete one byte time from now
+    uart->rxDueNs = simTimeNs + halSim_uartByteTimeNs(uart);
+    uart->idleDueNs = HAL_SIM_NEVER;
+  }
+}
+
+void halSim_uart_setTxHook(USART_TypeDef *instance, HAL_SIM_UART_TX_HOOK_TYPEDEF hook, void *context){
+  HAL_SIM_UART_STRUCT_TYPEDEF *uart = halSim_uart_get(instance);
+  
+  uart->txHook = hook;
+  uart->txHookContext = context;
+}
+
+uint32_t halSim_uart_getPendingRxBytes(USART_TypeDef *instance){
+  return halSim_uart_get(instance)->rxCount;
+}
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart){
+  HAL_SIM_UART_STRUCT_TYPEDEF *uart;
+  
+  if (huart == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  uart = halSim_uart_get(huart->Instance);
+  uart->handle = huart;
+  if (huart->gState == HAL_UART_STATE_RESET){
+    huart->Lock = HAL_UNLOCKED;
+    HAL_UART_MspInit(huart);
+  }
+  huart->Instance->CR1 = USART_CR1_UE | USART_CR1_TE | USART_CR1_RE;
+  huart->Instance->CR3 = 0;
+  huart->Instance->ISR = USART_ISR_TXE | USART_ISR_TC;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_READY;
+  huart->RxState = HAL_UART_STATE_READY;
+  huart->Lock = HAL_UNLOCKED;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart){
+  if (huart == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  huart->Instance->CR1 = 0;
+  huart->Instance->CR3 = 0;
+  huart->Instance->ISR = 0;
+  halSim_uart_get(huart->Instance)->txDueNs = HAL_SIM_NEVER;
+  HAL_UART_MspDeInit(huart);
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_RESET;
+  huart->RxState = HAL_UART_STATE_RESET;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout){
+  HAL_SIM_UART_STRUCT_TYPEDEF *uart;
+  uint64_t byteTimeNs;
+  uint32_t i;
+  
+  (void) Timeout;
+  if ((pData == NULL) || (Size == 0)){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (huart->gState != HAL_UART_STATE_READY){
+    halSim_leave();
+    return HAL_BUSY;
+  }
+  uart = halSim_uart_get(huart->Instance);
+  byteTimeNs = halSim_uartByteTimeNs(uart);
+  huart->gState = HAL_UART_STATE_BUSY_TX;
+  for (i = 0; i < Size; i++){
+    // The core polls TXE, interrupts keep coming meanwhile
+    halSim_runUntil(simTimeNs + byteTimeNs);
+    simStatistics.uartTxBytes[uart - simUart]++;
+    if (uart->txHook != NULL){
+      uart->txHook(uart->txHookContext, pData[i]);
+    }
+  }
+  huart->gState = HAL_UART_STATE_READY;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size){
+  if ((pData == NULL) || (Size == 0)){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (huart->gState != HAL_UART_STATE_READY){
+    halSim_leave();
+    return HAL_BUSY;
+  }
+  huart->pTxBuffPtr = pData;
+  huart->TxXferSize = Size;
+  huart->TxXferCount = Size;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_BUSY_TX;
+  huart->Instance->CR1 |= USART_CR1_TXEIE;
+  // An empty TDR asks for the first byte right away
+  if ((huart->Instance->ISR & USART_ISR_TXE) != 0){
+    halSim_raiseIrq(halSim_uart_get(huart->Instance)->irq);
+  }
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size){
+  if ((pData == NULL) || (Size == 0)){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (huart->RxState != HAL_UART_STATE_READY){
+    halSim_leave();
+    return HAL_BUSY;
+  }
+  huart->pRxBuffPtr = pData;
+  huart->RxXferSize = Size;
+  huart->RxXferCount = Size;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+  huart->Instance->CR3 |= USART_CR3_EIE;
+  huart->Instance->CR1 |= USART_CR1_PEIE | USART_CR1_RXNEIE;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size){
+  if ((pData == NULL) || (Size == 0) || (huart->hdmarx == NULL)){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (huart->RxState != HAL_UART_STATE_READY){
+    halSim_leave();
+    return HAL_BUSY;
+  }
+  huart->pRxBuffPtr = pData;
+  huart->RxXferSize = Size;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+  huart->hdmarx->XferCpltCallback = halSim_uart_dmaRxComplete;
+  huart->hdmarx->XferHalfCpltCallback = halSim_uart_dmaRxHalfComplete;
+  huart->hdmarx->XferErrorCallback = NULL;
+  HAL_DMA_Start_IT(huart->hdmarx, (uint32_t) (uintptr_t) &huart->Instance->RDR, (uint32_t) (uintptr_t) pData, Size);
+  huart->Instance->ISR &= ~USART_ISR_ORE;
+  huart->Instance->CR1 |= USART_CR1_PEIE;
+  huart->Instance->CR3 |= USART_CR3_EIE | USART_CR3_DMAR;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart){
+  halSim_enter();
+  huart->Instance->CR1 &= ~(USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE | USART_CR1_IDLEIE);
+  huart->Instance->CR3 &= ~(USART_CR3_EIE | USART_CR3_DMAR | USART_CR3_DMAT);
+  if (huart->hdmarx != NULL){
+    HAL_DMA_Abort(huart->hdmarx);
+  }
+  huart->Instance->ISR &= ~(USART_ISR_RXNE | USART_ISR_ORE | USART_ISR_IDLE);
+  // A byte on the line gets cut off
+  halSim_uart_get(huart->Instance)->txDueNs = HAL_SIM_NEVER;
+  huart->Instance->ISR |= USART_ISR_TXE | USART_ISR_TC;
+  huart->RxXferCount = 0;
+  huart->TxXferCount = 0;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_READY;
+  huart->RxState = HAL_UART_STATE_READY;
+  halSim_leave();
+  return HAL_OK;
+}
+
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart){
+  USART_TypeDef *instance = huart->Instance;
+  uint8_t byte;
+  
+  halSim_enter();
+  // Overrun error
+  if (((instance->ISR & USART_ISR_ORE) != 0) && (((instance->CR3 & USART_CR3_EIE) != 0) || ((instance->CR1 & USART_CR1_RXNEIE) != 0))){
+    instance->ISR &= ~USART_ISR_ORE;
+    huart->ErrorCode |= HAL_UART_ERROR_ORE;
+  }
+  // Received byte
+  if (((instance->ISR & USART_ISR_RXNE) != 0) && ((instance->CR1 & USART_CR1_RXNEIE) != 0)){
+    byte = (uint8_t) instance->RDR;
+    instance->ISR &= ~USART_ISR_RXNE;
+    if ((huart->RxState == HAL_UART_STATE_BUSY_RX) && (huart->RxXferCount > 0)){
+      *huart->pRxBuffPtr = byte;
+      huart->pRxBuffPtr++;
+      huart->RxXferCount--;
+      if (huart->RxXferCount == 0){
+        instance->CR1 &= ~(USART_CR1_RXNEIE | USART_CR1_PEIE);
+        instance->CR3 &= ~USART_CR3_EIE;
+        huart->RxState = HAL_UART_STATE_READY;
+        HAL_UART_RxCpltCallback(huart);
+      }
+    }
+  }
+  // Transmit data register empty
+  if (((instance->ISR & USART_ISR_TXE) != 0) && ((instance->CR1 & USART_CR1_TXEIE) != 0)){
+    if (huart->TxXferCount == 0){
+      // The last byte is in the shift register, wait for it to complete
+      instance->CR1 &= ~USART_CR1_TXEIE;
+      instance->CR1 |= USART_CR1_TCIE;
+    }else{
+      instance->TDR = *huart->pTxBuffPtr;
+      huart->pTxBuffPtr++;
+      huart->TxXferCount--;
+      instance->ISR &= ~(USART_ISR_TXE | USART_ISR_TC);
+      halSim_uart_get(instance)->txDueNs = simTimeNs + halSim_uartByteTimeNs(halSim_uart_get(instance));
+    }
+  }
+  // Transmission complete
+  if (((instance->ISR & USART_ISR_TC) != 0) && ((instance->CR1 & USART_CR1_TCIE) != 0)){
+    instance->CR1 &= ~USART_CR1_TCIE;
+    huart->gState = HAL_UART_STATE_READY;
+    HAL_UART_TxCpltCallback(huart);
+  }
+  if (huart->ErrorCode != HAL_UART_ERROR_NONE){
+    HAL_UART_ErrorCallback(huart);
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+  }
+  halSim_leave();
+}
+
+__attribute__((weak)) void HAL_UART_MspInit(UART_HandleTypeDef *huart){
+  (void) huart;
+}
+
+__attribute__((weak)) void HAL_UART_MspDeInit(UART_HandleTypeDef *huart){
+  (void) huart;
+}
+
+__attribute__((weak)) void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart){
+  (void) huart;
+}
+
+__attribute__((weak)) void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart){
+  (void) huart;
+}
+
+__attribute__((weak)) void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart){
+  (void) huart;
+}
+
+__attribute__((weak)) void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart){
+  (void) huart;
+}
+
+/* ------------------------------------------------------------------ SPI --- */
+
+static void halSim_spi_csWatcher(void *context, GPIO_PinState level){
+  HAL_SIM_SPI_BUS_STRUCT_TYPEDEF *bus = (HAL_SIM_SPI_BUS_STRUCT_TYPEDEF*) context;
+  
+  if (level == GPIO_PIN_RESET){
+    bus->selected = 1;
+    if (bus->device->select != NULL){
+      bus->device->select(bus->device->context);
+    }
+  }else{
+    bus->selected = 0;
+    if (bus->device->deselect != NULL){
+      bus->device->deselect(bus->device->context);
+    }
+  }
+}
+
+void halSim_spi_attach(SPI_TypeDef *instance, GPIO_TypeDef *csPort, uint16_t csPin, const HAL_SIM_SPI_DEVICE_STRUCT_TYPEDEF *device){
+  (void) instance;
+  simSpi1Bus.device = device;
+  simSpi1Bus.selected = 0;
+  halSim_gpio_watchPin(csPort, csPin, halSim_spi_csWatcher, &simSpi1Bus);
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi){
+  if (hspi == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (hspi->State == HAL_SPI_STATE_RESET){
+    HAL_SPI_MspInit(hspi);
+  }
+  hspi->Instance->CR1 = hspi->Init.Mode | hspi->Init.BaudRatePrescaler | hspi->Init.CLKPolarity | hspi->Init.CLKPhase;
+  hspi->State = HAL_SPI_STATE_READY;
+  hspi->ErrorCode = 0;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef *hspi){
+  if (hspi == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  hspi->Instance->CR1 = 0;
+  HAL_SPI_MspDeInit(hspi);
+  hspi->State = HAL_SPI_STATE_RESET;
+  halSim_leave();
+  return HAL_OK;
+}
+
+/** @brief Clocks bytes over the bus, MISO is dropped without a receive
+ *         buffer like the HAL does it with the overrun flag.
+ *  @return HAL_OK or HAL_ERROR.
+ */
+static HAL_StatusTypeDef halSim_spi_transfer(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size){
+  uint32_t divider;
+  uint64_t byteTimeNs;
+  uint16_t i;
+  uint8_t miso;
+  
+  if ((pTxData == NULL) || (Size == 0)){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (hspi->State != HAL_SPI_STATE_READY){
+    halSim_leave();
+    return HAL_ERROR;
+  }
+  divider = 2U << ((hspi->Init.BaudRatePrescaler >> 3) & 0x07);
+  byteTimeNs = (8ULL * HAL_SIM_NS_PER_S * divider) / HAL_RCC_GetPCLK2Freq();
+  simStatistics.spiTransfers++;
+  for (i = 0; i < Size; i++){
+    miso = 0x00;
+    if ((simSpi1Bus.device != NULL) && (simSpi1Bus.selected != 0)){
+      miso = simSpi1Bus.device->exchange(simSpi1Bus.device->context, pTxData[i]);
+    }
+    if (pRxData != NULL){
+      pRxData[i] = miso;
+    }
+    simStatistics.spiBytes++;
+  }
+  halSim_runUntil(simTimeNs + (byteTimeNs * Size));
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout){
+  (void) Timeout;
+  return halSim_spi_transfer(hspi, pData, NULL, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint32_t Timeout){
+  (void) Timeout;
+  if (pRxData == NULL){
+    return HAL_ERROR;
+  }
+  return halSim_spi_transfer(hspi, pTxData, pRxData, Size);
+}
+
+void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi){
+  (void) hspi;
+}
+
+__attribute__((weak)) void HAL_SPI_MspInit(SPI_HandleTypeDef *hspi){
+  (void) hspi;
+}
+
+__attribute__((weak)) void HAL_SPI_MspDeInit(SPI_HandleTypeDef *hspi){
+  (void) hspi;
+}
+
+/* ------------------------------------------------------------------ TIM --- */
+
+static uint64_t halSim_tim2PeriodNs(void){
+  uint64_t timerClock = HAL_RCC_GetPCLK1Freq();
+  
+  // The timer runs on twice the APB clock if the APB is divided
+  if (simApb1Divider > 1){
+    timerClock *= 2;
+  }
+  return (((uint64_t) halSimTim2.ARR + 1) * ((uint64_t) halSimTim2.PSC + 1) * HAL_SIM_NS_PER_S) / timerClock;
+}
+
+static void halSim_tim2Update(void){
+  uint32_t value;
+  uint32_t channelIndex = 1;
+  
+  halSimTim2.SR |= TIM_SR_UIF;
+  // TIM2_UP is request 8 of channel 2
+  if (((halSimTim2.DIER & TIM_DIER_UDE) != 0) && (((halSimDma1Csel.CSELR >> (channelIndex * 4)) & 0x0F) == DMA_REQUEST_8)){
+    halSim_dma_request(channelIndex, &value);
+    halSim_gpio_sync();
+  }
+  if ((halSimTim2.DIER & TIM_DIER_UIE) != 0){
+    halSim_raiseIrq(TIM2_IRQn);
+  }
+}
+
+static void halSim_tim2Sync(void){
+  // A generated update restarts the counter
+  if ((halSimTim2.EGR & TIM_EGR_UG) != 0){
+    halSimTim2.EGR = 0;
+    halSimTim2.CNT = 0;
+    if ((halSimTim2.CR1 & TIM_CR1_CEN) != 0){
+      simTim2DueNs = simTimeNs + halSim_tim2PeriodNs();
+    }
+    halSim_tim2Update();
+  }
+  if (((halSimTim2.CR1 & TIM_CR1_CEN) != 0) && ((simTim2LastCr1 & TIM_CR1_CEN) == 0)){
+    simTim2DueNs = simTimeNs + halSim_tim2PeriodNs();
+  }else if ((halSimTim2.CR1 & TIM_CR1_CEN) == 0){
+    simTim2DueNs = HAL_SIM_NEVER;
+  }
+  simTim2LastCr1 = halSimTim2.CR1;
+}
+
+static void halSim_fireTim2Update(void){
+  simTim2DueNs += halSim_tim2PeriodNs();
+  if (simPowerMode == HAL_SIM_POWER_MODE_STOP){
+    return;
+  }
+  halSim_tim2Update();
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim){
+  if (htim == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (htim->State == HAL_TIM_STATE_RESET){
+    htim->Lock = HAL_UNLOCKED;
+    HAL_TIM_Base_MspInit(htim);
+  }
+  htim->Instance->PSC = htim->Init.Prescaler;
+  htim->Instance->ARR = htim->Init.Period;
+  htim->Instance->CNT = 0;
+  htim->State = HAL_TIM_STATE_READY;
+  htim->Lock = HAL_UNLOCKED;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_DeInit(TIM_HandleTypeDef *htim){
+  if (htim == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  htim->Instance->CR1 = 0;
+  htim->Instance->DIER = 0;
+  htim->Instance->SR = 0;
+  halSim_tim2Sync();
+  HAL_TIM_Base_MspDeInit(htim);
+  htim->State = HAL_TIM_STATE_RESET;
+  halSim_leave();
+  return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim){
+  (void) htim;
+}
+
+__attribute__((weak)) void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef *htim){
+  (void) htim;
+}
+
+/** @brief Register writes of the firmware only get visible to the simulation
+ *         with the next HAL call. As the time stands still in between, this
+ *         changes nothing on the timing.
+ *  @return Nothing.
+ */
+static void halSim_syncRegisters(void){
+  halSim_gpio_sync();
+  halSim_tim2Sync();
+}
+
+/* ------------------------------------------------------------------ ADC --- */
+
+static uint32_t halSim_adc_channelNumber(uint32_t channel){
+  uint32_t i;
+  
+  for (i = 0; i < HAL_SIM_ADC_CHANNEL_COUNT; i++){
+    if ((channel & (1U << i)) != 0){
+      return i;
+    }
+  }
+  return 0;
+}
+
+void halSim_adc_setChannelValue(uint32_t channel, uint16_t value){
+  simAdcChannelValue[halSim_adc_channelNumber(channel & ADC_CHANNEL_MASK)] = value & 0x0FFF;
+}
+
+static uint32_t halSim_adc_oversamplingRatio(ADC_TypeDef *adc){
+  if ((adc->CFGR2 & ADC_CFGR2_OVSE) == 0){
+    return 1;
+  }
+  return 2U << ((adc->CFGR2 & ADC_CFGR2_OVSR) >> ADC_CFGR2_OVSR_Pos);
+}
+
+/** @brief Looks for the next selected channel of the forward scan
+ *  @param chselr The selected channels
+ *  @param from The first channel number to look at
+ *  @return The channel number, HAL_SIM_ADC_CHANNEL_COUNT at the end of the sequence.
+ */
+static uint32_t halSim_adc_nextChannel(uint32_t chselr, uint32_t from){
+  uint32_t i;
+  
+  for (i = from; i < HAL_SIM_ADC_CHANNEL_COUNT; i++){
+    if ((chselr & (1U << i)) != 0){
+      return i;
+    }
+  }
+  return HAL_SIM_ADC_CHANNEL_COUNT;
+}
+
+/** @brief Runs the conversions of one result of a channel, through the
+ *         oversampler if it is enabled. The input does not change while they
+ *         run, so the sum is ratio times the channel value.
+ *  @param *adc The ADC
+ *  @param channelNumber The channel to convert
+ *  @return The result, as it goes into DR.
+ */
+static uint32_t halSim_adc_convert(ADC_TypeDef *adc, uint32_t channelNumber){
+  uint32_t ratio = halSim_adc_oversamplingRatio(adc);
+  uint32_t value = simAdcChannelValue[channelNumber];
+  
+  simStatistics.adcConversions += ratio;
+  if (ratio == 1){
+    return value;
+  }
+  return ((value * ratio) >> ((adc->CFGR2 & ADC_CFGR2_OVSS) >> ADC_CFGR2_OVSS_Pos)) & 0xFFFF;
+}
+
+/** @brief The end of a conversion while HAL_ADC_Start_DMA runs. It hands the
+ *         result to the DMA and goes on with the next channel of the scan,
+ *         in continuous mode also with the next scan.
+ *  @param *context The run it belongs to, stale runs are dropped
+ *  @return Nothing.
+ */
+static void halSim_adc_dmaConversion(void *context){
+  ADC_HandleTypeDef *hadc = simAdcDmaHandle;
+  uint32_t chselr = hadc->Instance->CHSELR & ADC_CHANNEL_MASK;
+  uint32_t value;
+  
+  if (((uint32_t) (uintptr_t) context != simAdcDmaRun) || ((hadc->Instance->CR & ADC_CR_ADSTART) == 0)){
+    return;
+  }
+  value = halSim_adc_convert(hadc->Instance, simAdcScanChannel);
+  hadc->Instance->DR = value;
+  hadc->Instance->ISR |= ADC_ISR_EOC;
+  if ((hadc->Instance->CFGR1 & ADC_CFGR1_DMAEN) != 0){
+    halSim_dma_request(halSim_dma_channelIndex(hadc->DMA_Handle->Instance), &value);
+  }
+  simAdcScanChannel = halSim_adc_nextChannel(chselr, simAdcScanChannel + 1);
+  if (simAdcScanChannel == HAL_SIM_ADC_CHANNEL_COUNT){
+    hadc->Instance->ISR |= ADC_ISR_EOS;
+    if ((hadc->Instance->CFGR1 & ADC_CFGR1_CONT) == 0){
+      hadc->Instance->CR &= ~ADC_CR_ADSTART;
+      return;
+    }
+    simAdcScanChannel = halSim_adc_nextChannel(chselr, 0);
+  }
+  halSim_scheduleCallback(halSim_adc_oversamplingRatio(hadc->Instance) * HAL_SIM_ADC_CONVERSION_NS, halSim_adc_dmaConversion, context);
+}
+
+static void halSim_adc_dmaComplete(DMA_HandleTypeDef *hdma){
+  HAL_ADC_ConvCpltCallback((ADC_HandleTypeDef*) hdma->Parent);
+}
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc){
+  if (hadc == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (hadc->State == 0){
+    HAL_ADC_MspInit(hadc);
+  }
+  hadc->State = 1;
+  hadc->ErrorCode = 0;
+  hadc->Instance->ISR = 0;
+  hadc->Instance->CFGR1 = 0;
+  if (hadc->Init.ContinuousConvMode == ENABLE){
+    hadc->Instance->CFGR1 |= ADC_CFGR1_CONT;
+  }
+  if (hadc->Init.Overrun == ADC_OVR_DATA_OVERWRITTEN){
+    hadc->Instance->CFGR1 |= ADC_CFGR1_OVRMOD;
+  }
+  if (hadc->Init.LowPowerAutoPowerOff == ENABLE){
+    hadc->Instance->CFGR1 |= ADC_CFGR1_AUTOFF;
+  }
+  hadc->Instance->CFGR2 = 0;
+  if (hadc->Init.OversamplingMode == ENABLE){
+    hadc->Instance->CFGR2 = ADC_CFGR2_OVSE | hadc->Init.Oversample.Ratio | hadc->Init.Oversample.RightBitShift | hadc->Init.Oversample.TriggeredMode;
+  }
+  hadc->Instance->SMPR = hadc->Init.SamplingTime;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_DeInit(ADC_HandleTypeDef *hadc){
+  if (hadc == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  hadc->Instance->CR = 0;
+  hadc->Instance->CFGR1 = 0;
+  hadc->Instance->CFGR2 = 0;
+  hadc->Instance->CHSELR = 0;
+  hadc->Instance->ISR = 0;
+  simAdcDmaRun++;
+  HAL_ADC_MspDeInit(hadc);
+  hadc->State = 0;
+  halSim_leave();
+  return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_ADC_MspInit(ADC_HandleTypeDef *hadc){
+  (void) hadc;
+}
+
+__attribute__((weak)) void HAL_ADC_MspDeInit(ADC_HandleTypeDef *hadc){
+  (void) hadc;
+}
+
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *hadc, ADC_ChannelConfTypeDef *sConfig){
+  halSim_enter();
+  if (sConfig->Rank != ADC_RANK_NONE){
+    hadc->Instance->CHSELR |= sConfig->Channel & ADC_CHANNEL_MASK;
+  }else{
+    hadc->Instance->CHSELR &= ~(sConfig->Channel & ADC_CHANNEL_MASK);
+  }
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *hadc){
+  halSim_enter();
+  hadc->Instance->CR |= ADC_CR_ADEN | ADC_CR_ADSTART;
+  hadc->Instance->ISR &= ~ADC_ISR_EOC;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef *hadc){
+  halSim_enter();
+  hadc->Instance->CR &= ~(ADC_CR_ADEN | ADC_CR_ADSTART);
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *hadc, uint32_t Timeout){
+  (void) Timeout;
+  halSim_enter();
+  if ((hadc->Instance->CR & ADC_CR_ADSTART) == 0){
+    halSim_leave();
+    return HAL_ERROR;
+  }
+  halSim_runUntil(simTimeNs + (halSim_adc_oversamplingRatio(hadc->Instance) * HAL_SIM_ADC_CONVERSION_NS));
+  hadc->Instance->DR = halSim_adc_convert(hadc->Instance, halSim_adc_channelNumber(hadc->Instance->CHSELR & ADC_CHANNEL_MASK));
+  hadc->Instance->ISR |= ADC_ISR_EOC;
+  hadc->Instance->CR &= ~ADC_CR_ADSTART;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length){
+  if ((hadc == NULL) || (hadc->DMA_Handle == NULL)){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if ((hadc->Instance->CR & ADC_CR_ADSTART) != 0){
+    halSim_leave();
+    return HAL_BUSY;
+  }
+  if ((hadc->Instance->CHSELR & ADC_CHANNEL_MASK) == 0){
+    halSim_leave();
+    return HAL_ERROR;
+  }
+  hadc->DMA_Handle->XferCpltCallback = halSim_adc_dmaComplete;
+  if (HAL_DMA_Start_IT(hadc->DMA_Handle, (uint32_t) (uintptr_t) &hadc->Instance->DR, (uint32_t) (uintptr_t) pData, Length) != HAL_OK){
+    halSim_leave();
+    return HAL_ERROR;
+  }
+  simAdcDmaHandle = hadc;
+  simAdcDmaRun++;
+  simAdcScanChannel = halSim_adc_nextChannel(hadc->Instance->CHSELR & ADC_CHANNEL_MASK, 0);
+  hadc->Instance->ISR &= ~(ADC_ISR_EOC | ADC_ISR_EOS);
+  hadc->Instance->CFGR1 |= ADC_CFGR1_DMAEN;
+  hadc->Instance->CR |= ADC_CR_ADEN | ADC_CR_ADSTART;
+  if (halSim_scheduleCallback(halSim_adc_oversamplingRatio(hadc->Instance) * HAL_SIM_ADC_CONVERSION_NS, halSim_adc_dmaConversion, (void*) (uintptr_t) simAdcDmaRun) == 0){
+    printf("HAL SIM: NO CALLBACK SLOT FOR THE ADC\r\n");
+    exit(EXIT_FAILURE);
+  }
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc){
+  halSim_enter();
+  hadc->Instance->CR &= ~(ADC_CR_ADEN | ADC_CR_ADSTART);
+  hadc->Instance->CFGR1 &= ~ADC_CFGR1_DMAEN;
+  simAdcDmaRun++;
+  if (hadc->DMA_Handle != NULL){
+    HAL_DMA_Abort(hadc->DMA_Handle);
+  }
+  halSim_leave();
+  return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc){
+  (void) hadc;
+}
+
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *hadc){
+  hadc->Instance->ISR &= ~ADC_ISR_EOC;
+  return hadc->Instance->DR;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_Calibration_Start(ADC_HandleTypeDef *hadc, uint32_t SingleDiff){
+  (void) SingleDiff;
+  halSim_enter();
+  halSim_runUntil(simTimeNs + HAL_SIM_ADC_CONVERSION_NS);
+  hadc->Instance->CALFACT = HAL_SIM_ADC_CALIBRATION;
+  halSim_leave();
+  return HAL_OK;
+}
+
+uint32_t HAL_ADCEx_Calibration_GetValue(ADC_HandleTypeDef *hadc, uint32_t SingleDiff){
+  (void) SingleDiff;
+  return hadc->Instance->CALFACT;
+}
+
+HAL_StatusTypeDef HAL_ADCEx_Calibration_SetValue(ADC_HandleTypeDef *hadc, uint32_t SingleDiff, uint32_t CalibrationFactor){
+  (void) SingleDiff;
+  hadc->Instance->CALFACT = CalibrationFactor & 0x7F;
+  return HAL_OK;
+}
+
+/* ------------------------------------------------------------------ CRC --- */
+
+static uint32_t halSim_crc_reflect(uint32_t value, uint32_t bits){
+  uint32_t result = 0;
+  uint32_t i;
+  
+  for (i = 0; i < bits; i++){
+    if ((value & (1U << i)) != 0){
+      result |= 1U << (bits - 1 - i);
+    }
+  }
+  return result;
+}
+
+static uint32_t halSim_crc_polySize(void){
+  switch((halSimCrc.CR >> CRC_CR_POLYSIZE_Pos) & 0x03){
+    case 1:
+      return 16;
+    case 2:
+      return 8;
+    case 3:
+      return 7;
+    default:
+      return 32;
+  }
+}
+
+/** @brief Feeds one data unit into the CRC unit, MSB first like the hardware.
+ *  @param data The data
+ *  @param bits The width of the data: 8, 16 or 32
+ *  @return Nothing.
+ */
+static void halSim_crc_feed(uint32_t data, uint32_t bits){
+  uint32_t polySize = halSim_crc_polySize();
+  uint32_t mask = (polySize == 32) ? 0xFFFFFFFFU : ((1U << polySize) - 1);
+  uint32_t crc = halSimCrc.DR & mask;
+  uint32_t reverseIn = (halSimCrc.CR >> CRC_CR_REV_IN_Pos) & 0x03;
+  uint32_t i;
+  uint32_t feedback;
+  
+  // Input reversal by byte, halfword or word
+  if (reverseIn == 1){
+    for (i = 0; i < bits; i += 8){
+      data = (data & ~(0xFFU << i)) | (halSim_crc_reflect((data >> i) & 0xFF, 8) << i);
+    }
+  }else if ((reverseIn == 2) && (bits >= 16)){
+    for (i = 0; i < bits; i += 16){
+      data = (data & ~(0xFFFFU << i)) | (halSim_crc_reflect((data >> i) & 0xFFFF, 16) << i);
+    }
+  }else if ((reverseIn == 3) && (bits == 32)){
+    data = halSim_crc_reflect(data, 32);
+  }
+  for (i = 0; i < bits; i++){
+    feedback = ((crc >> (polySize - 1)) & 0x01) ^ ((data >> (bits - 1 - i)) & 0x01);
+    crc = (crc << 1) & mask;
+    if (feedback != 0){
+      crc ^= halSimCrc.POL & mask;
+    }
+  }
+  halSimCrc.DR = crc;
+  simStatistics.crcWords++;
+}
+
+static uint32_t halSim_crc_result(void){
+  if ((halSimCrc.CR & CRC_CR_REV_OUT) != 0){
+    return halSim_crc_reflect(halSimCrc.DR, halSim_crc_polySize());
+  }
+  return halSimCrc.DR;
+}
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc){
+  if (hcrc == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (hcrc->State == HAL_CRC_STATE_RESET){
+    HAL_CRC_MspInit(hcrc);
+  }
+  hcrc->Instance->POL = (hcrc->Init.DefaultPolynomialUse == DEFAULT_POLYNOMIAL_ENABLE) ? DEFAULT_CRC32_POLY : hcrc->Init.GeneratingPolynomial;
+  hcrc->Instance->INIT = (hcrc->Init.DefaultInitValueUse == DEFAULT_INIT_VALUE_ENABLE) ? DEFAULT_CRC_INITVALUE : hcrc->Init.InitValue;
+  hcrc->Instance->CR = hcrc->Init.CRCLength | hcrc->Init.InputDataInversionMode | hcrc->Init.OutputDataInversionMode;
+  hcrc->Instance->DR = hcrc->Instance->INIT;
+  hcrc->State = HAL_CRC_STATE_READY;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CRC_DeInit(CRC_HandleTypeDef *hcrc){
+  if (hcrc == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  hcrc->Instance->CR = 0;
+  hcrc->Instance->POL = DEFAULT_CRC32_POLY;
+  hcrc->Instance->INIT = DEFAULT_CRC_INITVALUE;
+  hcrc->Instance->DR = DEFAULT_CRC_INITVALUE;
+  HAL_CRC_MspDeInit(hcrc);
+  hcrc->State = HAL_CRC_STATE_RESET;
+  halSim_leave();
+  return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_CRC_MspInit(CRC_HandleTypeDef *hcrc){
+  (void) hcrc;
+}
+
+__attribute__((weak)) void HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc){
+  (void) hcrc;
+}
+
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength){
+  uint32_t i;
+  uint32_t result;
+  
+  halSim_enter();
+  for (i = 0; i < BufferLength; i++){
+    switch(hcrc->InputDataFormat){
+      case CRC_INPUTDATA_FORMAT_BYTES:
+        halSim_crc_feed(((uint8_t*) pBuffer)[i], 8);
+        break;
+      case CRC_INPUTDATA_FORMAT_HALFWORDS:
+        halSim_crc_feed(((uint16_t*) pBuffer)[i], 16);
+        break;
+      default:
+        halSim_crc_feed(pBuffer[i], 32);
+        break;
+    }
+  }
+  result = halSim_crc_result();
+  halSim_leave();
+  return result;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength){
+  hcrc->Instance->DR = hcrc->Instance->INIT;
+  return HAL_CRC_Accumulate(hcrc, pBuffer, BufferLength);
+}
+
+/* ------------------------------------------------------------------ RTC --- */
+
+static void halSim_fireRtcWakeUp(void){
+  simRtcDueNs += simRtcPeriodNs;
+  halSimRtc.ISR |= RTC_ISR_WUTF;
+  halSimPwr.CSR |= PWR_CSR_WUF;
+  if ((halSimRtc.CR & RTC_CR_WUTIE) != 0){
+    halSim_raiseIrq(RTC_IRQn);
+  }
+}
+
+HAL_StatusTypeDef HAL_RTC_Init(RTC_HandleTypeDef *hrtc){
+  if (hrtc == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (hrtc->State == HAL_RTC_STATE_RESET){
+    hrtc->Lock = HAL_UNLOCKED;
+    HAL_RTC_MspInit(hrtc);
+  }
+  hrtc->Instance->PRER = (hrtc->Init.AsynchPrediv << 16) | hrtc->Init.SynchPrediv;
+  hrtc->State = HAL_RTC_STATE_READY;
+  halSim_leave();
+  return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_RTC_MspInit(RTC_HandleTypeDef *hrtc){
+  (void) hrtc;
+}
+
+__attribute__((weak)) void HAL_RTC_MspDeInit(RTC_HandleTypeDef *hrtc){
+  (void) hrtc;
+}
+
+HAL_StatusTypeDef HAL_RTCEx_SetWakeUpTimer_IT(RTC_HandleTypeDef *hrtc, uint32_t WakeUpCounter, uint32_t WakeUpClock){
+  uint64_t countNs;
+  
+  halSim_enter();
+  if (WakeUpClock >= RTC_WAKEUPCLOCK_CK_SPRE_16BITS){
+    countNs = HAL_SIM_NS_PER_S;
+  }else{
+    // RTCCLK / 16, 8, 4, 2
+    countNs = ((16ULL >> WakeUpClock) * HAL_SIM_NS_PER_S) / simLsiHz;
+  }
+  hrtc->Instance->WUTR = WakeUpCounter & 0xFFFF;
+  hrtc->Instance->CR |= RTC_CR_WUTE | RTC_CR_WUTIE;
+  hrtc->Instance->ISR &= ~RTC_ISR_WUTF;
+  simRtcPeriodNs = ((uint64_t) (WakeUpCounter & 0xFFFF) + 1) * countNs;
+  simRtcDueNs = simTimeNs + simRtcPeriodNs;
+  halSim_leave();
+  return HAL_OK;
+}
+
+uint32_t HAL_RTCEx_DeactivateWakeUpTimer(RTC_HandleTypeDef *hrtc){
+  halSim_enter();
+  hrtc->Instance->CR &= ~(RTC_CR_WUTE | RTC_CR_WUTIE);
+  hrtc->Instance->ISR &= ~RTC_ISR_WUTF;
+  simRtcDueNs = HAL_SIM_NEVER;
+  halSim_leave();
+  return HAL_OK;
+}
+
+void HAL_RTCEx_WakeUpTimerIRQHandler(RTC_HandleTypeDef *hrtc){
+  halSim_enter();
+  if ((hrtc->Instance->ISR & RTC_ISR_WUTF) != 0){
+    hrtc->Instance->ISR &= ~RTC_ISR_WUTF;
+    HAL_RTCEx_WakeUpTimerEventCallback(hrtc);
+  }
+  halSim_leave();
+}
+
+__attribute__((weak)) void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc){
+  (void) hrtc;
+}
+
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister, uint32_t Data){
+  hrtc->Instance->BKP[BackupRegister % 5] = Data;
+}
+
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister){
+  return hrtc->Instance->BKP[BackupRegister % 5];
+}
+
+/* ---------------------------------------------------------------- LPTIM --- */
+
+/** @brief Gives the divider of the prescaler of the LPTIM1
+ *  @return 1 to 128.
+ */
+static uint64_t halSim_lptimPrescaler(void){
+  return 1ULL << ((halSimLptim1.CFGR & LPTIM_CFGR_PRESC) >> LPTIM_CFGR_PRESC_Pos);
+}
+
+/** @brief Gives the time of the count-th count since the LPTIM1 was started
+ *  @param count The count
+ *  @return The time in ns.
+ */
+static uint64_t halSim_lptimTimeOfCount(uint64_t count){
+  uint64_t scaled = count * halSim_lptimPrescaler() * HAL_SIM_NS_PER_S;
+  
+  // The count is reached at the edge, not before
+  return simLptimStartNs + ((scaled + simLsiHz - 1) / simLsiHz);
+}
+
+/** @brief Plans the next compare match of the LPTIM1, it counts from 0 to ARR
+ *         over and over.
+ *  @return Nothing.
+ */
+static void halSim_lptimPlanCompare(void){
+  uint64_t count = (uint64_t) halSimLptim1.CMP + ((uint64_t) simLptimMatches * ((uint64_t) halSimLptim1.ARR + 1));
+  
+  simLptimDueNs = halSim_lptimTimeOfCount(count);
+}
+
+static void halSim_fireLptimCompare(void){
+  simLptimMatches++;
+  halSimLptim1.ISR |= LPTIM_ISR_CMPM;
+  halSim_lptimPlanCompare();
+  if ((halSimLptim1.IER & LPTIM_IER_CMPMIE) != 0){
+    halSim_raiseIrq(LPTIM1_IRQn);
+  }
+}
+
+HAL_StatusTypeDef HAL_LPTIM_Init(LPTIM_HandleTypeDef *hlptim){
+  if (hlptim == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  if (hlptim->State == HAL_LPTIM_STATE_RESET){
+    hlptim->Lock = HAL_UNLOCKED;
+    HAL_LPTIM_MspInit(hlptim);
+  }
+  // The LSI is the only kernel clock of the simulation
+  hlptim->Instance->CFGR = hlptim->Init.Clock.Prescaler & LPTIM_CFGR_PRESC;
+  hlptim->State = HAL_LPTIM_STATE_READY;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LPTIM_DeInit(LPTIM_HandleTypeDef *hlptim){
+  halSim_enter();
+  hlptim->Instance->CR = 0;
+  hlptim->Instance->IER = 0;
+  hlptim->Instance->ISR = 0;
+  simLptimDueNs = HAL_SIM_NEVER;
+  HAL_LPTIM_MspDeInit(hlptim);
+  hlptim->State = HAL_LPTIM_STATE_RESET;
+  halSim_leave();
+  return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_LPTIM_MspInit(LPTIM_HandleTypeDef *hlptim){
+  (void) hlptim;
+}
+
+__attribute__((weak)) void HAL_LPTIM_MspDeInit(LPTIM_HandleTypeDef *hlptim){
+  (void) hlptim;
+}
+
+HAL_StatusTypeDef HAL_LPTIM_TimeOut_Start_IT(LPTIM_HandleTypeDef *hlptim, uint32_t Period, uint32_t Timeout){
+  halSim_enter();
+  hlptim->Instance->CFGR |= LPTIM_CFGR_TIMOUT;
+  hlptim->Instance->IER |= LPTIM_IER_CMPMIE;
+  hlptim->Instance->CR |= LPTIM_CR_ENABLE;
+  hlptim->Instance->ARR = Period & 0xFFFF;
+  hlptim->Instance->CMP = Timeout & 0xFFFF;
+  hlptim->Instance->CR |= LPTIM_CR_CNTSTRT;
+  hlptim->Instance->ISR = 0;
+  simLptimStartNs = simTimeNs;
+  simLptimMatches = 0;
+  halSim_lptimPlanCompare();
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LPTIM_TimeOut_Stop_IT(LPTIM_HandleTypeDef *hlptim){
+  halSim_enter();
+  // Disabling resets the counter
+  hlptim->Instance->CR &= ~LPTIM_CR_ENABLE;
+  hlptim->Instance->CFGR &= ~LPTIM_CFGR_TIMOUT;
+  hlptim->Instance->IER &= ~LPTIM_IER_CMPMIE;
+  hlptim->Instance->CNT = 0;
+  simLptimDueNs = HAL_SIM_NEVER;
+  halSim_leave();
+  return HAL_OK;
+}
+
+uint32_t HAL_LPTIM_ReadCounter(LPTIM_HandleTypeDef *hlptim){
+  uint64_t count;
+  
+  halSim_enter();
+  // Is it counting?
+  if ((hlptim->Instance->CR & LPTIM_CR_ENABLE) != 0){
+    // Yes
+    count = ((simTimeNs - simLptimStartNs) * simLsiHz) / (halSim_lptimPrescaler() * HAL_SIM_NS_PER_S);
+    hlptim->Instance->CNT = (uint32_t) (count % ((uint64_t) hlptim->Instance->ARR + 1));
+  }
+  halSim_leave();
+  return hlptim->Instance->CNT;
+}
+
+void HAL_LPTIM_IRQHandler(LPTIM_HandleTypeDef *hlptim){
+  halSim_enter();
+  if (((hlptim->Instance->ISR & LPTIM_ISR_CMPM) != 0) && ((hlptim->Instance->IER & LPTIM_IER_CMPMIE) != 0)){
+    hlptim->Instance->ISR &= ~LPTIM_ISR_CMPM;
+    HAL_LPTIM_CompareMatchCallback(hlptim);
+  }
+  halSim_leave();
+}
+
+__attribute__((weak)) void HAL_LPTIM_CompareMatchCallback(LPTIM_HandleTypeDef *hlptim){
+  (void) hlptim;
+}
+
+/* ----------------------------------------------------------------- IWDG --- */
+
+static void halSim_fireIwdg(void){
+  // The device resets here, the simulation only notes it and carries on
+  simStatistics.watchdogExpiries++;
+  halSimRcc.CSR |= RCC_CSR_IWDGRSTF;
+  simIwdgDueNs = simTimeNs + simIwdgTimeoutNs;
+}
+
+HAL_StatusTypeDef HAL_IWDG_Init(IWDG_HandleTypeDef *hiwdg){
+  if (hiwdg == NULL){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  hiwdg->Instance->PR = hiwdg->Init.Prescaler;
+  hiwdg->Instance->RLR = hiwdg->Init.Reload;
+  hiwdg->Instance->WINR = hiwdg->Init.Window;
+  simIwdgTimeoutNs = (((uint64_t) hiwdg->Init.Reload + 1) * hiwdg->Init.Prescaler * HAL_SIM_NS_PER_S) / simLsiHz;
+  simIwdgDueNs = simTimeNs + simIwdgTimeoutNs;
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_IWDG_Refresh(IWDG_HandleTypeDef *hiwdg){
+  (void) hiwdg;
+  halSim_enter();
+  simStatistics.watchdogRefreshes++;
+  if (simIwdgDueNs != HAL_SIM_NEVER){
+    simIwdgDueNs = simTimeNs + simIwdgTimeoutNs;
+  }
+  halSim_leave();
+  return HAL_OK;
+}
+
+/* ------------------------------------------------------------------ RCC --- */
+
+void halSim_rcc_setLsiFrequency(uint32_t frequencyHz){
+  simLsiHz = frequencyHz;
+}
+
+static void halSim_rcc_update(void){
+  uint32_t sysclk;
+  
+  switch(simSysclkSource){
+    case RCC_SYSCLKSOURCE_HSI:
+      sysclk = HAL_SIM_HSI_HZ;
+      break;
+    case RCC_SYSCLKSOURCE_PLLCLK:
+      sysclk = (HAL_SIM_HSI_HZ * simPllMul) / simPllDiv;
+      break;
+    default:
+      sysclk = HAL_SIM_MSI_RANGE0_HZ << simMsiRange;
+      break;
+  }
+  SystemCoreClock = sysclk / simAhbDivider;
+  halSim_logPowerState();
+}
+
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct){
+  if ((RCC_OscInitStruct->OscillatorType & RCC_OSCILLATORTYPE_MSI) != 0){
+    simMsiRange = RCC_OscInitStruct->MSIClockRange;
+  }
+  if (RCC_OscInitStruct->PLL.PLLState == RCC_PLL_ON){
+    simPllMul = RCC_OscInitStruct->PLL.PLLMUL;
+    simPllDiv = RCC_OscInitStruct->PLL.PLLDIV;
+  }
+  halSim_rcc_update();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency){
+  (void) FLatency;
+  halSim_enter();
+  if ((RCC_ClkInitStruct->ClockType & RCC_CLOCKTYPE_SYSCLK) != 0){
+    simSysclkSource = RCC_ClkInitStruct->SYSCLKSource;
+  }
+  if ((RCC_ClkInitStruct->ClockType & RCC_CLOCKTYPE_HCLK) != 0){
+    simAhbDivider = RCC_ClkInitStruct->AHBCLKDivider;
+  }
+  if ((RCC_ClkInitStruct->ClockType & RCC_CLOCKTYPE_PCLK1) != 0){
+    simApb1Divider = RCC_ClkInitStruct->APB1CLKDivider;
+  }
+  if ((RCC_ClkInitStruct->ClockType & RCC_CLOCKTYPE_PCLK2) != 0){
+    simApb2Divider = RCC_ClkInitStruct->APB2CLKDivider;
+  }
+  halSim_rcc_update();
+  halSim_leave();
+  return HAL_OK;
+}
+
+void HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t *pFLatency){
+  RCC_ClkInitStruct->ClockType = RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+  RCC_ClkInitStruct->SYSCLKSource = simSysclkSource;
+  RCC_ClkInitStruct->AHBCLKDivider = simAhbDivider;
+  RCC_ClkInitStruct->APB1CLKDivider = simApb1Divider;
+  RCC_ClkInitStruct->APB2CLKDivider = simApb2Divider;
+  *pFLatency = FLASH_LATENCY_0;
+}
+
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit){
+  (void) PeriphClkInit;
+  return HAL_OK;
+}
+
+uint32_t HAL_RCC_GetSysClockFreq(void){
+  return SystemCoreClock * simAhbDivider;
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void){
+  return SystemCoreClock;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void){
+  return SystemCoreClock / simApb1Divider;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void){
+  return SystemCoreClock / simApb2Divider;
+}
+
+/* ------------------------------------------------------------------ PWR --- */
+
+void HAL_PWR_EnterSLEEPMode(uint32_t Regulator, uint8_t SLEEPEntry){
+  (void) Regulator;
+  (void) SLEEPEntry;
+  halSim_enter();
+  halSim_waitForWakeUp(HAL_SIM_POWER_MODE_SLEEP);
+  halSim_leave();
+}
+
+void HAL_PWR_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry){
+  (void) Regulator;
+  (void) STOPEntry;
+  halSim_enter();
+  halSim_waitForWakeUp(HAL_SIM_POWER_MODE_STOP);
+  // The core wakes up on the MSI, the firmware sets its clock tree again
+  simSysclkSource = RCC_SYSCLKSOURCE_MSI;
+  halSim_rcc_update();
+  halSim_leave();
+}
+
+void HAL_PWREx_EnableUltraLowPower(void){
+}
+
+void HAL_PWREx_DisableUltraLowPower(void){
+}
+
+void HAL_PWREx_EnableFastWakeUp(void){
+}
+
+void HAL_PWREx_DisableFastWakeUp(void){
+}
+
+/* --------------------------------------------------------------- EEPROM --- */
+
+static int halSim_eeprom_isValid(uint32_t address, uint32_t size){
+  return (address >= DATA_EEPROM_BASE) && ((address + size - 1) <= DATA_EEPROM_END) && ((address % size) == 0);
+}
+
+uint32_t halSim_eeprom_getWordWrites(uint32_t address){
+  if (halSim_eeprom_isValid(address & ~0x03U, 4) == 0){
+    return 0;
+  }
+  return simEepromWordWrites[(address - DATA_EEPROM_BASE) / 4];
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Unlock(void){
+  simEepromUnlocked = 1;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Lock(void){
+  simEepromUnlocked = 0;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Erase(uint32_t Address){
+  if ((simEepromUnlocked == 0) || (halSim_eeprom_isValid(Address, 4) == 0)){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  *((volatile uint32_t*) (uintptr_t) Address) = 0;
+  simEepromWordWrites[(Address - DATA_EEPROM_BASE) / 4]++;
+  simStatistics.eepromErases++;
+  halSim_runUntil(simTimeNs + HAL_SIM_EEPROM_PROGRAM_NS);
+  halSim_leave();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Program(uint32_t TypeProgram, uint32_t Address, uint32_t Data){
+  uint32_t size;
+  
+  switch(TypeProgram){
+    case FLASH_TYPEPROGRAMDATA_BYTE:
+      size = 1;
+      break;
+    case FLASH_TYPEPROGRAMDATA_HALFWORD:
+      size = 2;
+      break;
+    default:
+      size = 4;
+      break;
+  }
+  if ((simEepromUnlocked == 0) || (halSim_eeprom_isValid(Address, size) == 0)){
+    return HAL_ERROR;
+  }
+  halSim_enter();
+  halSim_dma_write(Address, size, Data);
+  simEepromWordWrites[(Address - DATA_EEPROM_BASE) / 4]++;
+  simStatistics.eepromWrites++;
+  halSim_runUntil(simTimeNs + HAL_SIM_EEPROM_PROGRAM_NS);
+  halSim_leave();
+  return HAL_OK;
+}
+
+/* ----------------------------------------------------------------- Init --- */
+
+/** @brief Maps anonymous memory at a fixed address of the device memory map.
+ *  @return Nothing.
+ */
+static void halSim_mapMemory(uintptr_t address, size_t size, uint8_t fill){
+  void *memory = mmap((void*) address, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  
+  if (memory != (void*) address){
+    printf("HAL SIM: CAN NOT MAP 0x%08lX\r\n", (unsigned long) address);
+    exit(EXIT_FAILURE);
+  }
+  memset(memory, fill, size);
+}
+
+static void halSim_resetPeripherals(void){
+  uint32_t i;
+  
+  for (i = 0; i < HAL_SIM_GPIO_PORT_COUNT; i++){
+    memset(simGpioPorts[i], 0, sizeof(GPIO_TypeDef));
+    // All pins are analog after reset
+    simGpioPorts[i]->MODER = 0xFFFFFFFFU;
+  }
+  memset(simGpioDriven, 0, sizeof(simGpioDriven));
+  memset(simGpioDrivenLevel, 0, sizeof(simGpioDrivenLevel));
+  memset(simGpioPreviousIdr, 0, sizeof(simGpioPreviousIdr));
+  memset(simExtiPort, 0, sizeof(simExtiPort));
+  memset(&halSimExti, 0, sizeof(halSimExti));
+  memset(simPinWatchers, 0, sizeof(simPinWatchers));
+  memset(&halSimUsart1, 0, sizeof(halSimUsart1));
+  memset(&halSimUsart2, 0, sizeof(halSimUsart2));
+  memset(&halSimSpi1, 0, sizeof(halSimSpi1));
+  memset(&halSimDma1, 0, sizeof(halSimDma1));
+  memset(&halSimDma1Csel, 0, sizeof(halSimDma1Csel));
+  memset(halSimDma1Channel, 0, sizeof(halSimDma1Channel));
+  memset(&halSimTim2, 0, sizeof(halSimTim2));
+  memset(&halSimAdc1, 0, sizeof(halSimAdc1));
+  memset(&halSimCrc, 0, sizeof(halSimCrc));
+  memset(&halSimRtc, 0, sizeof(halSimRtc));
+  memset(&halSimLptim1, 0, sizeof(halSimLptim1));
+  memset(&halSimIwdg, 0, sizeof(halSimIwdg));
+  memset(&halSimRcc, 0, sizeof(halSimRcc));
+  memset(&halSimPwr, 0, sizeof(halSimPwr));
+  halSimCrc.POL = DEFAULT_CRC32_POLY;
+  halSimCrc.INIT = DEFAULT_CRC_INITVALUE;
+  halSimCrc.DR = DEFAULT_CRC_INITVALUE;
+  // Power on and pin reset
+  halSimRcc.CSR = RCC_FLAG_PORRST | RCC_FLAG_PINRST;
+  
+  memset(simUart, 0, sizeof(simUart));
+  simUart[0].instance = USART1;
+  simUart[0].irq = USART1_IRQn;
+  simUart[1].instance = USART2;
+  simUart[1].irq = USART2_IRQn;
+  for (i = 0; i < HAL_SIM_UART_COUNT; i++){
+    simUart[i].rxDueNs = HAL_SIM_NEVER;
+    simUart[i].idleDueNs = HAL_SIM_NEVER;
+    simUart[i].txDueNs = HAL_SIM_NEVER;
+  }
+  memset(&simSpi1Bus, 0, sizeof(simSpi1Bus));
+  memset(simDmaHandles, 0, sizeof(simDmaHandles));
+  memset(simDmaReload, 0, sizeof(simDmaReload));
+  memset(simCallbacks, 0, sizeof(simCallbacks));
+  simTim2LastCr1 = 0;
+  simTim2DueNs = HAL_SIM_NEVER;
+  simRtcDueNs = HAL_SIM_NEVER;
+  simRtcPeriodNs = 0;
+  simLptimStartNs = 0;
+  simLptimDueNs = HAL_SIM_NEVER;
+  simLptimMatches = 0;
+  simIwdgDueNs = HAL_SIM_NEVER;
+  simIwdgTimeoutNs = 0;
+  memset(simAdcChannelValue, 0, sizeof(simAdcChannelValue));
+  // VDDA at the 3.0 V of the factory calibration
+  simAdcChannelValue[halSim_adc_channelNumber(ADC_CHANNEL_VREFINT & ADC_CHANNEL_MASK)] = HAL_SIM_VREFINT_CAL;
+  
+  simLsiHz = HAL_SIM_LSI_DEFAULT_HZ;
+  simMsiRange = HAL_SIM_MSI_RESET_RANGE;
+  simPllMul = RCC_PLLMUL_4;
+  simPllDiv = RCC_PLLDIV_2;
+  simSysclkSource = RCC_SYSCLKSOURCE_MSI;
+  simAhbDivider = 1;
+  simApb1Divider = 1;
+  simApb2Divider = 1;
+  halSim_rcc_update();
+  
+  simEepromUnlocked = 0;
+  memset(simEepromWordWrites, 0, sizeof(simEepromWordWrites));
+  memset(simNvicEnabled, 0, sizeof(simNvicEnabled));
+  memset(simNvicPending, 0, sizeof(simNvicPending));
+}
+
+void halSim_init(void){
+  static int memoryMapped = 0;
+  struct itimerval spinWatchTimer;
+  volatile uint16_t *vrefintCal;
+  volatile uint32_t *uid;
+  
+  // Keep the heap in the break segment, in the lower 4 GB
+  mallopt(M_MMAP_MAX, 0);
+  if (memoryMapped == 0){
+    memoryMapped = 1;
+    // The data EEPROM is the .eeprom section of the executable
+    halSim_mapMemory(FLASH_BASE, FLASH_SIZE, 0xFF);
+    halSim_mapMemory(HAL_SIM_SYSTEM_MEMORY_BASE, HAL_SIM_SYSTEM_MEMORY_SIZE, 0x00);
+  }
+  vrefintCal = (volatile uint16_t*) (uintptr_t) VREFINT_CAL_ADDR;
+  *vrefintCal = HAL_SIM_VREFINT_CAL;
+  uid = (volatile uint32_t*) (uintptr_t) UID_BASE;
+  uid[0] = 0x0030002BU;
+  uid[1] = 0x3432510AU;
+  uid[2] = 0x31383436U;
+  
+  simTimeNs = 0;
+  simTickNs = 0;
+  simTickSuspended = 0;
+  simPowerMode = HAL_SIM_POWER_MODE_RUN;
+  simPrimask = 0;
+  simInIsr = 0;
+  simBusy = 0;
+  simEntries = 0;
+  halSim_resetStatistics();
+  halSim_resetPeripherals();
+  
+  signal(SIGVTALRM, halSim_spinWatch);
+  spinWatchTimer.it_interval.tv_sec = 0;
+  spinWatchTimer.it_interval.tv_usec = HAL_SIM_SPIN_WATCH_PERIOD_US;
+  spinWatchTimer.it_value = spinWatchTimer.it_interval;
+  setitimer(ITIMER_VIRTUAL, &spinWatchTimer, NULL);
+}
+
+static void halSim_firmwareTrampoline(void){
+  simFirmwareResult = simFirmwareEntry();
+}
+
+int halSim_runOnFirmwareStack(int (*entry)(void)){
+  void *stack = mmap(NULL, HAL_SIM_FIRMWARE_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+  
+  if (stack == MAP_FAILED){
+    printf("HAL SIM: NO STACK BELOW 4 GB\r\n");
+    exit(EXIT_FAILURE);
+  }
+  simFirmwareEntry = entry;
+  getcontext(&simFirmwareContext);
+  simFirmwareContext.uc_stack.ss_sp = stack;
+  simFirmwareContext.uc_stack.ss_size = HAL_SIM_FIRMWARE_STACK_SIZE;
+  simFirmwareContext.uc_link = &simHostContext;
+  makecontext(&simFirmwareContext, halSim_firmwareTrampoline, 0);
+  swapcontext(&simHostContext, &simFirmwareContext);
+  munmap(stack, HAL_SIM_FIRMWARE_STACK_SIZE);
+  return simFirmwareResult;
+}
@@ -0,0 +1,250 @@
+/**
+  ******************************************************************************
+  * @file       HAL_Sim.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Simulated STM32L051 peripherals behind the HAL stand-in
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | Current model and power state timeline        |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 003       | 2026-10-18    | Tim Steinberg         | Longer power timeline                         |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __HAL_SIM_H
+#define __HAL_SIM_H
+
+/* Includes */
+#include <stdint.h>
+#include "stm32l0xx_hal.h"
+
+/* Typedefinitions */
+
+/** *@brief The power modes the simulation accounts the time for
+  * RUN   = the core executes
+  * SLEEP = the core waits in WFI, the peripherals run
+  * STOP  = everything but the LSI domain (RTC, IWDG) is stopped
+  */
+typedef enum HAL_SIM_POWER_MODE_VALUES {
+  HAL_SIM_POWER_MODE_RUN                = 0x00, /**< Core running */
+  HAL_SIM_POWER_MODE_SLEEP              = 0x01, /**< Sleep mode */
+  HAL_SIM_POWER_MODE_STOP               = 0x02, /**< Stop mode */
+  HAL_SIM_POWER_MODE_COUNT              = 0x03, /**< Count of modes */
+} HAL_SIM_POWER_MODE_VALUES_TYPEDEF;
+
+/** *@brief A device on a simulated SPI bus, selected by a GPIO output */
+typedef struct HAL_SIM_SPI_DEVICE_STRUCT {
+  void          (*select)(void *context);                 /**< Chip select went low */
+  uint8_t       (*exchange)(void *context, uint8_t mosi); /**< One byte full duplex, returns MISO */
+  void          (*deselect)(void *context);               /**< Chip select went high */
+  void          *context;                                 /**< Handed to all methods */
+} HAL_SIM_SPI_DEVICE_STRUCT_TYPEDEF;
+
+/** *@brief Gets called for every level change of a watched output pin */
+typedef void (*HAL_SIM_PIN_WATCHER_TYPEDEF)(void *context, GPIO_PinState level);
+
+/** *@brief Gets called for every byte a UART shifts out */
+typedef void (*HAL_SIM_UART_TX_HOOK_TYPEDEF)(void *context, uint8_t byte);
+
+/** *@brief A callback scheduled on the virtual time line */
+typedef void (*HAL_SIM_TIMED_CALLBACK_TYPEDEF)(void *context);
+
+/** *@brief Counters of the simulated peripherals */
+typedef struct HAL_SIM_STATISTICS_STRUCT {
+  uint64_t      powerModeTimeNs[HAL_SIM_POWER_MODE_COUNT]; /**< Time spent per power mode */
+  uint64_t      powerModeChargePc[HAL_SIM_POWER_MODE_COUNT]; /**< Charge drawn by the core per power mode in pC */
+  uint32_t      wakeUps;                /**< Exits from SLEEP or STOP */
+  uint32_t      interrupts;             /**< Executed interrupt handlers */
+  uint32_t      uartTxBytes[2];         /**< Bytes sent by USART1, USART2 */
+  uint32_t      uartRxBytes[2];         /**< Bytes received by USART1, USART2 */
+  uint32_t      uartRxBytesLost[2];     /**< Bytes overrun or received in STOP */
+  uint32_t      spiTransfers;           /**< HAL_SPI_TransmitReceive calls */
+  uint32_t      spiBytes;               /**< Bytes on the SPI bus */
+  uint32_t      dmaTransfers;           /**< Single DMA data transfers */
+  uint32_t      adcConversions;         /**< ADC conversions */
+  uint32_t      crcWords;               /**< Data units fed to the CRC unit */
+  uint32_t      eepromWrites;           /**< Programmed EEPROM words/halfwords/bytes */
+  uint32_t      eepromErases;           /**< Erased EEPROM words */
+  uint32_t      watchdogRefreshes;      /**< IWDG reloads */
+  uint32_t      watchdogExpiries;       /**< IWDG timeouts, a reset on the device */
+  uint32_t      powerStatesLost;        /**< Power states that did not fit the timeline */
+} HAL_SIM_STATISTICS_STRUCT_TYPEDEF;
+
+/** *@brief The count of power states the timeline keeps */
+#define HAL_SIM_POWER_TIMELINE_LENGTH   8192
+
+/** *@brief An entry of the power state timeline, the state lasts until the
+  *        next entry
+  */
+typedef struct HAL_SIM_POWER_STATE_STRUCT {
+  uint64_t                              timeNs;   /**< Virtual time the state was entered at */
+  HAL_SIM_POWER_MODE_VALUES_TYPEDEF     mode;     /**< The power mode of the core */
+  uint32_t                              hclkHz;   /**< The HCLK, 0 in STOP */
+  uint32_t                              currentNa; /**< The modelled supply current of the core */
+} HAL_SIM_POWER_STATE_STRUCT_TYPEDEF;
+
+/* Variables */
+
+/* Function definitions */
+
+/** @brief This method will map the memories, reset all peripherals and the
+ *         virtual time. Call it before any firmware code.
+ *  @return Nothing.
+ */
+void                            halSim_init(void);
+
+/** @brief This method will run the given function on a stack in the lower
+ *         4 GB, so the firmware can keep pointers in uint32_t.
+ *  @param entry The function to run
+ *  @return The return value of entry.
+ */
+int                             halSim_runOnFirmwareStack(int (*entry)(void));
+
+/** @brief This method will return the virtual time since halSim_init
+ *  @return The time in nanoseconds.
+ */
+uint64_t                        halSim_getTimeNs(void);
+
+/** @brief This method will let the virtual time pass, handling all events
+ *         and interrupts that fall into it. The core counts as running.
+ *  @param durationNs The time to pass
+ *  @return Nothing.
+ */
+void                            halSim_advanceNs(uint64_t durationNs);
+
+/** @brief This method will call the callback once the virtual time reached
+ *         now + delayNs. It runs like an interrupt handler.
+ *  @param delayNs The delay
+ *  @param callback The method to call
+ *  @param *context Handed to the callback
+ *  @return TRUE if scheduled, FALSE if all slots are in use.
+ */
+int                             halSim_scheduleCallback(uint64_t delayNs, HAL_SIM_TIMED_CALLBACK_TYPEDEF callback, void *context);
+
+/** @brief This method will return the counters since halSim_init or the last
+ *         halSim_resetStatistics
+ *  @param *statistics Where to copy the counters to
+ *  @return Nothing.
+ */
+void                            halSim_getStatistics(HAL_SIM_STATISTICS_STRUCT_TYPEDEF *statistics);
+
+/** @brief This method will zero all counters
+ *  @return Nothing.
+ */
+void                            halSim_resetStatistics(void);
+
+/** @brief This method will return the power states since halSim_init or the
+ *         last halSim_resetStatistics. The first entry is the state at the
+ *         reset, a new one is added on every change of the power mode or HCLK.
+ *  @param **entries Will be set to the first entry
+ *  @return The count of entries.
+ */
+uint32_t                        halSim_getPowerTimeline(const HAL_SIM_POWER_STATE_STRUCT_TYPEDEF **entries);
+
+/** @brief This method will return the power mode the core is in
+ *  @return The power mode.
+ */
+HAL_SIM_POWER_MODE_VALUES_TYPEDEF halSim_getPowerMode(void);
+
+/** @brief This method will queue bytes on the RX line of a UART. They arrive
+ *         one after another with the timing of the configured baudrate.
+ *  @param *instance USART1 or USART2
+ *  @param *data The bytes
+ *  @param length The count of bytes
+ *  @return Nothing.
+ */
+void                            halSim_uart_receive(USART_TypeDef *instance, const uint8_t *data, uint32_t length);
+
+/** @brief This method will set the method getting every byte on the TX line
+ *  @param *instance USART1 or USART2
+ *  @param hook The method, NULL for none
+ *  @param *context Handed to the hook
+ *  @return Nothing.
+ */
+void                            halSim_uart_setTxHook(USART_TypeDef *instance, HAL_SIM_UART_TX_HOOK_TYPEDEF hook, void *context);
+
+/** @brief This method will tell if the RX line of a UART has bytes queued
+ *  @param *instance USART1 or USART2
+ *  @return The count of bytes still to arrive.
+ */
+uint32_t                        halSim_uart_getPendingRxBytes(USART_TypeDef *instance);
+
+/** @brief This method will drive an input pin from outside
+ *  @param *port The GPIO port
+ *  @param pin The pin mask
+ *  @param level The level to drive
+ *  @return Nothing.
+ */
+void                            halSim_gpio_driveInput(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState level);
+
+/** @brief This method will return the level an output drives
+ *  @param *port The GPIO port
+ *  @param pin The pin mask
+ *  @return The level.
+ */
+GPIO_PinState                   halSim_gpio_getOutput(GPIO_TypeDef *port, uint16_t pin);
+
+/** @brief This method will call the watcher on every level change of the pin
+ *  @param *port The GPIO port
+ *  @param pin The pin mask
+ *  @param watcher The method
+ *  @param *context Handed to the watcher
+ *  @return TRUE if registered, FALSE if all slots are in use.
+ */
+int                             halSim_gpio_watchPin(GPIO_TypeDef *port, uint16_t pin, HAL_SIM_PIN_WATCHER_TYPEDEF watcher, void *context);
+
+/** @brief This method will put a device on a SPI bus
+ *  @param *instance SPI1
+ *  @param *csPort The port of the chip select
+ *  @param csPin The pin of the chip select
+ *  @param *device The device
+ *  @return Nothing.
+ */
+void                            halSim_spi_attach(SPI_TypeDef *instance, GPIO_TypeDef *csPort, uint16_t csPin, const HAL_SIM_SPI_DEVICE_STRUCT_TYPEDEF *device);
+
+/** @brief This method will set the value an ADC channel converts to
+ *  @param channel An ADC_CHANNEL_x define
+ *  @param value The 12 bit result
+ *  @return Nothing.
+ */
+void                            halSim_adc_setChannelValue(uint32_t channel, uint16_t value);
+
+/** @brief This method will set the frequency of the LSI, which clocks the RTC
+ *         and the IWDG
+ *  @param frequencyHz The frequency
+ *  @return Nothing.
+ */
+void                            halSim_rcc_setLsiFrequency(uint32_t frequencyHz);
+
+/** @brief This method will return how often an EEPROM word was written
+ *  @param address The address within the data EEPROM
+ *  @return The count of programs and erases of the word.
+ */
+uint32_t                        halSim_eeprom_getWordWrites(uint32_t address);
+
+#endif
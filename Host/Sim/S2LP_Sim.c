@@ -0,0 +1,538 @@
+/**
+  ******************************************************************************
+  * @file       S2LP_Sim.c
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Register level model of the S2LP on the simulated SPI
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | Packet handler, TX FIFO and nIRQ on GPIO2     |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 003       | 2026-10-18    | Tim Steinberg         | Oscillator startup after power up and wake    |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 004       | 2026-10-18    | Tim Steinberg         | Brown out of the S2LP                         |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 005       | 2026-10-18    | Tim Steinberg         | Oscillator that does not start                |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+/* Includes */
+#include <string.h>
+#include "main.h"
+#include "HAL_Sim.h"
+#include "S2LP_Sim.h"
+
+/* Typedefinitions / Prototypes */
+
+#define S2LP_SIM_REGISTER_COUNT         256
+#define S2LP_SIM_FIFO_SIZE              128
+
+#define S2LP_SIM_HEADER_WRITE           0x00
+#define S2LP_SIM_HEADER_READ            0x01
+#define S2LP_SIM_HEADER_COMMAND         0x80
+#define S2LP_SIM_FIFO_ADDRESS           0xFF
+
+#define S2LP_SIM_REG_GPIO2_CONF         0x02
+#define S2LP_SIM_REG_MOD4               0x0E
+#define S2LP_SIM_REG_MOD3               0x0F
+#define S2LP_SIM_REG_MOD2               0x10
+#define S2LP_SIM_REG_PCKTCTRL6          0x2B
+#define S2LP_SIM_REG_PCKTCTRL5          0x2C
+#define S2LP_SIM_REG_PCKTCTRL3          0x2E
+#define S2LP_SIM_REG_PCKTCTRL1          0x30
+#define S2LP_SIM_REG_PCKTLEN1           0x31
+#define S2LP_SIM_REG_PCKTLEN0           0x32
+#define S2LP_SIM_REG_SYNC3              0x33
+#define S2LP_SIM_REG_FIFO_CONFIG0       0x3F
+#define S2LP_SIM_REG_IRQ_MASK3          0x50
+#define S2LP_SIM_REG_MC_STATE1          0x8D
+#define S2LP_SIM_REG_MC_STATE0          0x8E
+#define S2LP_SIM_REG_TX_FIFO_STATUS     0x8F
+#define S2LP_SIM_REG_PARTNUM            0xF0
+#define S2LP_SIM_REG_VERSION            0xF1
+#define S2LP_SIM_REG_IRQ_STATUS3        0xFA
+#define S2LP_SIM_REG_IRQ_STATUS0        0xFD
+
+// The digital domain runs on the 50 MHz crystal divided by 2
+#define S2LP_SIM_DIGITAL_CLOCK_HZ       25000000.0
+
+// PCKTCTRL1 TXSOURCE, 0 = the packet handler sends the TX FIFO
+#define S2LP_SIM_TXSOURCE_MASK          0x0C
+// GPIO2_CONF with nIRQ selected as digital output (low or high power)
+#define S2LP_SIM_GPIO_NIRQ_MASK         0xFA
+#define S2LP_SIM_GPIO_NIRQ_OUTPUT       0x02
+
+#define S2LP_SIM_IRQ_TX_DATA_SENT       0x00000004
+#define S2LP_SIM_IRQ_TX_FIFO_ERROR      0x00000020
+#define S2LP_SIM_IRQ_TX_FIFO_ALMOST_EMPTY 0x00000100
+
+// MC_STATE1 with the RC calibration done, MC_STATE0 bit 0 is XO_ON
+#define S2LP_SIM_MC_STATE1_DEFAULT      0x10
+#define S2LP_SIM_MC_STATE0_XO_ON        0x01
+
+// The oscillator needs this long after the power up or a wake up out of
+// STANDBY or SLEEP, the chip shows READY without XO_ON meanwhile
+#define S2LP_SIM_XO_STARTUP_NS          200000ULL
+
+/** *@brief The command strobes */
+typedef enum S2LP_SIM_COMMAND_VALUES {
+  S2LP_SIM_COMMAND_TX                   = 0x60, /**< Start to transmit */
+  S2LP_SIM_COMMAND_RX                   = 0x61, /**< Start to receive */
+  S2LP_SIM_COMMAND_READY                = 0x62, /**< Go to ready */
+  S2LP_SIM_COMMAND_STANDBY              = 0x63, /**< Go to standby */
+  S2LP_SIM_COMMAND_SLEEP                = 0x64, /**< Go to sleep */
+  S2LP_SIM_COMMAND_LOCKRX               = 0x65, /**< Lock the synthesizer for RX */
+  S2LP_SIM_COMMAND_LOCKTX               = 0x66, /**< Lock the synthesizer for TX */
+  S2LP_SIM_COMMAND_SABORT               = 0x67, /**< Abort TX or RX */
+  S2LP_SIM_COMMAND_SRES                 = 0x70, /**< Soft reset */
+  S2LP_SIM_COMMAND_FLUSHRXFIFO          = 0x71, /**< Empty the RX FIFO */
+  S2LP_SIM_COMMAND_FLUSHTXFIFO          = 0x72, /**< Empty the TX FIFO */
+} S2LP_SIM_COMMAND_VALUES_TYPEDEF;
+
+/** *@brief The phase of a SPI transaction */
+typedef enum S2LP_SIM_PHASE_VALUES {
+  S2LP_SIM_PHASE_HEADER                 = 0x00, /**< Expecting the header byte */
+  S2LP_SIM_PHASE_ADDRESS                = 0x01, /**< Expecting address or command */
+  S2LP_SIM_PHASE_DATA                   = 0x02, /**< Data bytes of a read or write */
+  S2LP_SIM_PHASE_DONE                   = 0x03, /**< Command taken, ignore the rest */
+} S2LP_SIM_PHASE_VALUES_TYPEDEF;
+
+static void s2lpSim_select(void *context);
+static uint8_t s2lpSim_exchange(void *context, uint8_t mosi);
+static void s2lpSim_deselect(void *context);
+static void s2lpSim_updateIrq(void);
+
+/* Variables */
+static const HAL_SIM_SPI_DEVICE_STRUCT_TYPEDEF s2lpSimDevice = {
+  s2lpSim_select,
+  s2lpSim_exchange,
+  s2lpSim_deselect,
+  NULL
+};
+
+static uint8_t s2lpSimRegisters[S2LP_SIM_REGISTER_COUNT];
+static uint8_t s2lpSimTxFifo[S2LP_SIM_FIFO_SIZE];
+static uint32_t s2lpSimTxFifoCount;
+static S2LP_SIM_STATE_VALUES_TYPEDEF s2lpSimState;
+static S2LP_SIM_PHASE_VALUES_TYPEDEF s2lpSimPhase;
+static uint8_t s2lpSimHeader;
+static uint8_t s2lpSimAddress;
+static uint32_t s2lpSimBytesInTransaction;
+static uint64_t s2lpSimTxStartNs;
+static S2LP_SIM_STATISTICS_STRUCT_TYPEDEF s2lpSimStatistics;
+
+// The packet handler, a callback of an older packet is recognized by the
+// generation and dropped
+static uint32_t s2lpSimPacketGeneration;
+static uint32_t s2lpSimPacketBytesLeft;
+static uint64_t s2lpSimBitTimeNs;
+static uint32_t s2lpSimIrqStatus;
+static int s2lpSimIrqStatusRead;
+static int s2lpSimNirqLow;
+static uint8_t s2lpSimTxBits[S2LP_SIM_TX_BITS_MAX];
+static uint32_t s2lpSimTxBitCount;
+
+// The oscillator, a startup of an older wake up is recognized by the
+// generation and dropped
+static int s2lpSimXoOn;
+static uint32_t s2lpSimXoGeneration;
+// A broken crystal, the oscillator does not start any more
+static int s2lpSimXoBroken;
+
+/* Function definitions */
+
+static void s2lpSim_setState(S2LP_SIM_STATE_VALUES_TYPEDEF state){
+  uint64_t now = halSim_getTimeNs();
+  
+  if ((s2lpSimState == S2LP_SIM_STATE_TX) && (state != S2LP_SIM_STATE_TX)){
+    s2lpSimStatistics.txTimeNs += now - s2lpSimTxStartNs;
+  }else if ((s2lpSimState != S2LP_SIM_STATE_TX) && (state == S2LP_SIM_STATE_TX)){
+    s2lpSimTxStartNs = now;
+  }
+  s2lpSimState = state;
+  if (state == S2LP_SIM_STATE_SHUTDOWN){
+    return;
+  }
+  s2lpSimRegisters[S2LP_SIM_REG_MC_STATE0] = (uint8_t) ((state << 1) | ((s2lpSimXoOn != 0) ? S2LP_SIM_MC_STATE0_XO_ON : 0x00));
+  s2lpSimRegisters[S2LP_SIM_REG_TX_FIFO_STATUS] = (uint8_t) s2lpSimTxFifoCount;
+}
+
+static void s2lpSim_xoStarted(void *context){
+  if (((uint32_t) (uintptr_t) context != s2lpSimXoGeneration) || (s2lpSimXoBroken != 0)){
+    return;
+  }
+  s2lpSimXoOn = 1;
+  s2lpSim_setState(s2lpSimState);
+}
+
+/** @brief Stops the oscillator, a start schedules it to run after the
+ *         startup time.
+ *  @param start 1 to start it, 0 to stop it
+ *  @return Nothing.
+ */
+static void s2lpSim_xo(int start){
+  s2lpSimXoGeneration++;
+  s2lpSimXoOn = 0;
+  if (start != 0){
+    halSim_scheduleCallback(S2LP_SIM_XO_STARTUP_NS, s2lpSim_xoStarted, (void*) (uintptr_t) s2lpSimXoGeneration);
+  }
+}
+
+/** @brief Puts all registers to their reset values, the configuration of the
+ *         firmware is written over them anyway.
+ *  @return Nothing.
+ */
+static void s2lpSim_reset(void){
+  memset(s2lpSimRegisters, 0, sizeof(s2lpSimRegisters));
+  s2lpSimRegisters[S2LP_SIM_REG_MC_STATE1] = S2LP_SIM_MC_STATE1_DEFAULT;
+  s2lpSimRegisters[S2LP_SIM_REG_PARTNUM] = 0x03;
+  s2lpSimRegisters[S2LP_SIM_REG_VERSION] = 0xC1;
+  s2lpSimTxFifoCount = 0;
+  s2lpSimPacketGeneration++;
+  s2lpSimIrqStatus = 0;
+  s2lpSim_xo(1);
+  s2lpSim_setState(S2LP_SIM_STATE_READY);
+  s2lpSim_updateIrq();
+}
+
+/** @brief Mirrors the interrupt status into IRQ_STATUS and puts nIRQ on
+ *         GPIO2, if it is configured for it. It is low while an enabled
+ *         interrupt is set.
+ *  @return Nothing.
+ */
+static void s2lpSim_updateIrq(void){
+  uint32_t mask;
+  int low;
+  
+  s2lpSimRegisters[S2LP_SIM_REG_IRQ_STATUS3] = (uint8_t) (s2lpSimIrqStatus >> 24);
+  s2lpSimRegisters[S2LP_SIM_REG_IRQ_STATUS3 + 1] = (uint8_t) (s2lpSimIrqStatus >> 16);
+  s2lpSimRegisters[S2LP_SIM_REG_IRQ_STATUS3 + 2] = (uint8_t) (s2lpSimIrqStatus >> 8);
+  s2lpSimRegisters[S2LP_SIM_REG_IRQ_STATUS0] = (uint8_t) s2lpSimIrqStatus;
+  mask = ((uint32_t) s2lpSimRegisters[S2LP_SIM_REG_IRQ_MASK3] << 24) | ((uint32_t) s2lpSimRegisters[S2LP_SIM_REG_IRQ_MASK3 + 1] << 16) | ((uint32_t) s2lpSimRegisters[S2LP_SIM_REG_IRQ_MASK3 + 2] << 8) | s2lpSimRegisters[S2LP_SIM_REG_IRQ_MASK3 + 3];
+  low = ((s2lpSimState != S2LP_SIM_STATE_SHUTDOWN) && ((s2lpSimRegisters[S2LP_SIM_REG_GPIO2_CONF] & S2LP_SIM_GPIO_NIRQ_MASK) == S2LP_SIM_GPIO_NIRQ_OUTPUT) && ((s2lpSimIrqStatus & mask) != 0));
+  // The line is only driven once it was used, it stays high after that
+  if (low != s2lpSimNirqLow){
+    s2lpSimNirqLow = low;
+    halSim_gpio_driveInput(GPO_2_S2LP_GPIO_Port, GPO_2_S2LP_Pin, (low != 0) ? GPIO_PIN_RESET : GPIO_PIN_SET);
+  }
+}
+
+static void s2lpSim_raiseIrq(uint32_t irq){
+  s2lpSimIrqStatus |= irq;
+  s2lpSim_updateIrq();
+}
+
+/** @brief The time of one bit by the data rate of MOD4..MOD2.
+ *  @return The time in nanoseconds.
+ */
+static uint64_t s2lpSim_bitTimeNs(void){
+  uint32_t mantissa = ((uint32_t) s2lpSimRegisters[S2LP_SIM_REG_MOD4] << 8) | s2lpSimRegisters[S2LP_SIM_REG_MOD3];
+  uint32_t exponent = s2lpSimRegisters[S2LP_SIM_REG_MOD2] & 0x0F;
+  double dataRate;
+  
+  if (exponent == 0){
+    dataRate = S2LP_SIM_DIGITAL_CLOCK_HZ * mantissa / 4294967296.0;
+  }else{
+    dataRate = S2LP_SIM_DIGITAL_CLOCK_HZ * (65536.0 + mantissa) * (double) (1U << exponent) / 8589934592.0;
+  }
+  if (dataRate <= 0.0){
+    return 1000000000ULL;
+  }
+  return (uint64_t) ((1000000000.0 / dataRate) + 0.5);
+}
+
+static void s2lpSim_logTxBit(uint8_t bit){
+  if (s2lpSimTxBitCount < S2LP_SIM_TX_BITS_MAX){
+    s2lpSimTxBits[s2lpSimTxBitCount] = bit;
+    s2lpSimTxBitCount++;
+  }
+}
+
+/** @brief Starts a byte of the payload on the air, the FIFO gives it up right
+ *         away. Ends the packet once all bytes were on the air for their time.
+ *  @return Nothing.
+ */
+static void s2lpSim_packetByte(void *context){
+  uint8_t byte;
+  uint8_t threshold = s2lpSimRegisters[S2LP_SIM_REG_FIFO_CONFIG0] & 0x7F;
+  int i;
+  
+  if (((uint32_t) (uintptr_t) context != s2lpSimPacketGeneration) || (s2lpSimState != S2LP_SIM_STATE_TX)){
+    return;
+  }
+  // Is the packet done?
+  if (s2lpSimPacketBytesLeft == 0){
+    // Yes
+    s2lpSimStatistics.packets++;
+    s2lpSim_setState(S2LP_SIM_STATE_READY);
+    s2lpSim_raiseIrq(S2LP_SIM_IRQ_TX_DATA_SENT);
+    return;
+  }
+  // Did the firmware fall behind?
+  if (s2lpSimTxFifoCount == 0){
+    // Yes, the packet is lost
+    s2lpSimStatistics.fifoUnderflows++;
+    s2lpSim_setState(S2LP_SIM_STATE_READY);
+    s2lpSim_raiseIrq(S2LP_SIM_IRQ_TX_FIFO_ERROR);
+    return;
+  }
+  byte = s2lpSimTxFifo[0];
+  s2lpSimTxFifoCount--;
+  memmove(&s2lpSimTxFifo[0], &s2lpSimTxFifo[1], s2lpSimTxFifoCount);
+  s2lpSimRegisters[S2LP_SIM_REG_TX_FIFO_STATUS] = (uint8_t) s2lpSimTxFifoCount;
+  s2lpSimPacketBytesLeft--;
+  for (i = 7; i >= 0; i--){
+    s2lpSim_logTxBit((byte >> i) & 0x01);
+  }
+  halSim_scheduleCallback(8 * s2lpSimBitTimeNs, s2lpSim_packetByte, context);
+  if (s2lpSimTxFifoCount == threshold){
+    s2lpSim_raiseIrq(S2LP_SIM_IRQ_TX_FIFO_ALMOST_EMPTY);
+  }
+}
+
+/** @brief Starts a packet of the basic format: preamble, sync word and the
+ *         payload out of the TX FIFO. There is no CRC, no whitening and no
+ *         length field in this model.
+ *  @return Nothing.
+ */
+static void s2lpSim_packetStart(void){
+  uint32_t preamblePairs = (((uint32_t) s2lpSimRegisters[S2LP_SIM_REG_PCKTCTRL6] & 0x03) << 8) | s2lpSimRegisters[S2LP_SIM_REG_PCKTCTRL5];
+  uint32_t syncBits = s2lpSimRegisters[S2LP_SIM_REG_PCKTCTRL6] >> 2;
+  uint8_t firstBit = ((s2lpSimRegisters[S2LP_SIM_REG_PCKTCTRL3] & 0x03) == 0x01) ? 1 : 0;
+  uint32_t i;
+  
+  s2lpSimPacketGeneration++;
+  s2lpSimPacketBytesLeft = ((uint32_t) s2lpSimRegisters[S2LP_SIM_REG_PCKTLEN1] << 8) | s2lpSimRegisters[S2LP_SIM_REG_PCKTLEN0];
+  s2lpSimBitTimeNs = s2lpSim_bitTimeNs();
+  s2lpSimTxBitCount = 0;
+  for (i = 0; i < preamblePairs; i++){
+    s2lpSim_logTxBit(firstBit);
+    s2lpSim_logTxBit(firstBit ^ 0x01);
+  }
+  // The sync word is sent from SYNC3 on, its highest bit first
+  for (i = 0; i < syncBits; i++){
+    s2lpSim_logTxBit((s2lpSimRegisters[S2LP_SIM_REG_SYNC3 + (i >> 3)] >> (7 - (i & 0x07))) & 0x01);
+  }
+  halSim_scheduleCallback(((2 * preamblePairs) + syncBits) * s2lpSimBitTimeNs, s2lpSim_packetByte, (void*) (uintptr_t) s2lpSimPacketGeneration);
+}
+
+static void s2lpSim_command(uint8_t command){
+  s2lpSimStatistics.commands++;
+  switch(command){
+    case S2LP_SIM_COMMAND_TX:
+      s2lpSim_setState(S2LP_SIM_STATE_TX);
+      // Does the packet handler send the FIFO?
+      if ((s2lpSimRegisters[S2LP_SIM_REG_PCKTCTRL1] & S2LP_SIM_TXSOURCE_MASK) == 0){
+        // Yes, with direct GPIO the firmware does the timing
+        s2lpSim_packetStart();
+      }
+      break;
+    case S2LP_SIM_COMMAND_RX:
+      s2lpSim_setState(S2LP_SIM_STATE_RX);
+      break;
+    case S2LP_SIM_COMMAND_READY:
+    case S2LP_SIM_COMMAND_SABORT:
+      s2lpSimPacketGeneration++;
+      // Does the chip wake up?
+      if ((s2lpSimState == S2LP_SIM_STATE_STANDBY) || (s2lpSimState == S2LP_SIM_STATE_SLEEP)){
+        // Yes, SABORT is ignored there
+        if (command == S2LP_SIM_COMMAND_SABORT){
+          break;
+        }
+        s2lpSim_xo(1);
+      }
+      s2lpSim_setState(S2LP_SIM_STATE_READY);
+      break;
+    case S2LP_SIM_COMMAND_STANDBY:
+      s2lpSim_xo(0);
+      s2lpSim_setState(S2LP_SIM_STATE_STANDBY);
+      break;
+    case S2LP_SIM_COMMAND_SLEEP:
+      s2lpSim_xo(0);
+      s2lpSim_setState(S2LP_SIM_STATE_SLEEP);
+      break;
+    case S2LP_SIM_COMMAND_LOCKRX:
+    case S2LP_SIM_COMMAND_LOCKTX:
+      s2lpSim_setState(S2LP_SIM_STATE_LOCKON);
+      break;
+    case S2LP_SIM_COMMAND_SRES:
+      s2lpSim_reset();
+      break;
+    case S2LP_SIM_COMMAND_FLUSHTXFIFO:
+      s2lpSimTxFifoCount = 0;
+      s2lpSim_setState(s2lpSimState);
+      break;
+    default:
+      break;
+  }
+}
+
+static void s2lpSim_select(void *context){
+  (void) context;
+  s2lpSimPhase = S2LP_SIM_PHASE_HEADER;
+  s2lpSimBytesInTransaction = 0;
+  s2lpSimIrqStatusRead = 0;
+}
+
+static void s2lpSim_deselect(void *context){
+  (void) context;
+  if (s2lpSimBytesInTransaction > 0){
+    s2lpSimStatistics.transactions++;
+  }
+  // Reading IRQ_STATUS clears it, which releases nIRQ. A write may have
+  // changed the mask or the GPIO2 function
+  if (s2lpSimIrqStatusRead != 0){
+    s2lpSimIrqStatus = 0;
+  }
+  if (s2lpSimState != S2LP_SIM_STATE_SHUTDOWN){
+    s2lpSim_updateIrq();
+  }
+}
+
+/** @brief One byte on the bus. The chip shifts out MC_STATE1 and MC_STATE0
+ *         during the header, the register contents during a read.
+ *  @return The MISO byte.
+ */
+static uint8_t s2lpSim_exchange(void *context, uint8_t mosi){
+  uint8_t miso = 0x00;
+  
+  (void) context;
+  // Is the chip powered?
+  if (s2lpSimState == S2LP_SIM_STATE_SHUTDOWN){
+    // No, MISO floats
+    return 0x00;
+  }
+  s2lpSimBytesInTransaction++;
+  switch(s2lpSimPhase){
+    case S2LP_SIM_PHASE_HEADER:
+      miso = s2lpSimRegisters[S2LP_SIM_REG_MC_STATE1];
+      s2lpSimHeader = mosi;
+      s2lpSimPhase = S2LP_SIM_PHASE_ADDRESS;
+      break;
+    case S2LP_SIM_PHASE_ADDRESS:
+      miso = s2lpSimRegisters[S2LP_SIM_REG_MC_STATE0];
+      s2lpSimAddress = mosi;
+      if ((s2lpSimHeader & S2LP_SIM_HEADER_COMMAND) != 0){
+        s2lpSim_command(mosi);
+        s2lpSimPhase = S2LP_SIM_PHASE_DONE;
+      }else{
+        s2lpSimPhase = S2LP_SIM_PHASE_DATA;
+      }
+      break;
+    case S2LP_SIM_PHASE_DATA:
+      if ((s2lpSimHeader & S2LP_SIM_HEADER_READ) != 0){
+        miso = s2lpSimRegisters[s2lpSimAddress];
+        s2lpSimStatistics.registerReads++;
+        if ((s2lpSimAddress >= S2LP_SIM_REG_IRQ_STATUS3) && (s2lpSimAddress <= S2LP_SIM_REG_IRQ_STATUS0)){
+          s2lpSimIrqStatusRead = 1;
+        }
+      }else if (s2lpSimAddress == S2LP_SIM_FIFO_ADDRESS){
+        // The FIFO address does not increment
+        if (s2lpSimTxFifoCount < S2LP_SIM_FIFO_SIZE){
+          s2lpSimTxFifo[s2lpSimTxFifoCount] = mosi;
+          s2lpSimTxFifoCount++;
+          s2lpSimRegisters[S2LP_SIM_REG_TX_FIFO_STATUS] = (uint8_t) s2lpSimTxFifoCount;
+        }
+        s2lpSimStatistics.fifoBytes++;
+        break;
+      }else{
+        s2lpSimRegisters[s2lpSimAddress] = mosi;
+        s2lpSimStatistics.registerWrites++;
+      }
+      s2lpSimAddress++;
+      break;
+    default:
+      break;
+  }
+  return miso;
+}
+
+static void s2lpSim_shutdownWatcher(void *context, GPIO_PinState level){
+  (void) context;
+  if (level != GPIO_PIN_RESET){
+    s2lpSimPacketGeneration++;
+    s2lpSim_xo(0);
+    s2lpSim_setState(S2LP_SIM_STATE_SHUTDOWN);
+    s2lpSim_updateIrq();
+  }else if (s2lpSimState == S2LP_SIM_STATE_SHUTDOWN){
+    s2lpSimStatistics.powerUps++;
+    s2lpSim_reset();
+  }
+}
+
+void s2lpSim_attach(void){
+  memset(&s2lpSimStatistics, 0, sizeof(s2lpSimStatistics));
+  s2lpSimState = S2LP_SIM_STATE_SHUTDOWN;
+  s2lpSimPhase = S2LP_SIM_PHASE_HEADER;
+  s2lpSimIrqStatus = 0;
+  s2lpSimNirqLow = 0;
+  s2lpSimTxBitCount = 0;
+  s2lpSimXoOn = 0;
+  s2lpSimXoGeneration++;
+  s2lpSimXoBroken = 0;
+  halSim_spi_attach(SPI1, GPO_S2LP_CS_GPIO_Port, GPO_S2LP_CS_Pin, &s2lpSimDevice);
+  halSim_gpio_watchPin(GPO_S2LP_SHDWN_GPIO_Port, GPO_S2LP_SHDWN_Pin, s2lpSim_shutdownWatcher, NULL);
+}
+
+static void s2lpSim_brownOut(void *context){
+  (void) context;
+  // Is the chip powered at all?
+  if (s2lpSimState == S2LP_SIM_STATE_SHUTDOWN){
+    // No
+    return;
+  }
+  s2lpSim_reset();
+}
+
+void s2lpSim_brownOutIn(uint64_t delayNs){
+  halSim_scheduleCallback(delayNs, s2lpSim_brownOut, NULL);
+}
+
+void s2lpSim_breakXo(int broken){
+  s2lpSimXoBroken = broken;
+}
+
+S2LP_SIM_STATE_VALUES_TYPEDEF s2lpSim_getState(void){
+  return s2lpSimState;
+}
+
+uint8_t s2lpSim_getRegister(uint8_t address){
+  return s2lpSimRegisters[address];
+}
+
+void s2lpSim_getStatistics(S2LP_SIM_STATISTICS_STRUCT_TYPEDEF *statistics){
+  *statistics = s2lpSimStatistics;
+  if (s2lpSimState == S2LP_SIM_STATE_TX){
+    statistics->txTimeNs += halSim_getTimeNs() - s2lpSimTxStartNs;
+  }
+}
+
+void s2lpSim_resetStatistics(void){
+  memset(&s2lpSimStatistics, 0, sizeof(s2lpSimStatistics));
+  s2lpSimTxStartNs = halSim_getTimeNs();
+}
+
+uint32_t s2lpSim_getTxBits(const uint8_t **bits){
+  *bits = s2lpSimTxBits;
+  return s2lpSimTxBitCount;
+}
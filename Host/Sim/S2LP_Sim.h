@@ -0,0 +1,132 @@
+/**
+  ******************************************************************************
+  * @file       S2LP_Sim.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Register level model of the S2LP on the simulated SPI
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | TX bit log, packet and underflow counters     |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 003       | 2026-10-18    | Tim Steinberg         | Brown out of the S2LP                         |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 004       | 2026-10-18    | Tim Steinberg         | Oscillator that does not start                |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __S2LP_SIM_H
+#define __S2LP_SIM_H
+
+/* Includes */
+#include <stdint.h>
+
+/* Typedefinitions */
+
+// The count of bits the model keeps of the last packet
+#define S2LP_SIM_TX_BITS_MAX                    4096
+
+/** *@brief The main controller states of the S2LP (MC_STATE0 >> 1) */
+typedef enum S2LP_SIM_STATE_VALUES {
+  S2LP_SIM_STATE_READY                  = 0x00, /**< Ready */
+  S2LP_SIM_STATE_SLEEP_NOFIFO           = 0x01, /**< Sleep, FIFO lost */
+  S2LP_SIM_STATE_STANDBY                = 0x02, /**< Standby */
+  S2LP_SIM_STATE_SLEEP                  = 0x03, /**< Sleep, FIFO kept */
+  S2LP_SIM_STATE_LOCKON                 = 0x0C, /**< Synthesizer locked */
+  S2LP_SIM_STATE_RX                     = 0x30, /**< Receiving */
+  S2LP_SIM_STATE_LOCK_ST                = 0x14, /**< Locking for TX */
+  S2LP_SIM_STATE_TX                     = 0x5C, /**< Transmitting */
+  S2LP_SIM_STATE_SYNTH_SETUP            = 0x50, /**< Synthesizer setup */
+  S2LP_SIM_STATE_SHUTDOWN               = 0xFF, /**< SDN high, not a state of the chip */
+} S2LP_SIM_STATE_VALUES_TYPEDEF;
+
+/** *@brief Counters of the S2LP model */
+typedef struct S2LP_SIM_STATISTICS_STRUCT {
+  uint32_t      transactions;           /**< Chip select cycles */
+  uint32_t      registerWrites;         /**< Written register bytes */
+  uint32_t      registerReads;          /**< Read register bytes */
+  uint32_t      commands;               /**< Command strobes */
+  uint32_t      fifoBytes;              /**< Bytes written into the TX FIFO */
+  uint32_t      powerUps;               /**< SDN releases */
+  uint64_t      txTimeNs;               /**< Time spent in TX */
+  uint32_t      packets;                /**< Packets the packet handler completed */
+  uint32_t      fifoUnderflows;         /**< Packets lost by an empty TX FIFO */
+} S2LP_SIM_STATISTICS_STRUCT_TYPEDEF;
+
+/* Variables */
+
+/* Function definitions */
+
+/** @brief This method will put the S2LP on SPI1 with its chip select and
+ *         shutdown pins. The chip starts in shutdown.
+ *  @return Nothing.
+ */
+void                            s2lpSim_attach(void);
+
+/** @brief This method will return the state of the main controller
+ *  @return The state.
+ */
+S2LP_SIM_STATE_VALUES_TYPEDEF   s2lpSim_getState(void);
+
+/** @brief This method will return the content of a register
+ *  @param address The register address
+ *  @return The register content.
+ */
+uint8_t                         s2lpSim_getRegister(uint8_t address);
+
+/** @brief This method will return the counters since the attach or the last
+ *         s2lpSim_resetStatistics
+ *  @param *statistics Where to copy the counters to
+ *  @return Nothing.
+ */
+void                            s2lpSim_getStatistics(S2LP_SIM_STATISTICS_STRUCT_TYPEDEF *statistics);
+
+/** @brief This method will zero all counters
+ *  @return Nothing.
+ */
+void                            s2lpSim_resetStatistics(void);
+
+/** @brief This method will give the bits the packet handler put on the air
+ *         with the last packet: preamble, sync word and payload
+ *  @param **bits Will point to the bits, one per byte
+ *  @return The count of bits.
+ */
+uint32_t                        s2lpSim_getTxBits(const uint8_t **bits);
+
+/** @brief This method will reset the chip after the delay, like a dip of its
+ *         supply does. The registers get their reset values, a packet on the
+ *         air is lost and nIRQ isn't driven any more.
+ *  @param delayNs The delay
+ *  @return Nothing.
+ */
+void                            s2lpSim_brownOutIn(uint64_t delayNs);
+
+/** @brief This method will keep the oscillator from starting from its next
+ *         start on, the chip never gets READY with XO_ON then
+ *  @param broken 1 to break it, 0 to repair it
+ *  @return Nothing.
+ */
+void                            s2lpSim_breakXo(int broken);
+
+#endif
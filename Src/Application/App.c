@@ -25,13 +25,15 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Flash check in portions per wake              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-17    | Tim Steinberg         | Rebuild the EEPROM log index at boot          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Include names match the file names            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Prepare the 868 MHz frames at boot            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Notes instead of #warning                     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -51,12 +53,13 @@
 #include "Led.h"
 #include "GPIO.h"
 #include "EEPROM_ApplicationMapped.h"
+#include "EEPROM_Log.h"
 #include "RTC.h"
 #include "ADC.h"
 #include "Watchdog.h"
 #include "App_Misc.h"
 #include "App_868MHz.h"
-#include "App_RSL_Interaction_Broadcast.h"
+#include "APP_RSL_Interaction_Broadcast.h"
 #include "App_RSL_Interaction_Emergency.h"
 #include "App_RSL_Interaction_Pairing.h"
 #include "App_Misc.h"
@@ -66,12 +69,29 @@
 
 /* Typedefinitions / Prototypes */
 void app_TXV2_checkIntegrity(void);
+void app_TXV2_checkIntegrityFull(void);
 
 /* Variables */
 
 /* Function definitions */
+// Used on every wake: the flash is checked in portions of
+// FLASHCHECK_PAGES_PER_WAKE pages, the verdict comes with the end of a pass
 void app_TXV2_checkIntegrity(void){
   watchdog_feed();
+  if (flashCheck_ScanStep(FLASHCHECK_PAGES_PER_WAKE) == FLASHCHECK_SCAN_FAILED){
+    Error_SetError_FlashCorrupt();
+  }
+  
+  watchdog_feed();
+  if (eepromCheck_CheckEEPROMCRC() == FALSE){
+    Error_SetError_EEPCorrupt();
+  }
+}
+
+// Used at boot and after a watchdog reset: the whole flash at once
+void app_TXV2_checkIntegrityFull(void){
+  watchdog_feed();
+  flashCheck_ScanRestart();
   if (flashCheck_CheckFlashCRC() == FALSE){
     Error_SetError_FlashCorrupt();
   }
@@ -89,6 +109,12 @@ void app_TXV2_boot(void){
   watchdog_feed();
   gpio_userButtonUnarmedMode();
   watchdog_feed();
+  // Rebuild the index of the EEPROM log before anyone reads the counters
+  eepromLog_init();
+  watchdog_feed();
+  // Build the 868 MHz frames while nothing waits for them
+  app_868mhz_prepareFrames();
+  watchdog_feed();
   
   txInterpreter_DoTestMode();
   // pin dearm
@@ -108,8 +134,8 @@ void app_TXV2_boot(void){
   // -> LSI not calibrated
   
   // Check the integrity of the whole system
-  //app_TXV2_checkIntegrity();
-#warning "SECURITY SUBSYSTEM DISABLED BY COMMENTING THIS"
+  //app_TXV2_checkIntegrityFull();
+// SECURITY SUBSYSTEM DISABLED BY COMMENTING THIS
   
   switch(bootsource){
     
@@ -127,6 +153,9 @@ void app_TXV2_boot(void){
       // The watchdog led to a restart. TxV2 was hanging somewhere
       watchdog_feed();
       app_misc_error_maskInNewErrorcode(ERRORCODES_WD_TRIGGERED);
+      
+      // Whatever hung might have been the flash, don't wait for the scan
+      app_TXV2_checkIntegrityFull();
   
       led_turquoise();
       HAL_Delay(400);
@@ -165,7 +194,7 @@ void app_TXV2_boot(void){
       watchdog_feed();
       
       // Do a 868 MHz action
-#warning "KEEP THIS RIGHT"
+// KEEP THIS RIGHT
       if (eeprom_getBatteryValue() < 1){
         // Send battery low state
         app_868mhz_transmitMessage(FALSE, TRUE);
@@ -266,7 +295,7 @@ void app_TXV2_main(void){
   eeprom_setBatteryValue((uint8_t) batterylevel_getPercentage());
   watchdog_feed();
     
-  #warning "RAPHAELS 868 MHZ PART BATTERY"
+  // RAPHAELS 868 MHZ PART BATTERY
   
   // If not paired, then don't do bluetooth
   if (eeprom_getPairingState() == TRUE){
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-11    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Sequences of a flow share one link            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -60,7 +60,7 @@ typedef enum APP_RSL_INTERACTION_BROADCAST_STATES{
 /* Function definitions */
 APP_RSL_INTERACTION_BROADCAST_STATES_TYPEDEF broadcastStatemachine;
 
-void app_rsl_interaction_broadcast_main(void){ 
+static void app_rsl_interaction_broadcast_statemachine(void){
   uint32_t stateRetryCounter;
   bool afterBroadcastUpdateState = TRUE;
   USERMETHODS_CHARACTERISTICS_TRANSMISSION_STATE_TYPEDEF retVal;
@@ -216,4 +216,11 @@ void app_rsl_interaction_broadcast_main(void){
         
     }
   }while(1);
+}
+
+void app_rsl_interaction_broadcast_main(void){
+  // The sequences of the flow share one link
+  app_rsl_session_begin();
+  app_rsl_interaction_broadcast_statemachine();
+  app_rsl_session_end();
 }
\ No newline at end of file
@@ -25,13 +25,17 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Message kept packed, 1.8 KB RAM less          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Burst out of the S2LP TX FIFO                 |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | STOP mode between the bursts, testsuite       |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Cached frames per flag variant                |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Switch the S2LP off after a failed burst      |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Test traces the alarm, no unused variable     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -39,37 +43,95 @@
 /* Includes */
 #include "MasterDefine.h"
 #include "Runmode_Awake.h"
+#include "Runmode_Sleep.h"
 #include "GPIO.h"
 #include "Watchdog.h"
 #include "EEPROM_ApplicationMapped.h"
 #include "S2LP.h"
+#include "CRC.h"
 #include "App_868MHz_MessageBuilder.h"
 #include "App_868MHz_Sequencer.h"
+#include "App_868MHz.h"
+
+#if (TEST_APP_868MHZ >= 1) && defined(HOST_BUILD)
+#include <string.h>
+#include "Debug.h"
+#include "HAL_Sim.h"
+#include "S2LP_Sim.h"
+#endif
 
 /* Typedefinitions / Prototypes */
 
+// The pause between the three bursts of an alarm
+#define APP_868MHZ_INTER_MESSAGE_DELAY_MS               800
+
+// The flag byte of an emergency message
+#define APP_868MHZ_FLAGS_BATTERY_LOW                    0x80
+#define APP_868MHZ_FLAGS_ALERT                          0x01 // 0x01 = "Alarm Button", 0x0F = "TxV2"
+#define APP_868MHZ_FLAGS_NO_ALERT                       0x71
+
+// Only the flags change between the emergency messages of a device, so there
+// is one cached frame per combination of them
+#define APP_868MHZ_FRAME_VARIANT_ALERT                  0x01
+#define APP_868MHZ_FRAME_VARIANT_BATTERY_LOW            0x02
+#define APP_868MHZ_FRAME_VARIANTS                       4
+#define APP_868MHZ_FRAME_WORDS                          BITENCODER_WORDS_FOR_BITS(APP_868MHZ_SEQUENCER_MAX_STEPS)
+
+/**
+ * @brief An encoded emergency message (header, stuffing, CRC16 and NRZ-I
+ *        done), ready for the sequencer. The RAM keeps it over the STOP
+ *        phases, the checksum finds it if it got lost anyway.
+ */
+typedef struct APP_868MHZ_FRAME_STRUCT {
+  uint32_t uID;                                 /**< The UID the frame is built for */
+  uint32_t countOfBitsUsed;                     /**< The length of the frame in bits, 0 if never built */
+  uint32_t words[APP_868MHZ_FRAME_WORDS];       /**< The bits, packed like the BITENCODER does */
+  uint32_t checksum;                            /**< CRC32 MPEG2 of all words in front of it */
+} APP_868MHZ_FRAME_STRUCT_TYPEDEF;
+
+// The count of words the checksum covers
+#define APP_868MHZ_FRAME_CHECKSUM_WORDS                 ((sizeof(APP_868MHZ_FRAME_STRUCT_TYPEDEF) / sizeof(uint32_t)) - 1)
+
 /* Variables */
-bitfieldTimed bitArrayPreamble[2];
-bitfield bitsPreamble = {
-  .bitsToSend = bitArrayPreamble,
-  .countOfBits = 16,
+// The bits are kept packed, the sequencer gives every bit its 400 us when it
+// builds the schedules
+uint32_t wordsPreamble[1];
+BITENCODER_STRUCT_TYPEDEF bitsPreamble = {
+  .words = wordsPreamble,
+  .countOfWords = 1,
   .countOfBitsUsed = 0,
 };
 
-bitfieldTimed bitArrayMessage[100];
-bitfield bitsMessage = {
-  .bitsToSend = bitArrayMessage,
-  .countOfBits = 100,
+uint32_t wordsMessage[BITENCODER_WORDS_FOR_BITS(APP_868MHZ_SEQUENCER_MAX_STEPS)];
+BITENCODER_STRUCT_TYPEDEF bitsMessage = {
+  .words = wordsMessage,
+  .countOfWords = BITENCODER_WORDS_FOR_BITS(APP_868MHZ_SEQUENCER_MAX_STEPS),
   .countOfBitsUsed = 0,
 };
 
-void app_868mhz_s2lp_setupWorking(void){
-  S2LP_SetConfig_WorkingMode();
+#if APP_868MHZ_SEQUENCER_OUTPUT_FIFO < 1
+APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF schedulePreamble;
+APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF scheduleMessage;
+#endif
+
+static APP_868MHZ_FRAME_STRUCT_TYPEDEF frameCache[APP_868MHZ_FRAME_VARIANTS];
+// The count of frames built into the cache
+static uint32_t frameCacheBuilds;
+
+bool app_868mhz_s2lp_setupWorking(void){
+  bool retVal;
+  
+#if APP_868MHZ_SEQUENCER_OUTPUT_FIFO >= 1
+  retVal = S2LP_SetConfig_PacketMode();
+#else
+  retVal = S2LP_SetConfig_WorkingMode();
+#endif
    
   // ENTERING CRITICAL SECTION
   watchdog_feed();
   //__disable_irq();
   
+  return retVal;
 }
 
 void app_868mhz_s2lp_setupShutdown(void){
@@ -81,87 +143,155 @@ void app_868mhz_s2lp_setupShutdown(void){
 }
 
 void interMessageDelay(void){
-  runmode_awake_configClocktreeMidspeed();
-  HAL_Delay(800);
+  // The S2LP waits in STANDBY with its registers, the core stops until the
+  // RTC wakes it up on the MSI
+  runmode_sleep_stopForMilliseconds(APP_868MHZ_INTER_MESSAGE_DELAY_MS);
   runmode_awake_configClocktreeHighspeedHSI();
 }
 
-static void app_868mhz_slip(){
-  watchdog_feed();
-  app_868mhz_s2lp_setupWorking();
-  
-  app_868MHz_sequencer_output(&bitsPreamble); 
+static void app_868mhz_slip(const BITENCODER_STRUCT_TYPEDEF *frame){
+  APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF retVal = APP_868MHZ_SEQUENCER_RETURN_OK;
   
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
+  watchdog_feed();
+  // Did the S2LP get READY?
+  if (app_868mhz_s2lp_setupWorking() == FALSE){
+    // No, it is shut down already, there is nothing to send the burst with
+    S2LP_SetConfig_OffMode();
+    return;
+  }
   
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage); 
-  app_868MHz_sequencer_output(&bitsMessage);
+  // Preamble once, followed by the message 19 times without any gap
+#if APP_868MHZ_SEQUENCER_OUTPUT_FIFO >= 1
+  // The S2LP puts the preamble (0x55) in front by itself
+  retVal = app_868MHz_sequencer_outputFifo(frame, 19);
+#else
+  app_868MHz_sequencer_output(&schedulePreamble, &scheduleMessage, 19);
+#endif
   
   watchdog_feed();
+  // Did the burst get through?
+  if (retVal != APP_868MHZ_SEQUENCER_RETURN_OK){
+    // No, the S2LP may have lost its configuration. Switch it off, so the
+    // next burst starts it cold and writes everything again
+    S2LP_SetConfig_OffMode();
+    return;
+  }
   app_868mhz_s2lp_setupShutdown();
 }
 
+static void app_868mhz_buildSchedules(const BITENCODER_STRUCT_TYPEDEF *frame){
+#if APP_868MHZ_SEQUENCER_OUTPUT_FIFO < 1
+  app_868MHz_buildMessage_preamblePacked(&bitsPreamble);
+  app_868MHz_sequencer_buildSchedulePacked(&bitsPreamble, &schedulePreamble);
+  app_868MHz_sequencer_buildSchedulePacked(frame, &scheduleMessage);
+#endif
+}
+
+/** @brief Gives the checksum of a cached frame
+ *  @param *cached The frame
+ *  @return The CRC32 MPEG2 of everything in front of the checksum.
+ */
+static uint32_t app_868mhz_frameChecksum(APP_868MHZ_FRAME_STRUCT_TYPEDEF *cached){
+  return crc_calcCrc32_MPEG2((uint32_t*) cached, APP_868MHZ_FRAME_CHECKSUM_WORDS);
+}
+
+/** @brief Builds the emergency message of a variant into the cache
+ *  @param variant The APP_868MHZ_FRAME_VARIANT_x flags
+ *  @param uID The UID of the device
+ *  @return Nothing.
+ */
+static void app_868mhz_buildFrame(uint32_t variant, uint32_t uID){
+  APP_868MHZ_FRAME_STRUCT_TYPEDEF *cached = &frameCache[variant];
+  BITENCODER_STRUCT_TYPEDEF bits;
+  uint8_t messageField[7];
+  
+  messageField[0] = 0x7E;
+  messageField[1] = 0x00;
+  if ((variant & APP_868MHZ_FRAME_VARIANT_BATTERY_LOW) != 0){
+    messageField[1] = APP_868MHZ_FLAGS_BATTERY_LOW;
+  }
+  if ((variant & APP_868MHZ_FRAME_VARIANT_ALERT) != 0){
+    messageField[1] |= APP_868MHZ_FLAGS_ALERT;
+  }else{
+    messageField[1] |= APP_868MHZ_FLAGS_NO_ALERT;
+  }
+  messageField[2] = (uint8_t)((uID & 0xFF));
+  messageField[3] = (uint8_t)((uID >> 8) & 0xFF);
+  messageField[4] = (uint8_t)((uID >> 16) & 0xFF);
+  messageField[5] = (uint8_t)((uID >> 24) & 0xFF);
+  messageField[6] = 0x00;
+  
+  bitEncoder_init(&bits, cached->words, APP_868MHZ_FRAME_WORDS);
+  app_868MHz_buildMessage_emergencyPacked(messageField, 7, &bits);
+  cached->uID = uID;
+  cached->countOfBitsUsed = bits.countOfBitsUsed;
+  cached->checksum = app_868mhz_frameChecksum(cached);
+  frameCacheBuilds++;
+}
+
+/** @brief Gives the encoded emergency message of a variant. It comes out of
+ *         the cache and only gets built if the cache has no intact frame for
+ *         the UID of the device.
+ *  @param variant The APP_868MHZ_FRAME_VARIANT_x flags
+ *  @param *frame Will be set to the frame, it points into the cache
+ *  @return Nothing.
+ */
+static void app_868mhz_getFrame(uint32_t variant, BITENCODER_STRUCT_TYPEDEF *frame){
+  APP_868MHZ_FRAME_STRUCT_TYPEDEF *cached = &frameCache[variant];
+  uint32_t uID = eeprom_getUID();
+  
+  // Is the cached frame built for this UID and still intact?
+  if ((cached->countOfBitsUsed == 0) || (cached->uID != uID) || (cached->checksum != app_868mhz_frameChecksum(cached))){
+    // No, build it again
+    app_868mhz_buildFrame(variant, uID);
+  }
+  frame->words = cached->words;
+  frame->countOfWords = APP_868MHZ_FRAME_WORDS;
+  frame->countOfBitsUsed = cached->countOfBitsUsed;
+}
+
+void app_868mhz_prepareFrames(void){
+  BITENCODER_STRUCT_TYPEDEF frame;
+  
+  for (uint32_t variant = 0; variant < APP_868MHZ_FRAME_VARIANTS; variant++){
+    app_868mhz_getFrame(variant, &frame);
+  }
+}
+
 void app_868mhz_transmitDynamicMessage(uint8_t *message){
   watchdog_feed();
-  app_868MHz_buildMessage_preamble(&bitsPreamble);
-  app_868MHz_buildMessage_emergency(message, 7, &bitsMessage);
+  app_868MHz_buildMessage_emergencyPacked(message, 7, &bitsMessage);
+  app_868mhz_buildSchedules(&bitsMessage);
   
-  app_868mhz_slip();
+  app_868mhz_slip(&bitsMessage);
   interMessageDelay();
-  app_868mhz_slip();
+  app_868mhz_slip(&bitsMessage);
   interMessageDelay();
-  app_868mhz_slip();
+  app_868mhz_slip(&bitsMessage);
 }
   
 /* Function definitions */
 void app_868mhz_transmitMessage(BOOLEAN alertOnOff, BOOLEAN batteryLow){
-  uint8_t messageField[7];
-  uint32_t uID;
+  BITENCODER_STRUCT_TYPEDEF frame;
+  uint32_t variant = 0;
       
   /* REAL VALUES ASSIGNMENT */
   watchdog_feed();
   
-  messageField[0] = 0x7E;
-  if (batteryLow == TRUE){
-    messageField[1] = 0x80;
-  }
   if (alertOnOff == TRUE){
-    messageField[1] |= 0x01; //messageField[1] |= 0x0F; //0x01 = "Alarm Button", 0x0F = "TxV2"
-  }else{
-    messageField[1] |= 0x71;
+    variant |= APP_868MHZ_FRAME_VARIANT_ALERT;
   }
-  uID = eeprom_getUID();
-  messageField[2] = (uint8_t)((uID & 0xFF));
-  messageField[3] = (uint8_t)((uID >> 8) & 0xFF);
-  messageField[4] = (uint8_t)((uID >> 16) & 0xFF);
-  messageField[5] = (uint8_t)((uID >> 24) & 0xFF);
-  messageField[6] = 0x00;
-
-  watchdog_feed();
-  app_868MHz_buildMessage_preamble(&bitsPreamble);
-  app_868MHz_buildMessage_emergency(messageField, 7, &bitsMessage);
+  if (batteryLow == TRUE){
+    variant |= APP_868MHZ_FRAME_VARIANT_BATTERY_LOW;
+  }
+  app_868mhz_getFrame(variant, &frame);
+  app_868mhz_buildSchedules(&frame);
   
-  app_868mhz_slip();
+  app_868mhz_slip(&frame);
   interMessageDelay();
-  app_868mhz_slip();
+  app_868mhz_slip(&frame);
   interMessageDelay();
-  app_868mhz_slip();
+  app_868mhz_slip(&frame);
   
   /*  
   do{
@@ -297,4 +427,169 @@ void app_868MHz_test_Mixed(void){
     }
     HAL_Delay(3000);
   }
-}
\ No newline at end of file
+}
+
+#if TEST_APP_868MHZ >= 1
+#if defined(HOST_BUILD)
+/** @brief Sums up the charge of all power modes since the last reset of the
+ *         statistics
+ *  @return The charge in pC.
+ */
+static uint64_t app_868mhz_test_chargePc(void){
+  HAL_SIM_STATISTICS_STRUCT_TYPEDEF statistics;
+  uint64_t charge = 0;
+  
+  halSim_getStatistics(&statistics);
+  for (int i = 0; i < HAL_SIM_POWER_MODE_COUNT; i++){
+    charge += statistics.powerModeChargePc[i];
+  }
+  return charge;
+}
+
+/** @brief Counts the STOP phases on the power timeline, that last at least
+ *         the given time
+ *  @param minimumNs The shortest STOP phase to count
+ *  @return The count of STOP phases.
+ */
+static uint32_t app_868mhz_test_countStops(uint64_t minimumNs){
+  const HAL_SIM_POWER_STATE_STRUCT_TYPEDEF *entries;
+  uint32_t countOfEntries;
+  uint32_t countOfStops = 0;
+  
+  countOfEntries = halSim_getPowerTimeline(&entries);
+  for (uint32_t i = 0; (i + 1) < countOfEntries; i++){
+    if ((entries[i].mode == HAL_SIM_POWER_MODE_STOP) && ((entries[i + 1].timeNs - entries[i].timeNs) >= minimumNs)){
+      countOfStops++;
+    }
+  }
+  return countOfStops;
+}
+#endif
+
+int app_868MHz_testsuite(){
+#if defined(HOST_BUILD)
+  S2LP_SIM_STATISTICS_STRUCT_TYPEDEF s2lpStatistics;
+  HAL_SIM_STATISTICS_STRUCT_TYPEDEF statistics;
+  uint64_t chargeBusyPc;
+  uint64_t chargeStopPc;
+  uint64_t startNs;
+  uint32_t hclkHz;
+  BITENCODER_STRUCT_TYPEDEF frame;
+  uint8_t messageField[7];
+  uint32_t uID;
+  uint32_t expectedWord;
+  
+  // The former pause: the core busy waits on the midspeed clock
+  halSim_resetStatistics();
+  startNs = halSim_getTimeNs();
+  runmode_awake_configClocktreeMidspeed();
+  HAL_Delay(APP_868MHZ_INTER_MESSAGE_DELAY_MS);
+  runmode_awake_configClocktreeHighspeedHSI();
+  chargeBusyPc = app_868mhz_test_chargePc();
+  hclkHz = SystemCoreClock;
+  if ((halSim_getTimeNs() - startNs) < (APP_868MHZ_INTER_MESSAGE_DELAY_MS * 1000000ULL)){
+    return -1;
+  }
+  
+  // The pause after a burst stops the core, the S2LP stays in STANDBY and
+  // nothing talks to it
+  S2LP_SetConfig_OffMode();
+  app_868mhz_slip(&bitsMessage);
+  halSim_resetStatistics();
+  s2lpSim_resetStatistics();
+  startNs = halSim_getTimeNs();
+  interMessageDelay();
+  chargeStopPc = app_868mhz_test_chargePc();
+  halSim_getStatistics(&statistics);
+  s2lpSim_getStatistics(&s2lpStatistics);
+  if ((halSim_getTimeNs() - startNs) < ((APP_868MHZ_INTER_MESSAGE_DELAY_MS - 10) * 1000000ULL) || ((halSim_getTimeNs() - startNs) > ((APP_868MHZ_INTER_MESSAGE_DELAY_MS + 50) * 1000000ULL))){
+    S2LP_SetConfig_OffMode();
+    return -2;
+  }
+  if ((app_868mhz_test_countStops((APP_868MHZ_INTER_MESSAGE_DELAY_MS - 10) * 1000000ULL) != 1) || (statistics.powerStatesLost != 0)){
+    S2LP_SetConfig_OffMode();
+    return -3;
+  }
+  if ((s2lpSim_getState() != S2LP_SIM_STATE_STANDBY) || (s2lpStatistics.registerWrites != 0)){
+    S2LP_SetConfig_OffMode();
+    return -4;
+  }
+  // Back on the clock of the awake mode
+  if ((halSim_getPowerMode() != HAL_SIM_POWER_MODE_RUN) || (SystemCoreClock != hclkHz)){
+    S2LP_SetConfig_OffMode();
+    return -5;
+  }
+  if ((chargeStopPc * 100) >= chargeBusyPc){
+    S2LP_SetConfig_OffMode();
+    return -6;
+  }
+  
+  // A whole alarm out of shutdown: one cold start, the later bursts wake the
+  // S2LP out of STANDBY
+  S2LP_SetConfig_OffMode();
+  halSim_resetStatistics();
+  s2lpSim_resetStatistics();
+  app_868mhz_transmitMessage(TRUE, FALSE);
+  // The charge of the core at 3 V, 1 uC = 3 uJ
+  TRACE_TEST_VALUES(1, "868MHZ ALARM %i UC", (int) (app_868mhz_test_chargePc() / 1000000ULL));
+  s2lpSim_getStatistics(&s2lpStatistics);
+  if (app_868mhz_test_countStops((APP_868MHZ_INTER_MESSAGE_DELAY_MS - 10) * 1000000ULL) != 2){
+    S2LP_SetConfig_OffMode();
+    return -7;
+  }
+  if ((s2lpStatistics.powerUps != 1) || (s2lpSim_getState() != S2LP_SIM_STATE_STANDBY)){
+    S2LP_SetConfig_OffMode();
+    return -8;
+  }
+  S2LP_SetConfig_OffMode();
+  
+  // The cache holds the same frames the message builder gives, each built once
+  memset(frameCache, 0, sizeof(frameCache));
+  frameCacheBuilds = 0;
+  app_868mhz_prepareFrames();
+  app_868mhz_prepareFrames();
+  if (frameCacheBuilds != APP_868MHZ_FRAME_VARIANTS){
+    return -9;
+  }
+  uID = eeprom_getUID();
+  for (uint32_t variant = 0; variant < APP_868MHZ_FRAME_VARIANTS; variant++){
+    messageField[0] = 0x7E;
+    messageField[1] = ((variant & APP_868MHZ_FRAME_VARIANT_BATTERY_LOW) != 0) ? 0x80 : 0x00;
+    messageField[1] |= ((variant & APP_868MHZ_FRAME_VARIANT_ALERT) != 0) ? 0x01 : 0x71;
+    messageField[2] = (uint8_t)((uID & 0xFF));
+    messageField[3] = (uint8_t)((uID >> 8) & 0xFF);
+    messageField[4] = (uint8_t)((uID >> 16) & 0xFF);
+    messageField[5] = (uint8_t)((uID >> 24) & 0xFF);
+    messageField[6] = 0x00;
+    app_868MHz_buildMessage_emergencyPacked(messageField, 7, &bitsMessage);
+    app_868mhz_getFrame(variant, &frame);
+    if ((frame.countOfBitsUsed != bitsMessage.countOfBitsUsed) || (memcmp(frame.words, bitsMessage.words, BITENCODER_WORDS_FOR_BITS(frame.countOfBitsUsed) * sizeof(uint32_t)) != 0)){
+      return -10;
+    }
+  }
+  if (frameCacheBuilds != APP_868MHZ_FRAME_VARIANTS){
+    return -11;
+  }
+  
+  // A damaged frame gets built again
+  expectedWord = frameCache[APP_868MHZ_FRAME_VARIANT_ALERT].words[1];
+  frameCache[APP_868MHZ_FRAME_VARIANT_ALERT].words[1] ^= 0x00010000;
+  app_868mhz_getFrame(APP_868MHZ_FRAME_VARIANT_ALERT, &frame);
+  if ((frameCacheBuilds != (APP_868MHZ_FRAME_VARIANTS + 1)) || (frame.words[1] != expectedWord)){
+    return -12;
+  }
+  
+  // A new UID builds the frames again
+  eeprom_setUID(uID + 1);
+  app_868mhz_getFrame(APP_868MHZ_FRAME_VARIANT_ALERT, &frame);
+  eeprom_setUID(uID);
+  if ((frameCacheBuilds != (APP_868MHZ_FRAME_VARIANTS + 2)) || (frameCache[APP_868MHZ_FRAME_VARIANT_ALERT].uID != (uID + 1))){
+    return -13;
+  }
+  app_868mhz_prepareFrames();
+  
+  TRACE_TEST_VALUES(1, "868MHZ PAUSE %i UC BUSY, %i NC STOPPED, SAVED %i UJ PER ALARM, FRAME CACHE %i BYTES", (int) (chargeBusyPc / 1000000ULL), (int) (chargeStopPc / 1000ULL), (int) (((chargeBusyPc - chargeStopPc) * 2 * 3) / 1000000ULL), (int) sizeof(frameCache));
+#endif
+  return 0;
+}
+#endif
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Added testsuite                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added app_868mhz_prepareFrames                |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -40,13 +40,32 @@
 #define __APP_868MHZ_H
 
 /* Includes */
+#include "Test_Selector.h"
 
 /* Typedefinitions */
 
 /* Variables */
 
 /* Function definitions */
+
+/** @brief This method will build the encoded emergency messages of all flag
+ *         combinations for the UID of the device, so an alarm can be sent
+ *         without building its frame. A frame that is already cached for the
+ *         UID is kept.
+ *  @return Nothing.
+ */
+void app_868mhz_prepareFrames(void);
+
 void app_868mhz_transmitDynamicMessage(uint8_t *message);
 void app_868mhz_transmitMessage(BOOLEAN alertOnOff, BOOLEAN batteryLow);
 
+#if TEST_APP_868MHZ >= 1
+
+/** @brief This method is the test for this unit
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int app_868MHz_testsuite();
+
+#endif
+
 #endif
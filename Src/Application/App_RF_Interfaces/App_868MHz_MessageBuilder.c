@@ -25,13 +25,15 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-09    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | CRC16 by the selected engine                  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added packed builders and testsuite           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Test of bitEncoder_getBits                    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Test of the single bit times                  |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Benchmark only with test values               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -47,6 +49,7 @@
 #include "Helperfunction.h"
 #include "Headeradd.h"
 #include "NRZ.h"
+#include "BitEncoder.h"
 
 #include "App_868MHz_MessageBuilder.h"
 
@@ -61,7 +64,9 @@
 #define ARRAYLENGTH_HEADER                      2
 #define HEADERSIZE_BITS                         12
 #define BYTE_SIZE                               8
-#define WAIT_CYCLES_FOR_400_MUS                 210
+// The 12 bits of the header, right aligned
+#define HEADER_BITS_PACKED                      0x801
+#define ARRAYLENGTH_CRC                         2
 
 void app_868MHz_invertBitfield(bitfield *bits){  
   for (int i = 0; i < bits->countOfBitsUsed; i++){
@@ -95,7 +100,7 @@ int app_868MHz_buildMessage_emergency(uint8_t *message, uint32_t messageLength,
   uint32_t lengthUsed = ARRAYLENGTH_CODED_INPUT * BYTE_SIZE;
   uint16_t crc;
   
-  crc = crc_calcCrc16_868MHzProtocol_softwareCrc(message, messageLength);
+  crc = crc_calcCrc16_868MHzProtocol(message, messageLength);
   for (int i = 0; i < messageLength; i++){
     tempRaw[i] = message[i];
   }
@@ -115,6 +120,41 @@ int app_868MHz_buildMessage_emergency(uint8_t *message, uint32_t messageLength,
   return 0;
 }
 
+int app_868MHz_buildMessage_preamblePacked(BITENCODER_STRUCT_TYPEDEF *bits){
+  bits->countOfBitsUsed = 0;
+  if (bitEncoder_appendBits(bits, 0x55, BYTE_SIZE) == FALSE){
+    return -1;
+  }
+  return 0;
+}
+
+int app_868MHz_buildMessage_emergencyPacked(uint8_t *message, uint32_t messageLength, BITENCODER_STRUCT_TYPEDEF *bits){
+  uint8_t tempCrc[ARRAYLENGTH_CRC];
+  uint8_t countOfOnes = 0;
+  uint16_t crc;
+  
+  crc = crc_calcCrc16_868MHzProtocol(message, messageLength);
+  tempCrc[0] = (uint8_t) ((crc & 0xFF00) >> 8);
+  tempCrc[1] = (uint8_t) ((crc & 0x00FF) >> 0);
+  
+  // The header goes in front as it is, the message and its CRC get stuffed
+  // behind it and NRZ-I coded in place, so nothing has to be concatenated
+  bits->countOfBitsUsed = 0;
+  if (bitEncoder_appendBits(bits, HEADER_BITS_PACKED, HEADERSIZE_BITS) == FALSE){
+    return -1;
+  }
+  if (bitEncoder_appendStuffed(bits, message, messageLength, &countOfOnes) == FALSE){
+    return -1;
+  }
+  if (bitEncoder_appendStuffed(bits, tempCrc, ARRAYLENGTH_CRC, &countOfOnes) == FALSE){
+    return -1;
+  }
+  // nrz_i with SIGN_ZERO starts on the level 1
+  bitEncoder_nrzi(bits, HEADERSIZE_BITS, 1);
+  
+  return 0;
+}
+
 /* After the Bitstuffing the field must be :
                                       01111101 = 0x7D
                                       00010110 = 0x16
@@ -140,4 +180,168 @@ int app_868MHz_buildMessage_emergency(uint8_t *message, uint32_t messageLength,
                                       11001011 = 0xCB
                                       11       = 0xC0
     The field length used must still be 74
-  */
\ No newline at end of file
+  */
+
+#if TEST_APP_868MHZ_MESSAGEBUILDER >= 1
+
+#include "Debug.h"
+#if defined(HOST_BUILD)
+  #include <time.h>
+#endif
+
+// Count of builds each builder gets timed with on the host
+#define APP_868MHZ_MESSAGEBUILDER_TEST_BENCHMARK_RUNS   20000
+
+/** @brief This method will free variables and set back things to return from 
+ *         the test.
+ *  @param retVal The value you want to return.
+ *  @return The returnvalue you enter.
+ */
+int app_868MHz_messageBuilder_testsuiteReturner(int retVal){
+  return retVal;
+}
+
+/** @brief Compares a bitfield with a packed field bit by bit.
+ *  @param *bits The bitfield.
+ *  @param *packed The packed field.
+ *  @return 0 if both hold the same bits, -1 else.
+ */
+static int app_868MHz_messageBuilder_test_compare(bitfield *bits, BITENCODER_STRUCT_TYPEDEF *packed){
+  if (bits->countOfBitsUsed != packed->countOfBitsUsed){
+    return -1;
+  }
+  for (uint32_t i = 0; i < bits->countOfBitsUsed; i++){
+    if (((bits->bitsToSend[i >> 3].bitfield >> (7 - (i & 0x00000007))) & 0x01) != bitEncoder_getBit(packed, i)){
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/** @brief This method is the test for this unit. The packed builders have to
+ *         give the bits of the bitfield builders. On the host it also prints
+ *         the time and the RAM both take for an emergency message.
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int app_868MHz_messageBuilder_testsuite(){
+  static bitfieldTimed arrayPreamble[2];
+  static bitfieldTimed arrayMessage[16];
+  static uint32_t wordsPreamble[1];
+  static uint32_t wordsMessage[4];
+  bitfield bitsPreamble = {.bitsToSend = arrayPreamble, .countOfBits = 16, .countOfBitsUsed = 0};
+  bitfield bitsMessage = {.bitsToSend = arrayMessage, .countOfBits = 128, .countOfBitsUsed = 0};
+  BITENCODER_STRUCT_TYPEDEF packedPreamble;
+  BITENCODER_STRUCT_TYPEDEF packedMessage;
+  const uint8_t edgeMessages[][7] = {
+    {0x7E, 0x01, 0x03, 0xE0, 0x12, 0xFF, 0x00},
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8},
+  };
+  uint8_t message[7];
+  uint32_t seed = 0x2C3B4A59;
+  uint8_t countOfOnes;
+  
+  bitEncoder_init(&packedPreamble, wordsPreamble, 1);
+  bitEncoder_init(&packedMessage, wordsMessage, 4);
+  
+  //=============== TEST APPENDING ACROSS THE WORDS
+  packedMessage.countOfBitsUsed = 0;
+  if ((bitEncoder_appendBits(&packedMessage, 0xABCDE, 20) == FALSE) || (bitEncoder_appendBits(&packedMessage, 0x12345678, 32) == FALSE) || (bitEncoder_appendBits(&packedMessage, 0x5, 3) == FALSE)){
+    return app_868MHz_messageBuilder_testsuiteReturner(-1);
+  }
+  if ((packedMessage.countOfBitsUsed != 55) || (wordsMessage[0] != 0xABCDE123) || (wordsMessage[1] != 0x45678A00)){
+    return app_868MHz_messageBuilder_testsuiteReturner(-2);
+  }
+  // Reading several bits at once works across the words as well
+  if ((bitEncoder_getBits(&packedMessage, 0, 32) != 0xABCDE123) || (bitEncoder_getBits(&packedMessage, 16, 24) != 0xE12345) || (bitEncoder_getBits(&packedMessage, 52, 3) != 0x5)){
+    return app_868MHz_messageBuilder_testsuiteReturner(-2);
+  }
+  // Nothing goes in if it doesn't fit as a whole
+  if ((bitEncoder_appendBits(&packedMessage, 0, 32) == FALSE) || (bitEncoder_appendBits(&packedMessage, 0, 32) == FALSE) || (bitEncoder_appendBits(&packedMessage, 0, 10) == TRUE) || (packedMessage.countOfBitsUsed != 119)){
+    return app_868MHz_messageBuilder_testsuiteReturner(-3);
+  }
+  
+  //=============== TEST STUFFING AND NRZ-I
+  // Seven 1s get a 0 behind the fifth, the run count carries over the bytes
+  packedMessage.countOfBitsUsed = 0;
+  countOfOnes = 0;
+  message[0] = 0x0F;
+  message[1] = 0xE0;
+  bitEncoder_appendStuffed(&packedMessage, message, 2, &countOfOnes);
+  if ((packedMessage.countOfBitsUsed != 17) || (wordsMessage[0] != 0x0FB00000) || (countOfOnes != 0)){
+    return app_868MHz_messageBuilder_testsuiteReturner(-4);
+  }
+  // A 0 toggles the level, a 1 keeps it
+  bitEncoder_nrzi(&packedMessage, 0, 1);
+  if (wordsMessage[0] != 0x5F8A8000){
+    return app_868MHz_messageBuilder_testsuiteReturner(-5);
+  }
+  
+  //=============== TEST THE PACKED BUILDERS AGAINST THE BITFIELD BUILDERS
+  app_868MHz_buildMessage_preamble(&bitsPreamble);
+  if ((app_868MHz_buildMessage_preamblePacked(&packedPreamble) != 0) || (app_868MHz_messageBuilder_test_compare(&bitsPreamble, &packedPreamble) != 0)){
+    return app_868MHz_messageBuilder_testsuiteReturner(-6);
+  }
+  for (uint32_t i = 0; i < sizeof(edgeMessages) / sizeof(edgeMessages[0]); i++){
+    app_868MHz_buildMessage_emergency((uint8_t*) edgeMessages[i], 7, &bitsMessage);
+    if ((app_868MHz_buildMessage_emergencyPacked((uint8_t*) edgeMessages[i], 7, &packedMessage) != 0) || (app_868MHz_messageBuilder_test_compare(&bitsMessage, &packedMessage) != 0)){
+      return app_868MHz_messageBuilder_testsuiteReturner(-7);
+    }
+  }
+  for (uint32_t i = 0; i < 1000; i++){
+    for (uint32_t j = 0; j < sizeof(message); j++){
+      seed = (seed * 1103515245) + 12345;
+      message[j] = (uint8_t) (seed >> 16);
+    }
+    app_868MHz_buildMessage_emergency(message, 7, &bitsMessage);
+    if ((app_868MHz_buildMessage_emergencyPacked(message, 7, &packedMessage) != 0) || (app_868MHz_messageBuilder_test_compare(&bitsMessage, &packedMessage) != 0)){
+      return app_868MHz_messageBuilder_testsuiteReturner(-8);
+    }
+  }
+  // A storage that is too short is reported
+  packedMessage.countOfWords = 2;
+  if (app_868MHz_buildMessage_emergencyPacked((uint8_t*) edgeMessages[1], 7, &packedMessage) != -1){
+    return app_868MHz_messageBuilder_testsuiteReturner(-9);
+  }
+  packedMessage.countOfWords = 4;
+  
+  //=============== TEST THE TIMES OF SINGLE BITS
+  // Every bit gets the time of its own value, no matter the bits behind it
+  message[0] = 0xA5;
+  message[1] = 0x80;
+  initializeBitfield(message, 9, &bitsMessage, 1, 2);
+  for (uint32_t i = 0; i < 9; i++){
+    if (bitsMessage.bitsToSend[i >> 3].bitfieldTimes[(7 - i) & 0x07] != (((message[i >> 3] >> ((7 - i) & 0x07)) & 0x01) + 1)){
+      return app_868MHz_messageBuilder_testsuiteReturner(-10);
+    }
+  }
+  
+  //=============== BENCHMARK
+  TRACE_TEST_VALUES(1, "MESSAGEBUILDER RAM %i BYTES BITFIELD %i BYTES PACKED", (int) sizeof(arrayMessage), (int) sizeof(wordsMessage));
+  // The timing is only worth the runs, if it is printed
+#if defined(HOST_BUILD) && (DEBUG_LEESYS_TEST_VALUES >= 1)
+  {
+    clock_t start;
+    clock_t timeBitfield;
+    clock_t timePacked;
+    
+    start = clock();
+    for (uint32_t i = 0; i < APP_868MHZ_MESSAGEBUILDER_TEST_BENCHMARK_RUNS; i++){
+      message[0] = (uint8_t) i;
+      app_868MHz_buildMessage_emergency(message, 7, &bitsMessage);
+    }
+    timeBitfield = clock() - start;
+    start = clock();
+    for (uint32_t i = 0; i < APP_868MHZ_MESSAGEBUILDER_TEST_BENCHMARK_RUNS; i++){
+      message[0] = (uint8_t) i;
+      app_868MHz_buildMessage_emergencyPacked(message, 7, &packedMessage);
+    }
+    timePacked = clock() - start;
+    TRACE_TEST_VALUES(1, "MESSAGEBUILDER %i BUILDS %li US BITFIELD %li US PACKED", (int) APP_868MHZ_MESSAGEBUILDER_TEST_BENCHMARK_RUNS, (long) ((timeBitfield * 1000000) / CLOCKS_PER_SEC), (long) ((timePacked * 1000000) / CLOCKS_PER_SEC));
+  }
+#endif
+  
+  return app_868MHz_messageBuilder_testsuiteReturner(0);
+}
+#endif
\ No newline at end of file
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-09    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Added packed builders and testsuite           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -44,7 +44,14 @@
 #include <stdlib.h>
 #include <inttypes.h>
 
+#include "Test_Selector.h"
+#include "BitEncoder.h"
+
 /* Typedefinitions */
+// Length of one bit in the TA Radio Protocol. The sequencer takes this as the
+// base period of the waveform, all bit times must be multiples of it
+#define WAIT_CYCLES_FOR_400_MUS                 210
+
 typedef struct {
   uint8_t bitfield;
   uint16_t bitfieldTimes[8];
@@ -63,4 +70,27 @@ void    app_868MHz_invertBitfield(bitfield *bits);
 int     app_868MHz_buildMessage_preamble(bitfield *bits);
 int     app_868MHz_buildMessage_emergency(uint8_t *message, uint32_t messageLength, bitfield *bits);
 
+/** @brief Builds the preamble into a packed field.
+ *  @param *bits The field, its storage needs one word.
+ *  @return 0 upon success, -1 if the storage is too short.
+ */
+int     app_868MHz_buildMessage_preamblePacked(BITENCODER_STRUCT_TYPEDEF *bits);
+
+/** @brief Builds an emergency message into a packed field, the same bits as
+ *         app_868MHz_buildMessage_emergency gives. Every bit lasts
+ *         WAIT_CYCLES_FOR_400_MUS, the sequencer adds that when it outputs it.
+ *  @param *message The message without CRC.
+ *  @param messageLength The length of the message.
+ *  @param *bits The field, its storage needs BITENCODER_WORDS_FOR_BITS(APP_868MHZ_SEQUENCER_MAX_STEPS) words.
+ *  @return 0 upon success, -1 if the storage is too short.
+ */
+int     app_868MHz_buildMessage_emergencyPacked(uint8_t *message, uint32_t messageLength, BITENCODER_STRUCT_TYPEDEF *bits);
+
+#if TEST_APP_868MHZ_MESSAGEBUILDER >= 1
+/** @brief This method is the test for this unit
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int     app_868MHz_messageBuilder_testsuite();
+#endif
+
 #endif
\ No newline at end of file
@@ -1,6 +1,6 @@
 /**
   ******************************************************************************
-  * @file       App_868MHz_Sequencer.h
+  * @file       App_868MHz_Sequencer.c
   * @author     Tim Steinberg
   * @date       10.12.2020
   * @brief      Sequencer for the S2LP module
@@ -25,13 +25,21 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Waveform by TIM2 + DMA instead of NOP loops   |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added schedule of a packed field              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Output through the S2LP packet handler        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | TIM2 and DMA only without the packet handler  |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | TIM2 period from TIMxCLK                      |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Test checks every BSRR write and its time     |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 008       | 2026-10-18    | Tim Steinberg         | Bound the FIFO wait, abort a silent S2LP      |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 009       | 2026-10-18    | Tim Steinberg         | DMA addresses cast through uintptr_t          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -44,17 +52,82 @@
 #include "stm32l051xx.h"
 #include "main.h"
 
+#include "MasterDefine.h"
+#include "Test_Selector.h"
 #include "GPIO.h"
 #include "Watchdog.h"
+#include "ErrorHandling.h"
 #include "App_868MHz_Sequencer.h"
 #include "App_868MHz_MessageBuilder.h"
+#include "S2LP.h"
+
+#if (TEST_APP_868MHZ_SEQUENCER >= 1) && defined(HOST_BUILD)
+#include "Debug.h"
+#include "HAL_Sim.h"
+#include "S2LP_Sim.h"
+#endif
 
 /* Typedefinitions / Prototypes */
+/**
+ * @brief Inner state of the waveform output.
+ */
+typedef enum APP_868MHZ_SEQUENCER_STATE_VALUES {
+  APP_868MHZ_SEQUENCER_STATE_IDLE               = 0x00, /**< Nothing to output */
+  APP_868MHZ_SEQUENCER_STATE_RUNNING            = 0x01, /**< DMA writes the steps */
+  APP_868MHZ_SEQUENCER_STATE_HOLD_LAST_STEP     = 0x02, /**< Last step written, waiting for its end */
+} APP_868MHZ_SEQUENCER_STATE_VALUES_TYPEDEF;
+
+#define APP_868MHZ_SEQUENCER_BSRR_SET           ((uint32_t) GPO_2_S2LP_Pin)
+#define APP_868MHZ_SEQUENCER_BSRR_RESET         (((uint32_t) GPO_2_S2LP_Pin) << 16)
+
+// The TX FIFO gets written in pieces of this size
+#define APP_868MHZ_SEQUENCER_FIFO_CHUNK         32
+// The burst may take this much longer than its bits (preamble, tick jitter)
+#define APP_868MHZ_SEQUENCER_FIFO_TIMEOUT_MARGIN_MS     20
+
+// TIM2 and the DMA are only needed without the packet handler, the test plays
+// their model in any case
+#define APP_868MHZ_SEQUENCER_TIMER_OUTPUT       ((APP_868MHZ_SEQUENCER_OUTPUT_FIFO < 1) || (TEST_APP_868MHZ_SEQUENCER >= 1))
+
+#if APP_868MHZ_SEQUENCER_TIMER_OUTPUT
+static void app_868MHz_sequencer_transferComplete(DMA_HandleTypeDef *hdma);
+#endif
 
 /* Variables */
-static uint32_t waitTimeCycles;
-static uint8_t result;
-static uint32_t i;
+#if (TEST_APP_868MHZ_SEQUENCER < 1) && (APP_868MHZ_SEQUENCER_OUTPUT_FIFO < 1)
+static TIM_HandleTypeDef htim2;
+static DMA_HandleTypeDef hdma_tim2_up;
+#endif
+
+#if APP_868MHZ_SEQUENCER_TIMER_OUTPUT
+static const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *sequencerRepeated;
+static volatile uint32_t sequencerRepeatsLeft;
+static volatile APP_868MHZ_SEQUENCER_STATE_VALUES_TYPEDEF sequencerState = APP_868MHZ_SEQUENCER_STATE_IDLE;
+#endif
+
+// The bytes for the TX FIFO are cut out of the frame as they are needed
+static const BITENCODER_STRUCT_TYPEDEF *fifoFrame;
+static uint32_t fifoFramePosition;
+static uint32_t fifoBitsLeft;
+static uint32_t fifoBytesLeft;
+static uint8_t fifoPaddingLevel;
+static volatile bool fifoIrqPending;
+
+#if TEST_APP_868MHZ_SEQUENCER >= 1
+// Model of TIM2 + DMA, the test plays the update events
+static const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *modelDmaSchedule;
+static uint32_t modelDmaIndex;
+static bool modelDmaArmed;
+static bool modelUpdateDmaEnabled;
+static bool modelUpdateIrqEnabled;
+static uint32_t modelPinLevel;
+// The test moves the time, the model notes every BSRR write with it
+static uint32_t modelTimeUs;
+static uint32_t modelWrites;
+static uint32_t modelLastWord;
+static uint32_t modelLastWriteUs;
+static void app_868MHz_sequencer_test_timerUpdate(void);
+#endif
 
 /* Function definitions */
 void setOutputToHigh(void){
@@ -65,61 +138,638 @@ void setOutputToLow(void){
   ((GPIO_TypeDef*)GPO_2_S2LP_GPIO_Port)->BRR = GPO_2_S2LP_Pin;
 }
 
-static inline void setOutputOn(void){
-  ((GPIO_TypeDef*)GPO_2_S2LP_GPIO_Port)->BSRR = GPO_2_S2LP_Pin;
+APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF app_868MHz_sequencer_buildSchedule(bitfield *bits, APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *schedule){
+  uint32_t i;
+  uint32_t waitTimeCycles;
+  uint32_t stepWord;
+  
+  schedule->countOfSteps = 0;
+  for (i = 0; i < bits->countOfBitsUsed; i++){
+    waitTimeCycles = bits->bitsToSend[i >> 3].bitfieldTimes[7 - (i & 0x00000007)];
+    // Can the timer reproduce this bit time?
+    if ((waitTimeCycles == 0) || ((waitTimeCycles % WAIT_CYCLES_FOR_400_MUS) != 0)){
+      // No
+      return APP_868MHZ_SEQUENCER_RETURN_INVALID_TIMING;
+    }
+    if (((bits->bitsToSend[i >> 3].bitfield >> (7 - (i & 0x00000007))) & 0x01) != 0){
+      stepWord = APP_868MHZ_SEQUENCER_BSRR_SET;
+    }else{
+      stepWord = APP_868MHZ_SEQUENCER_BSRR_RESET;
+    }
+    while (waitTimeCycles > 0){
+      if (schedule->countOfSteps >= APP_868MHZ_SEQUENCER_MAX_STEPS){
+        return APP_868MHZ_SEQUENCER_RETURN_TOO_LONG;
+      }
+      schedule->steps[schedule->countOfSteps] = stepWord;
+      schedule->countOfSteps++;
+      waitTimeCycles -= WAIT_CYCLES_FOR_400_MUS;
+    }
+  }
+  return APP_868MHZ_SEQUENCER_RETURN_OK;
 }
 
-static inline void setOutputOff(void){
-  ((GPIO_TypeDef*)GPO_2_S2LP_GPIO_Port)->BRR = GPO_2_S2LP_Pin;
+APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF app_868MHz_sequencer_buildSchedulePacked(const BITENCODER_STRUCT_TYPEDEF *bits, APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *schedule){
+  uint32_t i;
+  uint32_t word = 0;
+  
+  schedule->countOfSteps = 0;
+  if (bits->countOfBitsUsed > APP_868MHZ_SEQUENCER_MAX_STEPS){
+    return APP_868MHZ_SEQUENCER_RETURN_TOO_LONG;
+  }
+  for (i = 0; i < bits->countOfBitsUsed; i++){
+    // Take the next word, its bits are shifted out from the top
+    if ((i & 0x0000001F) == 0){
+      word = bits->words[i >> 5];
+    }
+    if ((word & 0x80000000) != 0){
+      schedule->steps[i] = APP_868MHZ_SEQUENCER_BSRR_SET;
+    }else{
+      schedule->steps[i] = APP_868MHZ_SEQUENCER_BSRR_RESET;
+    }
+    word <<= 1;
+  }
+  schedule->countOfSteps = bits->countOfBitsUsed;
+  return APP_868MHZ_SEQUENCER_RETURN_OK;
+}
+
+#if (TEST_APP_868MHZ_SEQUENCER < 1) && (APP_868MHZ_SEQUENCER_OUTPUT_FIFO < 1)
+
+/** @brief Gives the clock TIM2 counts with
+ *  @return TIMxCLK in Hz.
+ */
+static uint32_t app_868MHz_sequencer_getTimerClock(void){
+  RCC_ClkInitTypeDef clkConfig;
+  uint32_t flashLatency;
+  uint32_t timerClock = HAL_RCC_GetPCLK1Freq();
+  
+  // The timers get twice the PCLK1 as soon as the APB1 is divided
+  HAL_RCC_GetClockConfig(&clkConfig, &flashLatency);
+  if (clkConfig.APB1CLKDivider != RCC_HCLK_DIV1){
+    timerClock *= 2;
+  }
+  return timerClock;
+}
+
+static void app_868MHz_sequencer_initHardware(void){
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  __HAL_RCC_TIM2_CLK_ENABLE();
+  
+  // TIM2_UP is mapped on channel 2 by request 8, it feeds the BSRR
+  hdma_tim2_up.Instance = DMA1_Channel2;
+  hdma_tim2_up.Init.Request = DMA_REQUEST_8;
+  hdma_tim2_up.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_tim2_up.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_tim2_up.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_tim2_up.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  hdma_tim2_up.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+  hdma_tim2_up.Init.Mode = DMA_NORMAL;
+  hdma_tim2_up.Init.Priority = DMA_PRIORITY_VERY_HIGH;
+  if (HAL_DMA_Init(&hdma_tim2_up) != HAL_OK)
+  {
+    Error_Handler_TxV2(INIT_DMA_FAILED);
+  }
+  hdma_tim2_up.XferCpltCallback = app_868MHz_sequencer_transferComplete;
+  
+  // One update per step
+  htim2.Instance = TIM2;
+  htim2.Init.Prescaler = 0;
+  htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim2.Init.Period = ((app_868MHz_sequencer_getTimerClock() / 1000000) * APP_868MHZ_SEQUENCER_STEP_LENGTH_US) - 1;
+  htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
+  {
+    Error_Handler_TxV2(INIT_TIMER_FAILED);
+  }
+  
+  HAL_NVIC_SetPriority(DMA1_Channel2_3_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel2_3_IRQn);
+  HAL_NVIC_SetPriority(TIM2_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(TIM2_IRQn);
+}
+
+static void app_868MHz_sequencer_armDma(const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *schedule){
+  HAL_DMA_Start_IT(&hdma_tim2_up, (uint32_t) (uintptr_t) schedule->steps, (uint32_t) (uintptr_t) &((GPIO_TypeDef*)GPO_2_S2LP_GPIO_Port)->BSRR, schedule->countOfSteps);
+}
+
+static void app_868MHz_sequencer_startTimer(void){
+  __HAL_TIM_SET_COUNTER(&htim2, 0);
+  __HAL_TIM_ENABLE_DMA(&htim2, TIM_DMA_UPDATE);
+  // The generated update writes the first step right away
+  htim2.Instance->EGR = TIM_EGR_UG;
+  __HAL_TIM_ENABLE(&htim2);
+}
+
+static void app_868MHz_sequencer_waitForLastStep(void){
+  // The last step was written by the update that just happened, its end is
+  // the next update
+  __HAL_TIM_DISABLE_DMA(&htim2, TIM_DMA_UPDATE);
+  __HAL_TIM_CLEAR_IT(&htim2, TIM_IT_UPDATE);
+  __HAL_TIM_ENABLE_IT(&htim2, TIM_IT_UPDATE);
+}
+
+static void app_868MHz_sequencer_stopHardware(void){
+  __HAL_TIM_DISABLE_IT(&htim2, TIM_IT_UPDATE);
+  __HAL_TIM_DISABLE(&htim2);
+  HAL_NVIC_DisableIRQ(TIM2_IRQn);
+  HAL_DMA_DeInit(&hdma_tim2_up);
+  HAL_TIM_Base_DeInit(&htim2);
+  __HAL_RCC_TIM2_CLK_DISABLE();
+}
+
+#elif TEST_APP_868MHZ_SEQUENCER >= 1
+
+static void app_868MHz_sequencer_initHardware(void){
+  modelDmaArmed = FALSE;
+  modelUpdateDmaEnabled = FALSE;
+  modelUpdateIrqEnabled = FALSE;
+}
+
+static void app_868MHz_sequencer_armDma(const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *schedule){
+  modelDmaSchedule = schedule;
+  modelDmaIndex = 0;
+  modelDmaArmed = TRUE;
+}
+
+static void app_868MHz_sequencer_startTimer(void){
+  modelUpdateDmaEnabled = TRUE;
+  app_868MHz_sequencer_test_timerUpdate();
+}
+
+static void app_868MHz_sequencer_waitForLastStep(void){
+  modelUpdateDmaEnabled = FALSE;
+  modelUpdateIrqEnabled = TRUE;
+}
+
+static void app_868MHz_sequencer_stopHardware(void){
+  modelUpdateIrqEnabled = FALSE;
+  modelDmaArmed = FALSE;
+}
+
+#endif
+
+#if APP_868MHZ_SEQUENCER_TIMER_OUTPUT
+
+/** @brief Called after the DMA wrote the last step of a schedule. The next
+ *         update is a full step away, which leaves plenty of time to arm the
+ *         next schedule.
+ *  @param *hdma Unused.
+ *  @return Nothing.
+ */
+static void app_868MHz_sequencer_transferComplete(DMA_HandleTypeDef *hdma){
+  // Is there another repetition to send?
+  if (sequencerRepeatsLeft > 0){
+    // Yes
+    sequencerRepeatsLeft--;
+    app_868MHz_sequencer_armDma(sequencerRepeated);
+    return;
+  }
+  // No, hold the last step for its length and stop then
+  sequencerState = APP_868MHZ_SEQUENCER_STATE_HOLD_LAST_STEP;
+  app_868MHz_sequencer_waitForLastStep();
+}
+
+/** @brief Called by the first update after the last step was written.
+ *  @return Nothing.
+ */
+static void app_868MHz_sequencer_timerUpdate(void){
+  if (sequencerState == APP_868MHZ_SEQUENCER_STATE_HOLD_LAST_STEP){
+    app_868MHz_sequencer_stopHardware();
+    sequencerState = APP_868MHZ_SEQUENCER_STATE_IDLE;
+  }
+}
+
+/** @brief Arms the hardware and outputs the first step.
+ *  @param *first The schedule sent first.
+ *  @param *repeated The schedule sent afterwards.
+ *  @param repeatCount How often the repeated schedule is sent.
+ *  @return Nothing.
+ */
+static void app_868MHz_sequencer_start(const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *first, const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *repeated, uint32_t repeatCount){
+  sequencerRepeated = repeated;
+  sequencerRepeatsLeft = repeatCount;
+  sequencerState = APP_868MHZ_SEQUENCER_STATE_RUNNING;
+  
+  app_868MHz_sequencer_initHardware();
+  app_868MHz_sequencer_armDma(first);
+  app_868MHz_sequencer_startTimer();
+}
+
+#endif
+
+/** @brief Gives the next byte of the burst. The frame is repeated without a
+ *         gap, so a byte may hold the end of one frame and the start of the
+ *         next one. Behind the last bit the level of it is kept.
+ *  @return The byte, its first bit is the highest one.
+ */
+static uint8_t app_868MHz_sequencer_fifoNextByte(void){
+  uint32_t byte = 0;
+  uint32_t filled = 0;
+  uint32_t count;
+  
+  while (filled < 8){
+    // Is the burst done?
+    if (fifoBitsLeft == 0){
+      // Yes, fill up with the last level
+      byte <<= (8 - filled);
+      if (fifoPaddingLevel != 0){
+        byte |= (1U << (8 - filled)) - 1;
+      }
+      break;
+    }
+    count = 8 - filled;
+    if (count > fifoFrame->countOfBitsUsed - fifoFramePosition){
+      count = fifoFrame->countOfBitsUsed - fifoFramePosition;
+    }
+    if (count > fifoBitsLeft){
+      count = fifoBitsLeft;
+    }
+    byte = (byte << count) | bitEncoder_getBits(fifoFrame, fifoFramePosition, count);
+    filled += count;
+    fifoBitsLeft -= count;
+    fifoFramePosition += count;
+    if (fifoFramePosition >= fifoFrame->countOfBitsUsed){
+      fifoFramePosition = 0;
+    }
+  }
+  return (uint8_t) byte;
+}
+
+/** @brief Writes the next bytes of the burst into the TX FIFO.
+ *  @param space The count of bytes that fit into the TX FIFO.
+ *  @return Nothing.
+ */
+static void app_868MHz_sequencer_fifoRefill(uint32_t space){
+  uint8_t chunk[APP_868MHZ_SEQUENCER_FIFO_CHUNK];
+  uint32_t count;
+  uint32_t i;
+  
+  if (space > fifoBytesLeft){
+    space = fifoBytesLeft;
+  }
+  while (space > 0){
+    count = (space > APP_868MHZ_SEQUENCER_FIFO_CHUNK) ? APP_868MHZ_SEQUENCER_FIFO_CHUNK : space;
+    for (i = 0; i < count; i++){
+      chunk[i] = app_868MHz_sequencer_fifoNextByte();
+    }
+    S2LP_WriteTxFifo(chunk, (uint8_t) count);
+    space -= count;
+    fifoBytesLeft -= count;
+  }
 }
 
-static inline void waitCycle(void){
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-  asm("NOP");
-}
-
-inline void app_868MHz_sequencer_output(bitfield *bits){
-  i = 0;
-  //waitTimeCyclesNext = bits->bitsToSend[0].bitfieldTimes[0] - 1;
-  //result = (bits->bitsToSend[0].bitfield >> 7) & 0x01;
-  while(i < bits->countOfBitsUsed){
+APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF app_868MHz_sequencer_outputFifo(const BITENCODER_STRUCT_TYPEDEF *frame, uint32_t repeatCount){
+  APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF retVal = APP_868MHZ_SEQUENCER_RETURN_OK;
+  uint32_t irqStatus = 0;
+  uint32_t timeoutMs;
+  uint32_t start;
+  
+  if ((frame->countOfBitsUsed == 0) || (repeatCount == 0)){
+    return APP_868MHZ_SEQUENCER_RETURN_OK;
+  }
+  // Does the burst fit into the packet length?
+  if (((frame->countOfBitsUsed * repeatCount) + 7) / 8 > 0xFFFF){
+    // No
+    return APP_868MHZ_SEQUENCER_RETURN_TOO_LONG;
+  }
+  fifoFrame = frame;
+  fifoFramePosition = 0;
+  fifoBitsLeft = frame->countOfBitsUsed * repeatCount;
+  fifoBytesLeft = (fifoBitsLeft + 7) / 8;
+  fifoPaddingLevel = bitEncoder_getBit(frame, frame->countOfBitsUsed - 1);
+  timeoutMs = ((fifoBytesLeft * 8 * APP_868MHZ_SEQUENCER_STEP_LENGTH_US) / 1000) + APP_868MHZ_SEQUENCER_FIFO_TIMEOUT_MARGIN_MS;
+  
+  S2LP_FlushTxFifo();
+  S2LP_SetPacketLength((uint16_t) fifoBytesLeft);
+  app_868MHz_sequencer_fifoRefill(S2LP_TX_FIFO_SIZE);
+  // Nothing of before may end the wait
+  S2LP_GetIrqStatus();
+  fifoIrqPending = FALSE;
+  S2LP_StartTx();
+  start = HAL_GetTick();
+  
+  // The tick keeps running: it bounds the wait if the S2LP never asks again
+  // and the SPI timeouts need it. Its wake ups are cheap against the TX.
+  do{
+    // The check and the WFI must not be split by the interrupt that ends it,
+    // a pending interrupt wakes the WFI up even while masked
+    __disable_irq();
+    if (fifoIrqPending == FALSE){
+      HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+    }
+    __enable_irq();
+    // Did the S2LP wake the core up?
+    if (fifoIrqPending == FALSE){
+      // No, the tick. Should the burst be over already?
+      if ((HAL_GetTick() - start) > timeoutMs){
+        // Yes, the S2LP got lost (reset, SPI)
+        S2LP_AbortTx();
+        retVal = APP_868MHZ_SEQUENCER_RETURN_TIMEOUT;
+        break;
+      }
+      continue;
+    }
+    fifoIrqPending = FALSE;
+    irqStatus = S2LP_GetIrqStatus();
+    // Did the S2LP run out of bytes?
+    if ((irqStatus & S2LP_IRQ_TX_FIFO_ERROR) != 0){
+      // Yes, the rest of the burst would be garbage
+      S2LP_AbortTx();
+      retVal = APP_868MHZ_SEQUENCER_RETURN_FIFO_ERROR;
+      break;
+    }
+    if ((irqStatus & S2LP_IRQ_TX_FIFO_ALMOST_EMPTY) != 0){
+      app_868MHz_sequencer_fifoRefill(S2LP_TX_FIFO_SIZE - S2LP_GetTxFifoCount());
+    }
+  }while((irqStatus & S2LP_IRQ_TX_DATA_SENT) == 0);
+  return retVal;
+}
+
+void app_868MHz_sequencer_s2lpIrqHandler(void){
+  if (__HAL_GPIO_EXTI_GET_IT(GPO_2_S2LP_Pin) != RESET){
+    __HAL_GPIO_EXTI_CLEAR_IT(GPO_2_S2LP_Pin);
+    fifoIrqPending = TRUE;
+  }
+}
+
+#if (TEST_APP_868MHZ_SEQUENCER < 1) && (APP_868MHZ_SEQUENCER_OUTPUT_FIFO < 1)
+
+void app_868MHz_sequencer_output(const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *first, const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *repeated, uint32_t repeatCount){
+  app_868MHz_sequencer_start(first, repeated, repeatCount);
+  
+  // The core only wakes up for the schedule switches, no need for the tick
+  HAL_SuspendTick();
+  do{
+    // The check and the WFI must not be split by the interrupt that ends it,
+    // a pending interrupt wakes the WFI up even while masked
+    __disable_irq();
+    if (sequencerState != APP_868MHZ_SEQUENCER_STATE_IDLE){
+      HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+    }
+    __enable_irq();
+  }while(sequencerState != APP_868MHZ_SEQUENCER_STATE_IDLE);
+  HAL_ResumeTick();
+}
+
+void app_868MHz_sequencer_dmaIrqHandler(void){
+  // The RSL reception shares the vector, the handle is set up with the first
+  // burst only
+  if (hdma_tim2_up.Instance != NULL){
+    HAL_DMA_IRQHandler(&hdma_tim2_up);
+  }
+}
+
+void app_868MHz_sequencer_timerIrqHandler(void){
+  if (htim2.Instance == NULL){
+    return;
+  }
+  if ((__HAL_TIM_GET_FLAG(&htim2, TIM_FLAG_UPDATE) != RESET) && (__HAL_TIM_GET_IT_SOURCE(&htim2, TIM_IT_UPDATE) != RESET)){
+    __HAL_TIM_CLEAR_IT(&htim2, TIM_IT_UPDATE);
+    app_868MHz_sequencer_timerUpdate();
+  }
+}
+
+#elif TEST_APP_868MHZ_SEQUENCER < 1
+
+// The packet handler sends the bursts, TIM2 and its DMA channel are never set
+// up. The DMA1 channel 2/3 interrupt belongs to the RSL reception alone.
+void app_868MHz_sequencer_dmaIrqHandler(void){
+}
+
+void app_868MHz_sequencer_timerIrqHandler(void){
+}
+
+#else
+
+void app_868MHz_sequencer_output(const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *first, const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *repeated, uint32_t repeatCount){
+  app_868MHz_sequencer_start(first, repeated, repeatCount);
+  while (sequencerState != APP_868MHZ_SEQUENCER_STATE_IDLE){
+    app_868MHz_sequencer_test_timerUpdate();
+  }
+}
+
+void app_868MHz_sequencer_dmaIrqHandler(void){
+}
+
+void app_868MHz_sequencer_timerIrqHandler(void){
+}
+
+/** @brief One update event of the modelled TIM2. With the update DMA request
+ *         enabled it writes the next step to the pin, else it raises the
+ *         update interrupt.
+ *  @return Nothing.
+ */
+static void app_868MHz_sequencer_test_timerUpdate(void){
+  uint32_t step;
+  
+  if (modelUpdateDmaEnabled == TRUE){
+    if (modelDmaArmed == FALSE){
+      return;
+    }
+    step = modelDmaSchedule->steps[modelDmaIndex];
+    modelWrites++;
+    modelLastWord = step;
+    modelLastWriteUs = modelTimeUs;
+    if (step == APP_868MHZ_SEQUENCER_BSRR_SET){
+      modelPinLevel = 1;
+    }
+    if (step == APP_868MHZ_SEQUENCER_BSRR_RESET){
+      modelPinLevel = 0;
+    }
+    modelDmaIndex++;
+    if (modelDmaIndex >= modelDmaSchedule->countOfSteps){
+      modelDmaArmed = FALSE;
+      app_868MHz_sequencer_transferComplete(NULL);
+    }
+    return;
+  }
+  if (modelUpdateIrqEnabled == TRUE){
+    app_868MHz_sequencer_timerUpdate();
+  }
+}
+
+/** @brief Returns the level bit i of a bitfield must have.
+ *  @param *bits The bitfield.
+ *  @param i The position of the bit.
+ *  @return 0 or 1.
+ */
+static uint32_t app_868MHz_sequencer_test_expectedLevel(bitfield *bits, uint32_t i){
+  return (bits->bitsToSend[i >> 3].bitfield >> (7 - (i & 0x00000007))) & 0x01;
+}
+
+int app_868MHz_sequencer_testsuite(){
+  static bitfieldTimed arrayPreamble[2];
+  static bitfieldTimed arrayMessage[16];
+  static APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF schedulePreamble;
+  static APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF scheduleMessage;
+  static APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF schedulePacked;
+  static uint32_t wordsMessage[4];
+  BITENCODER_STRUCT_TYPEDEF packedMessage;
+  bitfield bitsPreamble = {.bitsToSend = arrayPreamble, .countOfBits = 16, .countOfBitsUsed = 0};
+  bitfield bitsMessage = {.bitsToSend = arrayMessage, .countOfBits = 128, .countOfBitsUsed = 0};
+  uint8_t message[7] = {0x7E, 0x01, 0x03, 0xE0, 0x12, 0xFF, 0x00};
+  const uint32_t repeatCount = 18;
+  uint32_t lastLevel;
+  uint32_t edges;
+  uint32_t stepIndex;
+  uint32_t expected;
+  
+  if (app_868MHz_buildMessage_preamble(&bitsPreamble) != 0){
+    return -1;
+  }
+  if (app_868MHz_buildMessage_emergency(message, 7, &bitsMessage) != 0){
+    return -1;
+  }
+  if (app_868MHz_sequencer_buildSchedule(&bitsPreamble, &schedulePreamble) != APP_868MHZ_SEQUENCER_RETURN_OK){
+    return -2;
+  }
+  if (app_868MHz_sequencer_buildSchedule(&bitsMessage, &scheduleMessage) != APP_868MHZ_SEQUENCER_RETURN_OK){
+    return -2;
+  }
+  // Every bit is one step of 400 us
+  if ((schedulePreamble.countOfSteps != bitsPreamble.countOfBitsUsed) || (scheduleMessage.countOfSteps != bitsMessage.countOfBitsUsed)){
+    return -3;
+  }
+  
+  // Play the waveform on the model: one update each 400 us. Every update
+  // has to write exactly the BSRR word of the bit of its step, nothing gets
+  // skipped or written twice at the switch of the schedules
+  modelTimeUs = 0;
+  modelWrites = 0;
+  lastLevel = 0;
+  edges = 0;
+  stepIndex = 0;
+  app_868MHz_sequencer_start(&schedulePreamble, &scheduleMessage, repeatCount);
+  while (sequencerState != APP_868MHZ_SEQUENCER_STATE_IDLE){
+    if (stepIndex < schedulePreamble.countOfSteps){
+      expected = app_868MHz_sequencer_test_expectedLevel(&bitsPreamble, stepIndex);
+    }else{
+      expected = app_868MHz_sequencer_test_expectedLevel(&bitsMessage, (stepIndex - schedulePreamble.countOfSteps) % scheduleMessage.countOfSteps);
+    }
+    if ((modelWrites != stepIndex + 1) || (modelLastWriteUs != stepIndex * APP_868MHZ_SEQUENCER_STEP_LENGTH_US)){
+      return -5;
+    }
+    if ((modelLastWord != ((expected != 0) ? APP_868MHZ_SEQUENCER_BSRR_SET : APP_868MHZ_SEQUENCER_BSRR_RESET)) || (modelPinLevel != expected)){
+      return -4;
+    }
+    if ((stepIndex > 0) && (expected != lastLevel)){
+      edges++;
+    }
+    lastLevel = expected;
+    modelTimeUs += APP_868MHZ_SEQUENCER_STEP_LENGTH_US;
+    stepIndex++;
+    app_868MHz_sequencer_test_timerUpdate();
+  }
+  // The burst must end exactly after the last step was held for 400 us,
+  // without a write after it
+  if ((stepIndex != (schedulePreamble.countOfSteps + repeatCount * scheduleMessage.countOfSteps)) || (modelWrites != stepIndex) || (modelTimeUs != stepIndex * APP_868MHZ_SEQUENCER_STEP_LENGTH_US)){
+    return -6;
+  }
+  if (edges == 0){
+    return -7;
+  }
+  
+  // The packed message gives the same waveform
+  bitEncoder_init(&packedMessage, wordsMessage, 4);
+  if ((app_868MHz_buildMessage_emergencyPacked(message, 7, &packedMessage) != 0) || (app_868MHz_sequencer_buildSchedulePacked(&packedMessage, &schedulePacked) != APP_868MHZ_SEQUENCER_RETURN_OK)){
+    return -10;
+  }
+  if (schedulePacked.countOfSteps != scheduleMessage.countOfSteps){
+    return -11;
+  }
+  for (stepIndex = 0; stepIndex < scheduleMessage.countOfSteps; stepIndex++){
+    if (schedulePacked.steps[stepIndex] != scheduleMessage.steps[stepIndex]){
+      return -11;
+    }
+  }
+  
+#if defined(HOST_BUILD)
+  // The packet handler of the S2LP model has to put the same waveform on the
+  // air: its preamble, the message repeated without a gap and the padding of
+  // the last byte at the last level
+  {
+    S2LP_SIM_STATISTICS_STRUCT_TYPEDEF statistics;
+    const uint8_t *txBits;
+    uint32_t countOfTxBits;
+    uint32_t payloadBits = repeatCount * packedMessage.countOfBitsUsed;
+    uint32_t payloadBytes = (payloadBits + 7) / 8;
+    uint64_t expectedTimeNs;
+    uint64_t startNs;
     
-    waitTimeCycles = bits->bitsToSend[i >> 3].bitfieldTimes[7 - i & 0x00000007]; //waitTimeCyclesNext;
-    //waitTimeCyclesNext = bits->bitsToSend[i >> 3].bitfieldTimes[i & 0x00000007];
-    result = (bits->bitsToSend[i >> 3].bitfield >> (7 - i & 0x00000007)) & 0x01;
-    if(result != 0)
-    {
-      // Set
-      setOutputOn();
-    }
-    if(result == 0)
-    {
-      // Reset
-      setOutputOff();
-    }
-    i++;
-    while(waitTimeCycles > 0){
-      waitCycle();
-      waitTimeCycles -= 1;
+    S2LP_SetConfig_PacketMode();
+    // TX source FIFO, 4 preamble pairs (0x55), no sync word
+    if (((s2lpSim_getRegister(0x30) & 0x0C) != 0) || (s2lpSim_getRegister(0x2C) != 4) || ((s2lpSim_getRegister(0x2B) >> 2) != 0)){
+      return -12;
+    }
+    s2lpSim_resetStatistics();
+    if (app_868MHz_sequencer_outputFifo(&packedMessage, repeatCount) != APP_868MHZ_SEQUENCER_RETURN_OK){
+      S2LP_SetConfig_SleepMode();
+      return -13;
+    }
+    s2lpSim_getStatistics(&statistics);
+    if ((((uint32_t) s2lpSim_getRegister(0x31) << 8) | s2lpSim_getRegister(0x32)) != payloadBytes){
+      S2LP_SetConfig_SleepMode();
+      return -14;
+    }
+    countOfTxBits = s2lpSim_getTxBits(&txBits);
+    if (countOfTxBits != schedulePreamble.countOfSteps + (8 * payloadBytes)){
+      S2LP_SetConfig_SleepMode();
+      return -15;
     }
+    for (stepIndex = 0; stepIndex < countOfTxBits; stepIndex++){
+      if (stepIndex < schedulePreamble.countOfSteps){
+        expected = schedulePreamble.steps[stepIndex];
+      }else if (stepIndex - schedulePreamble.countOfSteps < payloadBits){
+        expected = scheduleMessage.steps[(stepIndex - schedulePreamble.countOfSteps) % scheduleMessage.countOfSteps];
+      }else{
+        expected = scheduleMessage.steps[scheduleMessage.countOfSteps - 1];
+      }
+      if (txBits[stepIndex] != ((expected == APP_868MHZ_SEQUENCER_BSRR_SET) ? 1 : 0)){
+        S2LP_SetConfig_SleepMode();
+        return -16;
+      }
+    }
+    if ((statistics.packets != 1) || (statistics.fifoUnderflows != 0)){
+      S2LP_SetConfig_SleepMode();
+      return -17;
+    }
+    // Every bit on the air for its 400 us, the data rate is off by < 0.1 %
+    expectedTimeNs = (uint64_t) countOfTxBits * APP_868MHZ_SEQUENCER_STEP_LENGTH_US * 1000;
+    if ((statistics.txTimeNs < expectedTimeNs - (expectedTimeNs / 1000)) || (statistics.txTimeNs > expectedTimeNs + (expectedTimeNs / 1000))){
+      S2LP_SetConfig_SleepMode();
+      return -18;
+    }
+    TRACE_TEST_VALUES(1, "SEQUENCER FIFO %i BITS IN %i US, %i FIFO BYTES IN %i SPI TRANSACTIONS", (int) countOfTxBits, (int) (statistics.txTimeNs / 1000), (int) statistics.fifoBytes, (int) statistics.transactions);
+    S2LP_SetConfig_SleepMode();
     
+    // A S2LP that resets in the middle of the burst never asks for bytes
+    // again, the wait ends by the time the burst takes
+    S2LP_SetConfig_PacketMode();
+    s2lpSim_brownOutIn(50ULL * 1000000ULL);
+    startNs = halSim_getTimeNs();
+    if (app_868MHz_sequencer_outputFifo(&packedMessage, repeatCount) != APP_868MHZ_SEQUENCER_RETURN_TIMEOUT){
+      S2LP_SetConfig_OffMode();
+      return -19;
+    }
+    if ((halSim_getTimeNs() - startNs) > (expectedTimeNs + ((APP_868MHZ_SEQUENCER_FIFO_TIMEOUT_MARGIN_MS + 5) * 1000000ULL))){
+      S2LP_SetConfig_OffMode();
+      return -20;
+    }
+    S2LP_SetConfig_OffMode();
   }
-}
\ No newline at end of file
+#endif
+  
+  // Double length bits become two steps, odd lengths can't be done
+  arrayPreamble[0].bitfieldTimes[7] = 2 * WAIT_CYCLES_FOR_400_MUS;
+  app_868MHz_sequencer_buildSchedule(&bitsPreamble, &schedulePreamble);
+  if ((schedulePreamble.countOfSteps != 9) || (schedulePreamble.steps[0] != schedulePreamble.steps[1])){
+    return -8;
+  }
+  arrayPreamble[0].bitfieldTimes[7] = WAIT_CYCLES_FOR_400_MUS + 1;
+  if (app_868MHz_sequencer_buildSchedule(&bitsPreamble, &schedulePreamble) != APP_868MHZ_SEQUENCER_RETURN_INVALID_TIMING){
+    return -9;
+  }
+  
+  return 0;
+}
+
+#endif
\ No newline at end of file
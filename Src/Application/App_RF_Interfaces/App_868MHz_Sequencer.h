@@ -25,13 +25,15 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Waveform by TIM2 + DMA instead of NOP loops   |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added schedule of a packed field              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Output through the S2LP packet handler        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Timer output only without the packet handler  |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Bound the FIFO wait, abort a silent S2LP      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -44,9 +46,40 @@
 #include <stdlib.h>
 #include <inttypes.h>
 
+#include "Test_Selector.h"
 #include "App_868MHz_MessageBuilder.h"
 
 /* Typedefinitions */
+// Length of one step of the waveform, matches WAIT_CYCLES_FOR_400_MUS
+#define APP_868MHZ_SEQUENCER_STEP_LENGTH_US     400
+// Maximum count of steps of one schedule (header + stuffed message = 108 bits)
+#define APP_868MHZ_SEQUENCER_MAX_STEPS          128
+
+// 1 = The packet handler of the S2LP sends the burst out of its TX FIFO
+// 0 = TIM2 and the DMA modulate the S2LP through GPIO2
+#ifndef APP_868MHZ_SEQUENCER_OUTPUT_FIFO
+  #define APP_868MHZ_SEQUENCER_OUTPUT_FIFO      1
+#endif
+
+/**
+ * @brief Return values of the schedule builder.
+ */
+typedef enum APP_868MHZ_SEQUENCER_RETURN_VALUES {
+  APP_868MHZ_SEQUENCER_RETURN_OK                = 0x00, /**< Schedule was built */
+  APP_868MHZ_SEQUENCER_RETURN_TOO_LONG          = 0x01, /**< Bitfield needs more than APP_868MHZ_SEQUENCER_MAX_STEPS */
+  APP_868MHZ_SEQUENCER_RETURN_INVALID_TIMING    = 0x02, /**< A bit time is no multiple of WAIT_CYCLES_FOR_400_MUS */
+  APP_868MHZ_SEQUENCER_RETURN_FIFO_ERROR        = 0x03, /**< The TX FIFO of the S2LP ran empty, the burst got aborted */
+  APP_868MHZ_SEQUENCER_RETURN_TIMEOUT           = 0x04, /**< The S2LP didn't finish the burst in time, it got aborted */
+} APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF;
+
+/**
+ * @brief A waveform in the form the DMA writes it to the BSRR of GPO_2_S2LP.
+ * Every step is one BSRR word which is held for APP_868MHZ_SEQUENCER_STEP_LENGTH_US.
+ */
+typedef struct APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT {
+  uint32_t countOfSteps;                                /**< Count of steps used */
+  uint32_t steps[APP_868MHZ_SEQUENCER_MAX_STEPS];       /**< BSRR words */
+} APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF;
 
 /* Variables */
 
@@ -54,6 +87,69 @@
 void setOutputToHigh(void);
 void setOutputToLow(void);
 
-void app_868MHz_sequencer_output(bitfield *bits);
+/** @brief Turns a bitfield into a schedule of BSRR words. Bits longer than one
+ *         step are split in several steps of the same level.
+ *  @param *bits The bitfield built by the message builder.
+ *  @param *schedule The schedule to fill.
+ *  @return APP_868MHZ_SEQUENCER_RETURN_OK or the reason why it failed.
+ */
+APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF app_868MHz_sequencer_buildSchedule(bitfield *bits, APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *schedule);
+
+/** @brief Turns a packed field into a schedule of BSRR words, every bit is
+ *         one step.
+ *  @param *bits The field built by the message builder.
+ *  @param *schedule The schedule to fill.
+ *  @return APP_868MHZ_SEQUENCER_RETURN_OK or the reason why it failed.
+ */
+APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF app_868MHz_sequencer_buildSchedulePacked(const BITENCODER_STRUCT_TYPEDEF *bits, APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *schedule);
+
+#if (APP_868MHZ_SEQUENCER_OUTPUT_FIFO < 1) || (TEST_APP_868MHZ_SEQUENCER >= 1)
+/** @brief Outputs the first schedule followed by repeatCount times the repeated
+ *         schedule without a gap. TIM2 paces the steps and the DMA writes them,
+ *         the core sleeps in between. Returns after the last step was held for
+ *         its full length.
+ *  @param *first The schedule sent first (e.g. preamble).
+ *  @param *repeated The schedule sent afterwards (e.g. message).
+ *  @param repeatCount How often the repeated schedule is sent.
+ *  @return Nothing.
+ */
+void app_868MHz_sequencer_output(const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *first, const APP_868MHZ_SEQUENCER_SCHEDULE_STRUCT_TYPEDEF *repeated, uint32_t repeatCount);
+#endif
+
+/** @brief Sends repeatCount times the frame without a gap as one packet of
+ *         the S2LP. Its packet handler puts the preamble in front and times
+ *         the bits, the core sleeps until the S2LP asks for more bytes and
+ *         refills the TX FIFO then. The last byte is filled up with the level
+ *         of the last bit. The S2LP has to be in S2LP_MODE_PACKET_FIFO.
+ *         If the S2LP isn't done by the time the burst takes (e.g. it got
+ *         reset meanwhile), the burst is aborted. Nothing is known about the
+ *         state of the S2LP then.
+ *  @param *frame The frame built by the message builder.
+ *  @param repeatCount How often the frame is sent.
+ *  @return APP_868MHZ_SEQUENCER_RETURN_OK or the reason why it failed.
+ */
+APP_868MHZ_SEQUENCER_RETURN_VALUES_TYPEDEF app_868MHz_sequencer_outputFifo(const BITENCODER_STRUCT_TYPEDEF *frame, uint32_t repeatCount);
+
+/** @brief Must be called by the EXTI line 4 to 15 interrupt.
+ *  @return Nothing.
+ */
+void app_868MHz_sequencer_s2lpIrqHandler(void);
+
+/** @brief Must be called by the DMA1 channel 2/3 interrupt.
+ *  @return Nothing.
+ */
+void app_868MHz_sequencer_dmaIrqHandler(void);
+
+/** @brief Must be called by the TIM2 interrupt.
+ *  @return Nothing.
+ */
+void app_868MHz_sequencer_timerIrqHandler(void);
+
+#if TEST_APP_868MHZ_SEQUENCER >= 1
+/** @brief This method is the test for this unit
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int app_868MHz_sequencer_testsuite();
+#endif
 
 #endif
\ No newline at end of file
@@ -25,13 +25,19 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 08.11.2020    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Session loop sleeps until an event is pending |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Include names match the file names            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Sequences are const                           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Session runs by the timer deadlines           |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Sequences of a flow share one link            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Sleeps by the LPTIM until the next timer      |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 008       | 2026-10-18    | Tim Steinberg         | Parser and steps run on their own events      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -44,8 +50,10 @@
 #include "EEPROM_Access.h"
 #include "Watchdog.h"
 #include "UART_RSL.h"
+#include "LPTIM.h"
 #include "Handler_Timer.h"
-#include "LED.h"
+#include "Led.h"
+#include "RingbufferWrapper.h"
 
 #include "Logic.h"
 #include "BehaviourController.h"
@@ -57,52 +65,241 @@
 #include "BehaviourV115_AlertBase.h"
 #include "BehaviourV115_SetAllCharacteristics.h"
 
-#include "app_RSL.h"
+#include "App_RSL.h"
 
 
 #define LED_IN_PROGRESS_TIME_ON         500
 #define LED_IN_PROGRESS_TIME_OFF        5000
 
+// The timers wake the stack by their deadlines, the LPTIM wakes the core up
+// for the earliest one. Without any timer it sleeps at most this long.
+#define APP_RSL_SESSION_SLEEP_MAX_MS            1000
+// Shorter sleeps keep the SysTick running, the LPTIM is not worth it then
+#define APP_RSL_SESSION_TICKLESS_MIN_MS         2
+// Controller passes run back to back after an event, the behaviour steps
+// move on by one state per pass
+#define APP_RSL_SESSION_SETTLE_PASSES           4
+// An open link is brought up anew, if no sequence ran on it for this time
+#define APP_RSL_SESSION_IDLE_TIMEOUT_MS         5000
+
 /* Typedefinitions / Prototypes */
+typedef struct APP_RSL_SESSION_SNAPSHOT_STRUCT{
+  uint32_t inputMessages;       /**< Messages in the input buffer */
+  uint32_t outputMessages;      /**< Messages in the output buffer */
+} APP_RSL_SESSION_SNAPSHOT_STRUCT_TYPEDEF;
 
 /* Variables */
 TIMER_STRUCT_TYPEDEF app_rsl_timer_led_off;
 TIMER_STRUCT_TYPEDEF app_rsl_timer_led_on;
 
+/** \brief app_rsl_session_timerIdle Runs while the link is up between two
+  *        sequences.
+  */
+static TIMER_STRUCT_TYPEDEF app_rsl_session_timerIdle;
+
+/** \brief app_rsl_session_linkUp TRUE while the UART and the stack are up.
+  */
+static bool app_rsl_session_linkUp = FALSE;
+
+/** \brief app_rsl_session_held TRUE between app_rsl_session_begin and
+  *        app_rsl_session_end, the link stays up after a sequence then.
+  */
+static bool app_rsl_session_held = FALSE;
+
 /* Function definitions */
-APP_RSL_INTERNAL_RETURN_VALUES_TYPEDEF app_rsl_handler_executeCommunication(uint32_t ledOnTime, uint32_t ledOffTime, void (*ledOnFunction)(), BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF* (*commfunction)()){
-  APP_RSL_INTERNAL_RETURN_VALUES_TYPEDEF retVal;
-  BEHAVIOUR_CONTROLLER_RETURN_VALUES_TYPEDEF returnValue;
+
+/** @brief Runs the blinking of the LED.
+ *  @param ledOnFunction Turns the LED on, may be NULL.
+ *  @param ledOffAtEnd TRUE, if the LED shall be turned off at the end of the on phase.
+ *  @return TRUE, if the on phase ended with this call.
+ */
+static bool app_rsl_session_handleLed(void (*ledOnFunction)(), bool ledOffAtEnd){
+  if (timerHandler_isTimerTimedOut(&app_rsl_timer_led_off, userMethods_characteristics_getTime()) == TRUE){
+    timerHandler_timerRestart(&app_rsl_timer_led_on, userMethods_characteristics_getTime());
+    timerHandler_timerStop(&app_rsl_timer_led_off);
+    if (ledOnFunction != NULL){
+      ledOnFunction();
+    }
+  }
+  if (timerHandler_isTimerTimedOut(&app_rsl_timer_led_on, userMethods_characteristics_getTime()) == TRUE){
+    timerHandler_timerRestart(&app_rsl_timer_led_off, userMethods_characteristics_getTime());
+    timerHandler_timerStop(&app_rsl_timer_led_on);
+    if (ledOffAtEnd == TRUE){
+      led_black();
+    }
+    return TRUE;
+  }
+  return FALSE;
+}
+
+/** @brief Takes a new snapshot of the message buffers.
+ *  @return TRUE, if a message came in or went out since the last snapshot.
+ */
+static bool app_rsl_session_takeSnapshot(APP_RSL_SESSION_SNAPSHOT_STRUCT_TYPEDEF *snapshot){
+  APP_RSL_SESSION_SNAPSHOT_STRUCT_TYPEDEF now;
+  bool changed = FALSE;
+  
+  now.inputMessages = logic_countOfMessagesInInputbuffer();
+  now.outputMessages = logic_countOfMessagesInOutputbuffer();
+  if ((now.inputMessages != snapshot->inputMessages) || (now.outputMessages != snapshot->outputMessages)){
+    changed = TRUE;
+  }
+  *snapshot = now;
+  return changed;
+}
+
+/** @brief Sleeps until the next interrupt, which is the UART reception or the
+ *         DMA of it, or until the earliest timer times out. The SysTick is
+ *         stopped meanwhile. Call it with the interrupts masked, right after
+ *         it was checked that there is nothing to do, so no interrupt gets
+ *         lost in between.
+ */
+static void app_rsl_session_sleep(void){
+  uint32_t sleepTime = APP_RSL_SESSION_SLEEP_MAX_MS;
+  uint32_t remaining;
   
+  // Is a timer running, which times out earlier?
+  if ((timerHandler_getNextDeadline(HAL_GetTick(), &remaining) == TRUE) && (remaining < sleepTime)){
+    // Yes, wake up for it
+    sleepTime = remaining;
+  }
+  // Is it due already?
+  if (sleepTime == 0){
+    // Yes
+    return;
+  }
+  // Is it too short to stop the tick?
+  if (sleepTime < APP_RSL_SESSION_TICKLESS_MIN_MS){
+    // Yes, the next tick wakes the core up
+    HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+    return;
+  }
+  // No
+  lptim_sleepForMilliseconds(sleepTime);
+}
+
+/** @brief Brings the UART and the stack up, unless they are up already. A
+ *         link that stood idle for too long is brought up anew.
+ */
+static void app_rsl_session_bringUp(void){
+  // Is the link up and was it used lately?
+  if ((app_rsl_session_linkUp == TRUE) && (timerHandler_isTimerTimedOut(&app_rsl_session_timerIdle, userMethods_characteristics_getTime()) == FALSE)){
+    // Yes, the sequence continues on it
+    timerHandler_timerStop(&app_rsl_session_timerIdle);
+    return;
+  }
+  // No
+  timerHandler_timerStop(&app_rsl_session_timerIdle);
+  if (app_rsl_session_linkUp == TRUE){
+    uart_rsl_deInit();
+    lptim_deInit();
+  }
   uart_rsl_init();
+  lptim_init();
   logic_resetEverything();
+  app_rsl_session_linkUp = TRUE;
+}
+
+/** @brief Takes the UART down.
+ */
+static void app_rsl_session_tearDown(void){
+  timerHandler_timerStop(&app_rsl_session_timerIdle);
+  // Is the link up?
+  if (app_rsl_session_linkUp == TRUE){
+    // Yes
+    uart_rsl_deInit();
+    lptim_deInit();
+    app_rsl_session_linkUp = FALSE;
+  }
+}
+
+/** @brief Keeps the link up for the sequences that follow, until
+ *         app_rsl_session_end is called. Use it around a flow of sequences.
+ *  @return Nothing.
+ */
+void app_rsl_session_begin(void){
+  app_rsl_session_held = TRUE;
+}
+
+/** @brief Ends the session of app_rsl_session_begin and takes the link down.
+ *  @return Nothing.
+ */
+void app_rsl_session_end(void){
+  app_rsl_session_held = FALSE;
+  app_rsl_session_tearDown();
+}
+
+APP_RSL_INTERNAL_RETURN_VALUES_TYPEDEF app_rsl_handler_executeCommunication(uint32_t ledOnTime, uint32_t ledOffTime, void (*ledOnFunction)(), const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF* (*commfunction)()){
+  APP_RSL_INTERNAL_RETURN_VALUES_TYPEDEF retVal;
+  BEHAVIOUR_CONTROLLER_RETURN_VALUES_TYPEDEF returnValue;
+  APP_RSL_SESSION_SNAPSHOT_STRUCT_TYPEDEF snapshot;
+  LOGIC_RETURN_VALUES_TYPEDEF parseResult;
+  uint32_t settlePasses = APP_RSL_SESSION_SETTLE_PASSES;
+  uint32_t parsedPutCount;
+  uint32_t countBeforeParse;
+  bool parsePending = TRUE;
+  uint32_t primask;
+  
+  app_rsl_session_bringUp();
   app_rsl_timer_led_off.time_waitTime = ledOffTime;
   app_rsl_timer_led_on.time_waitTime = ledOnTime;
   timerHandler_timerStop(&app_rsl_timer_led_on);
   timerHandler_timerStart(&app_rsl_timer_led_off, userMethods_characteristics_getTime(), ledOffTime);
   led_black();
   behaviourController_loadNewSequence(commfunction());
+  app_rsl_session_takeSnapshot(&snapshot);
+  parsedPutCount = ringbufferWrapper_getPutCount();
   
   do{
-    // Do LED handling
-    if (timerHandler_isTimerTimedOut(&app_rsl_timer_led_off, userMethods_characteristics_getTime()) == TRUE){
-      timerHandler_timerRestart(&app_rsl_timer_led_on, userMethods_characteristics_getTime());
-      timerHandler_timerStop(&app_rsl_timer_led_off);
-      if (ledOnFunction != NULL){
-        ledOnFunction();
+    // Feed watchdog to prevent restart
+    watchdog_feed();
+    // Did a timer time out? Only the earliest one is looked at to know
+    if (timerHandler_processExpired(HAL_GetTick()) > 0){
+      // Yes, do LED handling and let the parser (integrity timer) and the
+      // steps react on it
+      app_rsl_session_handleLed(ledOnFunction, TRUE);
+      parsePending = TRUE;
+      settlePasses = APP_RSL_SESSION_SETTLE_PASSES;
+    }
+    // Is there anything to do for the stack (new bytes or a step in progress)?
+    primask = userMethods_characteristics_enterCritical();
+    if (ringbufferWrapper_getPutCount() != parsedPutCount){
+      parsePending = TRUE;
+    }
+    if ((parsePending == FALSE) && (settlePasses == 0)){
+      // No, wait for the next interrupt or timer
+      app_rsl_session_sleep();
+      userMethods_characteristics_exitCritical(primask);
+      continue;
+    }
+    // Yes
+    userMethods_characteristics_exitCritical(primask);
+    // Are there bytes the parser has not seen yet?
+    if (parsePending == TRUE){
+      // Yes, check for communication
+      parsedPutCount = ringbufferWrapper_getPutCount();
+      countBeforeParse = ringbufferWrapper_getCount();
+      parseResult = logic_parseNachricht(HAL_GetTick());
+      // Did it take bytes? Then another frame may wait behind them
+      parsePending = (parseResult != LOGIC_RETURN_NOTHING) || (ringbufferWrapper_getCount() != countBeforeParse);
+      // Did a message come in or an ACK free the output buffer?
+      if ((parseResult != LOGIC_RETURN_NOTHING) || (app_rsl_session_takeSnapshot(&snapshot) == TRUE)){
+        // Yes, the steps react on it
+        settlePasses = APP_RSL_SESSION_SETTLE_PASSES;
       }
     }
-    if (timerHandler_isTimerTimedOut(&app_rsl_timer_led_on, userMethods_characteristics_getTime()) == TRUE){
-      timerHandler_timerRestart(&app_rsl_timer_led_off, userMethods_characteristics_getTime());
-      timerHandler_timerStop(&app_rsl_timer_led_on);
-      led_black();
+    // Is a step in progress?
+    if (settlePasses == 0){
+      // No, the parser had nothing for the steps
+      continue;
     }
-    // Feed watchdog to prevent restart
-    watchdog_feed();
-    // Check for communication
-    logic_parseNachricht(HAL_GetTick());
-    // Execute step
+    // Yes, execute step
+    settlePasses--;
     returnValue = behaviourController_main();
+    // Did the pass change anything? Then the next one follows right away
+    if ((app_rsl_session_takeSnapshot(&snapshot) == TRUE) || (returnValue == BEHAVIOUR_CONTROLLER_RETURN_ONGOING_LOAD_NEXT)){
+      settlePasses = APP_RSL_SESSION_SETTLE_PASSES;
+    }
     // Check the return value of the execute step
     if ((returnValue == BEHAVIOUR_CONTROLLER_RETURN_ONGOING) || (returnValue == BEHAVIOUR_CONTROLLER_RETURN_ONGOING_LOAD_NEXT)){
       continue;
@@ -110,20 +307,17 @@ APP_RSL_INTERNAL_RETURN_VALUES_TYPEDEF app_rsl_handler_executeCommunication(uint
     if (returnValue == BEHAVIOUR_CONTROLLER_RETURN_FINISHED){
       retVal = APP_RSL_INTERNAL_RETURN_VALUES_OK;
       
+      // Let the LED finish its on phase
       do{
         watchdog_feed();
-        if (timerHandler_isTimerTimedOut(&app_rsl_timer_led_off, userMethods_characteristics_getTime()) == TRUE){
-          timerHandler_timerRestart(&app_rsl_timer_led_on, userMethods_characteristics_getTime());
-          timerHandler_timerStop(&app_rsl_timer_led_off);
-          if (ledOnFunction != NULL){
-            ledOnFunction();
-          }
-        }
-        if (timerHandler_isTimerTimedOut(&app_rsl_timer_led_on, userMethods_characteristics_getTime()) == TRUE){
-          timerHandler_timerRestart(&app_rsl_timer_led_off, userMethods_characteristics_getTime());
-          timerHandler_timerStop(&app_rsl_timer_led_on);
+        // The timers of the stack are of no interest anymore
+        timerHandler_processExpired(HAL_GetTick());
+        if (app_rsl_session_handleLed(ledOnFunction, FALSE) == TRUE){
           break;
         }
+        primask = userMethods_characteristics_enterCritical();
+        app_rsl_session_sleep();
+        userMethods_characteristics_exitCritical(primask);
       }while(1);
       
       break;
@@ -134,7 +328,15 @@ APP_RSL_INTERNAL_RETURN_VALUES_TYPEDEF app_rsl_handler_executeCommunication(uint
       break;
     }
   }while(1);
-  uart_rsl_deInit();
+  
+  // Is the link held for the next sequence and did this one end in order?
+  if ((app_rsl_session_held == TRUE) && (retVal == APP_RSL_INTERNAL_RETURN_VALUES_OK)){
+    // Yes
+    timerHandler_timerStart(&app_rsl_session_timerIdle, userMethods_characteristics_getTime(), APP_RSL_SESSION_IDLE_TIMEOUT_MS);
+  }else{
+    // No, a repetition starts from a fresh link
+    app_rsl_session_tearDown();
+  }
   return retVal;
 }
 
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 08.11.2020    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Sequences are const                           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Sequences of a flow share one link            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -55,7 +55,9 @@ typedef enum APP_RSL_COMMUNICATION_RETURN_VALUES{
 /* Variables */
 
 /* Function definitions */
-APP_RSL_INTERNAL_RETURN_VALUES_TYPEDEF app_rsl_handler_executeCommunication(uint32_t ledOnTime, uint32_t ledOffTime, void (*ledOnFunction)(), BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF* (*commfunction)());
+void app_rsl_session_begin(void);
+void app_rsl_session_end(void);
+APP_RSL_INTERNAL_RETURN_VALUES_TYPEDEF app_rsl_handler_executeCommunication(uint32_t ledOnTime, uint32_t ledOffTime, void (*ledOnFunction)(), const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF* (*commfunction)());
 bool app_rsl_updateAllCharacteristics(void (*ledOnFunction)());
 bool app_rsl_broadcast(void (*ledOnFunction)());
 bool app_rsl_emergency(void (*ledOnFunction)());
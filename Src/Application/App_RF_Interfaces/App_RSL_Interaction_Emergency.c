@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-11    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Sequences of a flow share one link            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -62,7 +62,7 @@ typedef enum APP_RSL_INTERACTION_EMERGENCY_STATES{
 
 APP_RSL_INTERACTION_EMERGENCY_STATES_TYPEDEF emergencyStatemachine;
 
-void app_rsl_interaction_emergency_main(void){ 
+static void app_rsl_interaction_emergency_statemachine(void){
   uint32_t stateRetryCounter;
   bool afterEmergencyUpdateState = TRUE;
   USERMETHODS_CHARACTERISTICS_TRANSMISSION_STATE_TYPEDEF retVal;
@@ -221,3 +221,10 @@ void app_rsl_interaction_emergency_main(void){
   }while(1);
   
 }
+
+void app_rsl_interaction_emergency_main(void){
+  // The sequences of the flow share one link
+  app_rsl_session_begin();
+  app_rsl_interaction_emergency_statemachine();
+  app_rsl_session_end();
+}
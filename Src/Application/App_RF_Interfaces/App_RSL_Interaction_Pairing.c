@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-11    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Sequences of a flow share one link            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -61,7 +61,7 @@ typedef enum APP_RSL_INTERACTION_PAIRING_STATES{
 /* Function definitions */
 APP_RSL_INTERACTION_PAIRING_STATES_TYPEDEF pairingStatemachine;
 
-void app_rsl_interaction_pairing_main(void){  
+static void app_rsl_interaction_pairing_statemachine(void){
   uint32_t stateRetryCounter;
   bool afterPairingUpdateState = TRUE;
   USERMETHODS_CHARACTERISTICS_PAIRING_STATE_TYPEDEF retVal;
@@ -247,3 +247,10 @@ void app_rsl_interaction_pairing_main(void){
     }
   }while(1);
 }
+
+void app_rsl_interaction_pairing_main(void){
+  // The sequences of the flow share one link
+  app_rsl_session_begin();
+  app_rsl_interaction_pairing_statemachine();
+  app_rsl_session_end();
+}
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-16    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Renamed ADC button measurement                |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Note instead of #warning                      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -91,7 +91,7 @@ void TXCE_GetSoftwareVersion(ringbuffer *txInterpreter_rb){
   TXM_FillCmdInField(TX_INTERPRETER_MESSAGE_GETSOFTWAREVERSION_ANS, answerField, &pos);
   answerField[pos] = TX_INTERPRETER_SYMBOL_SPACE; pos++;
   
-#warning I dont exactly know in which format they want to have this. I assume that they want to see decimal numbers without stuffed '0's
+// I dont exactly know in which format they want to have this. I assume that they want to see decimal numbers without stuffed '0's
   pos += u32toString((uint32_t)eeprom_getSoftwareVersion_Type(), (char*) &answerField[pos]);
   answerField[pos] = TX_INTERPRETER_SYMBOL_DOT; pos++;
   if (eeprom_getSoftwareVersion_Status() == TX_INTERPRETER_SYMBOL_A){
@@ -398,7 +398,7 @@ void TXCE_ResetTestAnalog(ringbuffer *txInterpreter_rb, uint8_t paramPort, uint8
               
               // Wait for the button to reach a stable voltage
               HAL_Delay(10);
-              temp32 = adcBlocking_getButtonVoltage_fourOutOfSixAveraged();
+              temp32 = adcBlocking_getButtonVoltage();
               break;
               
             default: // If you try to reach a pin number that is not existing
@@ -477,7 +477,7 @@ void TXCE_ResetTest(ringbuffer *txInterpreter_rb){
     HAL_Delay(100);
     
     battery = batterylevel_mV();
-    buttonVal = adcBlocking_getButtonVoltage_fourOutOfSixAveraged();
+    buttonVal = adcBlocking_getButtonVoltage();
     
     upper = UserButtonGetLevel(battery, 1741, 11); // Upper level set to 85,00%, Userbutton set to more than 80%
     lower = UserButtonGetLevel(battery, 1229, 11); // Lower level set to 60,00%, Userbutton set to less than 70%
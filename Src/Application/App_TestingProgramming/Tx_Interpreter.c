@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-12    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Static power-of-two ringbuffer                |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Note instead of #warning                      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -59,16 +59,14 @@
 /* Typedefinitions / Prototypes */
 #define TX_INTERPRETER_RBBUFFER_LENGTH 128
 
+#if (TX_INTERPRETER_RBBUFFER_LENGTH & (TX_INTERPRETER_RBBUFFER_LENGTH - 1)) != 0
+  #error TX_INTERPRETER_RBBUFFER_LENGTH MUST BE A POWER OF TWO!
+#endif
+
 /* Variables */
 uint8_t txInterpreter_rbBuffer[TX_INTERPRETER_RBBUFFER_LENGTH];
 
-ringbuffer txInterpreter_rb = {
-  .length = TX_INTERPRETER_RBBUFFER_LENGTH,
-  .count = 0,
-  .readptr = txInterpreter_rbBuffer, 
-  .writeptr = txInterpreter_rbBuffer,
-  .buffer = txInterpreter_rbBuffer,          
-};
+ringbuffer txInterpreter_rb = RINGBUFFER_INITIALIZER(txInterpreter_rbBuffer, TX_INTERPRETER_RBBUFFER_LENGTH);
 
 /* Function definitions */
 void txInterpreter_uartReceptionCallback(){
@@ -115,7 +113,7 @@ void txInterpreter_DoTestMode(void){
     do{}while(1);
   }
   
-#warning "DELETE THIS IF FOR RELEASE!"
+// DELETE THIS IF FOR RELEASE!
   if (flashCheck_UpdateEEPROMCRC() == FALSE){
     do{}while(1);
   }
@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * @file       Application_Test.c
+  * @author     Tim Steinberg
+  * @date       17.10.2026
+  * @brief      Test option and runner for all units of the application and
+  *             the peripherals outside of the RSL protocol.
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-17    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-17    | Tim Steinberg         | Added test of EEPROM_Log.c                    |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 003       | 2026-10-18    | Tim Steinberg         | Failures end the host build with an error     |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 004       | 2026-10-18    | Tim Steinberg         | Added test of CRC.c                           |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 005       | 2026-10-18    | Tim Steinberg         | Added TEST_APP_868MHZ_MESSAGEBUILDER          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Added test of S2LP.c                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Added TEST_APP_868MHZ                         |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 008       | 2026-10-18    | Tim Steinberg         | Added test of LPTIM.c                         |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+/* Includes */
+#include "Test_Selector.h"
+#include "Debug.h"
+
+#include "App_868MHz_Sequencer.h"
+#include "App_868MHz_MessageBuilder.h"
+#include "FlashCheck.h"
+#include "EEPROM_Log.h"
+#include "CRC.h"
+#include "S2LP.h"
+#include "App_868MHz.h"
+#include "LPTIM.h"
+/* Typedefinitions */
+
+/* Variables */
+
+/* Function definitions */
+
+void applicationTestsuite_tests(){
+  
+#if TEST_GROUP_APPLICATION_ACTIVE >= 1
+  int32_t retVal;
+#endif 
+  
+#if TEST_APP_868MHZ_SEQUENCER >= 1
+  retVal = app_868MHz_sequencer_testsuite();
+  TRACE_TEST_VALUES(1, "TEST App_868MHz_Sequencer.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_FLASHCHECK >= 1
+  retVal = flashCheck_testsuite();
+  TRACE_TEST_VALUES(1, "TEST FlashCheck.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_EEPROM_LOG >= 1
+  retVal = eepromLog_testsuite();
+  TRACE_TEST_VALUES(1, "TEST EEPROM_Log.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_CRC >= 1
+  retVal = crc_testsuite();
+  TRACE_TEST_VALUES(1, "TEST CRC.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_APP_868MHZ_MESSAGEBUILDER >= 1
+  retVal = app_868MHz_messageBuilder_testsuite();
+  TRACE_TEST_VALUES(1, "TEST App_868MHz_MessageBuilder.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_S2LP >= 1
+  retVal = S2LP_testsuite();
+  TRACE_TEST_VALUES(1, "TEST S2LP.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_APP_868MHZ >= 1
+  retVal = app_868MHz_testsuite();
+  TRACE_TEST_VALUES(1, "TEST App_868MHz.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_LPTIM >= 1
+  retVal = lptim_testsuite();
+  TRACE_TEST_VALUES(1, "TEST LPTIM.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+}
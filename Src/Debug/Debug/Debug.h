@@ -10,8 +10,9 @@
 /* ====> Functions prototypes                                                   */
 /********************************************************************************/
 
-#include "String.h"
-#include "Stdio.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
 
 #define DEBUG_PROCESSOR_HALTABLE 0
 
@@ -133,4 +134,12 @@
   #define DEBUG_LEESYS_STACK_VALUES(y, x ...)
 #endif /* DEBUG_LEESYS_STACK */
 
+// A failed testsuite halts the processor for the debugger, the host build ends
+// the process with an error instead
+#if defined(HOST_BUILD)
+  #define TEST_FAILURE_HALT()   do{ printf("TEST FAILED %s:%i\r\n", __FILE__, __LINE__); exit(EXIT_FAILURE); }while(0)
+#else
+  #define TEST_FAILURE_HALT()   do{}while(1)
+#endif
+
 #endif
\ No newline at end of file
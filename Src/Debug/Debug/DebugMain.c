@@ -40,6 +40,7 @@
 #include "RSL_Protocol_Lower_Level_Test.h"
 #include "RSL_Protocol_Upper_Level_Steps_Test.h"
 #include "RSL_Protocol_Upper_Level_Behaviours_Test.h"
+#include "Application_Test.h"
 
 /* Typedefinitions / Prototypes */
 
@@ -51,4 +52,7 @@ void debugMain(){
   rslProtocolTestsuite_testsLowerLevel();
   rslProtocolTestsuite_testsUpperLevel_steps();
   rslProtocolTestsuite_testsUpperLevel_behaviours();
+  
+  // Application and peripheral tests
+  applicationTestsuite_tests();
 }
\ No newline at end of file
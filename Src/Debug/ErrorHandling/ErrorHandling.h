@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-13    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Added ACCESS_ADC_CONVERSION_FAILED            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -51,6 +51,7 @@ typedef enum ERROR_CODES {
   ACCESS_EEPROM_ACCESS_FAILED           = 0x00010000,
   ACCESS_WATCHDOG_FEED_FAILED           = 0x00010001,
   ACCESS_RTC_CALIBRATION_FAILED         = 0x00010002,
+  ACCESS_ADC_CONVERSION_FAILED          = 0x00010003,
   
   // INIT OF PERIPHERALS
   INIT_WATCHDOG_FAILED                  = 0x00020000,
@@ -60,6 +61,8 @@ typedef enum ERROR_CODES {
   INIT_RTC_FAILED                       = 0x00020004,
   INIT_CRC_FAILED                       = 0x00020005,
   INIT_SPI_FAILED                       = 0x00020006,
+  INIT_DMA_FAILED                       = 0x00020007,
+  INIT_TIMER_FAILED                     = 0x00020008,
   
   UNKNOWN                               = 0xFFFFFFFE,
 } ERROR_CODES_TYPEDEF;
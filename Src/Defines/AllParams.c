@@ -10,7 +10,7 @@
 
 #include "MasterDefine.h"
 #include "AllParams.h"
-#include "String.h"
+#include <string.h>
 #include "Tools.h"
 
 //#pragma location = PARAM_FACTORY_ADDR
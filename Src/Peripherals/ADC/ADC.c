@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Oversampled DMA captures in batches           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Bounded wait for the capture                  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -42,45 +42,78 @@
 #include "Debug.h"
 #include "ErrorHandling.h"
 #include "RTC.h"
+#include "ADC.h"
 
 /* Typedefinitions / Prototypes */
-void adcBlocking_button_init(void);
-void adcBlocking_button_deInit(void);
-void adcBlocking_batterylevel_init(void);
-void adcBlocking_batterylevel_deInit(void);
-uint16_t adcBlocking_getSingleMeasurementRaw(void);
-uint16_t adcBlocking_getFourOutOfSixAveragedRaw(void);
+// The oversampler sums 4 conversions of a channel and shifts them back to
+// 12 bit, this replaces the 4 out of 6 average in software
+#define ADC_ACQUISITION_OVERSAMPLING_RATIO      ADC_OVERSAMPLING_RATIO_4
+#define ADC_ACQUISITION_OVERSAMPLING_SHIFT      ADC_RIGHTBITSHIFT_2
+// One capture scans the button and VREFINT, the DMA stores them in the order
+// of the channel numbers
+#define ADC_ACQUISITION_SAMPLES                 2
+#define ADC_ACQUISITION_SAMPLE_BUTTON           0
+#define ADC_ACQUISITION_SAMPLE_VREFINT          1
+// Time in ms a capture may take, as the former polled conversion
+#define ADC_ACQUISITION_TIMEOUT                 10
+
+void adc_acquisition_init(void);
+void adc_acquisition_deInit(void);
+bool adc_acquisition_capture(uint32_t channels, uint32_t countOfChannels);
+uint16_t adc_acquisition_linearizeBatteryVoltage(uint32_t vrefint);
 uint16_t adcBlocking_getFactoryCalibrationValue(void);
 
 /* Variables */
 extern ADC_HandleTypeDef hadc;
-extern DMA_HandleTypeDef hdma_adc;
-uint32_t adcFactoryCalibrationValue;
+DMA_HandleTypeDef hdma_adc;
+
+/** \brief adcAcquisitionOpenCount
+  *        Nesting depth of adc_acquisition_open, the ADC stays configured as
+  *        long as it is above 0.
+  */
+static uint32_t adcAcquisitionOpenCount = 0;
+
+/** \brief adcAcquisitionVrefintNumerator
+  *        VREF * VREFINT_CAL, loaded once per batch.
+  */
+static uint32_t adcAcquisitionVrefintNumerator;
+
+/** \brief adcAcquisitionSamples
+  *        The DMA writes the oversampled results of one capture into this.
+  */
+static uint16_t adcAcquisitionSamples[ADC_ACQUISITION_SAMPLES];
+
+/** \brief adcAcquisitionDone
+  *        Set by the DMA transfer complete of the running capture.
+  */
+static volatile bool adcAcquisitionDone = FALSE;
 
 /* Function definitions */
 void adc_doInitialCalibration(void){
-  adcBlocking_batterylevel_init();
+  adc_acquisition_init();
   HAL_Delay(10);
   HAL_ADCEx_Calibration_Start(&hadc, ADC_SINGLE_ENDED);
   uint32_t adc_cal = HAL_ADCEx_Calibration_GetValue(&hadc, ADC_SINGLE_ENDED);
   rtc_adcCalSet(adc_cal);
-  adcBlocking_batterylevel_deInit();
+  adc_acquisition_deInit();
 }
 
 uint16_t adcBlocking_getFactoryCalibrationValue(void){
   return *((uint16_t*) ((uint32_t) 0x1FF80078));
 }
 
-void adcBlocking_button_init(void){
-  TRACE_PROCEDURE_CALLS(1, "adcBlocking_button_init(void)\r\n");
-    
+void adc_acquisition_init(void){
+  TRACE_PROCEDURE_CALLS(1, "adc_acquisition_init(void)\r\n");
+  
   __HAL_RCC_ADC1_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
   
-  ADC_ChannelConfTypeDef sConfig = {0};
-
   /** Configure the global features of the ADC (Clock, Resolution, Data Alignment and number of conversion) */
   hadc.Instance = ADC1;
-  hadc.Init.OversamplingMode = DISABLE;
+  hadc.Init.OversamplingMode = ENABLE;
+  hadc.Init.Oversample.Ratio = ADC_ACQUISITION_OVERSAMPLING_RATIO;
+  hadc.Init.Oversample.RightBitShift = ADC_ACQUISITION_OVERSAMPLING_SHIFT;
+  hadc.Init.Oversample.TriggeredMode = ADC_TRIGGEREDMODE_SINGLE_TRIGGER;
   hadc.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV1;
   hadc.Init.Resolution = ADC_RESOLUTION_12B;
   hadc.Init.SamplingTime = ADC_SAMPLETIME_160CYCLES_5; //ADC_SAMPLETIME_1CYCLE_5;
@@ -95,141 +128,133 @@ void adcBlocking_button_init(void){
   hadc.Init.Overrun = ADC_OVR_DATA_PRESERVED;
   hadc.Init.LowPowerAutoWait = DISABLE;
   hadc.Init.LowPowerFrequencyMode = DISABLE;
-  hadc.Init.LowPowerAutoPowerOff = DISABLE;
+  // Powers the ADC down between the captures of a batch
+  hadc.Init.LowPowerAutoPowerOff = ENABLE;
   if (HAL_ADC_Init(&hadc) != HAL_OK)
   {
     Error_Handler_TxV2(INIT_ADC_FAILED);
   }
   
-  // Lsche alle Kanle aus der Kanalkonfiguration
-  hadc.Instance->CHSELR &= (~ADC_CHANNEL_MASK);
-  
-  /** Configure for the selected ADC regular channel to be converted. */
-  sConfig.Channel = ADC_CHANNEL_1;
-  sConfig.Rank = ADC_RANK_CHANNEL_NUMBER;
-  if (HAL_ADC_ConfigChannel(&hadc, &sConfig) != HAL_OK)
+  // The ADC is mapped on channel 1 by request 0
+  hdma_adc.Instance = DMA1_Channel1;
+  hdma_adc.Init.Request = DMA_REQUEST_0;
+  hdma_adc.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_adc.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_adc.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_adc.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  hdma_adc.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+  hdma_adc.Init.Mode = DMA_NORMAL;
+  hdma_adc.Init.Priority = DMA_PRIORITY_LOW;
+  if (HAL_DMA_Init(&hdma_adc) != HAL_OK)
   {
-    Error_Handler_TxV2(INIT_ADC_CHANNEL_FAILED);
+    Error_Handler_TxV2(INIT_DMA_FAILED);
   }
+  __HAL_LINKDMA(&hadc, DMA_Handle, hdma_adc);
+  
+  HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
   
   // Lese alte Kalibrationswerte aus und verwende nochmal
   uint32_t adc_cal = rtc_adcCalGet();
   HAL_ADCEx_Calibration_SetValue(&hadc, ADC_SINGLE_ENDED, adc_cal);
 }
 
-void adcBlocking_button_deInit(void){
-  TRACE_PROCEDURE_CALLS(1, "adcBlocking_button_deInit(void)\r\n");
+void adc_acquisition_deInit(void){
+  TRACE_PROCEDURE_CALLS(1, "adc_acquisition_deInit(void)\r\n");
   
+  HAL_NVIC_DisableIRQ(DMA1_Channel1_IRQn);
+  HAL_DMA_DeInit(&hdma_adc);
   HAL_ADC_DeInit(&hadc);
   __HAL_RCC_ADC1_CLK_DISABLE();
 }
 
   //#define ADC_RANK_CHANNEL_NUMBER                 ((uint32_t)0x00001000U)  /*!< Enable the rank of the selected channels. Number of ranks in the sequence is defined by number of channels enabled, rank of each channel is defined by channel number (channel 0 fixed on rank 0, channel 1 fixed on rank1, ...) */
 
-void adcBlocking_batterylevel_init(void){
-  TRACE_PROCEDURE_CALLS(1, "adcBlocking_batterylevel_init(void)\r\n");
+void adc_acquisition_open(void){
+  // Is the ADC already configured by an outer batch?
+  if (adcAcquisitionOpenCount++ > 0){
+    // Yes, nothing to do
+    return;
+  }
+  
+  adc_acquisition_init();
+  
+  // Compensate difference from target voltage as TeleAlarm does
+  // VREF = Value where the calibrated value was taken
+  // gl_vRefintFactory = (*((uint16_t*) ((uint32_t) 0x1FF80078))) / 4; in TeleAlarm ressources
+  // adcFactoryCalibrationValue = (*((uint16_t*) ((uint32_t) 0x1FF80078))); redefined, no shift since all values use 12 bit
+  adcAcquisitionVrefintNumerator = VREF * adcBlocking_getFactoryCalibrationValue();
+}
 
-  __HAL_RCC_ADC1_CLK_ENABLE();
+void adc_acquisition_close(void){
+  // Is this the end of the outermost batch?
+  if ((adcAcquisitionOpenCount == 0) || (--adcAcquisitionOpenCount > 0)){
+    // No, the ADC stays configured
+    return;
+  }
   
+  adc_acquisition_deInit();
+}
+
+bool adc_acquisition_capture(uint32_t channels, uint32_t countOfChannels){
+  TRACE_PROCEDURE_CALLS(1, "adc_acquisition_capture(uint32_t channels, uint32_t countOfChannels)\r\n");
   ADC_ChannelConfTypeDef sConfig = {0};
-  /** Configure the global features of the ADC (Clock, Resolution, Data Alignment and number of conversion) */
-  hadc.Instance = ADC1;
-  hadc.Init.OversamplingMode = DISABLE;
-  hadc.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV1;
-  hadc.Init.Resolution = ADC_RESOLUTION_12B;
-  hadc.Init.SamplingTime = ADC_SAMPLETIME_160CYCLES_5; //ADC_SAMPLETIME_1CYCLE_5;
-  hadc.Init.ScanConvMode = ADC_SCAN_DIRECTION_FORWARD;
-  hadc.Init.DataAlign = ADC_DATAALIGN_RIGHT;
-  hadc.Init.ContinuousConvMode = DISABLE;
-  hadc.Init.DiscontinuousConvMode = DISABLE;
-  hadc.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
-  hadc.Init.ExternalTrigConv = ADC_SOFTWARE_START;
-  hadc.Init.DMAContinuousRequests = DISABLE;
-  hadc.Init.EOCSelection = ADC_EOC_SINGLE_CONV;
-  hadc.Init.Overrun = ADC_OVR_DATA_PRESERVED;
-  hadc.Init.LowPowerAutoWait = DISABLE;
-  hadc.Init.LowPowerFrequencyMode = DISABLE;
-  hadc.Init.LowPowerAutoPowerOff = DISABLE;
-  if (HAL_ADC_Init(&hadc) != HAL_OK)
-  {
-    Error_Handler_TxV2(INIT_ADC_FAILED);
-  }
+  uint32_t startTime;
   
   // Lsche alle Kanle aus der Kanalkonfiguration
   hadc.Instance->CHSELR &= (~ADC_CHANNEL_MASK);
   
-  /** Configure for the selected ADC regular channel to be converted. */
-  sConfig.Channel = ADC_CHANNEL_VREFINT;
+  /** Configure for the selected ADC regular channels to be converted. */
   sConfig.Rank = ADC_RANK_CHANNEL_NUMBER;
-  if (HAL_ADC_ConfigChannel(&hadc, &sConfig) != HAL_OK)
-  {
-    Error_Handler_TxV2(INIT_ADC_CHANNEL_FAILED);
+  if ((channels & ADC_CHANNEL_1) == ADC_CHANNEL_1){
+    sConfig.Channel = ADC_CHANNEL_1;
+    if (HAL_ADC_ConfigChannel(&hadc, &sConfig) != HAL_OK)
+    {
+      Error_Handler_TxV2(INIT_ADC_CHANNEL_FAILED);
+    }
+  }
+  if ((channels & ADC_CHANNEL_VREFINT) == ADC_CHANNEL_VREFINT){
+    sConfig.Channel = ADC_CHANNEL_VREFINT;
+    if (HAL_ADC_ConfigChannel(&hadc, &sConfig) != HAL_OK)
+    {
+      Error_Handler_TxV2(INIT_ADC_CHANNEL_FAILED);
+    }
   }
   
-  // Lese alte Kalibrationswerte aus und verwende nochmal
-  uint32_t adc_cal = rtc_adcCalGet();
-  HAL_ADCEx_Calibration_SetValue(&hadc, ADC_SINGLE_ENDED, adc_cal);
-}
-
-void adcBlocking_batterylevel_deInit(void){
-  TRACE_PROCEDURE_CALLS(1, "adcBlocking_batterylevel_deInit(void)\r\n");
-  
-  HAL_ADC_DeInit(&hadc);
-  __HAL_RCC_ADC1_CLK_DISABLE();
-}
-
-uint16_t adcBlocking_getSingleMeasurementRaw(void){
-  TRACE_PROCEDURE_CALLS(1, "adcBlocking_getMeasurement(void)\r\n");
-  uint16_t val;
-  HAL_ADC_Start(&hadc);
-  //HAL_ADC_PollForConversion(&hadc, 10);
-  //val = (uint16_t)HAL_ADC_GetValue(&hadc); // First "Dummy" measure! (ST problem ?...)
-  HAL_ADC_PollForConversion(&hadc, 10);
-  val = (uint16_t)HAL_ADC_GetValue(&hadc); 
-  HAL_ADC_Stop(&hadc);
-  return val;
-}
-
-uint16_t adcBlocking_getFourOutOfSixAveragedRaw(void){
-  uint16_t min = 0xFFFF;
-  uint16_t max = 0x0000;
-  uint32_t sum = 0;
-  uint16_t temp;
+  // One scan of the sequence, the transfer complete ends it
+  adcAcquisitionDone = FALSE;
+  if (HAL_ADC_Start_DMA(&hadc, (uint32_t*) adcAcquisitionSamples, countOfChannels) != HAL_OK)
+  {
+    Error_Handler_TxV2(ACCESS_ADC_CONVERSION_FAILED);
+    return FALSE;
+  }
   
-  for (int i = 0; i < 6; i++){
-    temp = adcBlocking_getSingleMeasurementRaw(); 
-    if (min > temp){
-      min = temp;
+  startTime = HAL_GetTick();
+  while (adcAcquisitionDone == FALSE){
+    // Did the ADC or the DMA stall?
+    if ((HAL_GetTick() - startTime) >= ADC_ACQUISITION_TIMEOUT){
+      // Yes, the SysTick wakes the WFI at least once per ms
+      HAL_ADC_Stop_DMA(&hadc);
+      Error_Handler_TxV2(ACCESS_ADC_CONVERSION_FAILED);
+      return FALSE;
     }
-    if (max < temp){
-      max = temp;
+    // The check and the WFI must not be split by the interrupt that ends it,
+    // a pending interrupt wakes the WFI up even while masked
+    __disable_irq();
+    if (adcAcquisitionDone == FALSE){
+      HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
     }
-    sum += temp;
+    __enable_irq();
   }
   
-  sum -= min;
-  sum -= max;
-  // Shift right times 2 because it's a sum of 4 summands
-  sum = sum >> 2;
-  
-  return (uint16_t)sum;
+  HAL_ADC_Stop_DMA(&hadc);
+  return TRUE;
 }
 
-uint16_t adcBlocking_getBatteryVoltage_fourOutOfSixAveragedLinearizedOffsetted(void){
+uint16_t adc_acquisition_linearizeBatteryVoltage(uint32_t vrefint){
   uint32_t temp;
   
-  adcBlocking_batterylevel_init();
-  // Get average from 4 oo 6
-  temp = adcBlocking_getFourOutOfSixAveragedRaw();
-  
-  adcBlocking_batterylevel_deInit();
-  
-  // Compensate difference from target voltage as TeleAlarm does
-  // VREF = Value where the calibrated value was taken
-  // gl_vRefintFactory = (*((uint16_t*) ((uint32_t) 0x1FF80078))) / 4; in TeleAlarm ressources
-  // adcFactoryCalibrationValue = (*((uint16_t*) ((uint32_t) 0x1FF80078))); redefined, no shift since all values use 12 bit
-  
-  temp = (VREF * adcBlocking_getFactoryCalibrationValue()) / temp;
+  temp = adcAcquisitionVrefintNumerator / vrefint;
   
   // Compensate unlinearity as TeleAlarm does
   temp = (((temp * 523) >> 9)); // * 513 followed by RSH 9 equals a factor of 1.021484375
@@ -247,17 +272,57 @@ uint16_t adcBlocking_getBatteryVoltage_fourOutOfSixAveragedLinearizedOffsetted(v
   return (uint16_t)temp;
 }
 
-uint16_t adcBlocking_getButtonVoltage_fourOutOfSixAveraged(void){
+uint16_t adc_acquisition_getBatteryVoltage(void){
+  // VREFINT alone, it is the first sample then
+  if (adc_acquisition_capture(ADC_CHANNEL_VREFINT, 1) == FALSE){
+    return ADC_ACQUISITION_FAILED;
+  }
+  
+  return adc_acquisition_linearizeBatteryVoltage(adcAcquisitionSamples[0]);
+}
+
+uint16_t adc_acquisition_getButtonVoltage(void){
+  uint32_t temp;
+  uint16_t battVal;
+  
+  if (adc_acquisition_capture(ADC_CHANNEL_1 | ADC_CHANNEL_VREFINT, ADC_ACQUISITION_SAMPLES) == FALSE){
+    return ADC_ACQUISITION_FAILED;
+  }
+  
+  battVal = adc_acquisition_linearizeBatteryVoltage(adcAcquisitionSamples[ADC_ACQUISITION_SAMPLE_VREFINT]);
+  temp = (battVal * adcAcquisitionSamples[ADC_ACQUISITION_SAMPLE_BUTTON]) >> 12;
+  
+  return (uint16_t)temp;
+}
+
+void adc_dmaIrqHandler(void){
+  HAL_DMA_IRQHandler(&hdma_adc);
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc){
+  adcAcquisitionDone = TRUE;
+}
+
+uint16_t adcBlocking_getBatteryVoltageLinearizedOffsetted(void){
   uint16_t temp;
-  uint16_t battVal = adcBlocking_getBatteryVoltage_fourOutOfSixAveragedLinearizedOffsetted();
   
-  adcBlocking_button_init();
+  adc_acquisition_open();
+  
+  temp = adc_acquisition_getBatteryVoltage();
+  
+  adc_acquisition_close();
   
-  temp = adcBlocking_getFourOutOfSixAveragedRaw();
+  return temp;
+}
+
+uint16_t adcBlocking_getButtonVoltage(void){
+  uint16_t temp;
+  
+  adc_acquisition_open();
   
-  adcBlocking_button_deInit();
+  temp = adc_acquisition_getButtonVoltage();
   
-  temp = (battVal * temp) >> 12;
+  adc_acquisition_close();
   
   return temp;
-}
\ No newline at end of file
+}
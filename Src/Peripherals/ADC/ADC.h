@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Oversampled DMA captures in batches           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | ADC_ACQUISITION_FAILED on a stalled capture   |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -43,12 +43,57 @@
 #include "stm32l0xx_hal.h"
 
 /* Typedefinitions */
+/** \brief ADC_ACQUISITION_FAILED
+  *        The voltage given if the capture did not end in time.
+  */
+#define ADC_ACQUISITION_FAILED                  0xFFFF
 
 /* Variables */
 
 /* Function definitions */
 void     adc_doInitialCalibration(void);
-uint16_t adcBlocking_getBatteryVoltage_fourOutOfSixAveragedLinearizedOffsetted(void);
-uint16_t adcBlocking_getButtonVoltage_fourOutOfSixAveraged(void);
+
+/** @brief This method will configure the ADC for a batch of measurements. It
+ *         stays configured until the matching adc_acquisition_close, batches
+ *         can be nested.
+ *  @return Nothing.
+ */
+void     adc_acquisition_open(void);
+
+/** @brief This method will end a batch of measurements and release the ADC
+ *         with the outermost batch.
+ *  @return Nothing.
+ */
+void     adc_acquisition_close(void);
+
+/** @brief This method will measure the battery voltage within a batch
+ *  @return The battery voltage in mV, linearized and offsetted.
+ *  @return ADC_ACQUISITION_FAILED if the capture did not end in time.
+ */
+uint16_t adc_acquisition_getBatteryVoltage(void);
+
+/** @brief This method will measure the button voltage within a batch. The
+ *         battery voltage is taken in the same capture.
+ *  @return The button voltage in mV.
+ *  @return ADC_ACQUISITION_FAILED if the capture did not end in time.
+ */
+uint16_t adc_acquisition_getButtonVoltage(void);
+
+/** @brief This method will handle the interrupt of the ADC DMA channel
+ *  @return Nothing.
+ */
+void     adc_dmaIrqHandler(void);
+
+/** @brief This method will measure the battery voltage in a batch of its own
+ *  @return The battery voltage in mV, linearized and offsetted.
+ *  @return ADC_ACQUISITION_FAILED if the capture did not end in time.
+ */
+uint16_t adcBlocking_getBatteryVoltageLinearizedOffsetted(void);
+
+/** @brief This method will measure the button voltage in a batch of its own
+ *  @return The button voltage in mV.
+ *  @return ADC_ACQUISITION_FAILED if the capture did not end in time.
+ */
+uint16_t adcBlocking_getButtonVoltage(void);
 
 #endif
\ No newline at end of file
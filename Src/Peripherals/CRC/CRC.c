@@ -3,7 +3,7 @@
   * @file       CRC.c
   * @author     Tim Steinberg
   * @date       08.07.2020
-  * @brief      NOT USED YET
+  * @brief      CRC unit and the CRC16 of the 868 MHz protocol
   ******************************************************************************
   * Redistribution in source and binary forms, with or without modification,
   * are not permitted. Use in source code needs the written approval of the author.
@@ -25,13 +25,13 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-08    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | CRC32 continuable from a saved state          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Include the own header                        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Table driven CRC16, CRC unit stays configured |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Removed the dead crc_test                     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -41,37 +41,102 @@
 #include "MasterDefine.h"
 #include "Debug.h"
 #include "ErrorHandling.h"
+#include "CRC.h"
 
 /* Typedefinitions / Prototypes */
+typedef enum CRC_CONFIGURATION_VALUES{
+  CRC_CONFIGURATION_NONE                = 0x00, /**< The unit is off */
+  CRC_CONFIGURATION_MPEG2               = 0x01, /**< The unit runs the CRC32 MPEG2 */
+  CRC_CONFIGURATION_868MHZ              = 0x02, /**< The unit runs the CRC16 of the 868 MHz protocol */
+} CRC_CONFIGURATION_VALUES_TYPEDEF;
 
 /* Variables */
 extern CRC_HandleTypeDef hcrc;
 
+/** \brief crc_configuration The configuration the CRC unit holds right now,
+  *        the 868 MHz CRC16 keeps it between its calls.
+  */
+static CRC_CONFIGURATION_VALUES_TYPEDEF crc_configuration = CRC_CONFIGURATION_NONE;
+
+/** \brief crc_crc16Table The CRC16 (poly 0x1021) of every byte value, the
+  *        byte wise engine takes one entry per byte.
+  */
+static const uint16_t crc_crc16Table[256] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+  0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+  0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+  0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+  0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+  0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+  0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+  0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+  0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+  0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+  0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+  0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+  0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+  0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+  0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+  0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+  0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+  0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+  0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+  0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+  0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+  0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+  0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+  0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+  0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+  0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+  0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+  0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+  0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+  0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+  0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+/** \brief crc_crc16NibbleTable The CRC16 (poly 0x1021) of every nibble value,
+  *        the small engine takes two entries per byte.
+  */
+static const uint16_t crc_crc16NibbleTable[16] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
 /* Function definitions */
 void crc_deInit(void){
   HAL_CRC_DeInit(&hcrc);
   __HAL_RCC_CRC_CLK_DISABLE();
+  crc_configuration = CRC_CONFIGURATION_NONE;
 }
 
-void crc_init_MPEG2(void)
+void crc_init_MPEG2(uint32_t initValue)
 {
   hcrc.Instance = CRC;
   hcrc.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_DISABLE;
-  hcrc.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_ENABLE;
+  hcrc.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_DISABLE;
   hcrc.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_NONE;
   hcrc.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE;
   hcrc.InputDataFormat = CRC_INPUTDATA_FORMAT_WORDS;
   hcrc.Init.CRCLength = CRC_POLYLENGTH_32B;
   hcrc.Init.GeneratingPolynomial = 0x04C11DB7;
-  hcrc.Init.InitValue = 0xFFFFFFFF;
+  hcrc.Init.InitValue = initValue;
   if (HAL_CRC_Init(&hcrc) != HAL_OK)
   {
     Error_Handler_TxV2(INIT_CRC_FAILED);
   }
+  crc_configuration = CRC_CONFIGURATION_MPEG2;
 }
 
 uint32_t crc_calcCrc32_MPEG2(uint32_t *ptrToData, uint32_t length){
-  crc_init_MPEG2();
+  return crc_calcCrc32_MPEG2_continue(CRC_CRC32_MPEG2_INIT, ptrToData, length);
+}
+
+// MPEG2 has neither a reflection nor a final XOR, so the result of one part is
+// exactly the register state to start the next part with
+uint32_t crc_calcCrc32_MPEG2_continue(uint32_t crcState, uint32_t *ptrToData, uint32_t length){
+  crc_init_MPEG2(crcState);
   hcrc.Instance->DR = 0x00000000;
   uint32_t crc = HAL_CRC_Calculate(&hcrc, ptrToData, length);
   crc_deInit();
@@ -100,6 +165,25 @@ uint16_t crc_calcCrc16_868MHzProtocol_softwareCrc(uint8_t *ptrToData, uint32_t l
   return wLocalCrc16;
 }
 
+uint16_t crc_calcCrc16_868MHzProtocol_tableCrc(uint8_t *ptrToData, uint32_t length){
+  uint16_t crc = 0x0000;
+  
+  for (uint32_t i = 0; i < length; i++){
+    crc = (uint16_t) (crc << 8) ^ crc_crc16Table[(uint8_t) ((crc >> 8) ^ ptrToData[i])];
+  }
+  return crc;
+}
+
+uint16_t crc_calcCrc16_868MHzProtocol_nibbleCrc(uint8_t *ptrToData, uint32_t length){
+  uint16_t crc = 0x0000;
+  
+  for (uint32_t i = 0; i < length; i++){
+    crc = (uint16_t) (crc << 4) ^ crc_crc16NibbleTable[((crc >> 12) ^ (ptrToData[i] >> 4)) & 0x0F];
+    crc = (uint16_t) (crc << 4) ^ crc_crc16NibbleTable[((crc >> 12) ^ ptrToData[i]) & 0x0F];
+  }
+  return crc;
+}
+
 void crc_init_868MHzProtocol(void)
 {
   hcrc.Instance = CRC;
@@ -115,19 +199,93 @@ void crc_init_868MHzProtocol(void)
   {
     Error_Handler_TxV2(INIT_CRC_FAILED);
   }
+  crc_configuration = CRC_CONFIGURATION_868MHZ;
 }
 
+// The unit keeps its configuration until the CRC32 needs it, every calculation
+// starts from the init value anyway
 uint16_t crc_calcCrc16_868MHzProtocol_hardwareCrc(uint8_t *ptrToData, uint32_t length){
-  crc_init_868MHzProtocol();
-  hcrc.Instance->DR = 0x00000000;
-  uint32_t crc = HAL_CRC_Calculate(&hcrc, (uint32_t*)ptrToData, length);
+  if (crc_configuration != CRC_CONFIGURATION_868MHZ){
+    crc_init_868MHzProtocol();
+  }
+  return (uint16_t) HAL_CRC_Calculate(&hcrc, (uint32_t*)ptrToData, length);
+}
+
+uint16_t crc_calcCrc16_868MHzProtocol(uint8_t *ptrToData, uint32_t length){
+#if CRC_CRC16_ENGINE == CRC_CRC16_ENGINE_HARDWARE
+  return crc_calcCrc16_868MHzProtocol_hardwareCrc(ptrToData, length);
+#elif CRC_CRC16_ENGINE == CRC_CRC16_ENGINE_NIBBLE
+  return crc_calcCrc16_868MHzProtocol_nibbleCrc(ptrToData, length);
+#elif CRC_CRC16_ENGINE == CRC_CRC16_ENGINE_BITWISE
+  return crc_calcCrc16_868MHzProtocol_softwareCrc(ptrToData, length);
+#else
+  return crc_calcCrc16_868MHzProtocol_tableCrc(ptrToData, length);
+#endif
+}
+
+#if TEST_CRC >= 1
+
+/** @brief This method will free variables and set back things to return from 
+ *         the test.
+ *  @param retVal The value you want to return.
+ *  @return The returnvalue you enter.
+ */
+int crc_testsuiteReturner(int retVal){
   crc_deInit();
-  return crc;
+  return retVal;
 }
 
-void crc_test(void){
+/** @brief This method is the test for this unit, every engine of the CRC16
+ *         has to give the result of the bitwise one.
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int crc_testsuite(){
+  uint8_t checkString[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
   uint32_t testArray[] = {0x01234567, 0x89abcdef, 0xfedcba98, 0x76543210};
+  uint8_t data[300];
+  uint32_t seed = 0x1F2E3D4C;
+  uint16_t crc;
   
-  uint32_t crc = crc_calcCrc32_MPEG2((uint32_t*) testArray, 4);
-  return;
-}
\ No newline at end of file
+  for (uint32_t i = 0; i < sizeof(data); i++){
+    seed = (seed * 1103515245) + 12345;
+    data[i] = (uint8_t) (seed >> 16);
+  }
+  
+  // The check value of the CRC16 with poly 0x1021 and init 0x0000
+  if (crc_calcCrc16_868MHzProtocol_softwareCrc(checkString, sizeof(checkString)) != 0x31C3){
+    return crc_testsuiteReturner(-1);
+  }
+  
+  // Every length and every byte value against the bitwise engine
+  for (uint32_t length = 0; length <= sizeof(data); length++){
+    crc = crc_calcCrc16_868MHzProtocol_softwareCrc(data, length);
+    if (crc_calcCrc16_868MHzProtocol_tableCrc(data, length) != crc){
+      return crc_testsuiteReturner(-2);
+    }
+    if (crc_calcCrc16_868MHzProtocol_nibbleCrc(data, length) != crc){
+      return crc_testsuiteReturner(-3);
+    }
+    if (crc_calcCrc16_868MHzProtocol_hardwareCrc(data, length) != crc){
+      return crc_testsuiteReturner(-4);
+    }
+    if (crc_calcCrc16_868MHzProtocol(data, length) != crc){
+      return crc_testsuiteReturner(-5);
+    }
+  }
+  
+  // The CRC32 takes the unit over, the CRC16 has to set it up again
+  crc = crc_calcCrc16_868MHzProtocol_softwareCrc(data, 17);
+  crc_calcCrc32_MPEG2(testArray, 4);
+  if (crc_configuration != CRC_CONFIGURATION_NONE){
+    return crc_testsuiteReturner(-6);
+  }
+  if (crc_calcCrc16_868MHzProtocol_hardwareCrc(data, 17) != crc){
+    return crc_testsuiteReturner(-7);
+  }
+  if (crc_configuration != CRC_CONFIGURATION_868MHZ){
+    return crc_testsuiteReturner(-8);
+  }
+  
+  return crc_testsuiteReturner(0);
+}
+#endif
\ No newline at end of file
@@ -25,11 +25,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-08    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | CRC32 continuable from a saved state          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | CRC16 engines                                 |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Removed the dead crc_test                     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -40,15 +40,35 @@
 #define __CRC_H
 
 /* Includes */
+#include <inttypes.h>
+#include "Test_Selector.h"
 
 /* Typedefinitions */
+#define CRC_CRC32_MPEG2_INIT                    0xFFFFFFFF
+
+// The engines for the CRC16 of the 868 MHz protocol, all give the same result
+#define CRC_CRC16_ENGINE_BITWISE                0       // No table, one bit per step
+#define CRC_CRC16_ENGINE_TABLE                  1       // 512 byte table, one byte per step
+#define CRC_CRC16_ENGINE_NIBBLE                 2       // 32 byte table, half a byte per step
+#define CRC_CRC16_ENGINE_HARDWARE               3       // CRC unit, kept configured between the calls
+
+#ifndef CRC_CRC16_ENGINE
+  #define CRC_CRC16_ENGINE                      CRC_CRC16_ENGINE_TABLE
+#endif
 
 /* Variables */
 
 /* Function definitions */
 uint32_t crc_calcCrc32_MPEG2(uint32_t *ptrToData, uint32_t length);
+uint32_t crc_calcCrc32_MPEG2_continue(uint32_t crcState, uint32_t *ptrToData, uint32_t length);
 uint16_t crc_calcCrc16_868MHzProtocol_softwareCrc(uint8_t *ptrToData, uint32_t length);
+uint16_t crc_calcCrc16_868MHzProtocol_tableCrc(uint8_t *ptrToData, uint32_t length);
+uint16_t crc_calcCrc16_868MHzProtocol_nibbleCrc(uint8_t *ptrToData, uint32_t length);
 uint16_t crc_calcCrc16_868MHzProtocol_hardwareCrc(uint8_t *ptrToData, uint32_t length);
-void crc_test(void);
+uint16_t crc_calcCrc16_868MHzProtocol(uint8_t *ptrToData, uint32_t length);
+
+#if TEST_CRC >= 1
+int crc_testsuite();
+#endif
 
 #endif
\ No newline at end of file
@@ -3,7 +3,9 @@
   * @file       DMA.c
   * @author     Tim Steinberg
   * @date       08.07.2020
-  * @brief      NOT USED YET
+  * @brief      Circular DMA reception for the RSL UART. The DMA writes the
+  *             recepted bytes into a circular buffer, the half / full transfer
+  *             and idle line events hand the new bytes to the stack in bulk.
   ******************************************************************************
   * Redistribution in source and binary forms, with or without modification,
   * are not permitted. Use in source code needs the written approval of the author.
@@ -25,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-08    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Circular RX buffer for the RSL UART           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -37,9 +39,210 @@
   */
 
 /* Includes */
+#include "stm32l0xx_hal.h"
+#include "ErrorHandling.h"
+#include "Test_Selector.h"
+#include "DMA.h"
+
+#if TEST_DMA >= 1
+#include "RingbufferWrapper.h"
+#include "UserMethods_UART.h"
+#endif
 
 /* Typedefinitions / Prototypes */
 
 /* Variables */
+DMA_HandleTypeDef hdma_usart1_rx;
+
+/** \brief dmaRslRxBuffer
+  *        The circular buffer the DMA writes the recepted bytes into.
+  */
+static uint8_t dmaRslRxBuffer[DMA_RSL_RX_BUFFERSIZE];
+
+/** \brief dmaRslReadIndex
+  *        Position of the first byte that was not handed to the stack yet.
+  */
+static volatile uint32_t dmaRslReadIndex = 0;
+
+#if TEST_DMA >= 1
+/** \brief dmaRslSimulatedWriteIndex
+  *        Replaces the DMA counter while the test is active.
+  */
+static volatile uint32_t dmaRslSimulatedWriteIndex = 0;
+#endif
 
 /* Function definitions */
+
+/** @brief Returns the position the DMA will write the next byte to.
+ *  @return The write index within dmaRslRxBuffer.
+ */
+static uint32_t dma_rsl_getWriteIndex(void){
+#if TEST_DMA >= 1
+  return dmaRslSimulatedWriteIndex;
+#else
+  // CNDTR counts down from the buffer size and gets reloaded in circular mode
+  return (DMA_RSL_RX_BUFFERSIZE - __HAL_DMA_GET_COUNTER(&hdma_usart1_rx)) % DMA_RSL_RX_BUFFERSIZE;
+#endif
+}
+
+void dma_rsl_init(UART_HandleTypeDef *huart){
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  
+  // USART1_RX is mapped on channel 3 by request 3
+  hdma_usart1_rx.Instance = DMA1_Channel3;
+  hdma_usart1_rx.Init.Request = DMA_REQUEST_3;
+  hdma_usart1_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_usart1_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_usart1_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_usart1_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_usart1_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_usart1_rx.Init.Mode = DMA_CIRCULAR;
+  hdma_usart1_rx.Init.Priority = DMA_PRIORITY_HIGH;
+  if (HAL_DMA_Init(&hdma_usart1_rx) != HAL_OK)
+  {
+    Error_Handler_TxV2(INIT_DMA_FAILED);
+  }
+  __HAL_LINKDMA(huart, hdmarx, hdma_usart1_rx);
+  
+  // Same priority as the USART1 interrupt, so the events never preempt each other
+  HAL_NVIC_SetPriority(DMA1_Channel2_3_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Channel2_3_IRQn);
+}
+
+void dma_rsl_deInit(UART_HandleTypeDef *huart){
+  HAL_NVIC_DisableIRQ(DMA1_Channel2_3_IRQn);
+  HAL_DMA_DeInit(huart->hdmarx);
+}
+
+void dma_rsl_startReception(UART_HandleTypeDef *huart){
+#if TEST_DMA >= 1
+  dmaRslSimulatedWriteIndex = 0;
+  dmaRslReadIndex = 0;
+#else
+  // Is the reception still running (e.g. after a noise error)?
+  if (huart->RxState != HAL_UART_STATE_READY){
+    // Yes, the DMA keeps its position, so must we
+    return;
+  }
+  if (HAL_UART_Receive_DMA(huart, dmaRslRxBuffer, DMA_RSL_RX_BUFFERSIZE) != HAL_OK){
+    return;
+  }
+  // The DMA starts at the first byte again
+  dmaRslReadIndex = 0;
+  
+  // The idle line closes a message that did not fill a half of the buffer
+  __HAL_UART_CLEAR_IDLEFLAG(huart);
+  __HAL_UART_ENABLE_IT(huart, UART_IT_IDLE);
+#endif
+}
+
+uint32_t dma_rsl_getPendingSpan(uint8_t **span){
+  uint32_t writeIndex = dma_rsl_getWriteIndex();
+  
+  *span = &dmaRslRxBuffer[dmaRslReadIndex];
+  
+  // Did the DMA wrap around since the last release?
+  if (writeIndex < dmaRslReadIndex){
+    // Yes, give everything up to the end of the buffer
+    return DMA_RSL_RX_BUFFERSIZE - dmaRslReadIndex;
+  }
+  // No
+  return writeIndex - dmaRslReadIndex;
+}
+
+void dma_rsl_releaseSpan(uint32_t length){
+  dmaRslReadIndex = (dmaRslReadIndex + length) % DMA_RSL_RX_BUFFERSIZE;
+}
+
+void dma_rsl_irqHandler(void){
+  HAL_DMA_IRQHandler(&hdma_usart1_rx);
+}
+
+#if TEST_DMA >= 1
+
+void dma_rsl_test_simulateReception(uint8_t *data, uint32_t length){
+  for (uint32_t i = 0; i < length; i++){
+    dmaRslRxBuffer[dmaRslSimulatedWriteIndex] = data[i];
+    dmaRslSimulatedWriteIndex = (dmaRslSimulatedWriteIndex + 1) % DMA_RSL_RX_BUFFERSIZE;
+  }
+}
+
+/** @brief This method will free variables and set back things to return from 
+ *         the test.
+ *  @param retVal The value you want to return.
+ *  @return The returnvalue you enter.
+ */
+int32_t dma_testsuiteReturner(int32_t retVal){
+  ringbufferWrapper_clear();
+  return retVal;
+}
+
+int dma_testsuite(){
+  uint8_t testData[DMA_RSL_RX_BUFFERSIZE];
+  uint8_t *span;
+  uint32_t i;
+  
+  for (i = 0; i < DMA_RSL_RX_BUFFERSIZE; i++){
+    testData[i] = (uint8_t) ((i * 7) & 0xFF);
+  }
+  
+  ringbufferWrapper_clear();
+  dma_rsl_startReception(NULL);
+  
+  // Nothing recepted, nothing pending
+  if (dma_rsl_getPendingSpan(&span) != 0){
+    return dma_testsuiteReturner(-1);
+  }
+  
+  // A short message followed by an idle line event must be handed over at once
+  dma_rsl_test_simulateReception(testData, 10);
+  userMethods_uartReceptionCallback(0);
+  if (ringbufferWrapper_getCount() != 10){
+    return dma_testsuiteReturner(-2);
+  }
+  if (dma_rsl_getPendingSpan(&span) != 0){
+    return dma_testsuiteReturner(-3);
+  }
+  
+  // A second event without new bytes must not change anything
+  userMethods_uartReceptionCallback(0);
+  if (ringbufferWrapper_getCount() != 10){
+    return dma_testsuiteReturner(-4);
+  }
+  
+  // Let the DMA wrap around: 10 + 60 bytes -> write index is 6 now
+  dma_rsl_test_simulateReception(&testData[4], 60);
+  if (dma_rsl_getPendingSpan(&span) != (DMA_RSL_RX_BUFFERSIZE - 10)){
+    return dma_testsuiteReturner(-5);
+  }
+  if (span[0] != testData[4]){
+    return dma_testsuiteReturner(-6);
+  }
+  userMethods_uartReceptionCallback(0);
+  if (ringbufferWrapper_getCount() != 70){
+    return dma_testsuiteReturner(-7);
+  }
+  
+  // The order must be kept across the wrap
+  for (i = 0; i < 10; i++){
+    if (ringbufferWrapper_getByte() != testData[i]){
+      return dma_testsuiteReturner(-8);
+    }
+  }
+  for (i = 0; i < 60; i++){
+    if (ringbufferWrapper_getByte() != testData[4 + i]){
+      return dma_testsuiteReturner(-9);
+    }
+  }
+  
+  // A restart begins at the first byte of the buffer again
+  dma_rsl_startReception(NULL);
+  dma_rsl_test_simulateReception(testData, 3);
+  if (dma_rsl_getPendingSpan(&span) != 3 || span != dmaRslRxBuffer){
+    return dma_testsuiteReturner(-10);
+  }
+  
+  return dma_testsuiteReturner(0);
+}
+
+#endif
@@ -3,7 +3,9 @@
   * @file       DMA.h
   * @author     Tim Steinberg
   * @date       08.07.2020
-  * @brief      NOT USED YET
+  * @brief      Circular DMA reception for the RSL UART. The DMA writes the
+  *             recepted bytes into a circular buffer, the half / full transfer
+  *             and idle line events hand the new bytes to the stack in bulk.
   ******************************************************************************
   * Redistribution in source and binary forms, with or without modification,
   * are not permitted. Use in source code needs the written approval of the author.
@@ -25,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-08    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Circular RX buffer for the RSL UART           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -40,11 +42,74 @@
 #define __DMA_H
 
 /* Includes */
+#include "stm32l0xx_hal.h"
+#include "Test_Selector.h"
 
 /* Typedefinitions */
+/** \brief DMA_RSL_RX_BUFFERSIZE
+  *        Size of the circular reception buffer of the RSL UART. Every half of
+  *        it raises an event, so 32 bytes (~2.8 ms at 115200 Baud) is the
+  *        longest time the stack has to fetch the bytes before they get
+  *        overwritten.
+  */
+#define DMA_RSL_RX_BUFFERSIZE                   64
 
 /* Variables */
 
 /* Function definitions */
 
+/** @brief Configures the DMA channel of the RSL UART reception and links it
+ *         to the handle. Must be called from the MSP init of the UART.
+ *  @param *huart The handle of the RSL UART.
+ *  @return Nothing.
+ */
+void dma_rsl_init(UART_HandleTypeDef *huart);
+
+/** @brief Releases the DMA channel of the RSL UART reception.
+ *  @param *huart The handle of the RSL UART.
+ *  @return Nothing.
+ */
+void dma_rsl_deInit(UART_HandleTypeDef *huart);
+
+/** @brief Starts the circular reception and the idle line detection. If the
+ *         reception is already running, nothing will be done.
+ *  @param *huart The handle of the RSL UART.
+ *  @return Nothing.
+ */
+void dma_rsl_startReception(UART_HandleTypeDef *huart);
+
+/** @brief Gives the continuous span of bytes the DMA wrote since the last
+ *         release. If the DMA wrapped around, the span ends at the end of the
+ *         buffer and the rest comes with the next call.
+ *  @param **span Will be set to the first new byte.
+ *  @return The count of bytes in the span, 0 if there is nothing new.
+ */
+uint32_t dma_rsl_getPendingSpan(uint8_t **span);
+
+/** @brief Marks bytes of the span as consumed.
+ *  @param length The count of bytes consumed.
+ *  @return Nothing.
+ */
+void dma_rsl_releaseSpan(uint32_t length);
+
+/** @brief Must be called by the DMA channel interrupt of the RSL reception.
+ *  @return Nothing.
+ */
+void dma_rsl_irqHandler(void);
+
+#if TEST_DMA >= 1
+/** @brief Simulates the DMA writing bytes into the circular buffer by moving
+ *         the simulated write index. No event will be raised.
+ *  @param *data The bytes the "UART" recepted.
+ *  @param length The count of bytes.
+ *  @return Nothing.
+ */
+void dma_rsl_test_simulateReception(uint8_t *data, uint32_t length);
+
+/** @brief This method is the test for this unit
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int dma_testsuite();
+#endif
+
 #endif
\ No newline at end of file
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Param ID access of logged values via the log  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Addresses cast through uintptr_t              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -44,6 +44,7 @@
 
 #include "ErrorHandling.h"
 #include "EEPROMCheck.h"
+#include "EEPROM_Log.h"
 
 /* Typedefinitions / Prototypes */
 
@@ -146,7 +147,7 @@ BOOLEAN eeprom_writeWord(uint32_t value, uint32_t offset){
 bool eeprom_writeByte_withValueCheck(uint8_t value, uint32_t offset){
   BOOLEAN success = FALSE;
   uint8_t retryCounter = 0;
-  uint8_t temp8 = *((uint8_t*) (eepromMemoryMap_getEEPROMBaseAddress() + offset));
+  uint8_t temp8 = *((uint8_t*) (uintptr_t) (eepromMemoryMap_getEEPROMBaseAddress() + offset));
   // Compare step - don't E/W if already contained
   if (temp8 == value){
     return TRUE;
@@ -157,7 +158,7 @@ bool eeprom_writeByte_withValueCheck(uint8_t value, uint32_t offset){
     eeprom_unlock();
     eeprom_writeErase(offset);
     eeprom_writeByte(value, offset);
-    if (*((uint8_t*) (eepromMemoryMap_getEEPROMBaseAddress() + offset)) == value){
+    if (*((uint8_t*) (uintptr_t) (eepromMemoryMap_getEEPROMBaseAddress() + offset)) == value){
       if (eepromCheck_UpdateEEPROMCRC() == FALSE){
         Error_SetError_EEPCorrupt();
         return FALSE;
@@ -171,7 +172,7 @@ bool eeprom_writeByte_withValueCheck(uint8_t value, uint32_t offset){
 bool eeprom_writeHalfword_withValueCheck(uint16_t value, uint32_t offset){
   BOOLEAN success = FALSE;
   uint8_t retryCounter = 0;
-  uint16_t temp16 = *((uint16_t*) (eepromMemoryMap_getEEPROMBaseAddress() + offset));
+  uint16_t temp16 = *((uint16_t*) (uintptr_t) (eepromMemoryMap_getEEPROMBaseAddress() + offset));
   // Compare step - don't E/W if already contained
   if (temp16 == value){
     return TRUE;
@@ -183,7 +184,7 @@ bool eeprom_writeHalfword_withValueCheck(uint16_t value, uint32_t offset){
     eeprom_writeErase(offset);
     eeprom_writeHalfWord(value, offset);
     eeprom_lock();
-    if (*((uint16_t*) (eepromMemoryMap_getEEPROMBaseAddress() + offset)) == value){
+    if (*((uint16_t*) (uintptr_t) (eepromMemoryMap_getEEPROMBaseAddress() + offset)) == value){
       if (eepromCheck_UpdateEEPROMCRC() == FALSE){
         Error_SetError_EEPCorrupt();
         return FALSE;
@@ -197,7 +198,7 @@ bool eeprom_writeHalfword_withValueCheck(uint16_t value, uint32_t offset){
 bool eeprom_writeWord_withValueCheck(uint32_t value, uint32_t offset){
   BOOLEAN success = FALSE;
   uint8_t retryCounter = 0;
-  uint32_t tmp32 = *((uint32_t*) (eepromMemoryMap_getEEPROMBaseAddress() + offset));
+  uint32_t tmp32 = *((uint32_t*) (uintptr_t) (eepromMemoryMap_getEEPROMBaseAddress() + offset));
   // Compare step - don't E/W if already contained
   if (tmp32 == value){
     return TRUE;
@@ -209,7 +210,7 @@ bool eeprom_writeWord_withValueCheck(uint32_t value, uint32_t offset){
     eeprom_writeErase(offset);
     eeprom_writeWord(value, offset);
     eeprom_lock();
-    if (*((uint32_t*) (eepromMemoryMap_getEEPROMBaseAddress() + offset)) == value){
+    if (*((uint32_t*) (uintptr_t) (eepromMemoryMap_getEEPROMBaseAddress() + offset)) == value){
       if (eepromCheck_UpdateEEPROMCRC() == FALSE){
         Error_SetError_EEPCorrupt();
         return FALSE;
@@ -226,10 +227,24 @@ bool eeprom_writeWord_withValueCheck(uint32_t value, uint32_t offset){
 
 void eeprom_writeWord_byId_WithValueCheck(uint32_t value, uint8_t id){
   uint32_t addrOffset = id << 2;
+  EEPROM_LOG_KEY_VALUES_TYPEDEF key = eepromLog_getKey_byOffset(addrOffset);
+  // Is the value kept in the log?
+  if (key != EEPROM_LOG_KEY_INVALID){
+    // Yes
+    eepromLog_write(key, value);
+    return;
+  }
   eeprom_writeWord_withValueCheck(value, addrOffset);
 }
 
 uint32_t eeprom_getWord_byId(uint8_t id){
   uint32_t addrOffset = id << 2;
-  return (*((uint32_t*) (eepromMemoryMap_getEEPROMBaseAddress() + addrOffset )));
+  uint32_t value;
+  EEPROM_LOG_KEY_VALUES_TYPEDEF key = eepromLog_getKey_byOffset(addrOffset);
+  // Is the value kept in the log?
+  if ((key != EEPROM_LOG_KEY_INVALID) && (eepromLog_read(key, &value) == TRUE)){
+    // Yes
+    return value;
+  }
+  return (*((uint32_t*) (uintptr_t) (eepromMemoryMap_getEEPROMBaseAddress() + addrOffset )));
 }
\ No newline at end of file
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Exported the single word access methods       |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -48,6 +48,11 @@
 /* Variables */
 
 /* Function definitions */
+BOOLEAN eeprom_unlock();
+BOOLEAN eeprom_lock();
+BOOLEAN eeprom_writeErase(uint32_t offset);
+BOOLEAN eeprom_writeWord(uint32_t value, uint32_t offset);
+
 bool eeprom_writeByte_withValueCheck(uint8_t value, uint32_t offset);
 bool eeprom_writeHalfword_withValueCheck(uint16_t value, uint32_t offset);
 bool eeprom_writeWord_withValueCheck(uint32_t value, uint32_t offset);
@@ -25,11 +25,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-13    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Hot counters kept in the EEPROM log           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added the RSL10 round trip time baseline      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Addresses cast through uintptr_t              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -39,6 +39,7 @@
 /* Includes */
 #include "EEPROM_Map.h"
 #include "EEPROM_Access.h"
+#include "EEPROM_Log.h"
 #include "MasterDefine.h"
 #include "Watchdog.h"
 
@@ -47,20 +48,34 @@
 /* Variables */
 
 /* Function definitions */
+//==========================================//
+// Logged values
+//==========================================//
+
+// Before the first write of a key the log has no record of it, the value of
+// the former fixed location is taken over until then
+static uint32_t eeprom_getLoggedWord(EEPROM_LOG_KEY_VALUES_TYPEDEF key, uint32_t offset){
+  uint32_t value;
+  if (eepromLog_read(key, &value) == TRUE){
+    return value;
+  }
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + offset));
+}
+
 //==========================================//
 // Endianess & Access check
 //==========================================//
 
 uint8_t eeprom_getEACheckUint8_t(){
-  return *((uint8_t*)eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_IDENT);
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_IDENT));
 }
 
 uint16_t eeprom_getEACheckUint16_t(){
-  return *((uint16_t*)eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_IDENT);
+  return *((uint16_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_IDENT));
 }
 
 uint32_t eeprom_getEACheckUint32_t(){
-  return *((uint32_t*)eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_IDENT);
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_IDENT));
 }
 
 //==========================================//
@@ -68,11 +83,11 @@ uint32_t eeprom_getEACheckUint32_t(){
 //==========================================//
 
 uint8_t eeprom_getBatteryValue(){
-  return *((uint8_t*)eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_BATTERY);
+  return (uint8_t) eeprom_getLoggedWord(EEPROM_LOG_KEY_BATTERY, EEPROM_MAP_OFFSET_BATTERY);
 }
 
 bool eeprom_setBatteryValue(uint8_t batteryVal){
-  return eeprom_writeByte_withValueCheck(batteryVal, EEPROM_MAP_OFFSET_BATTERY);
+  return eepromLog_write(EEPROM_LOG_KEY_BATTERY, batteryVal);
 }
 
 //==========================================//
@@ -80,7 +95,7 @@ bool eeprom_setBatteryValue(uint8_t batteryVal){
 //==========================================//
 
 uint8_t eeprom_getAlertValue(){
-  return *((uint8_t*)eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_ALERT);
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_ALERT));
 }
 
 bool eeprom_setAlertValue(uint8_t alertVal){
@@ -92,7 +107,7 @@ bool eeprom_setAlertValue(uint8_t alertVal){
 //==========================================//
 
 uint8_t eeprom_getErrorValue(){
-  return *((uint8_t*)eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_ERROR);
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_ERROR));
 }
 
 bool eeprom_setErrorValue(uint8_t errorVal){
@@ -104,17 +119,17 @@ bool eeprom_setErrorValue(uint8_t errorVal){
 //==========================================//
 
 uint32_t eeprom_getBatteryLowCounter(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_BATTERYLOWCOUNTER));
+  return eeprom_getLoggedWord(EEPROM_LOG_KEY_BATTERYLOWCOUNTER, EEPROM_MAP_OFFSET_BATTERYLOWCOUNTER);
 }
 
 void eeprom_setBatteryLowCounter(uint32_t batteryLowCounter){
-  eeprom_writeWord_withValueCheck(batteryLowCounter, EEPROM_MAP_OFFSET_BATTERYLOWCOUNTER);
+  eepromLog_write(EEPROM_LOG_KEY_BATTERYLOWCOUNTER, batteryLowCounter);
   return;
 }
 
 void eeprom_incBatteryLowCounter(void){
   uint32_t battLowCount = eeprom_getBatteryLowCounter() + 1;
-  eeprom_writeWord_withValueCheck(battLowCount, EEPROM_MAP_OFFSET_BATTERYLOWCOUNTER);
+  eepromLog_write(EEPROM_LOG_KEY_BATTERYLOWCOUNTER, battLowCount);
   return;
 }
 
@@ -124,7 +139,7 @@ void eeprom_incBatteryLowCounter(void){
 
 BOOLEAN eeprom_getPairingState(void){
   uint32_t addr = eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_PAIRING_STATE;
-  uint32_t cmpVal = *((uint32_t*)(addr));
+  uint32_t cmpVal = *((uint32_t*)(uintptr_t)(addr));
   if (cmpVal == 0xDEADBEEF){
     return FALSE;
   }
@@ -146,17 +161,17 @@ void eeprom_setUnPaired(void){
 //==========================================//
 
 uint32_t eeprom_getAlertCounter(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_ALERTCOUNTER));
+  return eeprom_getLoggedWord(EEPROM_LOG_KEY_ALERTCOUNTER, EEPROM_MAP_OFFSET_ALERTCOUNTER);
 }
 
 void eeprom_setAlertCounter(uint32_t alertCounter){
-  eeprom_writeWord_withValueCheck(alertCounter, EEPROM_MAP_OFFSET_ALERTCOUNTER);
+  eepromLog_write(EEPROM_LOG_KEY_ALERTCOUNTER, alertCounter);
   return;
 }
 
 void eeprom_incAlertCounter(void){
   uint32_t alertCount = eeprom_getAlertCounter() + 1;
-  eeprom_writeWord_withValueCheck(alertCount, EEPROM_MAP_OFFSET_ALERTCOUNTER);
+  eepromLog_write(EEPROM_LOG_KEY_ALERTCOUNTER, alertCount);
   return;
 }
 
@@ -165,7 +180,7 @@ void eeprom_incAlertCounter(void){
 //==========================================//
 
 uint32_t eeprom_getLsiCalibration(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_LSICALIBRATION));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_LSICALIBRATION));
 }
 
 void eeprom_setLsiCalibration(uint32_t lsiCalibrationValue){
@@ -178,34 +193,48 @@ void eeprom_setLsiCalibration(uint32_t lsiCalibrationValue){
 //==========================================//
 
 uint32_t eeprom_getNumberOfTransmissions868(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONS868));
+  return eeprom_getLoggedWord(EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONS868, EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONS868);
 }
 
 void eeprom_incNumberOfTransmissions868(){
   uint32_t count = eeprom_getNumberOfTransmissions868();
   count++;
-  eeprom_writeWord_withValueCheck(count, EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONS868);
+  eepromLog_write(EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONS868, count);
   return;
 }
 
 void eeprom_resetNumberOfTransmissions868(){
-  eeprom_writeWord_withValueCheck(0, EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONS868);
+  eepromLog_write(EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONS868, 0);
   return;
 }
 
 uint32_t eeprom_getNumberOfTransmissionsBLE(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONSBLE));
+  return eeprom_getLoggedWord(EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONSBLE, EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONSBLE);
 }
 
 void eeprom_incNumberOfTransmissionsBLE(){
   uint32_t count = eeprom_getNumberOfTransmissionsBLE();
   count++;
-  eeprom_writeWord_withValueCheck(count, EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONSBLE);
+  eepromLog_write(EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONSBLE, count);
   return;
 }
 
 void eeprom_resetNumberOfTransmissionsBLE(){
-  eeprom_writeWord_withValueCheck(0, EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONSBLE);
+  eepromLog_write(EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONSBLE, 0);
+  return;
+}
+
+//==========================================//
+// RSL10 round trip times
+//==========================================//
+
+// Only in the log, there is no former fixed location to fall back to
+bool eeprom_getRttBaseline(uint32_t *baseline){
+  return eepromLog_read(EEPROM_LOG_KEY_RTTBASELINE, baseline);
+}
+
+void eeprom_setRttBaseline(uint32_t baseline){
+  eepromLog_write(EEPROM_LOG_KEY_RTTBASELINE, baseline);
   return;
 }
 
@@ -214,7 +243,7 @@ void eeprom_resetNumberOfTransmissionsBLE(){
 //==========================================//
 
 uint32_t eeprom_getUID(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_U_ID));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_U_ID));
 }
   
 void eeprom_setUID(uint32_t number){
@@ -222,7 +251,7 @@ void eeprom_setUID(uint32_t number){
 }
 
 uint32_t eeprom_getSerialNumber(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SERIALNUMBER));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SERIALNUMBER));
 }
   
 void eeprom_setSerialNumber(uint32_t number){
@@ -234,7 +263,7 @@ void eeprom_setSerialNumber(uint32_t number){
 //==========================================//
 
 uint8_t eeprom_getBatteryLowThresholdValue(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_BATTERYLOWTHRESHOLDVALUE));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_BATTERYLOWTHRESHOLDVALUE));
 }
 
 //==========================================//
@@ -243,15 +272,15 @@ uint8_t eeprom_getBatteryLowThresholdValue(){
 
 
 uint8_t eeprom_getRepetitionCountEmergency(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_RETRYCOUNTEMERGENCY));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_RETRYCOUNTEMERGENCY));
 }
 
 uint8_t eeprom_getRepetitionCountPairing(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_RETRYCOUNTPAIRING));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_RETRYCOUNTPAIRING));
 }
 
 uint8_t eeprom_getRepetitionCountBattery(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_RETRYCOUNTBATTERY));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_RETRYCOUNTBATTERY));
 }
 
 //==========================================//
@@ -259,7 +288,7 @@ uint8_t eeprom_getRepetitionCountBattery(){
 //==========================================//
 
 uint32_t eeprom_getWaitCycleCount(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_NUMBEROFWAITCYCLES));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_NUMBEROFWAITCYCLES));
 }
 
 //==========================================//
@@ -267,11 +296,11 @@ uint32_t eeprom_getWaitCycleCount(){
 //==========================================//
 
 uint8_t eeprom_getPCBVersion(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_HARDWARE_PCB_VERSION));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_HARDWARE_PCB_VERSION));
 }
 
 uint8_t eeprom_getBOMVersion(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_HARDWARE_BOM_VERSION));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_HARDWARE_BOM_VERSION));
 }
 
 void eeprom_setPCBVersion(uint8_t val){
@@ -285,27 +314,27 @@ void eeprom_setBOMVersion(uint8_t val){
 }
 
 uint32_t eeprom_getSoftwareVersion_Type(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_VERSION));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_VERSION));
 }
 
 uint32_t eeprom_getSoftwareVersion_Status(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_STATUS));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_STATUS));
 }
 
 uint32_t eeprom_getSoftwareVersion_Major(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_MAJOR));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_MAJOR));
 }
 
 uint32_t eeprom_getSoftwareVersion_Minor(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_MINOR));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_MINOR));
 }
 
 uint32_t eeprom_getSoftwareVersion_Build(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_BUILD));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_BUILD));
 }
 
 uint32_t eeprom_getSoftwareVersion_CMI(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_CMI));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_SOFTWARE_CMI));
 }
 
 //==========================================//
@@ -313,7 +342,7 @@ uint32_t eeprom_getSoftwareVersion_CMI(){
 //==========================================//
 
 uint32_t eeprom_getFlashCRC(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_FLASH_CRC));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_FLASH_CRC));
 }
 
 bool eeprom_setFlashCRC(uint32_t value){
@@ -321,7 +350,7 @@ bool eeprom_setFlashCRC(uint32_t value){
 }
 
 uint32_t eeprom_getEEPROMCRC(){
-  return *((uint32_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_EEPROM_CRC));
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_EEPROM_CRC));
 }
 
 bool eeprom_setEEPROMCRC(uint32_t value){
@@ -333,19 +362,19 @@ bool eeprom_setEEPROMCRC(uint32_t value){
 //==========================================//
 
 uint8_t eeprom_getS2LP_Synth3(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_SYNTH + 0));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_SYNTH + 0));
 }
 
 uint8_t eeprom_getS2LP_Synth2(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_SYNTH + 1));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_SYNTH + 1));
 }
 
 uint8_t eeprom_getS2LP_Synth1(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_SYNTH + 2));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_SYNTH + 2));
 }
 
 uint8_t eeprom_getS2LP_Synth0(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_SYNTH + 3));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_SYNTH + 3));
 }
 
 bool eeprom_setS2LP_Synth_3_0(uint32_t value){
@@ -357,19 +386,19 @@ bool eeprom_setS2LP_Synth_3_0(uint32_t value){
 //==========================================//
 
 uint8_t eeprom_getS2LP_OutputPower8(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_8_5 + 0));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_8_5 + 0));
 }
 
 uint8_t eeprom_getS2LP_OutputPower7(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_8_5 + 1));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_8_5 + 1));
 }
 
 uint8_t eeprom_getS2LP_OutputPower6(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_8_5 + 2));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_8_5 + 2));
 }
 
 uint8_t eeprom_getS2LP_OutputPower5(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_8_5 + 3));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_8_5 + 3));
 }
 
 bool eeprom_setS2LP_OutputPower_8_5(uint32_t value){
@@ -379,19 +408,19 @@ bool eeprom_setS2LP_OutputPower_8_5(uint32_t value){
 //======
 
 uint8_t eeprom_getS2LP_OutputPower4(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_4_1 + 0));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_4_1 + 0));
 }
 
 uint8_t eeprom_getS2LP_OutputPower3(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_4_1 + 1));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_4_1 + 1));
 }
 
 uint8_t eeprom_getS2LP_OutputPower2(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_4_1 + 2));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_4_1 + 2));
 }
 
 uint8_t eeprom_getS2LP_OutputPower1(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_4_1 + 3));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_4_1 + 3));
 }
 
 bool eeprom_setS2LP_OutputPower_4_1(uint32_t value){
@@ -401,7 +430,7 @@ bool eeprom_setS2LP_OutputPower_4_1(uint32_t value){
 //======
 
 uint8_t eeprom_getS2LP_OutputPower0(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_0 + 0));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_OUTPUTPOWER_0 + 0));
 }
 
 bool eeprom_setS2LP_OutputPower_0(uint32_t value){
@@ -413,7 +442,7 @@ bool eeprom_setS2LP_OutputPower_0(uint32_t value){
 //==========================================//
 
 uint8_t eeprom_getS2LP_ClocksourceSelector(){
-  return *((uint8_t*)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_CLOCKSOURCE_SELECTOR));
+  return *((uint8_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + EEPROM_MAP_OFFSET_S2LP_CLOCKSOURCE_SELECTOR));
 }
 
 void eeprom_setS2LP_ClocksourceSelector(uint8_t val){
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-13    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Added the RSL10 round trip time baseline      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -84,6 +84,9 @@ uint32_t eeprom_getNumberOfTransmissionsBLE();
 void eeprom_incNumberOfTransmissionsBLE();
 void eeprom_resetNumberOfTransmissionsBLE();
 
+bool eeprom_getRttBaseline(uint32_t *baseline);
+void eeprom_setRttBaseline(uint32_t baseline);
+
 uint8_t eeprom_getBatteryLowThresholdValue();
 
 uint8_t eeprom_getRepetitionCountEmergency();
@@ -0,0 +1,426 @@
+/**
+  ******************************************************************************
+  * @file       EEPROM_Log.c
+  * @author     Tim Steinberg
+  * @date       17.10.2026
+  * @brief      Log structured record store for often changing values
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-17    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | Addresses cast through uintptr_t              |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+/* Includes */
+#include "stm32l0xx_hal.h"
+#include "MasterDefine.h"
+#include "EEPROM_Map.h"
+#include "EEPROM_Access.h"
+#include "EEPROM_Log.h"
+#include "Test_Selector.h"
+
+/* Typedefinitions / Prototypes */
+// The log area is split into two sectors. Records are appended to the active
+// sector, a full sector gets its live records copied into the other one.
+// A record takes two words, the value first and the header second:
+//   header = key | CRC-8 << 8 | sequence << 16
+// An erased word reads 0, so a zero header is a free record and a header
+// without the matching CRC a torn or broken write
+#define EEPROM_LOG_RECORD_SIZE                  8
+#define EEPROM_LOG_OFFSET_VALUE                 0
+#define EEPROM_LOG_OFFSET_HEADER                4
+#define EEPROM_LOG_SECTOR_SIZE                  ((EEPROM_MAP_OFFSET_LOG_END - EEPROM_MAP_OFFSET_LOG_START) >> 1)
+#define EEPROM_LOG_RECORDS_PER_SECTOR           (EEPROM_LOG_SECTOR_SIZE / EEPROM_LOG_RECORD_SIZE)
+#define EEPROM_LOG_CRC8_POLYNOMIAL              0x07
+#define EEPROM_LOG_CRC8_INIT                    0xFF
+
+typedef struct EEPROM_LOG_INDEX_STRUCT{
+  uint32_t value;       /**< Value of the newest record */
+  uint16_t sequence;    /**< Sequence number of the newest record */
+  bool     valid;       /**< TRUE, if the log holds a record of the key */
+} EEPROM_LOG_INDEX_STRUCT_TYPEDEF;
+
+/* Variables */
+// RAM index, rebuilt by eepromLog_init() from the log area
+static EEPROM_LOG_INDEX_STRUCT_TYPEDEF eepromLog_index[EEPROM_LOG_KEY_COUNT];
+static uint8_t  eepromLog_activeSector = 0;
+static uint32_t eepromLog_nextRecord = 0;
+static uint16_t eepromLog_sequence = 0;
+static bool     eepromLog_initialized = FALSE;
+
+#if TEST_EEPROM_LOG >= 1
+// Stand-in for the log area, counts the erase and program cycles of every word
+static uint32_t eepromLog_simMemory[(EEPROM_MAP_OFFSET_LOG_END - EEPROM_MAP_OFFSET_LOG_START) >> 2];
+static uint16_t eepromLog_simCycles[(EEPROM_MAP_OFFSET_LOG_END - EEPROM_MAP_OFFSET_LOG_START) >> 2];
+#endif
+
+/* Function definitions */
+
+//==========================================//
+// Memory access
+//==========================================//
+
+static void eepromLog_nvmOpen(void){
+#if TEST_EEPROM_LOG < 1
+  eeprom_unlock();
+#endif
+}
+
+static void eepromLog_nvmClose(void){
+#if TEST_EEPROM_LOG < 1
+  eeprom_lock();
+#endif
+}
+
+static uint32_t eepromLog_nvmRead(uint32_t offset){
+#if TEST_EEPROM_LOG >= 1
+  return eepromLog_simMemory[(offset - EEPROM_MAP_OFFSET_LOG_START) >> 2];
+#else
+  return *((uint32_t*)(uintptr_t)(eepromMemoryMap_getEEPROMBaseAddress() + offset));
+#endif
+}
+
+static bool eepromLog_nvmProgram(uint32_t value, uint32_t offset){
+#if TEST_EEPROM_LOG >= 1
+  eepromLog_simMemory[(offset - EEPROM_MAP_OFFSET_LOG_START) >> 2] = value;
+  eepromLog_simCycles[(offset - EEPROM_MAP_OFFSET_LOG_START) >> 2]++;
+#else
+  eeprom_writeWord(value, offset);
+#endif
+  if (eepromLog_nvmRead(offset) == value){
+    return TRUE;
+  }
+  return FALSE;
+}
+
+static void eepromLog_nvmErase(uint32_t offset){
+  // Is the word erased already?
+  if (eepromLog_nvmRead(offset) == 0){
+    // Yes, save the cycle
+    return;
+  }
+#if TEST_EEPROM_LOG >= 1
+  eepromLog_simMemory[(offset - EEPROM_MAP_OFFSET_LOG_START) >> 2] = 0;
+  eepromLog_simCycles[(offset - EEPROM_MAP_OFFSET_LOG_START) >> 2]++;
+#else
+  eeprom_writeErase(offset);
+#endif
+}
+
+//==========================================//
+// Records
+//==========================================//
+
+static uint32_t eepromLog_recordOffset(uint8_t sector, uint32_t record){
+  return EEPROM_MAP_OFFSET_LOG_START + (sector * EEPROM_LOG_SECTOR_SIZE) + (record * EEPROM_LOG_RECORD_SIZE);
+}
+
+static uint8_t eepromLog_crc8(uint8_t key, uint16_t sequence, uint32_t value){
+  uint8_t data[7];
+  uint8_t crc = EEPROM_LOG_CRC8_INIT;
+  uint8_t i, j;
+  
+  data[0] = key;
+  data[1] = (uint8_t) sequence;
+  data[2] = (uint8_t) (sequence >> 8);
+  data[3] = (uint8_t) value;
+  data[4] = (uint8_t) (value >> 8);
+  data[5] = (uint8_t) (value >> 16);
+  data[6] = (uint8_t) (value >> 24);
+  for (i = 0; i < sizeof(data); i++){
+    crc ^= data[i];
+    for (j = 0; j < 8; j++){
+      if (crc & 0x80){
+        crc = (uint8_t) ((crc << 1) ^ EEPROM_LOG_CRC8_POLYNOMIAL);
+      }else{
+        crc = (uint8_t) (crc << 1);
+      }
+    }
+  }
+  return crc;
+}
+
+/** @brief Reads and checks the record at the given offset.
+ *  @return TRUE, if the record holds a known key and its CRC matches.
+ */
+static bool eepromLog_readRecord(uint32_t offset, uint8_t *key, uint16_t *sequence, uint32_t *value){
+  uint32_t header = eepromLog_nvmRead(offset + EEPROM_LOG_OFFSET_HEADER);
+  
+  *value = eepromLog_nvmRead(offset + EEPROM_LOG_OFFSET_VALUE);
+  *key = (uint8_t) header;
+  *sequence = (uint16_t) (header >> 16);
+  if ((*key == EEPROM_LOG_KEY_INVALID) || (*key >= EEPROM_LOG_KEY_COUNT)){
+    return FALSE;
+  }
+  if ((uint8_t) (header >> 8) != eepromLog_crc8(*key, *sequence, *value)){
+    return FALSE;
+  }
+  return TRUE;
+}
+
+static bool eepromLog_isNewer(uint16_t sequence, uint16_t reference){
+  // The sequence wraps, the live records are never more than two sectors apart
+  if ((int16_t) (sequence - reference) > 0){
+    return TRUE;
+  }
+  return FALSE;
+}
+
+static bool eepromLog_append(uint8_t key, uint32_t value){
+  uint32_t offset = eepromLog_recordOffset(eepromLog_activeSector, eepromLog_nextRecord);
+  uint16_t sequence = eepromLog_sequence + 1;
+  uint32_t header = key | ((uint32_t) eepromLog_crc8(key, sequence, value) << 8) | ((uint32_t) sequence << 16);
+  bool retVal;
+  
+  // A failed write uses up the record as well, the boot scan skips it the same way
+  eepromLog_nextRecord++;
+  eepromLog_sequence = sequence;
+  
+  eepromLog_nvmOpen();
+  retVal = eepromLog_nvmProgram(value, offset + EEPROM_LOG_OFFSET_VALUE);
+  if (retVal == TRUE){
+    retVal = eepromLog_nvmProgram(header, offset + EEPROM_LOG_OFFSET_HEADER);
+  }
+  eepromLog_nvmClose();
+  
+  if (retVal == TRUE){
+    eepromLog_index[key].value = value;
+    eepromLog_index[key].sequence = sequence;
+    eepromLog_index[key].valid = TRUE;
+  }
+  return retVal;
+}
+
+static void eepromLog_collectGarbage(void){
+  uint8_t target = eepromLog_activeSector ^ 1;
+  uint32_t record;
+  uint8_t key;
+  
+  // Clear the target first. If this gets interrupted, the live records are
+  // still in the full sector and the boot scan finds them there
+  eepromLog_nvmOpen();
+  for (record = 0; record < EEPROM_LOG_RECORDS_PER_SECTOR; record++){
+    eepromLog_nvmErase(eepromLog_recordOffset(target, record) + EEPROM_LOG_OFFSET_VALUE);
+    eepromLog_nvmErase(eepromLog_recordOffset(target, record) + EEPROM_LOG_OFFSET_HEADER);
+  }
+  eepromLog_nvmClose();
+  
+  // Copy the live records. The full sector is left as it is, its records are
+  // older and it gets cleared before its next use
+  eepromLog_activeSector = target;
+  eepromLog_nextRecord = 0;
+  for (key = EEPROM_LOG_KEY_INVALID + 1; key < EEPROM_LOG_KEY_COUNT; key++){
+    if (eepromLog_index[key].valid == TRUE){
+      eepromLog_append(key, eepromLog_index[key].value);
+    }
+  }
+}
+
+//==========================================//
+// Interface
+//==========================================//
+
+void eepromLog_init(void){
+  uint8_t sector, key;
+  uint16_t sequence;
+  uint32_t record, offset, value;
+  bool found = FALSE;
+  
+  for (key = 0; key < EEPROM_LOG_KEY_COUNT; key++){
+    eepromLog_index[key].valid = FALSE;
+  }
+  eepromLog_activeSector = 0;
+  eepromLog_nextRecord = 0;
+  eepromLog_sequence = 0;
+  
+  // The newest record of every key wins, the newest record at all marks the active sector
+  for (sector = 0; sector < 2; sector++){
+    for (record = 0; record < EEPROM_LOG_RECORDS_PER_SECTOR; record++){
+      if (eepromLog_readRecord(eepromLog_recordOffset(sector, record), &key, &sequence, &value) == FALSE){
+        continue;
+      }
+      if ((eepromLog_index[key].valid == FALSE) || (eepromLog_isNewer(sequence, eepromLog_index[key].sequence) == TRUE)){
+        eepromLog_index[key].value = value;
+        eepromLog_index[key].sequence = sequence;
+        eepromLog_index[key].valid = TRUE;
+      }
+      if ((found == FALSE) || (eepromLog_isNewer(sequence, eepromLog_sequence) == TRUE)){
+        found = TRUE;
+        eepromLog_sequence = sequence;
+        eepromLog_activeSector = sector;
+      }
+    }
+  }
+  
+  // Append behind the last used record of the active sector, torn ones included
+  if (found == TRUE){
+    for (record = EEPROM_LOG_RECORDS_PER_SECTOR; record > 0; record--){
+      offset = eepromLog_recordOffset(eepromLog_activeSector, record - 1);
+      if ((eepromLog_nvmRead(offset + EEPROM_LOG_OFFSET_VALUE) != 0) || (eepromLog_nvmRead(offset + EEPROM_LOG_OFFSET_HEADER) != 0)){
+        break;
+      }
+    }
+    eepromLog_nextRecord = record;
+  }
+  eepromLog_initialized = TRUE;
+}
+
+bool eepromLog_read(EEPROM_LOG_KEY_VALUES_TYPEDEF key, uint32_t *value){
+  if ((key == EEPROM_LOG_KEY_INVALID) || (key >= EEPROM_LOG_KEY_COUNT)){
+    return FALSE;
+  }
+  if (eepromLog_initialized == FALSE){
+    eepromLog_init();
+  }
+  if (eepromLog_index[key].valid == FALSE){
+    return FALSE;
+  }
+  *value = eepromLog_index[key].value;
+  return TRUE;
+}
+
+bool eepromLog_write(EEPROM_LOG_KEY_VALUES_TYPEDEF key, uint32_t value){
+  if ((key == EEPROM_LOG_KEY_INVALID) || (key >= EEPROM_LOG_KEY_COUNT)){
+    return FALSE;
+  }
+  if (eepromLog_initialized == FALSE){
+    eepromLog_init();
+  }
+  // Compare step - don't append if already contained
+  if ((eepromLog_index[key].valid == TRUE) && (eepromLog_index[key].value == value)){
+    return TRUE;
+  }
+  // Is the active sector full?
+  if (eepromLog_nextRecord >= EEPROM_LOG_RECORDS_PER_SECTOR){
+    // Yes
+    eepromLog_collectGarbage();
+  }
+  return eepromLog_append(key, value);
+}
+
+EEPROM_LOG_KEY_VALUES_TYPEDEF eepromLog_getKey_byOffset(uint32_t offset){
+  switch (offset){
+    case EEPROM_MAP_OFFSET_BATTERY:
+      return EEPROM_LOG_KEY_BATTERY;
+    case EEPROM_MAP_OFFSET_BATTERYLOWCOUNTER:
+      return EEPROM_LOG_KEY_BATTERYLOWCOUNTER;
+    case EEPROM_MAP_OFFSET_ALERTCOUNTER:
+      return EEPROM_LOG_KEY_ALERTCOUNTER;
+    case EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONS868:
+      return EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONS868;
+    case EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONSBLE:
+      return EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONSBLE;
+    default:
+      return EEPROM_LOG_KEY_INVALID;
+  }
+}
+
+#if TEST_EEPROM_LOG >= 1
+static void eepromLog_test_reboot(void){
+  eepromLog_initialized = FALSE;
+  eepromLog_init();
+}
+
+int eepromLog_testsuite(){
+  uint32_t i, value;
+  uint16_t maxCycles = 0;
+  
+  for (i = 0; i < (sizeof(eepromLog_simMemory) >> 2); i++){
+    eepromLog_simMemory[i] = 0;
+    eepromLog_simCycles[i] = 0;
+  }
+  eepromLog_test_reboot();
+  
+  // An empty log knows no key
+  if (eepromLog_read(EEPROM_LOG_KEY_ALERTCOUNTER, &value) == TRUE){
+    return -1;
+  }
+  
+  // The same value again costs no record
+  eepromLog_write(EEPROM_LOG_KEY_BATTERY, 3);
+  eepromLog_write(EEPROM_LOG_KEY_BATTERY, 3);
+  if (eepromLog_nextRecord != 1){
+    return -2;
+  }
+  
+  // Count up through many garbage collections
+  for (i = 1; i <= 10000; i++){
+    if (eepromLog_write(EEPROM_LOG_KEY_ALERTCOUNTER, i) == FALSE){
+      return -3;
+    }
+    if ((i % 10) == 0){
+      if (eepromLog_write(EEPROM_LOG_KEY_BATTERYLOWCOUNTER, i / 10) == FALSE){
+        return -3;
+      }
+    }
+  }
+  
+  // The index gets rebuilt from the log
+  eepromLog_test_reboot();
+  if ((eepromLog_read(EEPROM_LOG_KEY_ALERTCOUNTER, &value) == FALSE) || (value != 10000)){
+    return -4;
+  }
+  if ((eepromLog_read(EEPROM_LOG_KEY_BATTERYLOWCOUNTER, &value) == FALSE) || (value != 1000)){
+    return -5;
+  }
+  if ((eepromLog_read(EEPROM_LOG_KEY_BATTERY, &value) == FALSE) || (value != 3)){
+    return -6;
+  }
+  
+  // A fixed slot would have seen 10000 cycles, the log spreads them
+  for (i = 0; i < (sizeof(eepromLog_simCycles) >> 1); i++){
+    if (eepromLog_simCycles[i] > maxCycles){
+      maxCycles = eepromLog_simCycles[i];
+    }
+  }
+  if (maxCycles > 150){
+    return -7;
+  }
+  
+  // A torn write, only the value made it
+  eepromLog_simMemory[(eepromLog_recordOffset(eepromLog_activeSector, eepromLog_nextRecord) - EEPROM_MAP_OFFSET_LOG_START) >> 2] = 10001;
+  eepromLog_test_reboot();
+  if ((eepromLog_read(EEPROM_LOG_KEY_ALERTCOUNTER, &value) == FALSE) || (value != 10000)){
+    return -8;
+  }
+  eepromLog_write(EEPROM_LOG_KEY_ALERTCOUNTER, 10001);
+  eepromLog_test_reboot();
+  if ((eepromLog_read(EEPROM_LOG_KEY_ALERTCOUNTER, &value) == FALSE) || (value != 10001)){
+    return -9;
+  }
+  
+  // A broken record falls back to the one before
+  eepromLog_simMemory[(eepromLog_recordOffset(eepromLog_activeSector, eepromLog_nextRecord - 1) - EEPROM_MAP_OFFSET_LOG_START) >> 2] ^= 0x100;
+  eepromLog_test_reboot();
+  if ((eepromLog_read(EEPROM_LOG_KEY_ALERTCOUNTER, &value) == FALSE) || (value != 10000)){
+    return -10;
+  }
+  
+  return 0;
+}
+#endif
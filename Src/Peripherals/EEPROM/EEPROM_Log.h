@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * @file       EEPROM_Log.h
+  * @author     Tim Steinberg
+  * @date       17.10.2026
+  * @brief      Log structured record store for often changing values
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-17    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | Added EEPROM_LOG_KEY_RTTBASELINE              |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __EEPROM_LOG_H
+#define __EEPROM_LOG_H
+
+/* Includes */
+#include "stm32l0xx_hal.h"
+#include "MasterDefine.h"
+#include "Test_Selector.h"
+
+/* Typedefinitions */
+typedef enum EEPROM_LOG_KEY_VALUES{
+  EEPROM_LOG_KEY_INVALID                        = 0x00,   /**< Never written, marks an erased record */
+  EEPROM_LOG_KEY_BATTERY                        = 0x01,   /**< Replaces EEPROM_MAP_OFFSET_BATTERY */
+  EEPROM_LOG_KEY_BATTERYLOWCOUNTER              = 0x02,   /**< Replaces EEPROM_MAP_OFFSET_BATTERYLOWCOUNTER */
+  EEPROM_LOG_KEY_ALERTCOUNTER                   = 0x03,   /**< Replaces EEPROM_MAP_OFFSET_ALERTCOUNTER */
+  EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONS868       = 0x04,   /**< Replaces EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONS868 */
+  EEPROM_LOG_KEY_NUMBEROFTRANSMISSIONSBLE       = 0x05,   /**< Replaces EEPROM_MAP_OFFSET_NUMBEROFTRANSMISSIONSBLE */
+  EEPROM_LOG_KEY_RTTBASELINE                    = 0x06,   /**< Round trip times of the RSL10, see Handler_RTT */
+  EEPROM_LOG_KEY_COUNT                          = 0x07,   /**< Count of keys, has to stay the last entry */
+} EEPROM_LOG_KEY_VALUES_TYPEDEF;
+
+/* Variables */
+
+/* Function definitions */
+void eepromLog_init(void);
+bool eepromLog_read(EEPROM_LOG_KEY_VALUES_TYPEDEF key, uint32_t *value);
+bool eepromLog_write(EEPROM_LOG_KEY_VALUES_TYPEDEF key, uint32_t value);
+EEPROM_LOG_KEY_VALUES_TYPEDEF eepromLog_getKey_byOffset(uint32_t offset);
+
+#if TEST_EEPROM_LOG >= 1
+int eepromLog_testsuite();
+#endif
+
+#endif
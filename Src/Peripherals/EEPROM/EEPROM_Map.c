@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Placement for the host build                  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Addresses cast through uintptr_t              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -46,7 +46,12 @@
 /* Variables */
 
 // WARNING: TAKE NOTE THAT THE ERASING IS IN WORD MODE. YOU CAN NOT CHANGE THIS!
+#if defined(__ICCARM__)
 const uint8_t eepromMemoryMap[2048] @ 0x08080000 = {
+#else
+// The host build links the .eeprom section to 0x08080000, it has to be writable
+uint8_t eepromMemoryMap[2048] __attribute__((section(".eeprom"))) = {
+#endif
   
   // STATIC AREA !!! DO NOT CHANGE EVEN WITH SOFTWARE UPDATE, JUST CHANGE IN PRODUCTION STEP !!!
   
@@ -137,5 +142,5 @@ const uint8_t eepromMemoryMap[2048] @ 0x08080000 = {
 
 /* Function definitions */
 uint32_t eepromMemoryMap_getEEPROMBaseAddress(void){
-  return (uint32_t) eepromMemoryMap;
+  return (uint32_t) (uintptr_t) eepromMemoryMap;
 }
\ No newline at end of file
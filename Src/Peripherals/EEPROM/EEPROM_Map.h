@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Reserved the log area                         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -116,6 +116,11 @@
 #define EEPROM_MAP_OFFSET_FLASH_CRC                     256
 #define EEPROM_MAP_OFFSET_EEPROM_CRC                    260
 
+  // LOG AREA, records of often changing values, see EEPROM_Log.c. Not part of the EEPROM CRC
+
+#define EEPROM_MAP_OFFSET_LOG_START                     512
+#define EEPROM_MAP_OFFSET_LOG_END                       2048
+
 /* Variables */
 
 /* Function definitions */
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | GPO2 as nIRQ input of the S2LP                |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | CS pulled up while the S2LP keeps its regs    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -39,6 +39,7 @@
 /* Includes */
 #include "main.h"
 #include "Debug.h"
+#include "GPIO.h"
 /* Typedefinitions / Prototypes */
 
 /* Variables */
@@ -284,7 +285,7 @@ void gpio_initSleepMode(void){
 
   // Not used pins => Analog with no pull
   GPIO_InitStruct.Pin = GPO_TCXO_EN_Pin|GPO_T20_GATE_Pin|
-                          GPO_2_S2LP_Pin|GPO_1_S2LP_Pin|GPO_S2LP_CS_Pin|
+                          GPO_2_S2LP_Pin|GPO_1_S2LP_Pin|
                           USART1_TX_RSL10_Pin|USART1_RX_RSL10_Pin|
                           GPO_LED_RED_Pin|
                           GPI_TEST_MODE_Pin;
@@ -299,6 +300,9 @@ void gpio_initSleepMode(void){
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+  
+  // The S2LP may keep its registers in STANDBY, a floating CS could select it
+  gpio_s2lp_pinCS_setToRetention();
   /*
   // Shut down the S2LP
   GPIO_InitStruct.Pin = GPO_S2LP_SHDWN_Pin;
@@ -383,6 +387,30 @@ void gpio_s2lp_signalGPO2Output_deInit(void){
   HAL_GPIO_Init(GPO_2_S2LP_GPIO_Port, &GPIO_InitStruct);
 }
 
+void gpio_s2lp_signalGPO2Irq_init(void){
+  TRACE_PROCEDURE_CALLS(1, "gpio_s2lp_signalGPO2Irq_init(void)\r\n");
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  
+  // GPIO2 of the S2LP is its nIRQ, it pulls low for an event
+  GPIO_InitStruct.Pin = GPO_2_S2LP_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
+  GPIO_InitStruct.Pull = GPIO_PULLUP;
+  HAL_GPIO_Init(GPO_2_S2LP_GPIO_Port, &GPIO_InitStruct);
+  
+  HAL_NVIC_SetPriority(EXTI4_15_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(EXTI4_15_IRQn);
+}
+
+void gpio_s2lp_signalGPO2Irq_deInit(void){
+  TRACE_PROCEDURE_CALLS(1, "gpio_s2lp_signalGPO2Irq_deInit(void)\r\n");
+  
+  HAL_NVIC_DisableIRQ(EXTI4_15_IRQn);
+  // Releases the EXTI line as well and leaves the pin analog
+  HAL_GPIO_DeInit(GPO_2_S2LP_GPIO_Port, GPO_2_S2LP_Pin);
+}
+
 void gpio_s2lp_pinShutdown_setToShutdown(void){
   TRACE_PROCEDURE_CALLS(1, "gpio_s2lp_signal_deInit(void)\r\n");
   GPIO_InitTypeDef GPIO_InitStruct = {0};
@@ -433,6 +461,18 @@ void gpio_s2lp_pinCS_deInit(void){
   HAL_GPIO_Init(GPO_S2LP_CS_GPIO_Port, &GPIO_InitStruct);
 }
 
+void gpio_s2lp_pinCS_setToRetention(void){
+  TRACE_PROCEDURE_CALLS(1, "gpio_s2lp_pinCS_setToRetention(void)\r\n");
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  
+  GPIO_InitStruct.Pin = GPO_S2LP_CS_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_PULLUP;
+  HAL_GPIO_Init(GPO_S2LP_CS_GPIO_Port, &GPIO_InitStruct);
+}
+
 void gpio_s2lp_pinCS_setToTransmission(void){
   HAL_GPIO_WritePin(GPO_S2LP_CS_GPIO_Port, GPO_S2LP_CS_Pin, GPIO_PIN_RESET);
 }
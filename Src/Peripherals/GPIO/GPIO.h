@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | GPO2 as nIRQ input of the S2LP                |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added gpio_s2lp_pinCS_setToRetention          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -72,11 +72,14 @@ void gpio_s2lp_signalGPO1Output_deInit(void);
 void gpio_s2lp_signalGPO2Output_deInit(void);
 void gpio_s2lp_signalGPO1Output_set(uint8_t level);
 void gpio_s2lp_signalGPO2Output_set(uint8_t level);
+void gpio_s2lp_signalGPO2Irq_init(void);
+void gpio_s2lp_signalGPO2Irq_deInit(void);
 
 void gpio_s2lp_pinShutdown_setToShutdown(void);
 void gpio_s2lp_pinShutdown_setToRunmode(void);
 void gpio_s2lp_pinCS_init(void);
 void gpio_s2lp_pinCS_deInit(void);
+void gpio_s2lp_pinCS_setToRetention(void);
 void gpio_s2lp_pinCS_setToTransmission(void);
 void gpio_s2lp_pinCS_setToSilence(void);
 
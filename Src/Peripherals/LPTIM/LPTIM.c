@@ -0,0 +1,208 @@
+/**
+  ******************************************************************************
+  * @file       LPTIM.c
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Tickless sleep of the awake runmode on the LPTIM1
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+/* Includes */
+#include "stm32l0xx_hal.h"
+#include "ErrorHandling.h"
+#include "RTC.h"
+#include "LPTIM.h"
+
+#if (TEST_LPTIM >= 1) && defined(HOST_BUILD)
+#include "HAL_Sim.h"
+#endif
+
+/* Typedefinitions / Prototypes */
+
+// The LPTIM1 runs on the LSI / 16, the same clock the RTC calibration counts
+#define LPTIM_COUNTS_MAX                0xFFFF
+
+/* Variables */
+static LPTIM_HandleTypeDef hlptim1;
+
+/* Function definitions */
+
+void lptim_init(void){
+  RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
+  
+  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_LPTIM1;
+  PeriphClkInit.LptimClockSelection = RCC_LPTIM1CLKSOURCE_LSI;
+  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
+  {
+    Error_Handler_TxV2(INIT_TIMER_FAILED);
+  }
+  __HAL_RCC_LPTIM1_CLK_ENABLE();
+  
+  hlptim1.Instance = LPTIM1;
+  hlptim1.Init.Clock.Source = LPTIM_CLOCKSOURCE_APBCLOCK_LPOSC;
+  hlptim1.Init.Clock.Prescaler = LPTIM_PRESCALER_DIV16;
+  hlptim1.Init.Trigger.Source = LPTIM_TRIGSOURCE_SOFTWARE;
+  hlptim1.Init.OutputPolarity = LPTIM_OUTPUTPOLARITY_HIGH;
+  hlptim1.Init.UpdateMode = LPTIM_UPDATE_IMMEDIATE;
+  hlptim1.Init.CounterSource = LPTIM_COUNTERSOURCE_INTERNAL;
+  if (HAL_LPTIM_Init(&hlptim1) != HAL_OK)
+  {
+    Error_Handler_TxV2(INIT_TIMER_FAILED);
+  }
+  
+  HAL_NVIC_SetPriority(LPTIM1_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+}
+
+void lptim_deInit(void){
+  HAL_NVIC_DisableIRQ(LPTIM1_IRQn);
+  HAL_LPTIM_DeInit(&hlptim1);
+  __HAL_RCC_LPTIM1_CLK_DISABLE();
+  hlptim1.Instance = NULL;
+}
+
+/** @brief Sleeps with the SysTick stopped until the LPTIM1 runs out or another
+ *         interrupt comes. Must be called with the interrupts masked, the WFI
+ *         wakes up anyway and the interrupt runs as soon as the caller
+ *         unmasks them. The tick is corrected by the time that passed.
+ *  @param milliseconds The longest time to sleep
+ *  @return The milliseconds the tick was advanced by.
+ */
+uint32_t lptim_sleepForMilliseconds(uint32_t milliseconds){
+  uint32_t calibrationValue = rtc_getCalibrationValue();
+  uint32_t counts;
+  uint32_t elapsedCounts;
+  uint32_t elapsedMilliseconds;
+  uint32_t i;
+  
+  // The calibration value is the count of 0.1 s, round up to not wake early
+  counts = ((milliseconds * calibrationValue) + 99) / 100;
+  if (counts > LPTIM_COUNTS_MAX){
+    counts = LPTIM_COUNTS_MAX;
+  }
+  if ((counts == 0) || (hlptim1.Instance == NULL)){
+    return 0;
+  }
+  
+  HAL_SuspendTick();
+  HAL_LPTIM_TimeOut_Start_IT(&hlptim1, LPTIM_COUNTS_MAX, counts);
+  HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+  
+  // The counter runs asynchronously, it is valid when read twice the same
+  do {
+    elapsedCounts = HAL_LPTIM_ReadCounter(&hlptim1);
+  } while (elapsedCounts != HAL_LPTIM_ReadCounter(&hlptim1));
+  // Did the compare match already? The counter may be past it by then
+  if (elapsedCounts > counts){
+    elapsedCounts = counts;
+  }
+  HAL_LPTIM_TimeOut_Stop_IT(&hlptim1);
+  HAL_ResumeTick();
+  
+  // Round down, the tick must never run ahead of the time
+  elapsedMilliseconds = (elapsedCounts * 100) / calibrationValue;
+  for (i = 0; i < elapsedMilliseconds; i++){
+    HAL_IncTick();
+  }
+  return elapsedMilliseconds;
+}
+
+void lptim_irqHandler(void){
+  if (hlptim1.Instance == NULL){
+    return;
+  }
+  HAL_LPTIM_IRQHandler(&hlptim1);
+}
+
+#if TEST_LPTIM >= 1
+
+/** @brief This method will free variables and set back things to return from 
+ *         the test.
+ *  @param retVal The value to return
+ *  @return retVal.
+ */
+int lptim_testsuiteReturner(int retVal){
+  lptim_deInit();
+  return retVal;
+}
+
+/** @brief This method will test the sleep on the LPTIM1.
+ *  @return 0 if all tests passed, a negative value for the failed one.
+ */
+int lptim_testsuite(){
+  uint32_t startTick;
+  uint32_t elapsed;
+#if defined(HOST_BUILD)
+  HAL_SIM_STATISTICS_STRUCT_TYPEDEF statistics;
+  uint64_t startNs;
+#endif
+  
+  lptim_init();
+  
+  // Nothing to sleep
+  __disable_irq();
+  elapsed = lptim_sleepForMilliseconds(0);
+  __enable_irq();
+  if (elapsed != 0){
+    return lptim_testsuiteReturner(-1);
+  }
+  
+  // The tick is advanced by the time that passed, the rounding may cost
+  // one millisecond but never puts the tick ahead
+  startTick = HAL_GetTick();
+#if defined(HOST_BUILD)
+  halSim_resetStatistics();
+  startNs = halSim_getTimeNs();
+#endif
+  __disable_irq();
+  elapsed = lptim_sleepForMilliseconds(50);
+  __enable_irq();
+  if ((elapsed < 49) || (elapsed > 50)){
+    return lptim_testsuiteReturner(-2);
+  }
+  if ((HAL_GetTick() - startTick) != elapsed){
+    return lptim_testsuiteReturner(-3);
+  }
+#if defined(HOST_BUILD)
+  // The LPTIM alone woke the core up, the SysTick was stopped
+  halSim_getStatistics(&statistics);
+  if (statistics.wakeUps != 1){
+    return lptim_testsuiteReturner(-4);
+  }
+  if ((halSim_getTimeNs() - startNs) < ((uint64_t) elapsed * 1000000ULL)){
+    return lptim_testsuiteReturner(-5);
+  }
+#endif
+  
+  return lptim_testsuiteReturner(0);
+}
+#endif
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-07    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Wakeup from STOP in milliseconds              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Calibration value is public for the LPTIM     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -44,11 +44,30 @@
 
 /* Typedefinitions / Prototypes */
 
+// The LSI ticks (RTCCLK / 16) of 0.1 s, the calibration accepts only these
+#define RTC_CALIBRATION_MIN             50
+#define RTC_CALIBRATION_MAX             400
+#define RTC_CALIBRATION_DEFAULT         231
+
 /* Variables */
 extern RTC_HandleTypeDef hrtc;
 volatile uint8_t rtcWakeupIntFired;
 
 /* Function definitions */
+
+/** @brief Gives the calibrated wakeup timer ticks of 0.1 s
+ *  @return The ticks, the default if the stored calibration is not realistic.
+ */
+uint32_t rtc_getCalibrationValue(void){
+  // Load last calibrated value
+  uint32_t calibrationValue = eeprom_getLsiCalibration();
+  // Is value realistic ? take it : load default
+  if ( (calibrationValue < RTC_CALIBRATION_MIN) || (calibrationValue > RTC_CALIBRATION_MAX) ){
+    calibrationValue = RTC_CALIBRATION_DEFAULT;
+  }
+  return calibrationValue;
+}
+
 uint32_t rtc_adcCalGet(void){
   return HAL_RTCEx_BKUPRead(&hrtc, 0);
 }
@@ -98,6 +117,32 @@ void rtc_setWakeUpInSeconds(uint32_t seconds){
   HAL_RTCEx_DeactivateWakeUpTimer(&hrtc);
 }
 
+void rtc_setWakeUpInMilliseconds(uint32_t milliseconds){
+  // Is the RTC already set up?
+  if (hrtc.State == HAL_RTC_STATE_RESET){
+    // No, the emergency path can come here before the first sleep
+    rtc_init();
+  }
+  // Set the flag to 0
+  rtcWakeupIntFired = 0x00;
+  // Set the wakeup timer with the calibrated LSI, the same clock as the
+  // calibration -> WARNING THE MAXIMUM TIME FOR THE WATCHDOG TO RUN OUT IS 28,3 SECONDS!
+  HAL_RTCEx_SetWakeUpTimer_IT(&hrtc, (rtc_getCalibrationValue() * milliseconds) / 100, RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+  
+  // Clear the wakeup flag
+  __HAL_PWR_CLEAR_FLAG(PWR_FLAG_WU); 
+  
+  do
+  {
+    // Enter stopmode now, until the wakeup timer ends it
+    HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+  }
+  while(rtcWakeupIntFired == 0x00);
+  
+  // Disable RTC Wakeup
+  HAL_RTCEx_DeactivateWakeUpTimer(&hrtc);
+}
+
 void rtc_wakeUpIntFire(void){
   rtcWakeupIntFired = 0x01;
 }
@@ -107,11 +152,7 @@ void rtc_lsi_calibration(void){
   uint32_t timeStamp;
 
   // Load last calibrated value
-  uint32_t calibrationValue = eeprom_getLsiCalibration();
-  // Is value realistic ? take it : load default
-  if ( (calibrationValue < 50) || (calibrationValue > 400) ){
-    calibrationValue = 231;
-  }
+  uint32_t calibrationValue = rtc_getCalibrationValue();
   uint32_t wakeupTime = calibrationValue;
   // Disable Wakeup Counter
   HAL_RTCEx_DeactivateWakeUpTimer(&hrtc);
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-07    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Wakeup from STOP in milliseconds              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Calibration value is public                   |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -51,6 +51,8 @@ void rtc_adcCalSet(uint32_t adc_calVal);
 void rtc_init(void);
 void rtc_wakeUpIntFire(void);
 void rtc_setWakeUpInSeconds(uint32_t seconds);
+void rtc_setWakeUpInMilliseconds(uint32_t milliseconds);
 void rtc_lsi_calibration(void);
+uint32_t rtc_getCalibrationValue(void);
 
 #endif
\ No newline at end of file
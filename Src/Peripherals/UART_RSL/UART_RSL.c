@@ -25,11 +25,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Queued transmission by interrupt              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Frame numbers of the transmission queue       |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Nesting critical section to queue a frame     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -40,21 +40,159 @@
 #include "stm32l0xx_hal.h"
 #include "ErrorHandling.h"
 #include "UserMethods_UART.h"
+#include "UserMethods_Characteristics.h"
+#include "Ringbuffer.h"
+#include "Test_Selector.h"
+#include "UART_RSL.h"
+#include "DMA.h"
+
+#if TEST_UART_RSL >= 1
+#include <string.h>
+#include "HAL_Sim.h"
+#include "RingbufferWrapper.h"
+#endif
 
 /* Typedefinitions / Prototypes */
 
 /* Variables */
 extern UART_HandleTypeDef huart1;
-uint8_t receptionByteRSL;
+
+/** \brief uartRslTxStorage
+  *        The copies of the queued frames, so the callers may reuse their
+  *        buffers right after handing them over.
+  */
+static uint8_t uartRslTxStorage[UART_RSL_TX_BUFFERSIZE];
+
+/** \brief uartRslTxBuffer
+  *        The superloop puts the frames in, the transmission interrupt takes
+  *        them out.
+  */
+static ringbuffer uartRslTxBuffer = RINGBUFFER_INITIALIZER(uartRslTxStorage, UART_RSL_TX_BUFFERSIZE);
+
+/** \brief uartRslTxFrameLength
+  *        The descriptors of the queued frames, which is their length. The
+  *        head is only moved by the superloop, the tail only by the interrupt,
+  *        both run freely like the ones of the ringbuffer.
+  */
+static uint16_t uartRslTxFrameLength[UART_RSL_TX_FRAMES];
+static volatile uint32_t uartRslTxFrameHead = 0;
+static volatile uint32_t uartRslTxFrameTail = 0;
+
+/** \brief uartRslTxFrameSent
+  *        The bytes of the oldest frame that already left the UART.
+  */
+static uint32_t uartRslTxFrameSent = 0;
+
+/** \brief uartRslTxSpanLength
+  *        The bytes handed to the UART right now, 0 if it is idle.
+  */
+static volatile uint32_t uartRslTxSpanLength = 0;
 
 /* Function definitions */
 
-void uart_rsl_transmit(uint32_t length, uint8_t *buffer){
-  HAL_UART_Transmit(&huart1, buffer, length, 100);
+/** @brief Hands the next piece of the oldest frame to the UART, if it is idle.
+ *         A frame across the end of the ringbuffer goes out in two pieces.
+ *         Must not be interrupted by the transmission interrupt.
+ *  @return Nothing.
+ */
+static void uart_rsl_startTransmission(void){
+  const uint8_t *span;
+  uint32_t length;
+  
+  // Is the UART busy or the queue empty?
+  if ((uartRslTxSpanLength != 0) || (uartRslTxFrameHead == uartRslTxFrameTail)){
+    // Yes
+    return;
+  }
+  length = ringbufferPeekSpan(&uartRslTxBuffer, 0, &span);
+  if (length > (uartRslTxFrameLength[uartRslTxFrameTail % UART_RSL_TX_FRAMES] - uartRslTxFrameSent)){
+    length = uartRslTxFrameLength[uartRslTxFrameTail % UART_RSL_TX_FRAMES] - uartRslTxFrameSent;
+  }
+  uartRslTxSpanLength = length;
+  if (HAL_UART_Transmit_IT(&huart1, (uint8_t*) span, length) != HAL_OK){
+    uartRslTxSpanLength = 0;
+  }
+}
+
+uint32_t uart_rsl_transmit(uint32_t length, uint8_t *buffer){
+  uint32_t primask;
+  
+  // Does the frame fit into the queue?
+  if ((length == 0) || ((uartRslTxFrameHead - uartRslTxFrameTail) >= UART_RSL_TX_FRAMES) || (ringbufferGetFree(&uartRslTxBuffer) < length)){
+    // No
+    return 0;
+  }
+  // Yes, the bytes first, the interrupt only looks at them behind a descriptor
+  ringbufferPutString(&uartRslTxBuffer, buffer, length);
+  uartRslTxFrameLength[uartRslTxFrameHead % UART_RSL_TX_FRAMES] = (uint16_t) length;
+  uartRslTxFrameHead++;
+  
+  // The interrupt of a transmission ending right now would start the next one
+  // as well. The caller may have masked the interrupts already
+  primask = userMethods_characteristics_enterCritical();
+  uart_rsl_startTransmission();
+  userMethods_characteristics_exitCritical(primask);
+  return length;
+}
+
+bool uart_rsl_transmissionCompleted(void){
+  bool frameCompleted = FALSE;
+  
+  ringbufferDropCount(&uartRslTxBuffer, uartRslTxSpanLength);
+  uartRslTxFrameSent += uartRslTxSpanLength;
+  uartRslTxSpanLength = 0;
+  // Did the whole frame leave the UART?
+  if (uartRslTxFrameSent >= uartRslTxFrameLength[uartRslTxFrameTail % UART_RSL_TX_FRAMES]){
+    // Yes
+    uartRslTxFrameSent = 0;
+    uartRslTxFrameTail++;
+    frameCompleted = TRUE;
+  }
+  uart_rsl_startTransmission();
+  return frameCompleted;
+}
+
+uint32_t uart_rsl_getQueuedFrames(void){
+  return uartRslTxFrameHead - uartRslTxFrameTail;
+}
+
+uint32_t uart_rsl_getFrameHead(void){
+  return uartRslTxFrameHead;
+}
+
+uint32_t uart_rsl_getFrameTail(void){
+  return uartRslTxFrameTail;
+}
+
+void uart_rsl_flushTransmission(void){
+  uint32_t startTime = HAL_GetTick();
+  
+  while (uart_rsl_getQueuedFrames() > 0){
+    if ((HAL_GetTick() - startTime) >= UART_RSL_TX_FLUSH_TIMEOUT){
+      break;
+    }
+    // The check and the WFI must not be split by the interrupt that ends it,
+    // a pending interrupt wakes the WFI up even while masked
+    __disable_irq();
+    if (uart_rsl_getQueuedFrames() > 0){
+      HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+    }
+    __enable_irq();
+  }
+}
+
+/** @brief Drops everything queued, the UART must not transmit.
+ *  @return Nothing.
+ */
+static void uart_rsl_clearTransmission(void){
+  ringbufferClear(&uartRslTxBuffer);
+  uartRslTxFrameTail = uartRslTxFrameHead;
+  uartRslTxFrameSent = 0;
+  uartRslTxSpanLength = 0;
 }
 
 void uart_rsl_startReception(){
-  HAL_StatusTypeDef hstd = HAL_UART_Receive_IT(&huart1, &receptionByteRSL, 1);
+  dma_rsl_startReception(&huart1);
 }
 
 // 9600 matching by 24 MHz baseclock
@@ -144,16 +282,160 @@ void uart_rsl_init_noAutobaud(void){
 }
 
 void uart_rsl_init(void){
+  uart_rsl_clearTransmission();
   //uart_rsl_init_HSIautobaud9600();
   uart_rsl_init_HSIautobaud115200();
 }
 
 void uart_rsl_deInit(void){
+  // The last frames (e.g. the final ACK) must not be cut off
+  uart_rsl_flushTransmission();
   HAL_UART_Abort(&huart1);
+  uart_rsl_clearTransmission();
   HAL_UART_DeInit(&huart1);
   __HAL_RCC_USART1_CLK_DISABLE();
 }
 
-uint8_t uart_rsl_getReceptedByte(void){ 
-  return receptionByteRSL;
+uint32_t uart_rsl_getReceptedBytes(uint8_t **bytes){
+  return dma_rsl_getPendingSpan(bytes);
 }
+
+void uart_rsl_releaseReceptedBytes(uint32_t length){
+  dma_rsl_releaseSpan(length);
+}
+
+bool uart_rsl_checkAndClearIdleLine(void){
+  // Did the line fall idle after a reception?
+  if ((__HAL_UART_GET_IT_SOURCE(&huart1, UART_IT_IDLE) != RESET) && (__HAL_UART_GET_FLAG(&huart1, UART_FLAG_IDLE) != RESET)){
+    // Yes
+    __HAL_UART_CLEAR_IDLEFLAG(&huart1);
+    return TRUE;
+  }
+  // No
+  return FALSE;
+}
+
+#if TEST_UART_RSL >= 1
+
+// One byte with start and stop bit at 115200 Baud
+#define UART_RSL_TEST_BYTE_TIME_NS              86806ULL
+#define UART_RSL_TEST_LENGTH                    48
+
+/** \brief uartRslTestTx
+  *        The bytes the simulated peer got on its RX line.
+  */
+static uint8_t uartRslTestTx[DMA_RSL_RX_BUFFERSIZE];
+static uint32_t uartRslTestTxCount = 0;
+
+/** \brief uartRslTestRx
+  *        The reception buffer of the test, it replaces the one of the DMA
+  *        unit, which is simulated itself while TEST_DMA is active.
+  */
+static uint8_t uartRslTestRx[DMA_RSL_RX_BUFFERSIZE];
+
+static void uart_rsl_test_txHook(void *context, uint8_t byte){
+  (void) context;
+  if (uartRslTestTxCount < DMA_RSL_RX_BUFFERSIZE){
+    uartRslTestTx[uartRslTestTxCount] = byte;
+  }
+  uartRslTestTxCount++;
+}
+
+/** @brief This method will free variables and set back things to return from 
+ *         the test.
+ *  @param retVal The value you want to return.
+ *  @return The returnvalue you enter.
+ */
+int32_t uart_rsl_testsuiteReturner(int32_t retVal){
+  uart_rsl_deInit();
+  halSim_uart_setTxHook(USART1, NULL, NULL);
+  ringbufferWrapper_clear();
+  return retVal;
+}
+
+/** @brief The test runs the real UART of the host simulation. The peer sends
+ *         while the frames are queued, both directions must run at once.
+ */
+int uart_rsl_testsuite(){
+  HAL_SIM_STATISTICS_STRUCT_TYPEDEF statistics;
+  uint8_t txData[UART_RSL_TEST_LENGTH];
+  uint8_t rxData[UART_RSL_TEST_LENGTH];
+  uint8_t frame[UART_RSL_TEST_LENGTH];
+  uint64_t startTime;
+  uint32_t frameHead;
+  uint32_t i;
+  
+  for (i = 0; i < UART_RSL_TEST_LENGTH; i++){
+    txData[i] = (uint8_t) ((i * 3) & 0xFF);
+    rxData[i] = (uint8_t) (0xFF - i);
+  }
+  uartRslTestTxCount = 0;
+  halSim_uart_setTxHook(USART1, uart_rsl_test_txHook, NULL);
+  uart_rsl_init();
+  HAL_UART_Abort(&huart1);
+  HAL_UART_Receive_DMA(&huart1, uartRslTestRx, DMA_RSL_RX_BUFFERSIZE);
+  halSim_resetStatistics();
+  frameHead = uart_rsl_getFrameHead();
+  
+  // The peer starts to send, then three frames get queued without any wait
+  halSim_uart_receive(USART1, rxData, UART_RSL_TEST_LENGTH);
+  startTime = halSim_getTimeNs();
+  memcpy(frame, txData, 20);
+  if (uart_rsl_transmit(20, frame) != 20){
+    return uart_rsl_testsuiteReturner(-1);
+  }
+  // The queue holds a copy, the caller may reuse its buffer at once
+  memset(frame, 0, sizeof(frame));
+  if ((uart_rsl_transmit(4, &txData[20]) != 4) || (uart_rsl_transmit(24, &txData[24]) != 24)){
+    return uart_rsl_testsuiteReturner(-2);
+  }
+  if ((halSim_getTimeNs() - startTime) >= UART_RSL_TEST_BYTE_TIME_NS){
+    return uart_rsl_testsuiteReturner(-3);
+  }
+  if ((uart_rsl_getQueuedFrames() != 3) || (uart_rsl_getFrameHead() != (frameHead + 3)) || (uart_rsl_getFrameTail() != frameHead)){
+    return uart_rsl_testsuiteReturner(-4);
+  }
+  
+  // Halfway both lines must be busy and the first frame out
+  halSim_advanceNs(22 * UART_RSL_TEST_BYTE_TIME_NS);
+  halSim_getStatistics(&statistics);
+  if ((statistics.uartTxBytes[0] < 20) || (statistics.uartTxBytes[0] >= UART_RSL_TEST_LENGTH) || (statistics.uartRxBytes[0] < 20) || (statistics.uartRxBytes[0] >= UART_RSL_TEST_LENGTH)){
+    return uart_rsl_testsuiteReturner(-5);
+  }
+  if ((uart_rsl_getQueuedFrames() != 2) || (uart_rsl_getFrameTail() != (frameHead + 1))){
+    return uart_rsl_testsuiteReturner(-6);
+  }
+  
+  // Full duplex: both directions are done in the time of one
+  halSim_advanceNs((UART_RSL_TEST_LENGTH - 22 + 2) * UART_RSL_TEST_BYTE_TIME_NS);
+  halSim_getStatistics(&statistics);
+  if ((uart_rsl_getQueuedFrames() != 0) || (uartRslTestTxCount != UART_RSL_TEST_LENGTH) || (statistics.uartRxBytes[0] != UART_RSL_TEST_LENGTH) || (statistics.uartRxBytesLost[0] != 0)){
+    return uart_rsl_testsuiteReturner(-7);
+  }
+  if (memcmp(uartRslTestTx, txData, UART_RSL_TEST_LENGTH) != 0){
+    return uart_rsl_testsuiteReturner(-8);
+  }
+  if (memcmp(uartRslTestRx, rxData, UART_RSL_TEST_LENGTH) != 0){
+    return uart_rsl_testsuiteReturner(-9);
+  }
+  
+  // A full queue refuses the frame instead of blocking
+  for (i = 0; i < UART_RSL_TX_FRAMES; i++){
+    if (uart_rsl_transmit(4, txData) != 4){
+      return uart_rsl_testsuiteReturner(-10);
+    }
+  }
+  if (uart_rsl_transmit(4, txData) != 0){
+    return uart_rsl_testsuiteReturner(-11);
+  }
+  
+  // The flush waits for all of them
+  uart_rsl_flushTransmission();
+  if ((uart_rsl_getQueuedFrames() != 0) || (uartRslTestTxCount != (UART_RSL_TEST_LENGTH + (4 * UART_RSL_TX_FRAMES)))){
+    return uart_rsl_testsuiteReturner(-12);
+  }
+  
+  return uart_rsl_testsuiteReturner(0);
+}
+
+#endif
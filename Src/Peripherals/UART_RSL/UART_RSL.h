@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Queued transmission by interrupt              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Frame numbers of the transmission queue       |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -41,16 +41,77 @@
 
 /* Includes */
 #include "stm32l0xx_hal.h"
+#include "MasterDefine.h"
+#include "Test_Selector.h"
 
 /* Typedefinitions */
+/** \brief UART_RSL_TX_BUFFERSIZE
+  *        Size of the transmission queue in bytes, a power of two. It holds
+  *        two frames of the maximum length.
+  */
+#define UART_RSL_TX_BUFFERSIZE                  512
+
+/** \brief UART_RSL_TX_FRAMES
+  *        Count of frames the transmission queue holds, a power of two.
+  */
+#define UART_RSL_TX_FRAMES                      8
+
+/** \brief UART_RSL_TX_FLUSH_TIMEOUT
+  *        Time in ms the deinit waits for the queued frames to leave.
+  */
+#define UART_RSL_TX_FLUSH_TIMEOUT               100
 
 /* Variables */
 
 /* Function definitions */
 void uart_rsl_init(void);
 void uart_rsl_deInit(void);
-void uart_rsl_transmit(uint32_t length, uint8_t *buffer);
 void uart_rsl_startReception(void);
-uint8_t uart_rsl_getReceptedByte(void);
+uint32_t uart_rsl_getReceptedBytes(uint8_t **bytes);
+void uart_rsl_releaseReceptedBytes(uint32_t length);
+bool uart_rsl_checkAndClearIdleLine(void);
+
+/** @brief Queues a frame for the transmission by interrupt and returns at
+ *         once. The frame gets copied, the buffer may be reused right away.
+ *  @param length The count of bytes
+ *  @param *buffer The frame
+ *  @return The count of bytes queued, 0 if the queue is full.
+ */
+uint32_t uart_rsl_transmit(uint32_t length, uint8_t *buffer);
+
+/** @brief Must be called by the transmission complete callback of the UART.
+ *         It releases the bytes sent and starts the next ones.
+ *  @return TRUE if a whole frame left the UART, FALSE else.
+ */
+bool uart_rsl_transmissionCompleted(void);
+
+/** @brief Gives the count of frames not completely transmitted yet.
+ *  @return The count of frames in the queue.
+ */
+uint32_t uart_rsl_getQueuedFrames(void);
+
+/** @brief Gives the number the next queued frame gets. The numbers run freely,
+ *         the frame queued last is the head - 1.
+ *  @return The head of the frame queue.
+ */
+uint32_t uart_rsl_getFrameHead(void);
+
+/** @brief Gives the number of the oldest frame not completely transmitted. All
+ *         frames before it left the UART or were dropped.
+ *  @return The tail of the frame queue.
+ */
+uint32_t uart_rsl_getFrameTail(void);
+
+/** @brief Sleeps until the queue is empty, UART_RSL_TX_FLUSH_TIMEOUT at most.
+ *  @return Nothing.
+ */
+void uart_rsl_flushTransmission(void);
+
+#if TEST_UART_RSL >= 1
+/** @brief This method is the test for this unit
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int uart_rsl_testsuite();
+#endif
 
 #endif
\ No newline at end of file
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-12    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Removed the unused handle                     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -53,7 +53,8 @@ void uart_tester_transmit(uint32_t length, uint8_t *buffer){
 }
 
 void uart_tester_startReception(){
-  HAL_StatusTypeDef hstd = HAL_UART_Receive_IT(&huart2, &receptionByteTester, 1);
+  // It is armed again out of the reception callback, the UART is ready then
+  HAL_UART_Receive_IT(&huart2, &receptionByteTester, 1);
 }
 
 // 230400 matching by 24 MHz baseclock
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-24    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Runs the const step tables                    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Calls the exit function of a left step        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -40,6 +40,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <string.h>
 #include "MasterDefine.h"
 #include "BehaviourDefines.h"
 #include "BehaviourController.h"
@@ -48,23 +49,40 @@
 /* Typedefinitions */
 
 /* Variables */
-BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF *sequence = NULL;
+const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF *sequence = NULL;
+BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF numberOfActualBehaviour = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED;
+bool initNext = FALSE;
+uint8_t redoCounter[BEHAVIOUR_SEQUENCE_MAX_STEPS];
 
 /* Function definitions */
 
+/** @brief      Lets the step know that the controller leaves it, so nothing it
+ *              started (e.g. a timer) outlives it.
+ *  @param *step The step that is left
+ *  @return Nothing
+ */
+static void behaviourController_leaveStep(const BEHAVIOUR_STEP_DESCRIPTOR_STRUCT_TYPEDEF *step){
+  // Has the step an exit function? // Yes, call it
+  if (step->behaviourExitFunction != NULL){
+    step->behaviourExitFunction();
+  }
+}
+
 /** @brief      This method is the loader function for a new sequence. This 
  *              function must be called before you try to call the controllers
  *              main function (to load the sequence you want to execute).
  *  @param *newSequence Pointer to the new sequence
  *  @return Nothing
  */
-void behaviourController_loadNewSequence(BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF *newSequence){
+void behaviourController_loadNewSequence(const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF *newSequence){
   // Set the local sequence pointer to the given new sequence
   sequence = newSequence;
   // Set the sequence step to the first behaviour
-  sequence->numberOfActualBehaviour = sequence->initializingBehaviour;
+  numberOfActualBehaviour = sequence->initializingBehaviour;
   // And set the initer to TRUE
-  sequence->initNext = TRUE;
+  initNext = TRUE;
+  // Every run of a sequence starts without reloads
+  memset(redoCounter, 0, sizeof(redoCounter));
 }
 
 /** @brief      Prior to this function CALL THE LOADER TO LOAD THE SEQUENCE. 
@@ -77,83 +95,105 @@ void behaviourController_loadNewSequence(BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDE
  */
 BEHAVIOUR_CONTROLLER_RETURN_VALUES_TYPEDEF behaviourController_main(){
   BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourSequenceReturnValue;
-  BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourSequenceCommandReturnValue;
+  const BEHAVIOUR_STEP_DESCRIPTOR_STRUCT_TYPEDEF *step;
+  const BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF *transition;
+  // Is the actual step part of the sequence? // No, the table is broken
+  if ((uint32_t) numberOfActualBehaviour >= sequence->numberOfSteps){
+    return BEHAVIOUR_CONTROLLER_RETURN_CRITICAL_ERROR;
+  }
+  step = &sequence->stepsOfSequence[numberOfActualBehaviour];
   // The "executive" part -> call the sequence main function
-  behaviourSequenceReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourMainFunction(sequence->initNext);
-  sequence->initNext = FALSE;
-  // The "reactive" part -> call the sequence callback function (for that step)
+  behaviourSequenceReturnValue = step->behaviourMainFunction(initNext);
+  initNext = FALSE;
+  // The "reactive" part -> look up the transition (for that step)
   switch(behaviourSequenceReturnValue){
-    /** This case will call the callback for the nothing case */
+    /** This case will select the transition for the nothing case */
     case BEHAVIOUR_STEP_RETURN_NOTHING:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionNothing();
+      transition = &step->transitionNothing;
       break;
-    /** This case will call the callback for the action a case */
+    /** This case will select the transition for the action a case */
     case BEHAVIOUR_STEP_RETURN_ACTION_A:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionAction_A();
+      transition = &step->transitionAction_A;
       break;
-    /** This case will call the callback for the action b case */
+    /** This case will select the transition for the action b case */
     case BEHAVIOUR_STEP_RETURN_ACTION_B:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionAction_B();
+      transition = &step->transitionAction_B;
       break;
-    /** This case will call the callback for the action c case */
+    /** This case will select the transition for the action c case */
     case BEHAVIOUR_STEP_RETURN_ACTION_C:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionAction_C();
+      transition = &step->transitionAction_C;
       break;
-    /** This case will call the callback for the action d case */
+    /** This case will select the transition for the action d case */
     case BEHAVIOUR_STEP_RETURN_ACTION_D:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionAction_D();
+      transition = &step->transitionAction_D;
       break;
-    /** This case will call the callback for the next step case */
+    /** This case will select the transition for the next step case */
     case BEHAVIOUR_STEP_RETURN_NEXT_BEHAVIOUR_STEP:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionNextBehaviour();
+      transition = &step->transitionNextBehaviour;
       break;
-    /** This case will call the callback for the redo step case */
+    /** This case will select the transition for the redo step case */
     case BEHAVIOUR_STEP_RETURN_REDO:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionRedo();
+      transition = &step->transitionRedo;
       break;
-    /** This case will call the callback for the abort case */
+    /** This case will select the transition for the abort case */
     case BEHAVIOUR_STEP_RETURN_ABORT:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionAbort();
+      transition = &step->transitionAbort;
       break;
-    /** This case will call the callback for the critical case */
+    /** This case will select the transition for the critical case */
     case BEHAVIOUR_STEP_RETURN_CRITICAL_ABORT:
-      behaviourSequenceCommandReturnValue = sequence->stepsOfSequence[sequence->numberOfActualBehaviour].behaviourCallbackFunctionCriticalAbort();
+      transition = &step->transitionCriticalAbort;
       break;
     /** This case will handle all unknown cases */
     default :
+      behaviourController_leaveStep(step);
       return BEHAVIOUR_CONTROLLER_RETURN_CRITICAL_ERROR;
       break;
   }
-  // The "handling" part in the behaviour controller -> handle the return value by doing what it stands for and return the result to the above layer
-  switch (behaviourSequenceCommandReturnValue.command){
-    /** This case will handle the nothing return value from the sequence callback */
+  // Has the transition a side effect? // Yes, execute it first
+  if (transition->action != NULL){
+    transition->action();
+  }
+  // The "handling" part in the behaviour controller -> handle the transition by doing what it stands for and return the result to the above layer
+  switch (transition->command){
+    /** This case will handle the nothing transition */
     case BEHAVIOUR_CONTROLLER_DO_NOTHING: 
       return BEHAVIOUR_CONTROLLER_RETURN_ONGOING;
       break;
-    /** This case will handle the reload return value from the sequence callback */
+    /** This case will handle the reload transition */
     case BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR:
-      sequence->initNext = TRUE;
+      behaviourController_leaveStep(step);
+      // Is the reload limited and reached? // Yes, the step failed too often
+      if (transition->redoLimit != 0){
+        if (++redoCounter[numberOfActualBehaviour] >= transition->redoLimit){
+          return BEHAVIOUR_CONTROLLER_RETURN_CRITICAL_ERROR;
+        }
+      }
+      initNext = TRUE;
       return BEHAVIOUR_CONTROLLER_RETURN_ONGOING;
       break;
-    /** This case will handle the load next return value from the sequence callback */
+    /** This case will handle the load next transition */
     case BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP:
-      if (behaviourSequenceCommandReturnValue.nextStep == BEHAVIOUR_SEQUENCING_STEP_UNDEFINED){
+      behaviourController_leaveStep(step);
+      if ((transition->nextStep == BEHAVIOUR_SEQUENCING_STEP_UNDEFINED) || ((uint32_t) transition->nextStep >= sequence->numberOfSteps)){
         return BEHAVIOUR_CONTROLLER_RETURN_CRITICAL_ERROR;
       }
-      sequence->initNext = TRUE;
-      sequence->numberOfActualBehaviour = behaviourSequenceCommandReturnValue.nextStep;
+      initNext = TRUE;
+      numberOfActualBehaviour = transition->nextStep;
       return BEHAVIOUR_CONTROLLER_RETURN_ONGOING_LOAD_NEXT;
       break;
-    /** This case will handle the finished return value from the sequence callback */
+    /** This case will handle the finished transition */
     case BEHAVIOUR_CONTROLLER_FINISHED_BEHAVIOUR: 
+      behaviourController_leaveStep(step);
       return BEHAVIOUR_CONTROLLER_RETURN_FINISHED;
       break;
-    /** This case will handle the critical return value from the sequence callback */
+    /** This case will handle the critical transition */
     case BEHAVIOUR_CONTROLLER_RETURN_CRITICAL: 
+      behaviourController_leaveStep(step);
       return BEHAVIOUR_CONTROLLER_RETURN_CRITICAL_ERROR;
       break;
-    /** This case will handle all the cases with unknown return values */
+    /** This case will handle all the transitions with unknown commands */
     default :
+      behaviourController_leaveStep(step);
       return BEHAVIOUR_CONTROLLER_RETURN_CRITICAL_ERROR;
       break;
   }
@@ -163,36 +203,22 @@ BEHAVIOUR_CONTROLLER_RETURN_VALUES_TYPEDEF behaviourController_main(){
 
 uint32_t testBehaviourFunctionCRepetitioncounter = 0x3C;
 uint32_t testBehaviourStartingCounter = 0x00;
+uint32_t testBehaviourExitCounter = 0x00;
 
-// This function will set up the whole thing to pass the test
+// The exit function of every test step
+void testSequence_countExit(void){
+  testBehaviourExitCounter++;
+}
+
+// This function will set up the whole thing to pass the test, the third start
+// jumps to step 4 by ACTION_A
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF testSequence_Initializer(bool init){
   testBehaviourFunctionCRepetitioncounter = 0;
   testBehaviourStartingCounter++;
-  return BEHAVIOUR_STEP_RETURN_NEXT_BEHAVIOUR_STEP;
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_Initializer_DoNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_Initializer_LoadNextStep(){
   if (testBehaviourStartingCounter <= 2){
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_1};
-  }else{
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_4};
+    return BEHAVIOUR_STEP_RETURN_NEXT_BEHAVIOUR_STEP;
   }
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_Initializer_Redo(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_Initializer_Abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_Initializer_CriticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
+  return BEHAVIOUR_STEP_RETURN_ACTION_A;
 }
 
 // This function will make the sequence load step C
@@ -205,26 +231,6 @@ BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF testSequence_FunctionA(bool init){
   return BEHAVIOUR_STEP_RETURN_NOTHING;
 }
 
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionA_DoNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionA_LoadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_3};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionA_Redo(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionA_Abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionA_CriticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
 // This function will end the sequence
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF testSequence_FunctionB(bool init){
   static uint32_t testBehaviourFunctionBInternalState = 0;
@@ -235,26 +241,6 @@ BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF testSequence_FunctionB(bool init){
   return BEHAVIOUR_STEP_RETURN_NOTHING;
 }
 
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionB_DoNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionB_LoadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_FINISHED_BEHAVIOUR, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionB_Redo(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionB_Abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionB_CriticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
 // This function will return REDO, so it will be run 3 times
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF testSequence_FunctionC(bool init){
   static uint32_t testBehaviourFunctionCInternalState = 0;
@@ -269,133 +255,74 @@ BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF testSequence_FunctionC(bool init){
   return BEHAVIOUR_STEP_RETURN_NOTHING;
 }
 
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionC_DoNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionC_LoadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_2};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionC_Redo(){
+// The action of the REDO transition of function C
+void testSequence_FunctionC_countRedo(void){
   testBehaviourFunctionCRepetitioncounter++;
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionC_Abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionC_CriticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
 }
 
-// This function will return REDO, so it will be run 3 times
+// This function will fail critical
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF testSequence_FunctionD(bool init){
   return BEHAVIOUR_STEP_RETURN_CRITICAL_ABORT;
 }
 
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionD_DoNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
+// This function will always want to be redone
+BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF testSequence_FunctionE(bool init){
+  return BEHAVIOUR_STEP_RETURN_REDO;
 }
 
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionD_LoadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionD_Redo(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
+const BEHAVIOUR_STEP_DESCRIPTOR_STRUCT_TYPEDEF behaviourControllerTestSteps[] = {
+  // BEHAVIOUR_SEQUENCING_STEP_START
+  {
+    .behaviourMainFunction      = testSequence_Initializer,
+    .behaviourExitFunction      = testSequence_countExit,
+    .transitionAction_A         = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_4),
+    .transitionNextBehaviour    = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_1),
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_1
+  {
+    .behaviourMainFunction      = testSequence_FunctionA,
+    .behaviourExitFunction      = testSequence_countExit,
+    .transitionNextBehaviour    = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_3),
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_2
+  {
+    .behaviourMainFunction      = testSequence_FunctionB,
+    .behaviourExitFunction      = testSequence_countExit,
+    .transitionNextBehaviour    = BEHAVIOUR_TRANSITION_FINISHED,
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_3
+  {
+    .behaviourMainFunction      = testSequence_FunctionC,
+    .behaviourExitFunction      = testSequence_countExit,
+    .transitionNextBehaviour    = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_2),
+    .transitionRedo             = {.command = BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR, .action = testSequence_FunctionC_countRedo},
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_4
+  {
+    .behaviourMainFunction      = testSequence_FunctionD,
+    .behaviourExitFunction      = testSequence_countExit,
+    .transitionCriticalAbort    = BEHAVIOUR_TRANSITION_CRITICAL,
+  },
+};
 
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionD_Abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
+const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF behaviourControllerTestSequence = {
+  .initializingBehaviour = BEHAVIOUR_SEQUENCING_STEP_START,
+  .numberOfSteps = BEHAVIOUR_STEP_COUNT(behaviourControllerTestSteps),
+  .stepsOfSequence = behaviourControllerTestSteps,
+};
 
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF testSequence_FunctionD_CriticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
+const BEHAVIOUR_STEP_DESCRIPTOR_STRUCT_TYPEDEF behaviourControllerTestStepsRedoLimit[] = {
+  // BEHAVIOUR_SEQUENCING_STEP_START
+  {
+    .behaviourMainFunction      = testSequence_FunctionE,
+    .transitionRedo             = BEHAVIOUR_TRANSITION_RELOAD(3),
+  },
+};
 
-BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF behaviourControllerTestSequence = {
+const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF behaviourControllerTestSequenceRedoLimit = {
   .initializingBehaviour = BEHAVIOUR_SEQUENCING_STEP_START,
-  .numberOfActualBehaviour = BEHAVIOUR_SEQUENCING_STEP_END,
-  .initNext = FALSE,
-  .stepsOfSequence = {
-    // BEHAVIOUR_SEQUENCING_STEP_START
-    {
-      .behaviourMainFunction                    = testSequence_Initializer,
-      .behaviourCallbackFunctionNothing         = testSequence_Initializer_DoNothing,
-      /*
-      .behaviourCallbackFunctionAction_A        = NULL,
-      .behaviourCallbackFunctionAction_B        = NULL,
-      .behaviourCallbackFunctionAction_C        = NULL,
-      .behaviourCallbackFunctionAction_D        = NULL,
-      */
-      .behaviourCallbackFunctionNextBehaviour   = testSequence_Initializer_LoadNextStep,
-      .behaviourCallbackFunctionRedo            = testSequence_Initializer_Redo,
-      .behaviourCallbackFunctionAbort           = testSequence_Initializer_Abort,
-      .behaviourCallbackFunctionCriticalAbort   = testSequence_Initializer_CriticalAbort,
-    },
-    // BEHAVIOUR_SEQUENCING_STEP_1
-    {
-      .behaviourMainFunction                    = testSequence_FunctionA,
-      .behaviourCallbackFunctionNothing         = testSequence_FunctionA_DoNothing,
-      /*
-      .behaviourCallbackFunctionAction_A        = NULL,
-      .behaviourCallbackFunctionAction_B        = NULL,
-      .behaviourCallbackFunctionAction_C        = NULL,
-      .behaviourCallbackFunctionAction_D        = NULL,
-      */
-      .behaviourCallbackFunctionNextBehaviour   = testSequence_FunctionA_LoadNextStep,
-      .behaviourCallbackFunctionRedo            = testSequence_FunctionA_Redo,
-      .behaviourCallbackFunctionAbort           = testSequence_FunctionA_Abort,
-      .behaviourCallbackFunctionCriticalAbort   = testSequence_FunctionA_CriticalAbort,
-    },
-    // BEHAVIOUR_SEQUENCING_STEP_2
-    {
-      .behaviourMainFunction                    = testSequence_FunctionB,
-      .behaviourCallbackFunctionNothing         = testSequence_FunctionB_DoNothing,
-      /*
-      .behaviourCallbackFunctionAction_A        = NULL,
-      .behaviourCallbackFunctionAction_B        = NULL,
-      .behaviourCallbackFunctionAction_C        = NULL,
-      .behaviourCallbackFunctionAction_D        = NULL,
-      */
-      .behaviourCallbackFunctionNextBehaviour   = testSequence_FunctionB_LoadNextStep,
-      .behaviourCallbackFunctionRedo            = testSequence_FunctionB_Redo,
-      .behaviourCallbackFunctionAbort           = testSequence_FunctionB_Abort,
-      .behaviourCallbackFunctionCriticalAbort   = testSequence_FunctionB_CriticalAbort,
-    },
-    // BEHAVIOUR_SEQUENCING_STEP_3
-    {
-      .behaviourMainFunction                    = testSequence_FunctionC,
-      .behaviourCallbackFunctionNothing         = testSequence_FunctionC_DoNothing,
-      /*
-      .behaviourCallbackFunctionAction_A        = NULL,
-      .behaviourCallbackFunctionAction_B        = NULL,
-      .behaviourCallbackFunctionAction_C        = NULL,
-      .behaviourCallbackFunctionAction_D        = NULL,
-      */
-      .behaviourCallbackFunctionNextBehaviour   = testSequence_FunctionC_LoadNextStep,
-      .behaviourCallbackFunctionRedo            = testSequence_FunctionC_Redo,
-      .behaviourCallbackFunctionAbort           = testSequence_FunctionC_Abort,
-      .behaviourCallbackFunctionCriticalAbort   = testSequence_FunctionC_CriticalAbort,
-    },
-    // BEHAVIOUR_SEQUENCING_STEP_4
-    {
-      .behaviourMainFunction                    = testSequence_FunctionD,
-      .behaviourCallbackFunctionNothing         = testSequence_FunctionD_DoNothing,
-      /*
-      .behaviourCallbackFunctionAction_A        = NULL,
-      .behaviourCallbackFunctionAction_B        = NULL,
-      .behaviourCallbackFunctionAction_C        = NULL,
-      .behaviourCallbackFunctionAction_D        = NULL,
-      */
-      .behaviourCallbackFunctionNextBehaviour   = testSequence_FunctionD_LoadNextStep,
-      .behaviourCallbackFunctionRedo            = testSequence_FunctionD_Redo,
-      .behaviourCallbackFunctionAbort           = testSequence_FunctionD_Abort,
-      .behaviourCallbackFunctionCriticalAbort   = testSequence_FunctionD_CriticalAbort,
-    },
-  },
+  .numberOfSteps = BEHAVIOUR_STEP_COUNT(behaviourControllerTestStepsRedoLimit),
+  .stepsOfSequence = behaviourControllerTestStepsRedoLimit,
 };
 
 //======================================//
@@ -456,6 +383,7 @@ int behaviourController_testsuiteReturner(int retVal){
 
 int behaviourController_testsuite(void){ 
   behaviourController_loadNewSequence(&behaviourControllerTestSequence);
+  testBehaviourExitCounter = 0;
   
   if (behaviourController_main() != BEHAVIOUR_CONTROLLER_RETURN_ONGOING_LOAD_NEXT){
     return behaviourController_testsuiteReturner(-1);
@@ -481,6 +409,12 @@ int behaviourController_testsuite(void){
     return behaviourController_testsuiteReturner(-1);
   }
   
+  // Every step was left once, step C three times (two reloads), the
+  // finishing step too
+  if (testBehaviourExitCounter != 6){
+    return behaviourController_testsuiteReturner(-2);
+  }
+  
   behaviourController_loadNewSequence(&behaviourControllerTestSequence);
   
   if (behaviourController_main() != BEHAVIOUR_CONTROLLER_RETURN_ONGOING_LOAD_NEXT){
@@ -508,6 +442,7 @@ int behaviourController_testsuite(void){
   }
   
   behaviourController_loadNewSequence(&behaviourControllerTestSequence);
+  testBehaviourExitCounter = 0;
   
   if (behaviourController_main() != BEHAVIOUR_CONTROLLER_RETURN_ONGOING_LOAD_NEXT){
     return behaviourController_testsuiteReturner(-1);
@@ -516,6 +451,28 @@ int behaviourController_testsuite(void){
   if (behaviourController_main() != BEHAVIOUR_CONTROLLER_RETURN_CRITICAL_ERROR){
     return behaviourController_testsuiteReturner(-1);
   }
+  
+  // The critical abort leaves the step as well
+  if (testBehaviourExitCounter != 2){
+    return behaviourController_testsuiteReturner(-3);
+  }
+  
+  // The third REDO fails, a new run of the sequence starts from 0 again
+  for (int run = 0; run < 2; run++){
+    behaviourController_loadNewSequence(&behaviourControllerTestSequenceRedoLimit);
+    
+    if (behaviourController_main() != BEHAVIOUR_CONTROLLER_RETURN_ONGOING){
+      return behaviourController_testsuiteReturner(-1);
+    }
+    
+    if (behaviourController_main() != BEHAVIOUR_CONTROLLER_RETURN_ONGOING){
+      return behaviourController_testsuiteReturner(-1);
+    }
+    
+    if (behaviourController_main() != BEHAVIOUR_CONTROLLER_RETURN_CRITICAL_ERROR){
+      return behaviourController_testsuiteReturner(-1);
+    }
+  }
 
   return behaviourController_testsuiteReturner(0);
 }
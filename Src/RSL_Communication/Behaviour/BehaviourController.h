@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-24    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Sequences are const                           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -57,7 +57,7 @@
  *  @param *newSequence Pointer to the new sequence
  *  @return Nothing
  */
-void behaviourController_loadNewSequence(BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF *newSequence);
+void behaviourController_loadNewSequence(const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF *newSequence);
 
 /** @brief      Prior to this function CALL THE LOADER TO LOAD THE SEQUENCE. 
  *              The controller will execute the loaded behaviour.
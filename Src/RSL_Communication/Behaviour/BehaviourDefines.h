@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-05-28    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Const step tables with transitions            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Exit function of a step                       |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -125,20 +125,15 @@ typedef enum BEHAVIOUR_CONTROLLER_RETURN_VALUES {
 } BEHAVIOUR_CONTROLLER_RETURN_VALUES_TYPEDEF;
 
 /**
- * @brief       This typedef struct defines a structure which is used as return
- *              value in the callbacks of the behaviour handling.
- *              command is the "decider" for what to do
- *              nextStep is only used for commands that do lead to a next step
+ * @brief       The count of steps a sequence can have, see
+ *              BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF.
  */
-typedef struct BEHAVIOUR_CONTROLLER_COMMAND_STRUCT {
-  BEHAVIOUR_CONTROLLER_COMMANDS_TYPEDEF command;/**< Returned command */
-  BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF nextStep;  /**< The next step ID. Leave BEHAVIOUR_SEQUENCING_STEP_UNDEFINED if not used by command */
-} BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF;
+#define BEHAVIOUR_SEQUENCE_MAX_STEPS                    32
 
 /**
  * @brief       The main function. Will be called first by the behaviour
  *              controller. The return value of this function will decide,
- *              which callback function will be executed afterwards.
+ *              which transition will be executed afterwards.
  *              return-type:         BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF
  *              param-types:         bool
  *              name of type:        BEHAVIOUR_MAIN_FUNC
@@ -146,49 +141,80 @@ typedef struct BEHAVIOUR_CONTROLLER_COMMAND_STRUCT {
 typedef BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF (*BEHAVIOUR_MAIN_FUNC)(bool init);
 
 /**
- * @brief       The callback function of the behaviour(-step). Will be called by 
- *              the behaviour controller after the main function.
- *              return-type:         BEHAVIOUR_CONTROLLER_RETURN_STRUCT_TYPEDEF
- *              param-types:         BEHAVIOUR_RETURN_VALUES_TYPEDEF
- *              name of type:        BEHAVIOUR_CALLBACK_FUNC
+ * @brief       An optional side effect of a transition (e.g. marking the
+ *              transmission as done). Called before the controller executes
+ *              the command of the transition.
+ *              return-type:         void
+ *              param-types:         void
+ *              name of type:        BEHAVIOUR_ACTION_FUNC
  */
-typedef BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF (*BEHAVIOUR_CALLBACK_FUNC)(void);
+typedef void (*BEHAVIOUR_ACTION_FUNC)(void);
 
 /**
- * @brief       The behaviour steps integral function. The main function is the
- *              "executive" part of each step, while the callbacks are the
+ * @brief       This typedef struct describes what the behaviour controller does
+ *              for one return value of a steps main function.
+ *              command is the "decider" for what to do
+ *              nextStep is only used by BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP
+ *              redoLimit is only used by BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR
+ *              A transition which is left out of a table is all zero, which
+ *              is BEHAVIOUR_CONTROLLER_DO_NOTHING without action.
+ */
+typedef struct BEHAVIOUR_TRANSITION_STRUCT {
+  BEHAVIOUR_CONTROLLER_COMMANDS_TYPEDEF command;        /**< The command for the controller */
+  BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF    nextStep;       /**< The next step ID for BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP */
+  uint8_t                               redoLimit;      /**< The reload which reaches this count (per step and sequence run) fails critical. 0 = no limit */
+  BEHAVIOUR_ACTION_FUNC                 action;         /**< The side effect of the transition, NULL if there is none */
+} BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF;
+
+/** @brief Transition: load the given step next */
+#define BEHAVIOUR_TRANSITION_LOAD_STEP(step)            {.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = (step)}
+/** @brief Transition: reload the actual step, the limit-th reload fails critical */
+#define BEHAVIOUR_TRANSITION_RELOAD(limit)              {.command = BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR, .redoLimit = (limit)}
+/** @brief Transition: the behaviour is finished */
+#define BEHAVIOUR_TRANSITION_FINISHED                   {.command = BEHAVIOUR_CONTROLLER_FINISHED_BEHAVIOUR}
+/** @brief Transition: the behaviour failed */
+#define BEHAVIOUR_TRANSITION_CRITICAL                   {.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL}
+/** @brief Transition: stay in the actual step, but execute the action */
+#define BEHAVIOUR_TRANSITION_ACTION(func)               {.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .action = (func)}
+
+/**
+ * @brief       The behaviour steps integral struct. The main function is the
+ *              "executive" part of each step, while the transitions are the
  *              "reactive" part of each step.
  *              If you want to build your own sequencing then you only
- *              need to integrate functions that are within the scope of the
- *              main functions return values. If you don't have any actions,
- *              then they'll never be called - so you can leave them open.
+ *              need to fill in the transitions that are within the scope of
+ *              the main functions return values. All others do nothing.
+ *              The steps are const tables and stay in the flash.
  */
-typedef struct BEHAVIOR_SEQUENCE_STEP_STRUCT {
-  //BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF numberOfNextStep;
-  BEHAVIOUR_MAIN_FUNC           behaviourMainFunction;                  /**< The "main" function of the sequence. This is where things are done */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionNothing;       /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_NOTHING" */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionAction_A;      /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_ACTION_A" */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionAction_B;      /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_ACTION_B" */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionAction_C;      /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_ACTION_C" */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionAction_D;      /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_ACTION_D" */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionNextBehaviour; /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_NEXT_BEHAVIOUR_STEP" */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionRedo;          /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_REDO" */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionAbort;         /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_ABORT" */
-  BEHAVIOUR_CALLBACK_FUNC       behaviourCallbackFunctionCriticalAbort; /**< The callback for the return value "BEHAVIOUR_STEP_RETURN_CRITICAL_ABORT" */
-} BEHAVIOR_SEQUENCE_STEP_STRUCT_TYPEDEF;
+typedef struct BEHAVIOUR_STEP_DESCRIPTOR_STRUCT {
+  BEHAVIOUR_MAIN_FUNC                   behaviourMainFunction;  /**< The "main" function of the sequence. This is where things are done */
+  BEHAVIOUR_ACTION_FUNC                 behaviourExitFunction;  /**< Called when the controller leaves the step (next step, reload, end of the sequence), e.g. to stop its timers. NULL if there is none */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionNothing;      /**< The transition for the return value "BEHAVIOUR_STEP_RETURN_NOTHING" */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionAction_A;     /**< The transition for the return value "BEHAVIOUR_STEP_RETURN_ACTION_A" */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionAction_B;     /**< The transition for the return value "BEHAVIOUR_STEP_RETURN_ACTION_B" */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionAction_C;     /**< The transition for the return value "BEHAVIOUR_STEP_RETURN_ACTION_C" */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionAction_D;     /**< The transition for the return value "BEHAVIOUR_STEP_RETURN_ACTION_D" */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionNextBehaviour;/**< The transition for the return value "BEHAVIOUR_STEP_RETURN_NEXT_BEHAVIOUR_STEP" */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionRedo;         /**< The transition for the return value "BEHAVIOUR_STEP_RETURN_REDO" */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionAbort;        /**< The transition for the return value "BEHAVIOUR_STEP_RETURN_ABORT" */
+  BEHAVIOUR_TRANSITION_STRUCT_TYPEDEF   transitionCriticalAbort;/**< The transition for the return value "BEHAVIOUR_STEP_RETURN_CRITICAL_ABORT" */
+} BEHAVIOUR_STEP_DESCRIPTOR_STRUCT_TYPEDEF;
 
 /**
  * @brief       The behaviours integral struct. This struct defines
- *              with which function to start, how many steps there are,
- *              the init flag and the behaviour steps themselves.
+ *              with which step to start, how many steps there are and the
+ *              behaviour steps themselves. It is const, the state of the
+ *              running sequence is kept by the behaviour controller.
  */
 typedef struct BEHAVIOUR_CONTROLLER_CALL_STRUCT {
-  BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF initializingBehaviour;
-  BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF numberOfActualBehaviour;
-  bool initNext;
-  BEHAVIOR_SEQUENCE_STEP_STRUCT_TYPEDEF stepsOfSequence[];
+  BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF                    initializingBehaviour;  /**< The step which is loaded first */
+  uint32_t                                              numberOfSteps;          /**< The count of steps in stepsOfSequence */
+  const BEHAVIOUR_STEP_DESCRIPTOR_STRUCT_TYPEDEF        *stepsOfSequence;       /**< The steps, indexed by BEHAVIOUR_SEQUENCING_STEPS_TYPEDEF */
 } BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF;
 
+/** @brief The count of steps of a step table */
+#define BEHAVIOUR_STEP_COUNT(steps)                     (sizeof(steps) / sizeof((steps)[0]))
+
 /* Variables */
 
 /* Function definitions */
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       |               | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Added selective ACK                           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Direct indexed descriptor table               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -43,218 +43,81 @@
 #include "Message_Definitions.h"
 #include "ValidMessages.h"
 /* Typedefinitions */
+// Shorthands to keep the table readable
+#define TO_RSL10        MESSAGE_DESCRIPTOR_FLAG_STM32_TO_RSL10
+#define TO_STM32        MESSAGE_DESCRIPTOR_FLAG_RSL10_TO_STM32
+#define ACK             MESSAGE_DESCRIPTOR_FLAG_REQUIRES_ACK
+#define FOTA            MESSAGE_DESCRIPTOR_FLAG_FOTA
 
 /* Variables */
-/*
-#ifdef I_AM_STM32
-  #define TRANSMISSION_ROWSIZE  4
-  #define TRANSMISSION_COLCOUNT 15
-  #define RECEPTION_ROWSIZE     4
-  #define RECEPTION_COLCOUNT    25
-#else
-  #ifdef I_AM_RSL10
-    #define TRANSMISSION_ROWSIZE  4
-    #define TRANSMISSION_COLCOUNT 15
-    #define RECEPTION_ROWSIZE     4
-    #define RECEPTION_COLCOUNT    25
-  #else
-    #warning NO DEVICE ROLE DEFINED!
-  #endif
-#endif
-*/
-
-#ifdef I_AM_STM32
-/**
- * @brief This 2D-Array contains the CMD-Byte, 
- *        the minimum allowed data length,
- *        the maximum allowed data length,
- *        spacer byte.
- *        This is for the transmission part (outgoing from STM32 side)
- */
-  const uint8_t uartMsgCmdDefinedTransmission[][4] = 
-                                                  {     {UART_MSG_CMD_PACK_REC_ACK                      , 0, 0, 0,}, /**< CMD ACK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PACK_REC_NAK                      , 0, 0, 0,}, /**< CMD NAK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_BATTERY_STATE                     , 1, 1, 0,}, /**< CMD Battery, min. 1 bytes, max. 1 bytes */
-                                                        {UART_MSG_CMD_ALERT                             , 1, 1, 0,}, /**< CMD Alert, min. 1 bytes, max. 1 bytes */
-                                                        {UART_MSG_CMD_ERROR                             , 1, 1, 0,}, /**< CMD Error, min. 1 bytes, max. 1 bytes */
-                                                        {UART_MSG_CMD_GO_TO_SLEEP                       , 0, 0, 0,}, /**< CMD Go to sleep, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_REBOOT                            , 0, 0, 0,}, /**< CMD Reboot, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_PAIRING                     , 0, 0, 0,}, /**< CMD Start pairing, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_REMOVE_PAIRED_DEVICE              , 0, 0, 0,}, /**< CMD Remove paired devices, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_BC                          , 0, 0, 0,}, /**< CMD Start broadcast, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_BC                           , 0, 0, 0,}, /**< CMD Stop broadcast, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_HCI_COMMAND                       , 0, 32,0,}, /**< CMD HCI, min. 0 bytes, max. 32 bytes */
-                                                        {UART_MSG_CMD_CALIBRATION_COMMAND               , 0, 32,0,}, /**< CMD CAL, min. 0 bytes, max. 32 bytes */
-                                                        {UART_MSG_CMD_START_FOTA                        , 0, 0, 0,}, /**< CMD FOTA start, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_FOTA                         , 0, 0, 0,}, /**< CMD FOTA stop, min. 0 bytes, max. 0 bytes */
-                                                  };
-/**
- * @brief This 2D-Array contains the CMD-Byte, 
- *        the minimum allowed data length,
- *        the maximum allowed data length,
- *        spacer byte.
- *        This is for the reception part (incoming from STM32 side)
- */
-  const uint8_t uartMsgCmdDefinedReception[][4] = 
-                                                  {     {UART_MSG_CMD_PACK_REC_ACK                      , 0, 0, 0,}, /**< CMD ACK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PACK_REC_NAK                      , 0, 0, 0,}, /**< CMD NAK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_CHAR_ACK                          , 0, 0, 0,}, /**< CMD Characteristic update OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_CHAR_NAK                          , 0, 0, 0,}, /**< CMD Characteristic update NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_GO_TO_SLEEP_OK                    , 0, 0, 0,}, /**< CMD Go to sleep OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_READY_AFTER_SLEEP                 , 0, 0, 0,}, /**< CMD Ready after sleep, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_GO_TO_SLEEP_MYSELF                , 0, 0, 0,}, /**< CMD Go to sleep myself, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_RESPONSE_TO_REBOOT                , 0, 0, 0,}, /**< CMD Reboot OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_READY_AFTER_BOOT_UP               , 0, 0, 0,}, /**< CMD Ready after boot, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PAIRING_OK                        , 0, 0, 0,}, /**< CMD Pairing OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PAIRING_NOT_OK                    , 0, 0, 0,}, /**< CMD Pairing NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PAIRED_DEVICE_REMOVED_OK          , 0, 0, 0,}, /**< CMD Remove devices OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_BC_OK                       , 0, 0, 0,}, /**< CMD Start broadcast OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_BC_NOT_OK                   , 0, 0, 0,}, /**< CMD Start broadcast NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_DATA_TRANSMIT_OK                  , 0, 0, 0,}, /**< CMD Data transmit OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_BC_OK                        , 0, 0, 0,}, /**< CMD Stop broadcast OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_BC_NOT_OK                    , 0, 0, 0,}, /**< CMD Stop broadcast NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_HCI_COMMAND_RESPONSE              , 0, 32,0,}, /**< CMD HCI response, min. 0 bytes, max. 32 bytes */
-                                                        {UART_MSG_CMD_CALIBRATION_COMMAND_RESPONSE      , 0, 32,0,}, /**< CMD CAL response, min. 0 bytes, max. 32 bytes */
-                                                        {UART_MSG_CMD_START_FOTA_OK                     , 0, 0, 0,}, /**< CMD Start FOTA OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_FOTA_NOK                    , 0, 0, 0,}, /**< CMD Start FOTA NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_FOTA_ONGOING                      , 0, 0, 0,}, /**< CMD FOTA ongoing, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_FOTA_FINISHED                     , 0, 0, 0,}, /**< CMD FOTA finished, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_FOTA_OK                      , 0, 0, 0,}, /**< CMD Stop FOTA OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_FOTA_NOK                     , 0, 0, 0,}, /**< CMD Stop FOTA NOT OK, min. 0 bytes, max. 0 bytes */
-                                                  };
-#else
-  #ifdef I_AM_RSL10
-/**
- * @brief This 2D-Array contains the CMD-Byte, 
- *        the minimum allowed data length,
- *        the maximum allowed data length,
- *        spacer byte.
- *        This is for the transmission part (outgoing from RSL10 side)
- */
-    const uint8_t uartMsgCmdDefinedReception[TRANSMISSION_COLCOUNT][TRANSMISSION_ROWSIZE] = 
-                                                    {   {UART_MSG_CMD_PACK_REC_ACK                      , 0, 0, 0,}, /**< CMD ACK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PACK_REC_NAK                      , 0, 0, 0,}, /**< CMD NAK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_BATTERY_STATE                     , 1, 1, 0,}, /**< CMD Battery, min. 1 bytes, max. 1 bytes */
-                                                        {UART_MSG_CMD_ALERT                             , 1, 1, 0,}, /**< CMD Alert, min. 1 bytes, max. 1 bytes */ 
-                                                        {UART_MSG_CMD_ERROR                             , 1, 1, 0,}, /**< CMD Error, min. 1 bytes, max. 1 bytes */
-                                                        {UART_MSG_CMD_GO_TO_SLEEP                       , 0, 0, 0,}, /**< CMD Go to sleep, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_REBOOT                            , 0, 0, 0,}, /**< CMD Reboot, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_PAIRING                     , 0, 0, 0,}, /**< CMD Start pairing, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_REMOVE_PAIRED_DEVICE              , 0, 0, 0,}, /**< CMD Remove paired devices, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_BC                          , 0, 0, 0,}, /**< CMD Start broadcast, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_BC                           , 0, 0, 0,}, /**< CMD Stop broadcast, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_HCI_COMMAND                       , 0, 32,0,}, /**< CMD HCI, min. 0 bytes, max. 32 bytes */
-                                                        {UART_MSG_CMD_CALIBRATION_COMMAND               , 0, 32,0,}, /**< CMD CAL, min. 0 bytes, max. 32 bytes */
-                                                        {UART_MSG_CMD_START_FOTA                        , 0, 0, 0,}, /**< CMD FOTA start, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_FOTA                         , 0, 0, 0,}, /**< CMD FOTA stop, min. 0 bytes, max. 0 bytes */
-                                                  };
 /**
- * @brief This 2D-Array contains the CMD-Byte, 
- *        the minimum allowed data length,
- *        the maximum allowed data length,
- *        spacer byte.
- *        This is for the reception part (incoming from RSL10 side)
+ * @brief This table contains the descriptor of every CMD-Byte, indexed by the
+ *        CMD-Byte itself: the minimum allowed data length, the maximum allowed
+ *        data length and the flags (direction, ACK, FOTA). It is the same for
+ *        both device roles, MESSAGE_DESCRIPTOR_FLAG_TRANSMISSION and
+ *        MESSAGE_DESCRIPTOR_FLAG_RECEPTION pick the direction of the own role.
+ *        CMD-Bytes not listed are zero and therefore not defined.
  */
-    const uint8_t uartMsgCmdDefinedTransmission[RECEPTION_COLCOUNT][RECEPTION_ROWSIZE] = 
-                                                    {   {UART_MSG_CMD_PACK_REC_ACK                      , 0, 0, 0,}, /**< CMD ACK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PACK_REC_NAK                      , 0, 0, 0,}, /**< CMD NAK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_CHAR_ACK                          , 0, 0, 0,}, /**< CMD Characteristic update OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_CHAR_NAK                          , 0, 0, 0,}, /**< CMD Characteristic update NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_GO_TO_SLEEP_OK                    , 0, 0, 0,}, /**< CMD Go to sleep OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_READY_AFTER_SLEEP                 , 0, 0, 0,}, /**< CMD Ready after sleep, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_GO_TO_SLEEP_MYSELF                , 0, 0, 0,}, /**< CMD Go to sleep myself, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_RESPONSE_TO_REBOOT                , 0, 0, 0,}, /**< CMD Reboot OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_READY_AFTER_BOOT_UP               , 0, 0, 0,}, /**< CMD Ready after boot, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PAIRING_OK                        , 0, 0, 0,}, /**< CMD Pairing OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PAIRING_NOT_OK                    , 0, 0, 0,}, /**< CMD Pairing NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_PAIRED_DEVICE_REMOVED_OK          , 0, 0, 0,}, /**< CMD Remove devices OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_BC_OK                       , 0, 0, 0,}, /**< CMD Start broadcast OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_BC_NOT_OK                   , 0, 0, 0,}, /**< CMD Start broadcast NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_DATA_TRANSMIT_OK                  , 0, 0, 0,}, /**< CMD Data transmit OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_BC_OK                        , 0, 0, 0,}, /**< CMD Stop broadcast OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_BC_NOT_OK                    , 0, 0, 0,}, /**< CMD Stop broadcast NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_HCI_COMMAND_RESPONSE              , 0, 32,0,}, /**< CMD HCI response, min. 0 bytes, max. 32 bytes */
-                                                        {UART_MSG_CMD_CALIBRATION_COMMAND_RESPONSE      , 0, 32,0,}, /**< CMD CAL response, min. 0 bytes, max. 32 bytes */
-                                                        {UART_MSG_CMD_START_FOTA_OK                     , 0, 0, 0,}, /**< CMD Start FOTA OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_START_FOTA_NOK                    , 0, 0, 0,}, /**< CMD Start FOTA NOT OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_FOTA_ONGOING                      , 0, 0, 0,}, /**< CMD FOTA ongoing, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_FOTA_FINISHED                     , 0, 0, 0,}, /**< CMD FOTA finished, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_FOTA_OK                      , 0, 0, 0,}, /**< CMD Stop FOTA OK, min. 0 bytes, max. 0 bytes */
-                                                        {UART_MSG_CMD_STOP_FOTA_NOK                     , 0, 0, 0,}, /**< CMD Stop FOTA NOT OK, min. 0 bytes, max. 0 bytes */
-                                                  };
-  #else
-    #warning NO DEVICE ROLE DEFINED!
-  #endif
-#endif
+const MESSAGE_DESCRIPTOR_STRUCT_TYPEDEF messageDescriptorTable[MESSAGE_DESCRIPTOR_TABLE_LENGTH] = {
+  [UART_MSG_CMD_PACK_REC_ACK]                    = { 0,  0, TO_RSL10 | TO_STM32                   }, /**< CMD ACK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_PACK_REC_NAK]                    = { 0,  0, TO_RSL10 | TO_STM32                   }, /**< CMD NAK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_PACK_REC_SACK]                   = { 1,  1, TO_RSL10 | TO_STM32                   }, /**< CMD Selective ACK, min. 1 bytes, max. 1 bytes */
+  [UART_MSG_CMD_BATTERY_STATE]                   = { 1,  1, TO_RSL10 | ACK                        }, /**< CMD Battery, min. 1 bytes, max. 1 bytes */
+  [UART_MSG_CMD_ALERT]                           = { 1,  1, TO_RSL10 | ACK                        }, /**< CMD Alert, min. 1 bytes, max. 1 bytes */
+  [UART_MSG_CMD_ERROR]                           = { 1,  1, TO_RSL10 | ACK                        }, /**< CMD Error, min. 1 bytes, max. 1 bytes */
+  [UART_MSG_CMD_GO_TO_SLEEP]                     = { 0,  0, TO_RSL10 | ACK                        }, /**< CMD Go to sleep, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_REBOOT]                          = { 0,  0, TO_RSL10 | ACK                        }, /**< CMD Reboot, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_START_PAIRING]                   = { 0,  0, TO_RSL10 | ACK                        }, /**< CMD Start pairing, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_REMOVE_PAIRED_DEVICE]            = { 0,  0, TO_RSL10 | ACK                        }, /**< CMD Remove paired devices, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_START_BC]                        = { 0,  0, TO_RSL10 | ACK                        }, /**< CMD Start broadcast, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_STOP_BC]                         = { 0,  0, TO_RSL10 | ACK                        }, /**< CMD Stop broadcast, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_HCI_COMMAND]                     = { 0, 32, TO_RSL10 | ACK                        }, /**< CMD HCI, min. 0 bytes, max. 32 bytes */
+  [UART_MSG_CMD_CALIBRATION_COMMAND]             = { 0, 32, TO_RSL10 | ACK                        }, /**< CMD CAL, min. 0 bytes, max. 32 bytes */
+  [UART_MSG_CMD_START_FOTA]                      = { 0,  0, TO_RSL10 | ACK | FOTA                 }, /**< CMD FOTA start, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_STOP_FOTA]                       = { 0,  0, TO_RSL10 | ACK | FOTA                 }, /**< CMD FOTA stop, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_CHAR_ACK]                        = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Characteristic update OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_CHAR_NAK]                        = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Characteristic update NOT OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_GO_TO_SLEEP_OK]                  = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Go to sleep OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_READY_AFTER_SLEEP]               = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Ready after sleep, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_GO_TO_SLEEP_MYSELF]              = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Go to sleep myself, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_RESPONSE_TO_REBOOT]              = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Reboot OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_READY_AFTER_BOOT_UP]             = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Ready after boot, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_PAIRING_OK]                      = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Pairing OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_PAIRING_NOT_OK]                  = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Pairing NOT OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_PAIRED_DEVICE_REMOVED_OK]        = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Remove devices OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_START_BC_OK]                     = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Start broadcast OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_START_BC_NOT_OK]                 = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Start broadcast NOT OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_DATA_TRANSMIT_OK]                = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Data transmit OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_STOP_BC_OK]                      = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Stop broadcast OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_STOP_BC_NOT_OK]                  = { 0,  0, TO_STM32 | ACK                        }, /**< CMD Stop broadcast NOT OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_HCI_COMMAND_RESPONSE]            = { 0, 32, TO_STM32 | ACK                        }, /**< CMD HCI response, min. 0 bytes, max. 32 bytes */
+  [UART_MSG_CMD_CALIBRATION_COMMAND_RESPONSE]    = { 0, 32, TO_STM32 | ACK                        }, /**< CMD CAL response, min. 0 bytes, max. 32 bytes */
+  [UART_MSG_CMD_START_FOTA_OK]                   = { 0,  0, TO_STM32 | ACK | FOTA                 }, /**< CMD Start FOTA OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_START_FOTA_NOK]                  = { 0,  0, TO_STM32 | ACK | FOTA                 }, /**< CMD Start FOTA NOT OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_FOTA_ONGOING]                    = { 0,  0, TO_STM32 | ACK | FOTA                 }, /**< CMD FOTA ongoing, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_FOTA_FINISHED]                   = { 0,  0, TO_STM32 | ACK | FOTA                 }, /**< CMD FOTA finished, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_STOP_FOTA_OK]                    = { 0,  0, TO_STM32 | ACK | FOTA                 }, /**< CMD Stop FOTA OK, min. 0 bytes, max. 0 bytes */
+  [UART_MSG_CMD_STOP_FOTA_NOK]                   = { 0,  0, TO_STM32 | ACK | FOTA                 }, /**< CMD Stop FOTA NOT OK, min. 0 bytes, max. 0 bytes */
+};
 
 /* Function definitions */
-/** @brief This method will return the pointer to the reception 2D-byte array
- *  @return Pointer to the reception 2D-byte array
- */
-uint8_t** messageParamValidity_reception_getPointerToBuffer(){
-  return (uint8_t **)uartMsgCmdDefinedReception;
-}
-
-/** @brief This method will return the overall byte count of the 2D-byte array
- *  @return Overall byte count of the 2D-byte array
- */
-uint32_t messageParamValidity_reception_getOverallSize(){
-  return sizeof(uartMsgCmdDefinedReception);
-}
-
-/** @brief This method will return the column count of the 2D-byte array
- *  @return Column count of the 2D-byte array
- */
-uint32_t messageParamValidity_reception_getColCount(){
-  return sizeof(uartMsgCmdDefinedReception[0]);
-}
-
-/** @brief This method will return the row count of the 2D-byte array
- *  @return Row count of the 2D-byte array
- */
-uint32_t messageParamValidity_reception_getRowCount(){
-  return sizeof(uartMsgCmdDefinedReception) / sizeof(uartMsgCmdDefinedReception[0]);
-}
-
-/** @brief This method will return the element size in the 2D-byte array
- *  @return Element size in the 2D-byte array
- */
-uint32_t messageParamValidity_reception_getElementSize(){
-  return sizeof(uartMsgCmdDefinedReception[0][0]);
-}
-
-
-/** @brief This method will return the pointer to the reception 2D-byte array
- *  @return Pointer to the reception 2D-byte array
- */
-uint8_t** messageParamValidity_transmission_getPointerToBuffer(){
-  return (uint8_t **)uartMsgCmdDefinedTransmission;
-}
-
-/** @brief This method will return the overall byte count of the 2D-byte array
- *  @return Overall byte count of the 2D-byte array
- */
-uint32_t messageParamValidity_transmission_getOverallSize(){
-  return sizeof(uartMsgCmdDefinedTransmission);
-}
-
-/** @brief This method will return the column count of the 2D-byte array
- *  @return Column count of the 2D-byte array
- */
-uint32_t messageParamValidity_transmission_getColCount(){
-  return sizeof(uartMsgCmdDefinedTransmission[0]);
-}
-
-/** @brief This method will return the row count of the 2D-byte array
- *  @return Row count of the 2D-byte array
+/** @brief This method will return the descriptor of a CMD-Byte
+ *  @param cmdByte Byte that contains the command
+ *  @return Pointer to the descriptor, its flags are 0 if the CMD-Byte is not defined
  */
-uint32_t messageParamValidity_transmission_getRowCount(){
-  return sizeof(uartMsgCmdDefinedTransmission) / sizeof(uartMsgCmdDefinedTransmission[0]);
+const MESSAGE_DESCRIPTOR_STRUCT_TYPEDEF* messageParamValidity_getDescriptor(uint8_t cmdByte){
+  return &messageDescriptorTable[cmdByte];
 }
 
-/** @brief This method will return the element size in the 2D-byte array
- *  @return Element size in the 2D-byte array
+/** @brief This method will check a CMD-Byte and its data length against the
+ *         descriptor table
+ *  @param directionFlag MESSAGE_DESCRIPTOR_FLAG_TRANSMISSION or MESSAGE_DESCRIPTOR_FLAG_RECEPTION
+ *  @param cmdByte Byte that contains the command
+ *  @param dataLengthByte Byte that contains the data length
+ *  @return 1 if the CMD-Byte is defined for the direction and the data length is in its interval, 0 else
  */
-uint32_t messageParamValidity_transmission_getElementSize(){
-  return sizeof(uartMsgCmdDefinedTransmission[0][0]);
+uint8_t messageParamValidity_isValid(uint8_t directionFlag, uint8_t cmdByte, uint8_t dataLengthByte){
+  const MESSAGE_DESCRIPTOR_STRUCT_TYPEDEF *descriptor = &messageDescriptorTable[cmdByte];
+  
+  return ((descriptor->flags & directionFlag) != 0) && (dataLengthByte >= descriptor->minLength) && (dataLengthByte <= descriptor->maxLength);
 }
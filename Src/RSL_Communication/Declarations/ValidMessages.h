@@ -1,58 +1,63 @@
 #ifndef __VALID_MESSAGES_H
 #define __VALID_MESSAGES_H
 
-// Reception validities
-
-/** @brief This method will return the pointer to the reception 2D-byte array
- *  @return Pointer to the reception 2D-byte array
- */
-uint8_t** messageParamValidity_reception_getPointerToBuffer();
-
-/** @brief This method will return the overall byte count of the 2D-byte array
- *  @return Overall byte count of the 2D-byte array
- */
-uint32_t messageParamValidity_reception_getOverallSize();
-
-/** @brief This method will return the column count of the 2D-byte array
- *  @return Column count of the 2D-byte array
- */
-uint32_t messageParamValidity_reception_getColCount();
-
-/** @brief This method will return the row count of the 2D-byte array
- *  @return Row count of the 2D-byte array
- */
-uint32_t messageParamValidity_reception_getRowCount();
-
-/** @brief This method will return the element size in the 2D-byte array
- *  @return Element size in the 2D-byte array
- */
-uint32_t messageParamValidity_reception_getElementSize();
-
-// Transmission validities
-
-/** @brief This method will return the pointer to the reception 2D-byte array
- *  @return Pointer to the reception 2D-byte array
- */
-uint8_t** messageParamValidity_transmission_getPointerToBuffer();
-
-/** @brief This method will return the overall byte count of the 2D-byte array
- *  @return Overall byte count of the 2D-byte array
- */
-uint32_t messageParamValidity_transmission_getOverallSize();
-
-/** @brief This method will return the column count of the 2D-byte array
- *  @return Column count of the 2D-byte array
- */
-uint32_t messageParamValidity_transmission_getColCount();
-
-/** @brief This method will return the row count of the 2D-byte array
- *  @return Row count of the 2D-byte array
- */
-uint32_t messageParamValidity_transmission_getRowCount();
-
-/** @brief This method will return the element size in the 2D-byte array
- *  @return Element size in the 2D-byte array
- */
-uint32_t messageParamValidity_transmission_getElementSize();
-
-#endif
\ No newline at end of file
+#include <inttypes.h>
+#include "Device_Definitions.h"
+
+/**
+ * @brief The descriptor table has one entry per possible CMD-Byte, so the
+ *        CMD-Byte is the index into it.
+ */
+#define MESSAGE_DESCRIPTOR_TABLE_LENGTH                 256
+
+/**
+ * @brief Flags of a message descriptor.
+ *        MESSAGE_DESCRIPTOR_FLAG_STM32_TO_RSL10 = The STM32 sends it, the RSL10 receives it
+ *        MESSAGE_DESCRIPTOR_FLAG_RSL10_TO_STM32 = The RSL10 sends it, the STM32 receives it
+ *        MESSAGE_DESCRIPTOR_FLAG_REQUIRES_ACK = The receiver answers it with an ACK
+ *        MESSAGE_DESCRIPTOR_FLAG_FOTA = It belongs to the firmware update over the air
+ *        A CMD-Byte without any direction flag is not defined.
+ */
+#define MESSAGE_DESCRIPTOR_FLAG_STM32_TO_RSL10          0x01
+#define MESSAGE_DESCRIPTOR_FLAG_RSL10_TO_STM32          0x02
+#define MESSAGE_DESCRIPTOR_FLAG_REQUIRES_ACK            0x04
+#define MESSAGE_DESCRIPTOR_FLAG_FOTA                    0x08
+
+// The direction flags seen from the own device role
+#ifdef I_AM_STM32
+  #define MESSAGE_DESCRIPTOR_FLAG_TRANSMISSION          MESSAGE_DESCRIPTOR_FLAG_STM32_TO_RSL10
+  #define MESSAGE_DESCRIPTOR_FLAG_RECEPTION             MESSAGE_DESCRIPTOR_FLAG_RSL10_TO_STM32
+#else
+  #ifdef I_AM_RSL10
+    #define MESSAGE_DESCRIPTOR_FLAG_TRANSMISSION        MESSAGE_DESCRIPTOR_FLAG_RSL10_TO_STM32
+    #define MESSAGE_DESCRIPTOR_FLAG_RECEPTION           MESSAGE_DESCRIPTOR_FLAG_STM32_TO_RSL10
+  #else
+    #error NO DEVICE ROLE DEFINED!
+  #endif
+#endif
+
+/**
+ * @brief This struct describes one CMD-Byte of the protocol.
+ */
+typedef struct MESSAGE_DESCRIPTOR_STRUCT {
+  uint8_t minLength;            /**< The minimum allowed data length */
+  uint8_t maxLength;            /**< The maximum allowed data length */
+  uint8_t flags;                /**< The MESSAGE_DESCRIPTOR_FLAG_x of the CMD-Byte */
+} MESSAGE_DESCRIPTOR_STRUCT_TYPEDEF;
+
+/** @brief This method will return the descriptor of a CMD-Byte
+ *  @param cmdByte Byte that contains the command
+ *  @return Pointer to the descriptor, its flags are 0 if the CMD-Byte is not defined
+ */
+const MESSAGE_DESCRIPTOR_STRUCT_TYPEDEF* messageParamValidity_getDescriptor(uint8_t cmdByte);
+
+/** @brief This method will check a CMD-Byte and its data length against the
+ *         descriptor table
+ *  @param directionFlag MESSAGE_DESCRIPTOR_FLAG_TRANSMISSION or MESSAGE_DESCRIPTOR_FLAG_RECEPTION
+ *  @param cmdByte Byte that contains the command
+ *  @param dataLengthByte Byte that contains the data length
+ *  @return 1 if the CMD-Byte is defined for the direction and the data length is in its interval, 0 else
+ */
+uint8_t messageParamValidity_isValid(uint8_t directionFlag, uint8_t cmdByte, uint8_t dataLengthByte);
+
+#endif
@@ -29,10 +29,16 @@
 #ifdef I_AM_STM32
   #define UART_AWAITING_MAGIC                                                   0x03
   #define UART_TRANSMISSION_MAGIC                                               0x02
+  // Frames with a sequence number between data and CRC
+  #define UART_AWAITING_MAGIC_SEQUENCED                                         0x13
+  #define UART_TRANSMISSION_MAGIC_SEQUENCED                                     0x12
 #else
   #ifdef I_AM_RSL10
     #define UART_AWAITING_MAGIC                                                 0x02
     #define UART_TRANSMISSION_MAGIC                                             0x03
+    // Frames with a sequence number between data and CRC
+    #define UART_AWAITING_MAGIC_SEQUENCED                                       0x12
+    #define UART_TRANSMISSION_MAGIC_SEQUENCED                                   0x13
   #else
     #error NO DEVICE ROLE DEFINED!
   #endif
@@ -29,6 +29,7 @@
 
 #define UART_MSG_CMD_PACK_REC_ACK                                               0x50
 #define UART_MSG_CMD_PACK_REC_NAK                                               0x51
+#define UART_MSG_CMD_PACK_REC_SACK                                              0x52
 
 #define UART_MSG_CMD_GO_TO_SLEEP                                                0x60
 #define UART_MSG_CMD_GO_TO_SLEEP_OK                                             0x61
@@ -79,6 +80,7 @@ typedef enum UART_MESSAGE_TYPES {
   UART_MESSAGE_TYPE_STOP_FOTA_NOK                                               = UART_MSG_CMD_STOP_FOTA_NOK,
   UART_MESSAGE_TYPE_PACK_REC_ACK                                                = UART_MSG_CMD_PACK_REC_ACK,
   UART_MESSAGE_TYPE_PACK_REC_NAK                                                = UART_MSG_CMD_PACK_REC_NAK,
+  UART_MESSAGE_TYPE_PACK_REC_SACK                                               = UART_MSG_CMD_PACK_REC_SACK,
   UART_MESSAGE_TYPE_GO_TO_SLEEP                                                 = UART_MSG_CMD_GO_TO_SLEEP,
   UART_MESSAGE_TYPE_GO_TO_SLEEP_OK                                              = UART_MSG_CMD_GO_TO_SLEEP_OK,
   UART_MESSAGE_TYPE_READY_AFTER_SLEEP                                           = UART_MSG_CMD_READY_AFTER_SLEEP,
@@ -103,6 +105,7 @@ typedef enum UART_MESSAGE_TYPES {
 #define UART_PACKAGE_HEADER_SIZE                                                0x02
 #define UART_PACKAGE_DATA_SIZE                                                  0x01
 #define UART_PACKAGE_CRC_SIZE                                                   0x01
+#define UART_PACKAGE_SEQUENCE_SIZE                                              0x01
 
 #define UART_PACKAGE_POSITION_CMD_BYTE                                          0x01
 #define UART_PACKAGE_POSITION_DATA_LENGTH_BYTE                                  0x02
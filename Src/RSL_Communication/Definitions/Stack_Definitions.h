@@ -25,11 +25,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-05-26    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Added LOGIC_SEQUENCED_RX_WINDOW               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | RINGBUFFER_SIZE must be a power of two        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Limit the MIB/MOB slot counts to 32           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -52,6 +52,10 @@
 #define LOGIC_MOB_SLOTCOUNT     5
 #define LOGIC_MOB_BUFFERSIZE    40
 
+// Sequenced framing: frames this far beyond the next expected one are kept
+// and reported by a selective ACK (one bit each)
+#define LOGIC_SEQUENCED_RX_WINDOW   8
+
 #define PARSER_MESSAGE_INTEGRITY_TIMEOUT_LENGTH_MS 100
 
 #if PARSER_MESSAGE_INTEGRITY_TIMEOUT_LENGTH_MS < 10
@@ -65,6 +69,10 @@
   #warning THAT MEANS YOU LOOK AFTER NEW MESSAGES SLOWER THAN ONCE A SEC!
 #endif
 
+#if (RINGBUFFER_SIZE & (RINGBUFFER_SIZE - 1)) != 0
+  #error RINGBUFFER_SIZE MUST BE A POWER OF TWO!
+#endif
+
 #if RINGBUFFER_SIZE < 64
   #warning YOU MIGHT HAVE PROBLEMS WITH SLOWER SETTINGS, BECAUSE OF OVERFLOWS
 #endif
@@ -77,6 +85,11 @@
   #warning YOU MIGHT HAVE PROBLEMS IF YOU HAVE DEEP LOGICAL INTERLEAVING
 #endif
 
+// The message IO buffer keeps its free slots in a 32 bit map
+#if (LOGIC_MIB_SLOTCOUNT > 32) || (LOGIC_MOB_SLOTCOUNT > 32)
+  #error THE MESSAGE IO BUFFER HOLDS 32 SLOTS AT MOST!
+#endif
+
 #if LOGIC_MIB_BUFFERSIZE < 36
   #warning YOU MIGHT HAVE PROBLEMS IF YOU HAVE LONG MESSAGES
 #endif
@@ -85,6 +98,14 @@
   #warning YOU MIGHT HAVE PROBLEMS IF YOU HAVE LONG MESSAGES
 #endif
 
+#if LOGIC_SEQUENCED_RX_WINDOW > 8
+  #error THE SELECTIVE ACK HOLDS 8 FRAMES AT MOST
+#endif
+
+#if LOGIC_MOB_SLOTCOUNT > LOGIC_SEQUENCED_RX_WINDOW
+  #warning THE PEER MIGHT DROP FRAMES BEYOND ITS RECEPTION WINDOW
+#endif
+
 #if LOGIC_MIB_BUFFERSIZE != LOGIC_MOB_BUFFERSIZE
   #warning DO YOU REALLY HAVE ASYMETRICAL MESSAGE BUILDUPS?
 #endif
@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2016-11-28    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Added ringbufferDropCount                     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Power-of-two SPSC ringbuffer with span access |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -38,80 +38,43 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
 #include "Ringbuffer.h"
 #include "Test_Selector.h"
 
+// The data must be in the buffer before the producer publishes the head, and
+// read out before the consumer publishes the tail
+#if defined(__ICCARM__)
+  #include <intrinsics.h>
+  #define RINGBUFFER_BARRIER()    __DMB()
+#else
+  #define RINGBUFFER_BARRIER()    __asm volatile ("" ::: "memory")
+#endif
+
 // Create Functions
-/** @brief This method is used to create a completely new ringbuffer in runtime.
- *  @param length refers to the length of the ringbuffer.
- *  @return ringbuffer* which is the pointer to the object itself.
+/** @brief This method will set up a ringbuffer on a given field in runtime.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param *storage is the byte field the ringbuffer works on.
+ *  @param length is the length of the field, it must be a power of two.
+ *  @return EOF if buffer is nullpointer.
+ *  @return EOF if length is no power of two.
+ *  @return 0 upon success.
  */
-ringbuffer* ringbufferCreateCompleteObject(uint32_t length){
-  ringbuffer* tmp;
-  // Allocate new ringbuffer object
-  tmp = (ringbuffer*) malloc(sizeof(ringbuffer));
-  // Success?
-  if (tmp != NULL){
-    // Yes
-    
-    // Allocate new buffer for ringbuffer object
-    tmp->buffer = (uint8_t*) malloc(length);
-    // Success?
-    if (tmp->buffer != NULL){
-      // Yes
-      
-      // Set the ringbuffer object initial values
-      tmp->count = 0;
-      tmp->length = length;
-      tmp->readptr = (volatile uint8_t*) tmp->buffer;
-      tmp->writeptr = (volatile uint8_t*) tmp->buffer;
-      return tmp;
-    }else{
-      // No, buffer allocation failed
-      
-      // Free ringbuffer object
-      free(tmp);
-      // Return null to show that there is no ringbuffer object
-      return NULL;
-    }
-  }else{ 
-    // No, ringbuffer object allocation failed
-    
-    // Return null to show that there is no ringbuffer object
-    return NULL;
+int ringbufferInit(ringbuffer *buf, uint8_t *storage, uint32_t length){
+  // Check if buffer valid
+  if (storage == NULL){
+    return EOF;
   }
-}
-
-/** @brief This method is used to create a completely new ringbuffer in runtime.
- *  @param length refers to the length of the ringbuffer.
- *  @param *buf is a struct which contains the pointers, but not the buffer field.
- *  @return length of the buffer field.
- *  @return -1 upon fail
- */
-int ringbufferCreateBuffer(ringbuffer *buf, uint32_t length){
-  buf->buffer = (uint8_t*) malloc(length);
-  if (buf->buffer != NULL){
-    return length;
-  }else{
-    return -1;
+  // The indices are wrapped by masking, so only 2^x works
+  if (!RINGBUFFER_IS_VALID_LENGTH(length)){
+    return EOF;
   }
-}
-
-// Free Functions
-/** @brief This method will completely free the object.
- *  @param *buf is the pointer to the ringbuffer object.
- */
-void ringbufferFreeCompleteObject(ringbuffer *buf){
-  free(buf->buffer);
-  free(buf);
-}
-
-/** @brief This method will only free the buffer.
- *  @param *buf is the pointer to the ringbuffer object.
- */
-void ringbufferFreeBuffer(ringbuffer *buf){
-  free(buf->buffer);
+  buf->mask = length - 1;
+  buf->head = 0;
+  buf->tail = 0;
+  buf->buffer = storage;
+  return 0;
 }
 
 // Change Functions
@@ -123,7 +86,16 @@ void ringbufferFreeBuffer(ringbuffer *buf){
  *  @return count of bytes in buffer.
  */
 uint32_t ringbufferGetCount(ringbuffer *buf){
-  return buf->count;
+  // Both run freely, so this is even right after the turnaround of the head
+  return buf->head - buf->tail;
+}
+
+/** @brief This method will give you the count of bytes that still fit in.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @return count of free bytes in buffer.
+ */
+uint32_t ringbufferGetFree(ringbuffer *buf){
+  return (buf->mask + 1) - (buf->head - buf->tail);
 }
 
 /** @brief This method will put a byte into buffer.
@@ -134,23 +106,92 @@ uint32_t ringbufferGetCount(ringbuffer *buf){
  *  @return 0 upon success.
  */
 int ringbufferPutChar(ringbuffer *buf, uint8_t data){
+  uint32_t head = buf->head;
   // Check if buffer valid
   if (buf->buffer == NULL){
     return EOF;
   }
   // Check for buffer full
-  if (buf->count == buf->length){
+  if ((head - buf->tail) > buf->mask){
     return EOF;
   }
   // Write through
-  *(buf->writeptr) = data;
-  // Move writeptr
-  buf->writeptr += 1;
-  if ( (buf->writeptr) >= ( buf->buffer + buf->length) ){
-    buf->writeptr = buf->buffer;
-  }
-  // Set count
-  buf->count += 1;
+  buf->buffer[head & buf->mask] = data;
+  // Publish it
+  RINGBUFFER_BARRIER();
+  buf->head = head + 1;
+  return 0;
+}
+
+/** @brief This method will put a number of bytes into buffer. If they don't fit
+ *  all, the buffer is filled up and the rest is left out.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param *data is the pointer to the bytes to fit in.
+ *  @param numberOfBytes is how many bytes you intend to put in.
+ *  @return The count of bytes that were put in.
+ */
+uint32_t ringbufferPutString(ringbuffer *buf, const uint8_t *data, uint32_t numberOfBytes){
+  uint8_t *span;
+  uint32_t spanLength;
+  uint32_t written = 0;
+  
+  // At most two regions: up to the end of the field and from its start on
+  while (written < numberOfBytes){
+    spanLength = ringbufferPutSpan(buf, &span);
+    // Is the buffer full?
+    if (spanLength == 0){
+      // Yes
+      break;
+    }
+    if (spanLength > (numberOfBytes - written)){
+      spanLength = numberOfBytes - written;
+    }
+    memcpy(span, &data[written], spanLength);
+    ringbufferPutCommit(buf, spanLength);
+    written += spanLength;
+  }
+  return written;
+}
+
+/** @brief This method gives the producer the free region behind the head, that
+ *  can be written without a turnaround. Write into it and hand the bytes over
+ *  with ringbufferPutCommit.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param **span will be set to the start of the region.
+ *  @return The length of the region, 0 if buffer full.
+ */
+uint32_t ringbufferPutSpan(ringbuffer *buf, uint8_t **span){
+  uint32_t head = buf->head;
+  uint32_t offset = head & buf->mask;
+  uint32_t freeBytes;
+  uint32_t untilEnd;
+  
+  // Check if buffer valid
+  if (buf->buffer == NULL){
+    return 0;
+  }
+  freeBytes = (buf->mask + 1) - (head - buf->tail);
+  untilEnd = (buf->mask + 1) - offset;
+  *span = &buf->buffer[offset];
+  return (freeBytes < untilEnd) ? freeBytes : untilEnd;
+}
+
+/** @brief This method hands bytes written into the span of ringbufferPutSpan
+ *  over to the consumer.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param numberOfBytes is how many bytes were written.
+ *  @return EOF if there is less free space than that.
+ *  @return 0 upon success.
+ */
+int ringbufferPutCommit(ringbuffer *buf, uint32_t numberOfBytes){
+  uint32_t head = buf->head;
+  // Check for buffer size validity
+  if (((buf->mask + 1) - (head - buf->tail)) < numberOfBytes){
+    return EOF;
+  }
+  // Publish them
+  RINGBUFFER_BARRIER();
+  buf->head = head + numberOfBytes;
   return 0;
 }
 
@@ -163,27 +204,51 @@ int ringbufferPutChar(ringbuffer *buf, uint8_t data){
  *  @return 0 upon success.
  */
 int ringbufferGetString(ringbuffer *buf, uint8_t *buffer, uint32_t numberOfBytes){
-  uint32_t i;
+  const uint8_t *span;
+  uint32_t spanLength;
+  uint32_t read = 0;
   // Check if buffer valid
   if (buf->buffer == NULL){
     return EOF;
   }
   // Check for buffer size validity
-  if (buf->count < numberOfBytes){
+  if (ringbufferGetCount(buf) < numberOfBytes){
     return EOF;
-  }else{
-    // Get values
-    for (i=0; i < numberOfBytes; i++){
-      buffer[i] = (int) *(buf->readptr);
-      // Move pointer
-      buf->readptr += 1;
-      if ( (buf->readptr) >= ( (buf->buffer) + buf->length) ){
-        buf->readptr = buf->buffer;
-      }
-      // Set count
-      buf->count -= 1;
+  }
+  // Get values, at most two regions due to the turnaround
+  while (read < numberOfBytes){
+    spanLength = ringbufferPeekSpan(buf, read, &span);
+    if (spanLength > (numberOfBytes - read)){
+      spanLength = numberOfBytes - read;
     }
+    memcpy(&buffer[read], span, spanLength);
+    read += spanLength;
+  }
+  // Release them in one step
+  return ringbufferDropCount(buf, numberOfBytes);
+}
+
+/** @brief This method drops a number of bytes from the ringbuffer in one step,
+ *  by moving the read index instead of reading every byte.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param numberOfBytes is how many bytes you intend to drop.
+ *  @return EOF if buffer is nullpointer.
+ *  @return EOF if buffer is less filled then you want to drop.
+ *  @return 0 upon success.
+ */
+int ringbufferDropCount(ringbuffer *buf, uint32_t numberOfBytes){
+  uint32_t tail = buf->tail;
+  // Check if buffer valid
+  if (buf->buffer == NULL){
+    return EOF;
+  }
+  // Check for buffer size validity
+  if ((buf->head - tail) < numberOfBytes){
+    return EOF;
   }
+  // Release the bytes to the producer
+  RINGBUFFER_BARRIER();
+  buf->tail = tail + numberOfBytes;
   return 0;
 }
 
@@ -195,24 +260,21 @@ int ringbufferGetString(ringbuffer *buf, uint8_t *buffer, uint32_t numberOfBytes
  */
 int ringbufferGetChar(ringbuffer *buf){
   int retval;
+  uint32_t tail = buf->tail;
   // Check if buffer valid
   if (buf->buffer == NULL){
     return EOF;
   }
   // Check for buffer empty
-  if (buf->count == 0){
+  if (buf->head == tail){
     return EOF;
-  }else{
-    // Get value
-    retval = (int) *(buf->readptr);
-    // Move pointer
-    buf->readptr += 1;
-    if ( (buf->readptr) >= ( (buf->buffer) + buf->length) ){
-      buf->readptr = buf->buffer;
-    }
-    // Set count
-    buf->count -= 1;
   }
+  // Get value
+  RINGBUFFER_BARRIER();
+  retval = (int) buf->buffer[tail & buf->mask];
+  // Release it
+  RINGBUFFER_BARRIER();
+  buf->tail = tail + 1;
   return retval;
 }
 
@@ -221,34 +283,56 @@ int ringbufferGetChar(ringbuffer *buf){
  *  @param position is the offset regarding to the first byte you would've get
  *  if you called ringbufferGetChar(*buf).
  *  @return EOF if buffer is nullpointer.
- *  @return EOF if buffer count of bytes is smaller than your intended position.
+ *  @return EOF if there is no byte at your intended position.
  *  @return [0;255] upon success, which is the byte you wanted.
  */
 int ringbufferPeekCharPosition(ringbuffer *buf, uint32_t position){
+  uint32_t tail = buf->tail;
   // Check if buffer valid
   if (buf->buffer == NULL){
     return EOF;
   }
   // Check for validity
-  if ((buf->count) < (position)){
+  if ((buf->head - tail) <= position){
     return EOF;
   }
-  // Check for tournaround
-  if ( (( ((uint32_t) (buf->readptr)) - ((uint32_t) (buf->buffer))) + position) >= (buf->length)){ // turnaround
-    return (int) *((uint8_t*) ( buf->readptr + position - buf->length ));
-  } else { // still in front of intended readptr
-    return (int) *((uint8_t*) ( buf->readptr + position ));
-  }
+  // The mask does the turnaround
+  RINGBUFFER_BARRIER();
+  return (int) buf->buffer[(tail + position) & buf->mask];
+}
+
+/** @brief This method gives the consumer the used region from a position on,
+ *  that can be read without a turnaround. Release it with ringbufferDropCount.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param position is the offset regarding to the first byte you would've get
+ *  if you called ringbufferGetChar(*buf).
+ *  @param **span will be set to the start of the region.
+ *  @return The length of the region, 0 if there is no byte at the position.
+ */
+uint32_t ringbufferPeekSpan(ringbuffer *buf, uint32_t position, const uint8_t **span){
+  uint32_t tail = buf->tail;
+  uint32_t count = buf->head - tail;
+  uint32_t offset;
+  uint32_t untilEnd;
+  
+  // Check if buffer valid and if there is a byte at the position
+  if ((buf->buffer == NULL) || (count <= position)){
+    return 0;
+  }
+  RINGBUFFER_BARRIER();
+  offset = (tail + position) & buf->mask;
+  untilEnd = (buf->mask + 1) - offset;
+  *span = &buf->buffer[offset];
+  return ((count - position) < untilEnd) ? (count - position) : untilEnd;
 }
 
-/** @brief This method will clear the buffer by setting the read and write pointer.
- *  It will NOT write 0x00 over every byte the buffer is made of.
+/** @brief This method will clear the buffer by moving the read index onto the
+ *  write index. It will NOT write 0x00 over every byte the buffer is made of.
+ *  Only the consumer may call it.
  *  @param *buf is the pointer to the ringbuffer object.
  */
 void ringbufferClear(ringbuffer *buf){
-  buf->readptr = buf->buffer;
-  buf->writeptr = buf->buffer;
-  buf->count = 0;
+  buf->tail = buf->head;
 }
 
 
@@ -269,188 +353,278 @@ void ringbufferClear(ringbuffer *buf){
  *  @return 0 upon success.
  *  @return -1 else.
  */
-int ringbufferTestsuiteReturner(ringbuffer **rba, ringbuffer *rbb, int retVal){
-  ringbufferFreeCompleteObject(*rba);
-  ringbufferFreeBuffer(rbb);
+int ringbufferTestsuiteReturner(int retVal){
   return retVal;
 }
 
 int ringbufferTestsuite(){
-  ringbuffer *testobject; // test complete create function member
-  ringbuffer testsubject; // test allocate function member
+  static uint8_t testobjectBuffer[8];
+  static uint8_t testsubjectBuffer[8];
+  ringbuffer testobjectRingbuffer = RINGBUFFER_INITIALIZER(testobjectBuffer, 8);
+  ringbuffer *testobject = &testobjectRingbuffer; // test static initializer member
+  ringbuffer testsubject; // test init function member
+  const uint8_t *peekSpan;
+  uint8_t *putSpan;
+  uint8_t bTmp[8];
   
   // test constructors
-  testobject = ringbufferCreateCompleteObject(8);
-  if (testobject == NULL){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
-  }
-  if (ringbufferCreateBuffer(&testsubject, 8) != 8){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
-  }else{
-    testsubject.count = 0;
-    testsubject.readptr = &testsubject.buffer[0];
-    testsubject.writeptr = &testsubject.buffer[0];
-    testsubject.length = 8;
+  if (ringbufferInit(&testsubject, testsubjectBuffer, 6) != EOF){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferInit(&testsubject, NULL, 8) != EOF){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferInit(&testsubject, testsubjectBuffer, 8) != 0){
+    return ringbufferTestsuiteReturner(-1);
   }
   
   // test validity of constructions and initial setters
   if (ringbufferGetChar(testobject) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferGetChar(&testsubject) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferPeekCharPosition(testobject, 0) != EOF){
+    return ringbufferTestsuiteReturner(-1);
   }
-  // THIS DOES WORK, SINCE IT REFEERS TO THE ACTUAL RPTR POSITION!
-  // if (ringbufferPeekCharPosition(testobject, 0) != EOF){
-  //   return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
-  // }
   if (ringbufferPeekCharPosition(testobject, 1) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferPeekCharPosition(testobject, 8) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferPeekCharPosition(testobject, 9) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferPeekCharPosition(&testsubject, 0) != EOF){
+    return ringbufferTestsuiteReturner(-1);
   }
-  // THIS DOES WORK, SINCE IT REFEERS TO THE ACTUAL RPTR POSITION!
-  // if (ringbufferPeekCharPosition(&testsubject, 0) != EOF){
-  //   return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
-  // }
   if (ringbufferPeekCharPosition(&testsubject, 1) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferPeekCharPosition(&testsubject, 8) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferPeekCharPosition(&testsubject, 9) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferGetFree(testobject) != 8 || ringbufferPeekSpan(testobject, 0, &peekSpan) != 0){
+    return ringbufferTestsuiteReturner(-1);
   }
   
   // test put in and get out x24 [tripple the max filling]
   for (int i=0;i<24;i++){
     if (ringbufferPutChar(testobject, i) == EOF){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
     if (ringbufferGetChar(testobject) != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   for (int i=0;i<24;i++){
     if (ringbufferPutChar(&testsubject, i) == EOF){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
     if (ringbufferGetChar(&testsubject) != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   
   // test overflow protection
   for (int i=0;i<=7;i++){
     if (ringbufferPutChar(testobject, i) == EOF){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   for (int i=0;i<=7;i++){
     if (ringbufferPutChar(&testsubject, i) == EOF){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   if (ringbufferPutChar(testobject, 8) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferPutChar(&testsubject, 8) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferGetFree(testobject) != 0 || ringbufferPutSpan(testobject, &putSpan) != 0){
+    return ringbufferTestsuiteReturner(-1);
   }
   
   // buffer is now filled from 0 to 7, peektest without turnaround!
   for (int i=0;i<=7;i++){
     if (ringbufferPeekCharPosition(testobject, i) != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   for (int i=0;i<=7;i++){
     if (ringbufferPeekCharPosition(&testsubject, i) != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   
   // clear buffer
   ringbufferClear(testobject);
   ringbufferClear(&testsubject);
-  if (testobject->count != 0){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+  if (ringbufferGetCount(testobject) != 0){
+    return ringbufferTestsuiteReturner(-1);
   }
-  if (testsubject.count != 0){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+  if (ringbufferGetCount(&testsubject) != 0){
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferGetChar(testobject) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferGetChar(&testsubject) != EOF){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   
   // Move pointers for 3 byte, then fill 0-7 and peek them -> peek with turnaround
   for (int i=0;i<3;i++){
     if (ringbufferPutChar(testobject, i) == EOF){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
     if (ringbufferGetChar(testobject) != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   for (int i=0;i<3;i++){
     if (ringbufferPutChar(&testsubject, i) == EOF){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
     if (ringbufferGetChar(&testsubject) != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   for (int i=0;i<=7;i++){
     if (ringbufferPutChar(testobject, i) == EOF){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   for (int i=0;i<=7;i++){
     if (ringbufferPutChar(&testsubject, i) == EOF){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   for (int i=0;i<=7;i++){
     if (ringbufferPeekCharPosition(testobject, i) != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   for (int i=0;i<=7;i++){
     if (ringbufferPeekCharPosition(&testsubject, i) != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   
+  // Test PeekSpan, the read index is at 3 -> 0...4 up to the end, 5...7 from the start
+  if (ringbufferPeekSpan(testobject, 0, &peekSpan) != 5 || peekSpan[0] != 0 || peekSpan[4] != 4){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferPeekSpan(testobject, 5, &peekSpan) != 3 || peekSpan[0] != 5 || peekSpan[2] != 7){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferPeekSpan(testobject, 8, &peekSpan) != 0){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  
   //Test StringCopy function
-  uint8_t bTmp[8];
   if (ringbufferGetCount(testobject) != 8){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   if (ringbufferGetCount(&testsubject) != 8){
-    return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+    return ringbufferTestsuiteReturner(-1);
   }
   ringbufferGetString(testobject, bTmp, 8);
   for (int i=0;i<8;i++){
     if (bTmp[i] != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   ringbufferGetString(&testsubject, bTmp, 8);
   for (int i=0;i<8;i++){
     if (bTmp[i] != i){
-      return ringbufferTestsuiteReturner(&testobject, &testsubject, -1);
+      return ringbufferTestsuiteReturner(-1);
+    }
+  }
+  
+  // Test DropCount function, read pointer is at 3 -> drop with turnaround
+  for (int i=0;i<=7;i++){
+    if (ringbufferPutChar(testobject, i) == EOF){
+      return ringbufferTestsuiteReturner(-1);
+    }
+  }
+  if (ringbufferDropCount(testobject, 6) != 0){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferGetCount(testobject) != 2){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferPeekCharPosition(testobject, 0) != 6){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferDropCount(testobject, 3) != EOF){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferGetChar(testobject) != 6){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  
+  // Test PutString function, write index is at 3 -> put with turnaround and cut off
+  for (int i=0;i<8;i++){
+    bTmp[i] = (uint8_t) (0x10 + i);
+  }
+  if (ringbufferPutString(testobject, bTmp, 5) != 5){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferPutString(testobject, bTmp, 8) != 2){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  for (int i=0;i<5;i++){
+    if (ringbufferPeekCharPosition(testobject, 1 + i) != 0x10 + i){
+      return ringbufferTestsuiteReturner(-1);
+    }
+  }
+  if (ringbufferPeekCharPosition(testobject, 0) != 7 || ringbufferPeekCharPosition(testobject, 7) != 0x11){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  
+  // Test PutSpan and PutCommit, write index is at 2 -> 3 until the read index
+  ringbufferDropCount(testobject, 3);
+  if (ringbufferPutSpan(testobject, &putSpan) != 3 || putSpan != &testobjectBuffer[2]){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  putSpan[0] = 0x20;
+  putSpan[1] = 0x21;
+  if (ringbufferGetCount(testobject) != 5){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferPutCommit(testobject, 4) != EOF || ringbufferPutCommit(testobject, 2) != 0){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  if (ringbufferGetCount(testobject) != 7 || ringbufferPeekCharPosition(testobject, 6) != 0x21){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  
+  // Test the turnaround of the free running indices
+  testsubject.head = 0xFFFFFFFEu;
+  testsubject.tail = 0xFFFFFFFEu;
+  for (int i=0;i<4;i++){
+    if (ringbufferPutChar(&testsubject, i) == EOF){
+      return ringbufferTestsuiteReturner(-1);
+    }
+  }
+  if (ringbufferGetCount(&testsubject) != 4 || ringbufferGetFree(&testsubject) != 4){
+    return ringbufferTestsuiteReturner(-1);
+  }
+  for (int i=0;i<4;i++){
+    if (ringbufferGetChar(&testsubject) != i){
+      return ringbufferTestsuiteReturner(-1);
     }
   }
   
-  return ringbufferTestsuiteReturner(&testobject, &testsubject, 0);
+  return ringbufferTestsuiteReturner(0);
 }
 
 #endif
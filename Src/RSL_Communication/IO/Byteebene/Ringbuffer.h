@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2016-11-28    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Added ringbufferDropCount                     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Power-of-two SPSC ringbuffer with span access |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -46,18 +46,28 @@
 
 /**
  * @brief This structure is the ringerbuffer. It's a kind of circle FIFO and should be POSIX conform, except the look ahead function.
- * 
- * This buffer knows it's own length and count of used byte. You might be able to calculate both from the read and write pointer (by aligning it to 128 or whatever 2^x you want it to be),
- * but these 8 bytes are totally worth the overhead and safes us from wasting cycles. And you can have as many of them as you wish, until your RAM is a goner.
+ *
+ * It is made for exactly one producer (e.g. a reception interrupt) and one consumer (e.g. the superloop). The head is only ever written by the producer,
+ * the tail only by the consumer. Both run freely and are wrapped by the mask on access, so head - tail is the count of used bytes (even across the
+ * 2^32 turnaround) and no count has to be shared between both sides. Thus the length must be a power of two.
  */
 typedef struct {
-  uint32_t length;              /**< The length of this buffer.*/
-  volatile uint32_t count;      /**< The used bytes of this buffer. */
-  volatile uint8_t *readptr;    /**< Where do we read actually? */
-  volatile uint8_t *writeptr;   /**< Where do we write actually? */
+  uint32_t mask;                /**< The length of this buffer minus 1, the length is a power of two.*/
+  volatile uint32_t head;       /**< Free running write index, only moved by the producer. */
+  volatile uint32_t tail;       /**< Free running read index, only moved by the consumer. */
   uint8_t *buffer;              /**< The pointer to the buffer itself (it can be located somewhere else). */
 } ringbuffer;
 
+/** @brief Initializer for a statically allocated ringbuffer.
+ *  @param storage is the byte field the ringbuffer works on.
+ *  @param length is the length of the field, it must be a power of two.
+ */
+#define RINGBUFFER_INITIALIZER(storage, length)  { .mask = ((uint32_t) (length)) - 1, .head = 0, .tail = 0, .buffer = (storage) }
+
+/** @brief Evaluates to 1 if the length can be used for a ringbuffer.
+ */
+#define RINGBUFFER_IS_VALID_LENGTH(length)       (((length) > 0) && (((length) & ((length) - 1)) == 0))
+
 #ifdef EOF
   #if EOF != (-1)
     #error WARNING EOF HAS BEEN DEFINED WITH SOMETHING ELSE THAN -1!
@@ -66,38 +76,51 @@ typedef struct {
   #endif
 #endif
 
-/** @brief This method is used to create a completely new ringbuffer in runtime.
- *  @param length refers to the length of the ringbuffer.
- *  @return ringbuffer* which is the pointer to the object itself.
+/** @brief This method will set up a ringbuffer on a given field in runtime.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param *storage is the byte field the ringbuffer works on.
+ *  @param length is the length of the field, it must be a power of two.
+ *  @return EOF if buffer is nullpointer.
+ *  @return EOF if length is no power of two.
+ *  @return 0 upon success.
  */
-ringbuffer*     ringbufferCreateCompleteObject  (uint32_t length);
+int             ringbufferInit                  (ringbuffer *buf, uint8_t *storage, uint32_t length);
 
-/** @brief This method is used to create a completely new ringbuffer in runtime.
- *  @param length refers to the length of the ringbuffer.
- *  @param *buf is a struct which contains the pointers, but not the buffer field.
- *  @return length of the buffer field.
- *  @return -1 upon fail
+/** @brief This method will put a byte into buffer.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param data is the byte to fit in.
+ *  @return EOF if buffer is nullpointer.
+ *  @return EOF if buffer full.
+ *  @return 0 upon success.
  */
-int             ringbufferCreateBuffer          (ringbuffer *buf, uint32_t length);
+int             ringbufferPutChar               (ringbuffer *buf, uint8_t data);
 
-/** @brief This method will completely free the object.
+/** @brief This method will put a number of bytes into buffer. If they don't fit
+ *  all, the buffer is filled up and the rest is left out.
  *  @param *buf is the pointer to the ringbuffer object.
+ *  @param *data is the pointer to the bytes to fit in.
+ *  @param numberOfBytes is how many bytes you intend to put in.
+ *  @return The count of bytes that were put in.
  */
-void            ringbufferFreeCompleteObject    (ringbuffer *buf);
+uint32_t        ringbufferPutString             (ringbuffer *buf, const uint8_t *data, uint32_t numberOfBytes);
 
-/** @brief This method will only free the buffer.
+/** @brief This method gives the producer the free region behind the head, that
+ *  can be written without a turnaround. Write into it and hand the bytes over
+ *  with ringbufferPutCommit.
  *  @param *buf is the pointer to the ringbuffer object.
+ *  @param **span will be set to the start of the region.
+ *  @return The length of the region, 0 if buffer full.
  */
-void            ringbufferFreeBuffer            (ringbuffer *buf);
+uint32_t        ringbufferPutSpan               (ringbuffer *buf, uint8_t **span);
 
-/** @brief This method will put a byte into buffer.
+/** @brief This method hands bytes written into the span of ringbufferPutSpan
+ *  over to the consumer.
  *  @param *buf is the pointer to the ringbuffer object.
- *  @param data is the byte to fit in.
- *  @return EOF if buffer is nullpointer.
- *  @return EOF if buffer full.
+ *  @param numberOfBytes is how many bytes were written.
+ *  @return EOF if there is less free space than that.
  *  @return 0 upon success.
  */
-int             ringbufferPutChar               (ringbuffer *buf, uint8_t data);
+int             ringbufferPutCommit             (ringbuffer *buf, uint32_t numberOfBytes);
 
 /** @brief This method get a byte out of the ringbuffer.
  *  @param *buf is the pointer to the ringbuffer object.
@@ -112,13 +135,24 @@ int             ringbufferGetChar               (ringbuffer *buf);
  *  @param position is the offset regarding to the first byte you would've get
  *  if you called ringbufferGetChar(*buf).
  *  @return EOF if buffer is nullpointer.
- *  @return EOF if buffer count of bytes is smaller than your intended position.
+ *  @return EOF if there is no byte at your intended position.
  *  @return [0;255] upon success, which is the byte you wanted.
  */
 int             ringbufferPeekCharPosition      (ringbuffer *buf, uint32_t position);
 
-/** @brief This method will clear the buffer by setting the read and write pointer.
- *  It will NOT write 0x00 over every byte the buffer is made of.
+/** @brief This method gives the consumer the used region from a position on,
+ *  that can be read without a turnaround. Release it with ringbufferDropCount.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param position is the offset regarding to the first byte you would've get
+ *  if you called ringbufferGetChar(*buf).
+ *  @param **span will be set to the start of the region.
+ *  @return The length of the region, 0 if there is no byte at the position.
+ */
+uint32_t        ringbufferPeekSpan              (ringbuffer *buf, uint32_t position, const uint8_t **span);
+
+/** @brief This method will clear the buffer by moving the read index onto the
+ *  write index. It will NOT write 0x00 over every byte the buffer is made of.
+ *  Only the consumer may call it.
  *  @param *buf is the pointer to the ringbuffer object.
  */
 void            ringbufferClear                 (ringbuffer *buf);
@@ -129,6 +163,12 @@ void            ringbufferClear                 (ringbuffer *buf);
  */
 uint32_t        ringbufferGetCount              (ringbuffer *buf);
 
+/** @brief This method will give you the count of bytes that still fit in.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @return count of free bytes in buffer.
+ */
+uint32_t        ringbufferGetFree               (ringbuffer *buf);
+
 /** @brief This method get a number of bytes out of the ringbuffer.
  *  @param *buf is the pointer to the ringbuffer object.
  *  @param *buffer is the pointer to a field where to put the read bytes at.
@@ -139,6 +179,16 @@ uint32_t        ringbufferGetCount              (ringbuffer *buf);
  */
 int             ringbufferGetString             (ringbuffer *buf, uint8_t *buffer, uint32_t numberOfBytes);
 
+/** @brief This method drops a number of bytes from the ringbuffer in one step,
+ *  by moving the read index instead of reading every byte.
+ *  @param *buf is the pointer to the ringbuffer object.
+ *  @param numberOfBytes is how many bytes you intend to drop.
+ *  @return EOF if buffer is nullpointer.
+ *  @return EOF if buffer is less filled then you want to drop.
+ *  @return 0 upon success.
+ */
+int             ringbufferDropCount             (ringbuffer *buf, uint32_t numberOfBytes);
+
 #if TEST_RINGBUFFER >= 1
 /** @brief This method is there to test the ringbuffer by using it with sample data
  *  and interaction.
@@ -35,11 +35,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-17    | Tim Steinberg         | Drop a count of bytes in one step             |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Bulk put and span peek on the SPSC ringbuffer |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Count of bytes ever put in                    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -62,19 +62,18 @@
 uint8_t ringbufferArray[RINGBUFFER_SIZE];
 
 /** \brief rb The ringbuffer object itself with the standard values. */
-ringbuffer rb = {
-  .length = RINGBUFFER_SIZE,    /**< Size = Size of the related buffer.*/
-  .count = 0,                   /**< Set initial reception count to 0.*/
-  .readptr = ringbufferArray,   /**< Set initial readpointer to first byte.*/
-  .writeptr = ringbufferArray,  /**< Set initial writepointer to first byte.*/
-  .buffer = ringbufferArray,    /**< Set buffer pointer to first byte.*/
-};
+ringbuffer rb = RINGBUFFER_INITIALIZER(ringbufferArray, RINGBUFFER_SIZE);
 
 /** \brief receptionBuffer_state
   *        The internal state object of the buffer.
   */
 RINGBUFFER_WRAPPER_STATE_VALUES_TYPEDEF ringbufferWrapper_state = RINGBUFFER_WRAPPER_STATE_OK;
 
+/** \brief ringbufferWrapper_putCount
+  *        Counts every byte ever put in, it wraps around and is not cleared.
+  */
+volatile uint32_t ringbufferWrapper_putCount = 0;
+
 /* Function definitions */
 
 /** @brief This method asks the count of bytes in the ringbuffer.
@@ -85,6 +84,14 @@ uint32_t ringbufferWrapper_getCount(void){
   return ringbufferGetCount(&rb);
 }
 
+/** @brief This method asks the count of bytes ever put in the ringbuffer. It
+ *         only changes, if new bytes come in, not if some get taken out.
+ *  @return The count of bytes put in, it wraps around.
+ */
+uint32_t ringbufferWrapper_getPutCount(void){
+  return ringbufferWrapper_putCount;
+}
+
 /** @brief This method clears the ringbuffer and resets the state.
  *  @return Nothing.
  */
@@ -105,6 +112,18 @@ uint8_t ringbufferWrapper_peekByte(uint32_t position){
   return ((uint8_t) (ringbufferPeekCharPosition(&rb, position) & 0xFF));
 }
 
+/** @brief This method gives the bytes from a position on, that lie in one
+ *         piece inside the ringbuffer. Scan them directly instead of peeking
+ *         every single byte.
+ *  @param position Is the position you want to start at.
+ *  @param **span Will be set to the first byte.
+ *  @return The count of bytes in one piece, 0 if there is none at position.
+ */
+uint32_t ringbufferWrapper_peekSpan(uint32_t position, const uint8_t **span){
+  // Just forward the result, nothing much to wrap here
+  return ringbufferPeekSpan(&rb, position, span);
+}
+
 /** @brief This method will drop the first byte from the ringbuffer.
  *  @return Nothing.
  */
@@ -118,11 +137,11 @@ void ringbufferWrapper_dropByte(void){
  *  @return Nothing.
  */
 void ringbufferWrapper_dropBytesCount(uint32_t count){  
-  // We might use get string, but we'd have to create a buffer here
-  while(count > 0){
-    ringbufferGetChar(&rb);
-    count --;
+  // Move the read pointer in one step, but never drop more than there is
+  if (count > ringbufferGetCount(&rb)){
+    count = ringbufferGetCount(&rb);
   }
+  ringbufferDropCount(&rb, count);
 }
 
 /** @brief This method will get the first byte from the ringbuffer (peek+drop)
@@ -139,6 +158,7 @@ uint8_t ringbufferWrapper_getByte(void){
  *  @return Nothing.
  */
 void ringbufferWrapper_putByte(uint8_t byte){
+  ringbufferWrapper_putCount++;
   // Put the byte and check if the result was an EOF
   if (ringbufferPutChar(&rb, byte) == EOF){
     // Yes
@@ -148,6 +168,23 @@ void ringbufferWrapper_putByte(uint8_t byte){
   }
 }
 
+/** @brief This method will put several bytes in the ringbuffer. If you put in
+ *         too many the system will set the overflow flag.
+ *  @param *bytes The bytes you want to put in.
+ *  @param length The count of bytes.
+ *  @return Nothing.
+ */
+void ringbufferWrapper_putBytes(uint8_t *bytes, uint32_t length){
+  ringbufferWrapper_putCount += length;
+  // Copy them in one go and check if all of them did fit
+  if (ringbufferPutString(&rb, bytes, length) != length){
+    // No
+    
+    // Set state to overflow
+    ringbufferWrapper_state = RINGBUFFER_WRAPPER_STATE_OVERFLOW;
+  }
+}
+
 /** @brief This method will return the flag state.
  *  @return The flag state of the OVERFLOW flag.
  */
@@ -176,8 +213,10 @@ int ringbufferWrapper_testsuite(){
   // if you want to see anything!
   uint8_t debugUint8_t;
   uint32_t debugUint32_t;
+  uint32_t putCount;
   
   ringbufferWrapper_clear();
+  putCount = ringbufferWrapper_getPutCount();
   
   // Check getCount and putByte for NOT overflowing conditions
   // Put 0...127 in buffer
@@ -188,6 +227,9 @@ int ringbufferWrapper_testsuite(){
   if (ringbufferWrapper_getCount() != 128){
     return ringbufferWrapper_returner(-1);
   }
+  if ((ringbufferWrapper_getPutCount() - putCount) != 128){
+    return ringbufferWrapper_returner(-1);
+  }
   
   // Check peek for NOT overflowing conditions without delete
   // Check elements 0 (=0) and 63 (=63)
@@ -226,6 +268,10 @@ int ringbufferWrapper_testsuite(){
   if (debugUint32_t != 32){
     return ringbufferWrapper_returner(-1);
   }
+  // Taking bytes out is no new reception
+  if ((ringbufferWrapper_getPutCount() - putCount) != 128){
+    return ringbufferWrapper_returner(-1);
+  }
   
   // Check clear for NOT overflowing conditions
   // Kick them all and reset pointers AND reset flag
@@ -306,6 +352,52 @@ int ringbufferWrapper_testsuite(){
     return ringbufferWrapper_returner(-1);
   }
   
+  // Check putBytes, it must keep the order and flag an overflow as well
+  uint8_t bulk[200];
+  for (i = 0; i < 200; i++){
+    bulk[i] = (uint8_t) ((200 - i) & 0xFF);
+  }
+  ringbufferWrapper_putBytes(bulk, 200);
+  if (ringbufferWrapper_getCount() != 200){
+    return ringbufferWrapper_returner(-1);
+  }
+  if (ringbufferWrapper_peekByte(0) != 200 || ringbufferWrapper_peekByte(199) != 1){
+    return ringbufferWrapper_returner(-1);
+  }
+  if (ringbufferWrapper_flagState() != RINGBUFFER_WRAPPER_STATE_OK){
+    return ringbufferWrapper_returner(-1);
+  }
+  ringbufferWrapper_putBytes(bulk, 57);
+  if (ringbufferWrapper_flagState() != RINGBUFFER_WRAPPER_STATE_OVERFLOW){
+    return ringbufferWrapper_returner(-1);
+  }
+  // The part that did fit is kept
+  if (ringbufferWrapper_getCount() != 256 || ringbufferWrapper_peekByte(255) != 145){
+    return ringbufferWrapper_returner(-1);
+  }
+  
+  // Check peekSpan, the spans must cover 200...145 followed by 200...191
+  ringbufferWrapper_dropBytesCount(200);
+  ringbufferWrapper_putBytes(bulk, 10);
+  const uint8_t *span;
+  uint32_t spanLength;
+  debugUint32_t = 0;
+  while ((spanLength = ringbufferWrapper_peekSpan(debugUint32_t, &span)) > 0){
+    for (i = 0; i < (int32_t) spanLength; i++){
+      if (span[i] != ringbufferWrapper_peekByte(debugUint32_t + i)){
+        return ringbufferWrapper_returner(-1);
+      }
+    }
+    debugUint32_t += spanLength;
+  }
+  if (debugUint32_t != 66 || ringbufferWrapper_peekByte(55) != 145 || ringbufferWrapper_peekByte(65) != 191){
+    return ringbufferWrapper_returner(-1);
+  }
+  if (ringbufferWrapper_peekSpan(66, &span) != 0){
+    return ringbufferWrapper_returner(-1);
+  }
+  ringbufferWrapper_clear();
+  
   return ringbufferWrapper_returner(0);
 }
 #endif
\ No newline at end of file
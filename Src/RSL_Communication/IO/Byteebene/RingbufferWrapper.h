@@ -30,9 +30,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added ringbufferWrapper_peekSpan              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Count of bytes ever put in                    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -69,6 +69,12 @@ typedef enum RINGBUFFER_WRAPPER_STATE_VALUES {
  */
 uint32_t                                        ringbufferWrapper_getCount(void);
 
+/** @brief This method asks the count of bytes ever put in the ringbuffer. It
+ *         only changes, if new bytes come in, not if some get taken out.
+ *  @return The count of bytes put in, it wraps around.
+ */
+uint32_t                                        ringbufferWrapper_getPutCount(void);
+
 /** @brief This method clears the ringbuffer and resets the state.
  *  @return Nothing.
  */
@@ -81,6 +87,15 @@ void                                            ringbufferWrapper_clear(void);
  */
 uint8_t                                         ringbufferWrapper_peekByte(uint32_t position);
 
+/** @brief This method gives the bytes from a position on, that lie in one
+ *         piece inside the ringbuffer. Scan them directly instead of peeking
+ *         every single byte.
+ *  @param position Is the position you want to start at.
+ *  @param **span Will be set to the first byte.
+ *  @return The count of bytes in one piece, 0 if there is none at position.
+ */
+uint32_t                                        ringbufferWrapper_peekSpan(uint32_t position, const uint8_t **span);
+
 /** @brief This method will drop the first byte from the ringbuffer.
  *  @return Nothing.
  */
@@ -104,6 +119,14 @@ uint8_t                                         ringbufferWrapper_getByte(void);
  */
 void                                            ringbufferWrapper_putByte(uint8_t byte);
 
+/** @brief This method will put several bytes in the ringbuffer. If you put in
+ *         too many the system will set the overflow flag.
+ *  @param *bytes The bytes you want to put in.
+ *  @param length The count of bytes.
+ *  @return Nothing.
+ */
+void                                            ringbufferWrapper_putBytes(uint8_t *bytes, uint32_t length);
+
 /** @brief This method will return the flag state.
  *  @return The flag state of the OVERFLOW flag.
  */
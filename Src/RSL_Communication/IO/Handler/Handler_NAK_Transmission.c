@@ -27,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Include names match the file names            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -43,7 +43,7 @@
 #include "Test_Selector.h"
 #include "Message_Definitions.h"
 #include "Handler_NAK_Transmission.h"
-#include "userMethods_UART.h"
+#include "UserMethods_UART.h"
 
 /* Typedefinitions */
 
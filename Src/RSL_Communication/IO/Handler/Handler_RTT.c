@@ -0,0 +1,404 @@
+/**
+  ******************************************************************************
+  * @file       Handler_RTT.c
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Round trip time estimation and adaptive timeouts
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "Test_Selector.h"
+#include "MasterDefine.h"
+#include "Handler_RTT.h"
+#include "UserMethods_Characteristics.h"
+
+/* Typedefinitions */
+// The deviation term never goes below the resolution of the time (in ms)
+#define HANDLER_RTT_GRANULARITY                         10
+// The baseline gets persisted not before this count of measurements
+#define HANDLER_RTT_BASELINE_SAMPLES                    8
+// The persisted baseline holds the smoothed round trip time of every class in
+// 16 bit, 0 means not measured
+#define HANDLER_RTT_BASELINE_BITS                       16
+#define HANDLER_RTT_BASELINE_MASK                       0xFFFF
+
+/**
+ * @brief This struct definition contains the estimation of one class. The
+ *        values are kept scaled, so the smoothing works without fractions.
+ */
+typedef struct HANDLER_RTT_ESTIMATION_STRUCT {
+  uint32_t srtt;                /**< Smoothed round trip time, scaled by 8.*/
+  uint32_t rttvar;              /**< Mean deviation of the round trip time, scaled by 4.*/
+  uint32_t samples;             /**< Count of measurements since the init.*/
+  bool valid;                   /**< TRUE if measured or loaded from the baseline.*/
+} HANDLER_RTT_ESTIMATION_STRUCT_TYPEDEF;
+
+/**
+ * @brief This struct definition contains the timeouts of one class.
+ */
+typedef struct HANDLER_RTT_BOUNDS_STRUCT {
+  uint32_t initial;             /**< Timeout before the first measurement.*/
+  uint32_t min;                 /**< Lowest timeout.*/
+  uint32_t max;                 /**< Highest timeout, longer round trips are no answers.*/
+} HANDLER_RTT_BOUNDS_STRUCT_TYPEDEF;
+
+/* Variables */
+/** \brief handlerRTT_bounds The timeouts of every class */
+static const HANDLER_RTT_BOUNDS_STRUCT_TYPEDEF handlerRTT_bounds[HANDLER_RTT_CLASS_COUNT] = {
+  [HANDLER_RTT_CLASS_LINK]              = {HANDLER_RTT_TIMEOUT_INITIAL_LINK, HANDLER_RTT_TIMEOUT_MIN_LINK, HANDLER_RTT_TIMEOUT_MAX_LINK},
+  [HANDLER_RTT_CLASS_CHARACTERISTIC]    = {HANDLER_RTT_TIMEOUT_INITIAL_CHARACTERISTIC, HANDLER_RTT_TIMEOUT_MIN_CHARACTERISTIC, HANDLER_RTT_TIMEOUT_MAX_CHARACTERISTIC},
+};
+/** \brief handlerRTT_estimation The estimation of every class */
+static HANDLER_RTT_ESTIMATION_STRUCT_TYPEDEF handlerRTT_estimation[HANDLER_RTT_CLASS_COUNT];
+/** \brief handlerRTT_baseline The persisted round trip time of every class (in ms) */
+static uint32_t handlerRTT_baseline[HANDLER_RTT_CLASS_COUNT];
+/** \brief handlerRTT_initialized TRUE after the baseline got loaded */
+static bool handlerRTT_initialized = FALSE;
+
+#if TEST_HANDLER_RTT >= 1
+  /** \brief handlerRTT_testBaseline Stand-in for the persisted baseline */
+  uint32_t handlerRTT_testBaseline;
+  /** \brief handlerRTT_testBaselineValid TRUE if the stand-in holds a baseline */
+  bool handlerRTT_testBaselineValid;
+  /** \brief handlerRTT_testBaselineWrites counter for testing purpose (to see, how often persisted) */
+  uint32_t handlerRTT_testBaselineWrites;
+#endif
+
+/* Function definitions */
+
+/** @brief This method will read the persisted baseline
+ *  @param *baseline Pointer where to put the baseline
+ *  @return TRUE if there is one, FALSE else.
+ */
+static bool handlerRTT_loadBaseline(uint32_t *baseline){
+  #if TEST_HANDLER_RTT >= 1
+    *baseline = handlerRTT_testBaseline;
+    return handlerRTT_testBaselineValid;
+  #else
+    return userMethods_characteristics_loadRttBaseline(baseline);
+  #endif
+}
+
+/** @brief This method will persist the baseline of all classes
+ *  @return Nothing.
+ */
+static void handlerRTT_storeBaseline(void){
+  uint32_t baseline = 0;
+  
+  for (uint32_t i = 0; i < HANDLER_RTT_CLASS_COUNT; i++){
+    baseline |= handlerRTT_baseline[i] << (i * HANDLER_RTT_BASELINE_BITS);
+  }
+  #if TEST_HANDLER_RTT >= 1
+    handlerRTT_testBaseline = baseline;
+    handlerRTT_testBaselineValid = TRUE;
+    handlerRTT_testBaselineWrites++;
+  #else
+    userMethods_characteristics_storeRttBaseline(baseline);
+  #endif
+}
+
+/** @brief This method will load the persisted baseline and start the
+ *         estimation from it. It is called on the first use by itself.
+ *  @return Nothing.
+ */
+void handlerRTT_init(void){
+  uint32_t baseline;
+  
+  if (handlerRTT_loadBaseline(&baseline) == FALSE){
+    baseline = 0;
+  }
+  
+  for (uint32_t i = 0; i < HANDLER_RTT_CLASS_COUNT; i++){
+    handlerRTT_baseline[i] = (baseline >> (i * HANDLER_RTT_BASELINE_BITS)) & HANDLER_RTT_BASELINE_MASK;
+    handlerRTT_estimation[i].samples = 0;
+    // Is there a baseline of the class?
+    if (handlerRTT_baseline[i] == 0){
+      // No, wait with the initial timeout until the first measurement
+      handlerRTT_estimation[i].srtt = 0;
+      handlerRTT_estimation[i].rttvar = 0;
+      handlerRTT_estimation[i].valid = FALSE;
+    }else{
+      // Yes, take it like a first measurement
+      handlerRTT_estimation[i].srtt = handlerRTT_baseline[i] << 3;
+      handlerRTT_estimation[i].rttvar = handlerRTT_baseline[i] << 1;
+      handlerRTT_estimation[i].valid = TRUE;
+    }
+  }
+  handlerRTT_initialized = TRUE;
+}
+
+/** @brief This method will persist the smoothed round trip time, if enough
+ *         got measured and it drifted off the baseline by more than a
+ *         quarter. Small changes are not worth an EEPROM write.
+ *  @param rttClass The class of the answer
+ *  @return Nothing.
+ */
+static void handlerRTT_updateBaseline(HANDLER_RTT_CLASS_VALUES_TYPEDEF rttClass){
+  uint32_t rtt = handlerRTT_estimation[rttClass].srtt >> 3;
+  uint32_t baseline = handlerRTT_baseline[rttClass];
+  
+  if (handlerRTT_estimation[rttClass].samples < HANDLER_RTT_BASELINE_SAMPLES){
+    return;
+  }
+  // 0 marks a class without baseline
+  if (rtt == 0){
+    rtt = 1;
+  }
+  if ((rtt <= (baseline + (baseline >> 2))) && (rtt >= (baseline - (baseline >> 2)))){
+    return;
+  }
+  if (rtt > HANDLER_RTT_BASELINE_MASK){
+    rtt = HANDLER_RTT_BASELINE_MASK;
+  }
+  handlerRTT_baseline[rttClass] = rtt;
+  handlerRTT_storeBaseline();
+}
+
+/** @brief This method will feed a measured round trip into the estimation.
+ *         Only measure answers to frames that were sent once, the answer of a
+ *         retransmitted frame can belong to any of its transmissions.
+ *  @param rttClass The class of the answer
+ *  @param sendTime The time the request was sent at
+ *  @param time The time the answer arrived at
+ *  @return Nothing.
+ */
+void handlerRTT_sample(HANDLER_RTT_CLASS_VALUES_TYPEDEF rttClass, uint32_t sendTime, uint32_t time){
+  HANDLER_RTT_ESTIMATION_STRUCT_TYPEDEF *estimation;
+  uint32_t rtt = time - sendTime;
+  int32_t delta;
+  
+  if (handlerRTT_initialized == FALSE){
+    handlerRTT_init();
+  }
+  if (rttClass >= HANDLER_RTT_CLASS_COUNT){
+    return;
+  }
+  // Is the answer from before the request or later than any timeout?
+  if (((int32_t) rtt < 0) || (rtt > handlerRTT_bounds[rttClass].max)){
+    // Yes, it is no measurement
+    return;
+  }
+  
+  estimation = &handlerRTT_estimation[rttClass];
+  if (estimation->valid == FALSE){
+    estimation->srtt = rtt << 3;
+    estimation->rttvar = rtt << 1;
+    estimation->valid = TRUE;
+  }else{
+    // srtt = 7/8 srtt + 1/8 rtt, rttvar = 3/4 rttvar + 1/4 |srtt - rtt|
+    delta = (int32_t) rtt - (int32_t) (estimation->srtt >> 3);
+    estimation->srtt = (uint32_t) ((int32_t) estimation->srtt + delta);
+    if (delta < 0){
+      delta = -delta;
+    }
+    estimation->rttvar = estimation->rttvar + (uint32_t) delta - (estimation->rttvar >> 2);
+  }
+  estimation->samples++;
+  
+  handlerRTT_updateBaseline(rttClass);
+}
+
+/** @brief This method will give the time to wait for an answer of the class
+ *  @param rttClass The class of the answer
+ *  @return The timeout in ms.
+ */
+uint32_t handlerRTT_getTimeout(HANDLER_RTT_CLASS_VALUES_TYPEDEF rttClass){
+  uint32_t timeout;
+  
+  if (handlerRTT_initialized == FALSE){
+    handlerRTT_init();
+  }
+  if (rttClass >= HANDLER_RTT_CLASS_COUNT){
+    return HANDLER_RTT_TIMEOUT_MAX_BACKOFF;
+  }
+  if (handlerRTT_estimation[rttClass].valid == FALSE){
+    return handlerRTT_bounds[rttClass].initial;
+  }
+  
+  // timeout = srtt + 4 * rttvar, rttvar is already scaled by 4
+  timeout = handlerRTT_estimation[rttClass].rttvar;
+  if (timeout < HANDLER_RTT_GRANULARITY){
+    timeout = HANDLER_RTT_GRANULARITY;
+  }
+  timeout += handlerRTT_estimation[rttClass].srtt >> 3;
+  
+  if (timeout < handlerRTT_bounds[rttClass].min){
+    return handlerRTT_bounds[rttClass].min;
+  }
+  if (timeout > handlerRTT_bounds[rttClass].max){
+    return handlerRTT_bounds[rttClass].max;
+  }
+  return timeout;
+}
+
+/** @brief This method will give the smoothed round trip time of the class
+ *  @param rttClass The class of the answer
+ *  @return The round trip time in ms, 0 if nothing got measured yet.
+ */
+uint32_t handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_VALUES_TYPEDEF rttClass){
+  if (handlerRTT_initialized == FALSE){
+    handlerRTT_init();
+  }
+  if (rttClass >= HANDLER_RTT_CLASS_COUNT){
+    return 0;
+  }
+  return handlerRTT_estimation[rttClass].srtt >> 3;
+}
+
+/** @brief This method will give the timeout of the next retransmission
+ *  @param timeout The timeout of the last transmission
+ *  @return The doubled timeout, HANDLER_RTT_TIMEOUT_MAX_BACKOFF at most.
+ */
+uint32_t handlerRTT_getBackoffTimeout(uint32_t timeout){
+  if (timeout >= (HANDLER_RTT_TIMEOUT_MAX_BACKOFF >> 1)){
+    return HANDLER_RTT_TIMEOUT_MAX_BACKOFF;
+  }
+  return timeout << 1;
+}
+
+#if TEST_HANDLER_RTT >= 1
+
+/** @brief This method will free variables and set back things to return from
+ *         the test.
+ *  @param retVal The value you want to return.
+ *  @return The returnvalue you enter.
+ */
+int handlerRTT_testsuiteReturner(int retVal){
+  handlerRTT_testBaselineValid = FALSE;
+  handlerRTT_init();
+  return retVal;
+}
+
+/** @brief This method is the test for this unit
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int handlerRTT_testsuite(){
+  uint32_t i;
+  
+  handlerRTT_testBaselineValid = FALSE;
+  handlerRTT_testBaselineWrites = 0;
+  handlerRTT_init();
+  
+  // Nothing measured, the former fixed timeouts are used
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_LINK) != HANDLER_RTT_TIMEOUT_INITIAL_LINK){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_CHARACTERISTIC) != HANDLER_RTT_TIMEOUT_INITIAL_CHARACTERISTIC){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  if (handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_LINK) != 0){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  
+  // First measurement: srtt = 100, rttvar = 50, timeout = 100 + 4 * 50
+  handlerRTT_sample(HANDLER_RTT_CLASS_LINK, 1000, 1100);
+  if (handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_LINK) != 100){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_LINK) != 300){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  // The other class stays untouched
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_CHARACTERISTIC) != HANDLER_RTT_TIMEOUT_INITIAL_CHARACTERISTIC){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  
+  // An answer from before the request and one later than any timeout are no measurements
+  handlerRTT_sample(HANDLER_RTT_CLASS_LINK, 2000, 1000);
+  handlerRTT_sample(HANDLER_RTT_CLASS_LINK, 0, HANDLER_RTT_TIMEOUT_MAX_LINK + 1);
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_LINK) != 300){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  // The time may turn around in between
+  handlerRTT_sample(HANDLER_RTT_CLASS_LINK, 0xFFFFFFC0, 0x24);
+  if (handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_LINK) != 100){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  
+  // A steady link lets the deviation decay, the timeout ends at the lower bound
+  for (i = 0; i < HANDLER_RTT_BASELINE_SAMPLES - 3; i++){
+    handlerRTT_sample(HANDLER_RTT_CLASS_LINK, 0, 100);
+  }
+  if (handlerRTT_testBaselineWrites != 0){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  handlerRTT_sample(HANDLER_RTT_CLASS_LINK, 0, 100);
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_LINK) != HANDLER_RTT_TIMEOUT_MIN_LINK){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  
+  // Enough measurements, the baseline got persisted once
+  if ((handlerRTT_testBaselineWrites != 1) || (handlerRTT_testBaseline != 100)){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  // Small changes are not persisted
+  for (i = 0; i < 20; i++){
+    handlerRTT_sample(HANDLER_RTT_CLASS_LINK, 0, 110);
+  }
+  if (handlerRTT_testBaselineWrites != 1){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  
+  // A slow answer: srtt = 5000, rttvar = 2500, the timeout ends at the upper bound
+  handlerRTT_sample(HANDLER_RTT_CLASS_CHARACTERISTIC, 0, 5000);
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_CHARACTERISTIC) != HANDLER_RTT_TIMEOUT_MAX_CHARACTERISTIC){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  
+  // A restart continues from the baseline, the characteristic has none
+  handlerRTT_init();
+  if (handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_LINK) != 100){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_LINK) != 300){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  if (handlerRTT_getTimeout(HANDLER_RTT_CLASS_CHARACTERISTIC) != HANDLER_RTT_TIMEOUT_INITIAL_CHARACTERISTIC){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  
+  // Backoff doubles up to the limit
+  if (handlerRTT_getBackoffTimeout(HANDLER_RTT_TIMEOUT_MIN_LINK) != (HANDLER_RTT_TIMEOUT_MIN_LINK << 1)){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  if (handlerRTT_getBackoffTimeout(HANDLER_RTT_TIMEOUT_MAX_BACKOFF - 1) != HANDLER_RTT_TIMEOUT_MAX_BACKOFF){
+    return handlerRTT_testsuiteReturner(-1);
+  }
+  
+  return handlerRTT_testsuiteReturner(0);
+}
+
+#endif
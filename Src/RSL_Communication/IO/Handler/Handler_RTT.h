@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file       Handler_RTT.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Round trip time estimation and adaptive timeouts
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __HANDLER_RTT_H
+#define __HANDLER_RTT_H
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "Test_Selector.h"
+#include "MasterDefine.h"
+
+/* Typedefinitions */
+
+/**
+ * @brief This typedef defines the classes of answers the RSL10 gives. Every
+ *        class has an own round trip time estimation.
+ *        LINK = ACK of a transmitted frame
+ *        CHARACTERISTIC = CHAR_ACK/CHAR_NAK after the ACK of a characteristic update
+ */
+typedef enum HANDLER_RTT_CLASS_VALUES {
+  HANDLER_RTT_CLASS_LINK                        = 0x00, /**< The frame got ACKed */
+  HANDLER_RTT_CLASS_CHARACTERISTIC              = 0x01, /**< The characteristic update got answered */
+  HANDLER_RTT_CLASS_COUNT                       = 0x02, /**< Count of classes, has to stay the last entry */
+} HANDLER_RTT_CLASS_VALUES_TYPEDEF;
+
+// The timeouts (in ms) before the first measurement, these are the former
+// fixed values
+#define HANDLER_RTT_TIMEOUT_INITIAL_LINK                1000
+#define HANDLER_RTT_TIMEOUT_INITIAL_CHARACTERISTIC      1500
+
+// The bounds of the timeouts (in ms)
+#define HANDLER_RTT_TIMEOUT_MIN_LINK                    200
+#define HANDLER_RTT_TIMEOUT_MAX_LINK                    3000
+#define HANDLER_RTT_TIMEOUT_MIN_CHARACTERISTIC          300
+#define HANDLER_RTT_TIMEOUT_MAX_CHARACTERISTIC          6000
+
+// The timeout of a retransmission doubles up to this (in ms)
+#define HANDLER_RTT_TIMEOUT_MAX_BACKOFF                 8000
+
+/* Variables */
+
+/* Function declarations */
+
+/** @brief This method will load the persisted baseline and start the
+ *         estimation from it. It is called on the first use by itself.
+ *  @return Nothing.
+ */
+void handlerRTT_init(void);
+
+/** @brief This method will feed a measured round trip into the estimation.
+ *         Only measure answers to frames that were sent once, the answer of a
+ *         retransmitted frame can belong to any of its transmissions.
+ *  @param rttClass The class of the answer
+ *  @param sendTime The time the request was sent at
+ *  @param time The time the answer arrived at
+ *  @return Nothing.
+ */
+void handlerRTT_sample(HANDLER_RTT_CLASS_VALUES_TYPEDEF rttClass, uint32_t sendTime, uint32_t time);
+
+/** @brief This method will give the time to wait for an answer of the class
+ *  @param rttClass The class of the answer
+ *  @return The timeout in ms.
+ */
+uint32_t handlerRTT_getTimeout(HANDLER_RTT_CLASS_VALUES_TYPEDEF rttClass);
+
+/** @brief This method will give the smoothed round trip time of the class
+ *  @param rttClass The class of the answer
+ *  @return The round trip time in ms, 0 if nothing got measured yet.
+ */
+uint32_t handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_VALUES_TYPEDEF rttClass);
+
+/** @brief This method will give the timeout of the next retransmission
+ *  @param timeout The timeout of the last transmission
+ *  @return The doubled timeout, HANDLER_RTT_TIMEOUT_MAX_BACKOFF at most.
+ */
+uint32_t handlerRTT_getBackoffTimeout(uint32_t timeout);
+
+#if TEST_HANDLER_RTT >= 1
+
+/** @brief This method is the test for this unit
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int handlerRTT_testsuite();
+
+#endif
+
+#endif
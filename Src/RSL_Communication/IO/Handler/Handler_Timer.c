@@ -27,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Running timers in a deadline queue            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -44,13 +44,66 @@
 #include "MasterDefine.h"
 #include "Variable_Definitions.h"
 #include "Handler_Timer.h"
+#include "UserMethods_Characteristics.h"
 
 /* Typedefinitions */
 
 /* Variables */
 
+/** \brief timerHandler_queueHead The running timer with the earliest target
+  *        time, the others are linked behind it in the order of their target
+  *        times.
+  */
+static TIMER_STRUCT_TYPEDEF *timerHandler_queueHead = NULL;
+
 /* Function definitions */
 
+/** @brief This method will take a timer out of the deadline queue. Call it
+ *         inside of a critical section only.
+ *  @param *timer Pointer to the timer object.
+ *  @return Nothing.
+ */
+static void timerHandler_queueUnlink(TIMER_STRUCT_TYPEDEF *timer){
+  TIMER_STRUCT_TYPEDEF **link = &timerHandler_queueHead;
+  
+  // Is it linked at all?
+  if (timer->queue_linked == FALSE){
+    // No
+    return;
+  }
+  
+  while (*link != NULL){
+    // Is it the one?
+    if (*link == timer){
+      // Yes
+      *link = timer->queue_next;
+      break;
+    }
+    link = &((*link)->queue_next);
+  }
+  timer->queue_next = NULL;
+  timer->queue_linked = FALSE;
+}
+
+/** @brief This method will link a timer into the deadline queue in the order
+ *         of its target time. Timers with the same target time stay in the
+ *         order they were started in. Call it inside of a critical section
+ *         only.
+ *  @param *timer Pointer to the timer object.
+ *  @return Nothing.
+ */
+static void timerHandler_queueInsert(TIMER_STRUCT_TYPEDEF *timer){
+  TIMER_STRUCT_TYPEDEF **link = &timerHandler_queueHead;
+  
+  // The difference is taken signed, so the order holds across the turnaround
+  while ((*link != NULL) && ((int32_t) (timer->time_targetTime - (*link)->time_targetTime) >= 0)){
+    link = &((*link)->queue_next);
+  }
+  timer->queue_next = *link;
+  timer->queue_linked = TRUE;
+  *link = timer;
+}
+
 /** @brief This method will start the given timer with the set values
  *  @param *timer Pointer to the timer object.
  *  @param time The actual time you want it to start at
@@ -58,10 +111,15 @@
  *  @return Nothing.
  */
 void timerHandler_timerStart(TIMER_STRUCT_TYPEDEF *timer, uint32_t time, uint32_t timeouttime){
+  uint32_t primask = userMethods_characteristics_enterCritical();
+  
+  timerHandler_queueUnlink(timer);
   timer->time_targetTime = time + timeouttime;
   timer->flag_active = TIMER_FLAG_ACTIVE;
   timer->time_waitTime = timeouttime;
   timer->time_startTime = time;
+  timerHandler_queueInsert(timer);
+  userMethods_characteristics_exitCritical(primask);
 }
 
 /** @brief This method will check the active flag of the timer.
@@ -110,7 +168,11 @@ bool timerHandler_isTimerTimedOut(TIMER_STRUCT_TYPEDEF *timer, uint32_t time){
  *  @return Nothing.
  */
 void timerHandler_timerStop(TIMER_STRUCT_TYPEDEF  *timer){
+  uint32_t primask = userMethods_characteristics_enterCritical();
+  
+  timerHandler_queueUnlink(timer);
   timer->flag_active = TIMER_FLAG_INACTIVE;
+  userMethods_characteristics_exitCritical(primask);
 }
 
 /** @brief This method will restart a timer. Take note that the last entered
@@ -123,14 +185,129 @@ void timerHandler_timerRestart(TIMER_STRUCT_TYPEDEF *timer, uint32_t time){
   timerHandler_timerStart(timer, time, timer->time_waitTime);
 }
 
+/** @brief This method will set up a timer in fresh memory (e.g. on the stack)
+ *         as a stopped one. Never use it on a running timer, stop it instead.
+ *  @param *timer Pointer to the timer object.
+ *  @return Nothing.
+ */
+void timerHandler_timerInit(TIMER_STRUCT_TYPEDEF *timer){
+  timer->time_targetTime = 0;
+  timer->time_waitTime = 0;
+  timer->flag_active = TIMER_FLAG_INACTIVE;
+  timer->time_startTime = 0;
+  timer->queue_next = NULL;
+  timer->queue_linked = FALSE;
+  timer->callback = NULL;
+}
+
+/** @brief This method will set the method that is called when the timer times
+ *         out. It is called out of timerHandler_processExpired.
+ *  @param *timer Pointer to the timer object.
+ *  @param callback The method, NULL for none
+ *  @return Nothing.
+ */
+void timerHandler_timerSetCallback(TIMER_STRUCT_TYPEDEF *timer, void (*callback)(TIMER_STRUCT_TYPEDEF *timer)){
+  timer->callback = callback;
+}
+
+/** @brief This method will give the time until the next running timer times
+ *         out. It only looks at the head of the queue.
+ *  @param time The actual time
+ *  @param *remaining Will be set to the time (in ms) until the timeout, 0 if it is due
+ *  @return TRUE if there is a running timer, FALSE else.
+ */
+bool timerHandler_getNextDeadline(uint32_t time, uint32_t *remaining){
+  bool retVal = FALSE;
+  uint32_t primask = userMethods_characteristics_enterCritical();
+  TIMER_STRUCT_TYPEDEF *head = timerHandler_queueHead;
+  
+  // Is there a running timer?
+  if (head != NULL){
+    // Yes
+    retVal = TRUE;
+    
+    // Is it due already?
+    if (timerHandler_isTimerTimedOut(head, time) == TRUE){
+      // Yes
+      *remaining = 0;
+    }else{
+      // No, it times out once the target time is passed
+      *remaining = head->time_targetTime - time + 1;
+    }
+  }
+  userMethods_characteristics_exitCritical(primask);
+  return retVal;
+}
+
+/** @brief This method will take every timed out timer out of the queue and
+ *         call its callback. The timers stay active, so
+ *         timerHandler_isTimerTimedOut still reports them until they are
+ *         stopped or restarted.
+ *  @param time The actual time
+ *  @return The count of timers that timed out.
+ */
+uint32_t timerHandler_processExpired(uint32_t time){
+  uint32_t count = 0;
+  
+  while (1){
+    uint32_t primask = userMethods_characteristics_enterCritical();
+    TIMER_STRUCT_TYPEDEF *head = timerHandler_queueHead;
+    
+    // Is the earliest timer due?
+    if ((head == NULL) || (timerHandler_isTimerTimedOut(head, time) == FALSE)){
+      // No, so none of the ones behind it is
+      userMethods_characteristics_exitCritical(primask);
+      break;
+    }
+    timerHandler_queueHead = head->queue_next;
+    head->queue_next = NULL;
+    head->queue_linked = FALSE;
+    userMethods_characteristics_exitCritical(primask);
+    count++;
+    
+    // The callback may start the timer again, so it is called outside
+    if (head->callback != NULL){
+      head->callback(head);
+    }
+  }
+  return count;
+}
+
 #if TEST_HANDLER_TIMER >= 1
 
+/** \brief timerHandler_testTimer The timers of the test, they have to outlive
+  *        a failing test to be taken out of the queue again.
+  */
+static TIMER_STRUCT_TYPEDEF timerHandler_testTimer[4];
+
+/** \brief timerHandler_testQueueHead The queue of the running system, it is
+  *        put aside during the test.
+  */
+static TIMER_STRUCT_TYPEDEF *timerHandler_testQueueHead = NULL;
+
+/** \brief timerHandler_testCallbackCount Counts the calls of the test callback
+  */
+static uint32_t timerHandler_testCallbackCount = 0;
+
+/** @brief This method is the callback of the test, it restarts the timer.
+ *  @param *timer Pointer to the timer object.
+ *  @return Nothing.
+ */
+static void timerHandler_testCallback(TIMER_STRUCT_TYPEDEF *timer){
+  timerHandler_testCallbackCount++;
+  timerHandler_timerRestart(timer, timer->time_targetTime + 1);
+}
+
 /** @brief This method will free variables and set back things to return from 
  *         the test.
  *  @param retVal The value you want to return.
  *  @return The returnvalue you enter.
  */
 int timerHandler_testsuiteReturner(int32_t retVal){
+  for (uint32_t i = 0; i < (sizeof(timerHandler_testTimer) / sizeof(timerHandler_testTimer[0])); i++){
+    timerHandler_timerStop(&timerHandler_testTimer[i]);
+  }
+  timerHandler_queueHead = timerHandler_testQueueHead;
   return retVal;
 }
 
@@ -143,6 +320,14 @@ int timerHandler_testsuite(){
     .time_waitTime = 0,
     .flag_active = TIMER_FLAG_INACTIVE,    
   };
+  uint32_t remaining = 0;
+  
+  // The timers of the running system must not mix into the test
+  timerHandler_testQueueHead = timerHandler_queueHead;
+  timerHandler_queueHead = NULL;
+  for (uint32_t i = 0; i < (sizeof(timerHandler_testTimer) / sizeof(timerHandler_testTimer[0])); i++){
+    timerHandler_timerInit(&timerHandler_testTimer[i]);
+  }
   
   //===================== ORDINARY - TIMER TIMEOUT
   
@@ -361,8 +546,113 @@ int timerHandler_testsuite(){
   if (testTimer.time_waitTime != 0x100F0000){
     return timerHandler_testsuiteReturner(-1);
   }
+  timerHandler_timerStop(&testTimer);
+  
+  //===================== DEADLINE QUEUE - ORDER
+  
+  if (timerHandler_getNextDeadline(0x1000, &remaining) == TRUE){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  
+  // Started in a different order than they time out
+  timerHandler_timerStart(&timerHandler_testTimer[0], 0x1000, 300);
+  timerHandler_timerStart(&timerHandler_testTimer[1], 0x1000, 100);
+  timerHandler_timerStart(&timerHandler_testTimer[2], 0x1000, 200);
+  if (timerHandler_queueHead != &timerHandler_testTimer[1]){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_testTimer[1].queue_next != &timerHandler_testTimer[2]){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_testTimer[2].queue_next != &timerHandler_testTimer[0]){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_getNextDeadline(0x1000, &remaining) == FALSE){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (remaining != 101){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  
+  // Restart moves it to the back, stop takes it out
+  timerHandler_timerRestart(&timerHandler_testTimer[1], 0x1100);
+  if (timerHandler_queueHead != &timerHandler_testTimer[2]){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  timerHandler_timerStop(&timerHandler_testTimer[2]);
+  if ((timerHandler_queueHead != &timerHandler_testTimer[0]) || (timerHandler_testTimer[2].queue_linked == TRUE)){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_getNextDeadline(0x1100, &remaining) == FALSE){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (remaining != 45){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  
+  //===================== DEADLINE QUEUE - TIMEOUT
+  
+  if (timerHandler_processExpired(0x112C) != 0){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_getNextDeadline(0x112D, &remaining) == FALSE){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (remaining != 0){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_processExpired(0x112D) != 1){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  
+  // A timed out timer leaves the queue but is still reported
+  if ((timerHandler_testTimer[0].queue_linked == TRUE) || (timerHandler_queueHead != &timerHandler_testTimer[1])){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_isTimerTimedOut(&timerHandler_testTimer[0], 0x112D) == FALSE){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  
+  //===================== DEADLINE QUEUE - TURNAROUND AND CALLBACK
+  
+  timerHandler_timerStop(&timerHandler_testTimer[0]);
+  timerHandler_timerStop(&timerHandler_testTimer[1]);
+  timerHandler_testCallbackCount = 0;
+  timerHandler_timerSetCallback(&timerHandler_testTimer[3], timerHandler_testCallback);
+  timerHandler_timerStart(&timerHandler_testTimer[0], 0xFFFFFF00, 0x200);
+  timerHandler_timerStart(&timerHandler_testTimer[3], 0xFFFFFF00, 0x80);
+  timerHandler_timerStart(&timerHandler_testTimer[1], 0xFFFFFF00, 0x180);
+  if (timerHandler_queueHead != &timerHandler_testTimer[3]){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_testTimer[3].queue_next != &timerHandler_testTimer[1]){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_processExpired(0xFFFFFF81) != 1){
+    return timerHandler_testsuiteReturner(-1);
+  }
   
+  // The callback started it again, now it times out behind the turnaround
+  if ((timerHandler_testCallbackCount != 1) || (timerHandler_testTimer[3].queue_linked == FALSE)){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_testTimer[3].time_targetTime != 0x00000001){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_queueHead != &timerHandler_testTimer[3]){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  // It got started again behind the time, so it fires only once per call
+  if (timerHandler_processExpired(0x00000081) != 2){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_testCallbackCount != 2){
+    return timerHandler_testsuiteReturner(-1);
+  }
+  if (timerHandler_queueHead != &timerHandler_testTimer[3]){
+    return timerHandler_testsuiteReturner(-1);
+  }
   
-  return 0;
+  return timerHandler_testsuiteReturner(0);
 }
 #endif
\ No newline at end of file
@@ -27,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Running timers in a deadline queue            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -59,13 +59,20 @@ typedef enum TIMER_FLAG_ACTIVE_VALUES {
 } TIMER_FLAG_ACTIVE_VALUES_TYPEDEF;
 
 /**
- * @brief This struct definition contains all variables needed for the timer
+ * @brief This struct definition contains all variables needed for the timer.
+ *        Every running timer is linked into one queue, sorted by its target
+ *        time. So the next deadline is always the head of it and nobody has
+ *        to poll all timers to find it. The queue members are handled by this
+ *        unit only, a zero initialized timer is a stopped one.
  */
 typedef struct TIMER_STRUCT {
   uint32_t time_targetTime;                     /**< Target time.*/
   uint32_t time_waitTime;                       /**< Waiting time till timeout.*/
   TIMER_FLAG_ACTIVE_VALUES_TYPEDEF flag_active; /**< Timer activity state.*/
   uint32_t time_startTime;                      /**< Time when timer was started.*/
+  struct TIMER_STRUCT *queue_next;              /**< Next timer in the deadline queue.*/
+  bool queue_linked;                            /**< Timer is in the deadline queue.*/
+  void (*callback)(struct TIMER_STRUCT *timer); /**< Called on the timeout, NULL if not needed.*/
 } TIMER_STRUCT_TYPEDEF;
 
 /* Variables */
@@ -107,6 +114,38 @@ void                                    timerHandler_timerStop(TIMER_STRUCT_TYPE
  */
 void                                    timerHandler_timerRestart(TIMER_STRUCT_TYPEDEF *timer, uint32_t time);
 
+/** @brief This method will set up a timer in fresh memory (e.g. on the stack)
+ *         as a stopped one. Never use it on a running timer, stop it instead.
+ *  @param *timer Pointer to the timer object.
+ *  @return Nothing.
+ */
+void                                    timerHandler_timerInit(TIMER_STRUCT_TYPEDEF *timer);
+
+/** @brief This method will set the method that is called when the timer times
+ *         out. It is called out of timerHandler_processExpired.
+ *  @param *timer Pointer to the timer object.
+ *  @param callback The method, NULL for none
+ *  @return Nothing.
+ */
+void                                    timerHandler_timerSetCallback(TIMER_STRUCT_TYPEDEF *timer, void (*callback)(TIMER_STRUCT_TYPEDEF *timer));
+
+/** @brief This method will give the time until the next running timer times
+ *         out. It only looks at the head of the queue.
+ *  @param time The actual time
+ *  @param *remaining Will be set to the time (in ms) until the timeout, 0 if it is due
+ *  @return TRUE if there is a running timer, FALSE else.
+ */
+bool                                    timerHandler_getNextDeadline(uint32_t time, uint32_t *remaining);
+
+/** @brief This method will take every timed out timer out of the queue and
+ *         call its callback. The timers stay active, so
+ *         timerHandler_isTimerTimedOut still reports them until they are
+ *         stopped or restarted.
+ *  @param time The actual time
+ *  @return The count of timers that timed out.
+ */
+uint32_t                                timerHandler_processExpired(uint32_t time);
+
 #if TEST_HANDLER_TIMER >= 1
 
 /** @brief This method is the test for this unit
@@ -27,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added CRC_Software_continueCRC                |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -49,17 +49,27 @@
 
 /* Function definitions */
 
+/** @brief This method will continue a CRC over the next piece of a frame, so
+ *         a frame can be checked where it lies, even if it is split in pieces
+ *  @param crc CRC_SOFTWARE_START_VALUE or the result of the previous piece
+ *  @param *package Pointer to the piece
+ *  @param length The count of bytes in the piece
+ *  @return The CRC including the piece.
+ */
+uint8_t CRC_Software_continueCRC(uint8_t crc, const uint8_t *package, uint32_t length){
+  for (uint32_t i = (uint32_t) 0; i < length; i++){
+    crc ^= package[i];
+  }
+  return crc;
+}
+
 /** @brief This method will build a CRC for the given field
  *  @param *package Pointer to a buffer
  *  @param length The count of bytes to be used in the buffer
  *  @return The CRC-Byte.
  */
 uint8_t CRC_Software_buildCRC(uint8_t *package, uint32_t length){
-  uint8_t crc = (uint8_t)0xAA;
-  for (uint32_t i = (uint32_t) 0; i < length; i++){
-    crc ^= package[i];
-  }
-  return crc;
+  return CRC_Software_continueCRC(CRC_SOFTWARE_START_VALUE, package, length);
 }
 
 /** @brief This method will check a CRC for the given field
@@ -69,11 +79,7 @@ uint8_t CRC_Software_buildCRC(uint8_t *package, uint32_t length){
  */
 CRC_SOFTWARE_RETURN_VALUES_TYPEDEF CRC_Software_checkCRC(uint8_t *package, uint32_t length){
   CRC_SOFTWARE_RETURN_VALUES_TYPEDEF retVal = CRC_SOFTWARE_INVALID;
-  uint8_t crc = (uint8_t)0xAA;
-  for (uint32_t i = (uint32_t) 0; i < length; i++){
-    crc ^= package[i];
-  }
-  if (crc == (uint8_t)0x00){
+  if (CRC_Software_continueCRC(CRC_SOFTWARE_START_VALUE, package, length) == CRC_SOFTWARE_VALID_RESIDUE){
     retVal = CRC_SOFTWARE_VALID;
   }
   return retVal;
@@ -98,6 +104,10 @@ int CRC_Software_testsuite(){
   if (CRC_Software_checkCRC(testCRC_msgCheckWrong, 4) != CRC_SOFTWARE_INVALID){
     return -1;
   }
+  // A frame split in two pieces must give the same result
+  if (CRC_Software_continueCRC(CRC_Software_continueCRC(CRC_SOFTWARE_START_VALUE, testCRC_msgCheckCorrect, 1), &testCRC_msgCheckCorrect[1], 3) != CRC_SOFTWARE_VALID_RESIDUE){
+    return -1;
+  }
   
   return 0;
 }
@@ -27,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added CRC_Software_continueCRC                |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -57,10 +57,24 @@ typedef enum CRC_SOFTWARE_RETURN_VALUES {
   CRC_SOFTWARE_INVALID          = 0xFF, /**< CRC is invalid */
 } CRC_SOFTWARE_RETURN_VALUES_TYPEDEF;
 
+/** @brief The value a CRC starts with */
+#define CRC_SOFTWARE_START_VALUE        ((uint8_t) 0xAA)
+/** @brief The CRC over a whole frame including its CRC byte ends with this */
+#define CRC_SOFTWARE_VALID_RESIDUE      ((uint8_t) 0x00)
+
 /* Variables */
 
 /* Function definitions */
 
+/** @brief This method will continue a CRC over the next piece of a frame, so
+ *         a frame can be checked where it lies, even if it is split in pieces
+ *  @param crc CRC_SOFTWARE_START_VALUE or the result of the previous piece
+ *  @param *package Pointer to the piece
+ *  @param length The count of bytes in the piece
+ *  @return The CRC including the piece.
+ */
+uint8_t CRC_Software_continueCRC(uint8_t crc, const uint8_t *package, uint32_t length);
+
 /** @brief This method will build a CRC for the given field
  *  @param *package Pointer to a buffer
  *  @param length The count of bytes to be used in the buffer
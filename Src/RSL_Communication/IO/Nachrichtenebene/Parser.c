@@ -39,9 +39,19 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 003       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-17    | Tim Steinberg         | Accept frames with sequence number            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-17    | Tim Steinberg         | Bulk resync on the next valid header          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Resync scans the ringbuffer spans             |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Parse frames in place in the ringbuffer       |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 008       | 2026-10-18    | Tim Steinberg         | M/C/D check by the descriptor table           |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 009       | 2026-10-18    | Tim Steinberg         | Test MIOB set up by clearAllSlots             |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 010       | 2026-10-18    | Tim Steinberg         | Integrity timer leaves the deadline queue     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -50,6 +60,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include "Debug.h"
 #include "Test_Selector.h"
 #include "MasterDefine.h"
 #include "Device_Definitions.h"
@@ -99,8 +110,8 @@ PARSER_FAILURE_FLAG_VALUES_TYPEDEF parserFailureFlag = PARSER_FAILURE_FLAG_NO_FA
  *        started, when the parser tries to parse a message. If it's started
  *        then the reception can restart the timer. It is on hold when the
  *        parser successfully recepts a message. Until then make sure to call
- *        the parser often enough, since it only drops a single byte each run
- *        for failure. If it times out, the buffer gets flushed.
+ *        the parser often enough, since it needs a run to resynchronise after
+ *        each failure. If it times out, the buffer gets flushed.
  */
 TIMER_STRUCT_TYPEDEF parserTimer = {
   .time_targetTime = 0,
@@ -134,9 +145,9 @@ void parser_timerMessageIntegrityStartISP(uint32_t time){
 void parser_resetEverything(){
   // Reset parser related stuff
   parserFailureFlag = PARSER_FAILURE_FLAG_NO_FAILURE;
+  timerHandler_timerStop(&parserTimer);
   parserTimer.time_targetTime = 0;
   parserTimer.time_waitTime = 100;
-  parserTimer.flag_active = TIMER_FLAG_INACTIVE;
   
   // Reset reception buffer and its related stuff
   ringbufferWrapper_clear();
@@ -150,27 +161,60 @@ void parser_resetEverything(){
  */
 PARSER_ARE_MCD_BYTES_VALID_VALUES_TYPEDEF parser_areMCDBytesValid(uint8_t magicByte, uint8_t cmdByte, uint8_t dataLengthByte){
   PARSER_ARE_MCD_BYTES_VALID_VALUES_TYPEDEF retVal = MCG_BYTES_INVALID;
-  uint32_t colcount     = messageParamValidity_reception_getColCount();
-  uint32_t rowcount     = messageParamValidity_reception_getRowCount();
-  uint8_t **bufPtr      = messageParamValidity_reception_getPointerToBuffer();
-  uint32_t mover;
   
-  if (magicByte == (uint8_t) UART_AWAITING_MAGIC){
-    for (uint32_t i = (uint32_t) 0; i < rowcount; i++){
-      mover = i * colcount;
-      if (((uint8_t*) bufPtr)[mover] == cmdByte){
-        /* It is contained*/ 
+  if ((magicByte == (uint8_t) UART_AWAITING_MAGIC) || (magicByte == (uint8_t) UART_AWAITING_MAGIC_SEQUENCED)){
+    // The CMD-Byte indexes its descriptor directly
+    if (messageParamValidity_isValid(MESSAGE_DESCRIPTOR_FLAG_RECEPTION, cmdByte, dataLengthByte) != 0){
+      retVal = MCG_BYTES_VALID;
+    }
+  }
+  return retVal;
+}
+
+/** @brief This method will resynchronise the reception on the next possible
+ *         frame start. It scans the ringbuffer for the next magic byte, whose
+ *         command and data length bytes are valid as well, and drops all the
+ *         bytes in front of it in one step. A magic byte too close to the end
+ *         to check its header is kept, the next run will decide on it.
+ *  @return Nothing.
+ */
+void parser_resync(void){
+  uint32_t count = ringbufferWrapper_getCount();
+  uint32_t position = 1;
+  uint32_t spanStart;
+  uint32_t spanLength;
+  const uint8_t *span;
+  uint8_t candidate;
+  
+  // The first byte is the one that failed, so start right behind it. Scan the
+  // buffer in the (at most two) pieces it lies in, not byte per byte
+  while ((spanLength = ringbufferWrapper_peekSpan(position, &span)) > 0){
+    for (spanStart = position; position < (spanStart + spanLength); position++){
+      candidate = span[position - spanStart];
+      
+      // Is it a magic byte?
+      if ((candidate == (uint8_t) UART_AWAITING_MAGIC) || (candidate == (uint8_t) UART_AWAITING_MAGIC_SEQUENCED)){
+        // Yes
         
-        /* Check if the data length is in the correct interval as well */
-        if ((dataLengthByte >= ((uint8_t*) bufPtr)[mover + 1]) && (dataLengthByte <= ((uint8_t*) bufPtr)[mover + 2])){
-          /* It is correct */
-          retVal = MCG_BYTES_VALID;
-           break;
+        // Is the rest of the header already there?
+        if ((position + 2) >= count){
+          // No, so keep it and wait for more bytes
+          ringbufferWrapper_dropBytesCount(position);
+          return;
+        }
+        
+        // Are the command and datalength byte valid as well?
+        if (parser_areMCDBytesValid(candidate, ringbufferWrapper_peekByte(position + 1), ringbufferWrapper_peekByte(position + 2)) == MCG_BYTES_VALID){
+          // Yes, this is where the next frame may start
+          ringbufferWrapper_dropBytesCount(position);
+          return;
         }
       }
     }
   }
-  return retVal;
+  
+  // Drop the garbage in front of the candidate (or everything) at once
+  ringbufferWrapper_dropBytesCount(position);
 }
 
 /** @brief This method will handle the byte drops and tells the upper layer to
@@ -178,8 +222,8 @@ PARSER_ARE_MCD_BYTES_VALID_VALUES_TYPEDEF parser_areMCDBytesValid(uint8_t magicB
  *  @return TRUE or FALSE.
  */
 bool parser_handleByteDropAndErrorFlag(void){
-  // Drop a single byte
-    ringbufferWrapper_dropByte();
+  // Drop everything up to the next possible frame start
+    parser_resync();
     
     // Are we already in an erroneous parsing mode?
     // If we are, that means we already sent NAK and dropped bytes
@@ -198,14 +242,17 @@ bool parser_handleByteDropAndErrorFlag(void){
     return FALSE;
 }
 
-/** @brief This method makes the parser try to parse a message
- *  @param time The actual time (for entry in message buffer and for timeouts)
- *  @param *inputBuffer The pointer to the message input buffer
- *  @param inputBufferSlotId The slot that has to be used
+/** @brief This method makes the parser try to parse a frame where it lies in
+ *         the ringbuffer, the CRC is checked over the pieces without copying
+ *         them. Upon success the frame stays in the ringbuffer and must be
+ *         released with parser_releaseFrame before the next parse.
+ *  @param time The actual time (for timeouts)
+ *  @param *frame The description of the frame is put here upon success
  *  @return Take a look at typedef enum PARSER_RETURN_VALUES.
  */
-PARSER_RETURN_VALUES_TYPEDEF parser_parseMessage(uint32_t time, MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *inputBuffer, uint32_t inputBufferSlotId){
+PARSER_RETURN_VALUES_TYPEDEF parser_parseFrame(uint32_t time, PARSER_FRAME_STRUCT_TYPEDEF *frame){
   uint32_t packageLength;
+  uint8_t crc;
   
   // Check if the reception buffer got an "overflow" state
   if (ringbufferWrapper_flagState() == RINGBUFFER_WRAPPER_STATE_OVERFLOW){
@@ -262,9 +309,9 @@ PARSER_RETURN_VALUES_TYPEDEF parser_parseMessage(uint32_t time, MESSAGE_INPUT_OU
     
     // we must reset the timer to make sure, that the next reception starts
     // the timer anew.
+    timerHandler_timerStop(&parserTimer);
     parserTimer.time_targetTime = 0;
     parserTimer.time_waitTime = PARSER_MESSAGE_INTEGRITY_TIMEOUT_LENGTH_MS;
-    parserTimer.flag_active = TIMER_FLAG_INACTIVE;
     
     // Are we already in a problematic situation regarding reception?
     if (parserFailureFlag == PARSER_FAILURE_FLAG_FAILURE){
@@ -302,6 +349,12 @@ PARSER_RETURN_VALUES_TYPEDEF parser_parseMessage(uint32_t time, MESSAGE_INPUT_OU
   // Calculate the whole length of the message
   packageLength = (uint8_t) UART_PACKAGE_HEADER_SIZE + (uint8_t) UART_PACKAGE_DATA_SIZE + ringbufferWrapper_peekByte(2) + (uint8_t) UART_PACKAGE_CRC_SIZE;
   
+  // Does the frame carry a sequence number?
+  if (ringbufferWrapper_peekByte(0) == (uint8_t) UART_AWAITING_MAGIC_SEQUENCED){
+    // Yes, it sits between the data and the CRC
+    packageLength += (uint8_t) UART_PACKAGE_SEQUENCE_SIZE;
+  }
+  
   // Is everything already there?
   if (ringbufferWrapper_getCount() < packageLength){
     // No
@@ -310,18 +363,25 @@ PARSER_RETURN_VALUES_TYPEDEF parser_parseMessage(uint32_t time, MESSAGE_INPUT_OU
     return PARSER_RETURN_TOO_LESS_BYTES;
   }
   
-  // Just peek-copy the buffer in the assigned buffer field
-  for (uint32_t i = (uint32_t) 0; i < packageLength; i++){
-    messageIOBuffer_addByteToBuffer_bySlotId(inputBuffer, inputBufferSlotId, ringbufferWrapper_peekByte(i));
+  // Take the frame where it lies, in front of the turnaround...
+  frame->length = packageLength;
+  frame->spanLength[0] = ringbufferWrapper_peekSpan(0, &frame->span[0]);
+  frame->spanLength[1] = 0;
+  frame->span[1] = frame->span[0];
+  if (frame->spanLength[0] >= packageLength){
+    frame->spanLength[0] = packageLength;
+  }else{
+    // ...and behind it
+    ringbufferWrapper_peekSpan(frame->spanLength[0], &frame->span[1]);
+    frame->spanLength[1] = packageLength - frame->spanLength[0];
   }
   
   // Is the crc valid?
-  if (CRC_Software_checkCRC(messageIOBuffer_getBuffer_bySlotId(inputBuffer, inputBufferSlotId), packageLength) == CRC_SOFTWARE_INVALID){
+  crc = CRC_Software_continueCRC(CRC_SOFTWARE_START_VALUE, frame->span[0], frame->spanLength[0]);
+  crc = CRC_Software_continueCRC(crc, frame->span[1], frame->spanLength[1]);
+  if (crc != CRC_SOFTWARE_VALID_RESIDUE){
     // No
     
-    // Reset used buffer length
-    messageIOBuffer_setMessageLength_bySlotId(inputBuffer, inputBufferSlotId, 0);
-    
     // Call handler for drop a byte AND check if we need to tell upper layer
     // to send NAK or not
     if (parser_handleByteDropAndErrorFlag() == TRUE){
@@ -334,44 +394,103 @@ PARSER_RETURN_VALUES_TYPEDEF parser_parseMessage(uint32_t time, MESSAGE_INPUT_OU
   // Since we received something valid, we must reset the failure flag...
   parserFailureFlag = PARSER_FAILURE_FLAG_NO_FAILURE;
   
-  // ...stop the timer as well...
+  // ...and stop the timer as well. The bytes stay in the ringbuffer until the
+  // upper layer is done with them
   timerHandler_timerStop(&parserTimer);
   
-  // Since our message is correct, we must now take out the bytes for real
-  ringbufferWrapper_dropBytesCount(packageLength);
-    
+  return PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED;
+}
+
+/** @brief This method returns a byte of a parsed frame.
+ *  @param *frame The frame
+ *  @param position The position within the frame, must be below its length
+ *  @return The byte.
+ */
+uint8_t parser_frameByte(PARSER_FRAME_STRUCT_TYPEDEF *frame, uint32_t position){
+  // Is it in front of the turnaround?
+  if (position < frame->spanLength[0]){
+    // Yes
+    return frame->span[0][position];
+  }
+  return frame->span[1][position - frame->spanLength[0]];
+}
+
+/** @brief This method copies a parsed frame into a slot of a message buffer,
+ *         for frames that have to outlive their place in the ringbuffer.
+ *  @param *frame The frame
+ *  @param time The actual time (for entry in message buffer)
+ *  @param *inputBuffer The pointer to the message input buffer
+ *  @param inputBufferSlotId The slot that has to be used
+ *  @return TRUE if OK, FALSE if the frame doesn't fit.
+ */
+bool parser_storeFrame(PARSER_FRAME_STRUCT_TYPEDEF *frame, uint32_t time, MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *inputBuffer, uint32_t inputBufferSlotId){
+  // Copy both pieces in one step each
+  if ((messageIOBuffer_addBytesToBuffer_bySlotId(inputBuffer, inputBufferSlotId, frame->span[0], frame->spanLength[0]) == FALSE) ||
+      (messageIOBuffer_addBytesToBuffer_bySlotId(inputBuffer, inputBufferSlotId, frame->span[1], frame->spanLength[1]) == FALSE)){
+    // Reset used buffer length
+    messageIOBuffer_setMessageLength_bySlotId(inputBuffer, inputBufferSlotId, 0);
+    return FALSE;
+  }
+  
   // Now that everything is handled, we can validate our reception
   messageIOBuffer_validateMessage_bySlotId(inputBuffer, inputBufferSlotId, time, 1000);
+  return TRUE;
+}
+
+/** @brief This method takes a parsed frame out of the ringbuffer.
+ *  @param *frame The frame
+ *  @return Nothing.
+ */
+void parser_releaseFrame(PARSER_FRAME_STRUCT_TYPEDEF *frame){
+  ringbufferWrapper_dropBytesCount(frame->length);
+}
+
+/** @brief This method makes the parser try to parse a message and copies it
+ *         into the given slot.
+ *  @param time The actual time (for entry in message buffer and for timeouts)
+ *  @param *inputBuffer The pointer to the message input buffer
+ *  @param inputBufferSlotId The slot that has to be used
+ *  @return Take a look at typedef enum PARSER_RETURN_VALUES.
+ */
+PARSER_RETURN_VALUES_TYPEDEF parser_parseMessage(uint32_t time, MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *inputBuffer, uint32_t inputBufferSlotId){
+  PARSER_FRAME_STRUCT_TYPEDEF frame;
+  PARSER_RETURN_VALUES_TYPEDEF retVal = parser_parseFrame(time, &frame);
   
-  return PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED;
+  // Did we get a frame?
+  if (retVal == PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED){
+    // Yes, so copy it and take it out
+    parser_storeFrame(&frame, time, inputBuffer, inputBufferSlotId);
+    parser_releaseFrame(&frame);
+  }
+  return retVal;
 }
 
 #if TEST_PARSER >= 1
 
+/** \brief parser_testSlots The slots of the test, their timers have to be
+  *        stopped before they are left behind.
+  */
+static BUFFER_STRUCT_TYPEDEF parser_testSlots[PARSER_TEST_SLOTCOUNT];
+
 /** @brief This method will free variables and set back things to return from 
  *         the test.
  *  @param retVal The value you want to return.
  *  @return The returnvalue you enter.
  */
 int parser_testsuiteReturner(int retVal){
+  for (uint32_t i = 0; i < PARSER_TEST_SLOTCOUNT; i++){
+    timerHandler_timerStop(&parser_testSlots[i].timer);
+  }
   return retVal;
 }
 
 void parser_slotInit(BUFFER_STRUCT_TYPEDEF *slot, uint8_t *buffer){
-  slot->transmissionCount = 0;
-  slot->usedLength = 0;
+  messageIOBuffer_resetSlot(slot);
   slot->buffer = buffer;
-  slot->age = 0;
-  slot->valid = FALSE;
 }
 
 void parser_resetEverythingAndMiob(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *miob){
-  for (int i = 0; i < miob->slotCount; i++){
-    miob->slot[i].transmissionCount = 0;
-    miob->slot[i].usedLength = 0;
-    miob->slot[i].age = 0;
-    miob->slot[i].valid = FALSE;
-  }
+  messageIOBuffer_clearAllSlots(miob);
   parser_resetEverything();
 }
 
@@ -382,6 +501,11 @@ int parser_testsuite(){
   int32_t i;
   int32_t tempInt32_t;
   PARSER_RETURN_VALUES_TYPEDEF parserRetVal;
+  const uint32_t noiseBurstLengths[] = {1, 4, 16, 64, 128};
+  uint32_t noiseSeed = 0x2F6B3A19;
+  uint32_t parserCalls;
+  uint8_t noiseByte;
+  PARSER_FRAME_STRUCT_TYPEDEF frame;
   
   // Although this test should only test the buffer, due to it using the
   // message IO-struct it will test *SOME* of it's features, but passively
@@ -396,12 +520,14 @@ int parser_testsuite(){
    * 7.) test mixed behaviour - correct/wrong/correct: ensure correct behaviours
    * 8.) test mixed behaviour - correct/incomplete/correct: ensure correct behaviours
    * 9.) test overflowing conditions: ensure correct behaviour under spamming conditions
+   * 10.) test resync latency: ensure a noise burst costs a single parser run
+   * 11.) test in place parsing: ensure a frame across the turnaround is checked where it lies
    */
   
   // MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF init
   
   uint8_t bufferArrays[PARSER_TEST_SLOTCOUNT][PARSER_TEST_BUFFERSIZE];
-  BUFFER_STRUCT_TYPEDEF slots[PARSER_TEST_SLOTCOUNT];
+  BUFFER_STRUCT_TYPEDEF *slots = parser_testSlots;
   
   for (i = 0; i < PARSER_TEST_SLOTCOUNT; i++){
     parser_slotInit(&slots[i], bufferArrays[i]);
@@ -412,6 +538,7 @@ int parser_testsuite(){
     .maxBufferLength = PARSER_TEST_BUFFERSIZE,
     .slot = slots,
   };
+  messageIOBuffer_clearAllSlots(&miob);
   
   // Test reset
   parser_resetEverything();
@@ -1024,28 +1151,8 @@ int parser_testsuite(){
   if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
     return parser_testsuiteReturner(-1);
   }
-  // 2nd message - 2nd parse - must be PARSER_RETURN_DROP_BYTE
-  parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
-  if (parserRetVal != PARSER_RETURN_DROP_BYTE){
-    return parser_testsuiteReturner(-1);
-  }
-  if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
-    return parser_testsuiteReturner(-1);
-  }
-  // 2nd message - 3rd parse - must be PARSER_RETURN_DROP_BYTE
-  parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
-  if (parserRetVal != PARSER_RETURN_DROP_BYTE){
-    return parser_testsuiteReturner(-1);
-  }
-  if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
-    return parser_testsuiteReturner(-1);
-  }
-  // 2nd message - 4th parse - must be PARSER_RETURN_DROP_BYTE
-  parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
-  if (parserRetVal != PARSER_RETURN_DROP_BYTE){
-    return parser_testsuiteReturner(-1);
-  }
-  if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
+  // The resync dropped the whole 2nd message, the 3rd one is up front
+  if (ringbufferWrapper_getCount() != 4){
     return parser_testsuiteReturner(-1);
   }
   // 3RD MESSAGE
@@ -1102,28 +1209,8 @@ int parser_testsuite(){
   if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
     return parser_testsuiteReturner(-1);
   }
-  // 2nd message - 2nd parse - must be PARSER_RETURN_DROP_BYTE
-  parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
-  if (parserRetVal != PARSER_RETURN_DROP_BYTE){
-    return parser_testsuiteReturner(-1);
-  }
-  if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
-    return parser_testsuiteReturner(-1);
-  }
-  // 2nd message - 3rd parse - must be PARSER_RETURN_DROP_BYTE
-  parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
-  if (parserRetVal != PARSER_RETURN_DROP_BYTE){
-    return parser_testsuiteReturner(-1);
-  }
-  if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
-    return parser_testsuiteReturner(-1);
-  }
-  // 2nd message - 4th parse - must be PARSER_RETURN_DROP_BYTE
-  parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
-  if (parserRetVal != PARSER_RETURN_DROP_BYTE){
-    return parser_testsuiteReturner(-1);
-  }
-  if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
+  // The resync dropped the whole 2nd message, the 3rd one is up front
+  if (ringbufferWrapper_getCount() != 4){
     return parser_testsuiteReturner(-1);
   }
   // 3RD MESSAGE
@@ -1157,17 +1244,11 @@ int parser_testsuite(){
   if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
     return parser_testsuiteReturner(-1);
   }
-  // 2nd to 129th byte drop
-  for (i = 1; i < 129; i++){
-      parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
-    if (parserRetVal != PARSER_RETURN_DROP_BYTE){
-      return parser_testsuiteReturner(-1);
-    }
-    if (parserFailureFlag != PARSER_FAILURE_FLAG_FAILURE){
-      return parser_testsuiteReturner(-1);
-    }
+  // The spam got dropped in one go
+  if (ringbufferWrapper_getCount() != 4){
+    return parser_testsuiteReturner(-1);
   }
-  // 130th must be a successfull msg
+  // 2nd must be a successfull msg
   parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
   if (parserRetVal != PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED){
     return parser_testsuiteReturner(-1);
@@ -1177,6 +1258,44 @@ int parser_testsuite(){
   }
   parser_resetEverythingAndMiob(&miob);
   
+  //=============== TEST RESYNC LATENCY AFTER NOISE BURSTS OF DIFFERENT LENGTH
+  // The noise holds no magic byte, a fake header in there would make the
+  // parser wait for its payload instead of measuring the resync itself
+  for (i = 0; i < (int32_t) (sizeof(noiseBurstLengths) / sizeof(noiseBurstLengths[0])); i++){
+    for (uint32_t j = 0; j < noiseBurstLengths[i]; j++){
+      noiseSeed = (noiseSeed * 1103515245) + 12345;
+      noiseByte = (uint8_t) (noiseSeed >> 16);
+      if ((noiseByte == (uint8_t) UART_AWAITING_MAGIC) || (noiseByte == (uint8_t) UART_AWAITING_MAGIC_SEQUENCED)){
+        noiseByte ^= 0x80;
+      }
+      ringbufferWrapper_putByte(noiseByte);
+    }
+    ringbufferWrapper_putByte(UART_AWAITING_MAGIC);
+    ringbufferWrapper_putByte(UART_MSG_CMD_PACK_REC_ACK);
+    ringbufferWrapper_putByte(0x00);
+    ringbufferWrapper_putByte(0xF9);
+    tempInt32_t = messageIOBuffer_getFreeSlot(&miob);
+    if (tempInt32_t < 0){
+      return parser_testsuiteReturner(-1);
+    }
+    // Count the runs until the message is there, dropping byte by byte took
+    // one run per noise byte plus the one for the message
+    parserCalls = 0;
+    do{
+      parserRetVal = parser_parseMessage(123, &miob, tempInt32_t);
+      parserCalls++;
+    }while ((parserRetVal != PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED) && (parserCalls <= noiseBurstLengths[i]));
+    TRACE_TEST_VALUES(1, "PARSER RESYNC %i NOISE BYTES %i RUNS", (int) noiseBurstLengths[i], (int) parserCalls);
+    if (parserRetVal != PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED){
+      return parser_testsuiteReturner(-1);
+    }
+    // One run for the NAK and the resync, one for the message
+    if (parserCalls != 2){
+      return parser_testsuiteReturner(-1);
+    }
+    parser_resetEverythingAndMiob(&miob);
+  }
+  
   //=============== TEST OVERFLOW - FROM OK CONDITION
   for (i = 0; i < 300; i++){
     ringbufferWrapper_putByte(0x00);
@@ -1218,6 +1337,73 @@ int parser_testsuite(){
   }
   parser_resetEverythingAndMiob(&miob);
   
-  return 0;
+  //=============== TEST IN PLACE PARSING ACROSS THE TURNAROUND
+  // Move the ringbuffer on until the frame lies with 2 bytes in front of the
+  // turnaround and 2 bytes behind it
+  for (i = 0; i < RINGBUFFER_SIZE; i++){
+    ringbufferWrapper_putByte(UART_AWAITING_MAGIC);
+    ringbufferWrapper_putByte(UART_MSG_CMD_PACK_REC_ACK);
+    ringbufferWrapper_putByte(0x00);
+    ringbufferWrapper_putByte(0xF9);
+    if (ringbufferWrapper_peekSpan(0, &frame.span[0]) == 2){
+      break;
+    }
+    ringbufferWrapper_dropBytesCount(4);
+    ringbufferWrapper_putByte(0x00);
+    ringbufferWrapper_dropByte();
+  }
+  parserRetVal = parser_parseFrame(123, &frame);
+  if (parserRetVal != PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED){
+    return parser_testsuiteReturner(-1);
+  }
+  if ((frame.length != 4) || (frame.spanLength[0] != 2) || (frame.spanLength[1] != 2)){
+    return parser_testsuiteReturner(-1);
+  }
+  if ((parser_frameByte(&frame, 1) != UART_MSG_CMD_PACK_REC_ACK) || (parser_frameByte(&frame, 3) != 0xF9)){
+    return parser_testsuiteReturner(-1);
+  }
+  // The frame stays in the ringbuffer until it gets released
+  if (ringbufferWrapper_getCount() != 4){
+    return parser_testsuiteReturner(-1);
+  }
+  tempInt32_t = messageIOBuffer_getFreeSlot(&miob);
+  if ((tempInt32_t < 0) || (parser_storeFrame(&frame, 123, &miob, tempInt32_t) != TRUE)){
+    return parser_testsuiteReturner(-1);
+  }
+  if ((messageIOBuffer_getMessageLength_bySlotId(&miob, tempInt32_t) != 4) || (messageIOBuffer_getBuffer_bySlotId(&miob, tempInt32_t)[3] != 0xF9)){
+    return parser_testsuiteReturner(-1);
+  }
+  parser_releaseFrame(&frame);
+  if (ringbufferWrapper_getCount() != 0){
+    return parser_testsuiteReturner(-1);
+  }
+  parser_resetEverythingAndMiob(&miob);
+  
+  //=============== TEST M/C/D VALIDATION BY THE DESCRIPTOR TABLE
+  for (i = 0; i < MESSAGE_DESCRIPTOR_TABLE_LENGTH; i++){
+    const MESSAGE_DESCRIPTOR_STRUCT_TYPEDEF *descriptor = messageParamValidity_getDescriptor((uint8_t) i);
+    
+    // Is the command received by this device role?
+    if ((descriptor->flags & MESSAGE_DESCRIPTOR_FLAG_RECEPTION) != 0){
+      // Yes, both interval borders are valid, one more byte is not
+      if ((parser_areMCDBytesValid(UART_AWAITING_MAGIC, (uint8_t) i, descriptor->minLength) != MCG_BYTES_VALID) || (parser_areMCDBytesValid(UART_AWAITING_MAGIC_SEQUENCED, (uint8_t) i, descriptor->maxLength) != MCG_BYTES_VALID)){
+        return parser_testsuiteReturner(-1);
+      }
+      if (parser_areMCDBytesValid(UART_AWAITING_MAGIC, (uint8_t) i, descriptor->maxLength + 1) != MCG_BYTES_INVALID){
+        return parser_testsuiteReturner(-1);
+      }
+      // The magic of the own transmission must not be accepted
+      if (parser_areMCDBytesValid(UART_TRANSMISSION_MAGIC, (uint8_t) i, descriptor->minLength) != MCG_BYTES_INVALID){
+        return parser_testsuiteReturner(-1);
+      }
+    }else{
+      // No, it must be rejected with any length
+      if (parser_areMCDBytesValid(UART_AWAITING_MAGIC, (uint8_t) i, descriptor->minLength) != MCG_BYTES_INVALID){
+        return parser_testsuiteReturner(-1);
+      }
+    }
+  }
+  
+  return parser_testsuiteReturner(0);
 }
 #endif
\ No newline at end of file
@@ -41,9 +41,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 003       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-17    | Tim Steinberg         | Bulk resync on the next valid header          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Parse frames in place in the ringbuffer       |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -65,18 +65,29 @@
  *        MESSAGE_SUCCESSFULLY_RECEPTED = A message was successfully parsed
  *                                        and put in the assigned slot
  *        TOO_LESS_BYTES = Not enough bytes for a reception
- *        DROP_BYTE = Parser dropped a byte
+ *        DROP_BYTE = Parser dropped the bytes in front of the next frame
  *        DO_NAK_HANDLING = Tell upper layer to send a NAK
  *        TIMEOUT = Some bytes came in but never put together a valid message
  */
 typedef enum PARSER_RETURN_VALUES {
   PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED   = 0x01, /**< A message was successfully received and put in given slot */
   PARSER_RETURN_TOO_LESS_BYTES                  = 0x02, /**< There are still bytes missing for a parsing */
-  PARSER_RETURN_DROP_BYTE                       = 0x03, /**< Parser dropped a byte */
+  PARSER_RETURN_DROP_BYTE                       = 0x03, /**< Parser dropped the bytes in front of the next frame */
   PARSER_RETURN_DO_NAK_HANDLING                 = 0x0F, /**< Parser wants upper layer to do a nak handling */
   PARSER_RETURN_TIMEOUT                         = 0x1F, /**< Parser wants upper layer to do a timeout handling */
 } PARSER_RETURN_VALUES_TYPEDEF;
 
+/**
+ * @brief This typedef describes a valid frame, that is still in the
+ *        ringbuffer. It lies there in one piece or, if it crosses the
+ *        turnaround, in two. It stays valid until parser_releaseFrame.
+ */
+typedef struct PARSER_FRAME_STRUCT {
+  const uint8_t *span[2];                                     /**< Start of the pieces */
+  uint32_t spanLength[2];                                     /**< Length of the pieces, the second one may be 0 */
+  uint32_t length;                                            /**< Length of the whole frame */
+} PARSER_FRAME_STRUCT_TYPEDEF;
+
 /* Variables */
 
 /* Function definitions */
@@ -101,6 +112,39 @@ void parser_timerMessageIntegrityStartISP(uint32_t time);
  */
 PARSER_RETURN_VALUES_TYPEDEF parser_parseMessage(uint32_t time, MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *inputBuffer, uint32_t inputBufferSlotId);
 
+/** @brief This method makes the parser try to parse a frame where it lies in
+ *         the ringbuffer, the CRC is checked over the pieces without copying
+ *         them. Upon success the frame stays in the ringbuffer and must be
+ *         released with parser_releaseFrame before the next parse.
+ *  @param time The actual time (for timeouts)
+ *  @param *frame The description of the frame is put here upon success
+ *  @return Take a look at typedef enum PARSER_RETURN_VALUES.
+ */
+PARSER_RETURN_VALUES_TYPEDEF parser_parseFrame(uint32_t time, PARSER_FRAME_STRUCT_TYPEDEF *frame);
+
+/** @brief This method returns a byte of a parsed frame.
+ *  @param *frame The frame
+ *  @param position The position within the frame, must be below its length
+ *  @return The byte.
+ */
+uint8_t parser_frameByte(PARSER_FRAME_STRUCT_TYPEDEF *frame, uint32_t position);
+
+/** @brief This method copies a parsed frame into a slot of a message buffer,
+ *         for frames that have to outlive their place in the ringbuffer.
+ *  @param *frame The frame
+ *  @param time The actual time (for entry in message buffer)
+ *  @param *inputBuffer The pointer to the message input buffer
+ *  @param inputBufferSlotId The slot that has to be used
+ *  @return TRUE if OK, FALSE if the frame doesn't fit.
+ */
+bool parser_storeFrame(PARSER_FRAME_STRUCT_TYPEDEF *frame, uint32_t time, MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *inputBuffer, uint32_t inputBufferSlotId);
+
+/** @brief This method takes a parsed frame out of the ringbuffer.
+ *  @param *frame The frame
+ *  @return Nothing.
+ */
+void parser_releaseFrame(PARSER_FRAME_STRUCT_TYPEDEF *frame);
+
 /** @brief This method will reset the parser to starting setup.
  *  @return Nothing.
  */
@@ -29,9 +29,13 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 003       | 2020-06-16    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Added messageIOBuffer_addBytesToBuffer        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | O(1) slots by free bitmap and linked lists    |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Slot timers leave the deadline queue          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Test checks the copied payload                |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -39,6 +43,7 @@
 /* Includes */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
 #include "Test_Selector.h"
 #include "Message_Definitions.h"
@@ -47,22 +52,132 @@
 #include "Stack_Definitions.h"
 
 /* Typedefinitions */
+void messageIOBuffer_listAppend(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint8_t *oldest, MESSAGE_IO_BUFFER_LIST_VALUES_TYPEDEF list, uint8_t slotId);
+void messageIOBuffer_listRemove(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint8_t *oldest, MESSAGE_IO_BUFFER_LIST_VALUES_TYPEDEF list, uint8_t slotId);
+void messageIOBuffer_linkSlot(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint32_t slotId);
+void messageIOBuffer_unlinkSlot(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint32_t slotId);
 
 /* Variables */
+/** @brief Position of the single set bit of a 32 bit word, indexed by the
+ *         upper 5 bits of the word multiplied with the De Bruijn sequence
+ *         0x077CB531 (the Cortex-M0+ has no instruction to count zeros)
+ */
+const uint8_t messageIOBuffer_bitPosition[32] = {
+   0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+  31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9,
+};
 
 /* Function definitions */
 
-/** @brief This method will reset a single slot to the default values.
+/** @brief This method will append a slot to a list as its newest entry.
+ *  @param *buffer Pointer to the MIOB
+ *  @param *oldest Pointer to the head of the list
+ *  @param list The list the links belong to
+ *  @param slotId The ID of the slot you want to append
+ *  @return Nothing
+ */
+void messageIOBuffer_listAppend(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint8_t *oldest, MESSAGE_IO_BUFFER_LIST_VALUES_TYPEDEF list, uint8_t slotId){
+  BUFFER_STRUCT_TYPEDEF *slot = &buffer->slot[slotId];
+  uint8_t newest;
+  
+  // Is the list empty?
+  if (*oldest == MESSAGE_IO_BUFFER_NO_SLOT){
+    // Yes, the slot is oldest and newest at once
+    slot->older[list] = slotId;
+    slot->newer[list] = slotId;
+    *oldest = slotId;
+  }else{
+    // No, it goes between the newest and the oldest
+    newest = buffer->slot[*oldest].older[list];
+    slot->older[list] = newest;
+    slot->newer[list] = *oldest;
+    buffer->slot[newest].newer[list] = slotId;
+    buffer->slot[*oldest].older[list] = slotId;
+  }
+}
+
+/** @brief This method will remove a slot from a list.
+ *  @param *buffer Pointer to the MIOB
+ *  @param *oldest Pointer to the head of the list
+ *  @param list The list the links belong to
+ *  @param slotId The ID of the slot you want to remove
+ *  @return Nothing
+ */
+void messageIOBuffer_listRemove(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint8_t *oldest, MESSAGE_IO_BUFFER_LIST_VALUES_TYPEDEF list, uint8_t slotId){
+  BUFFER_STRUCT_TYPEDEF *slot = &buffer->slot[slotId];
+  
+  // Is it the only entry?
+  if (slot->newer[list] == slotId){
+    // Yes, the list is empty now
+    *oldest = MESSAGE_IO_BUFFER_NO_SLOT;
+  }else{
+    // No, link its neighbours to each other
+    buffer->slot[slot->older[list]].newer[list] = slot->newer[list];
+    buffer->slot[slot->newer[list]].older[list] = slot->older[list];
+    if (*oldest == slotId){
+      *oldest = slot->newer[list];
+    }
+  }
+  
+  slot->older[list] = MESSAGE_IO_BUFFER_NO_SLOT;
+  slot->newer[list] = MESSAGE_IO_BUFFER_NO_SLOT;
+}
+
+/** @brief This method will mark a slot as valid and append it to the age list
+ *         and to the list of its command byte.
+ *  @param *buffer Pointer to the MIOB
+ *  @param slotId The ID of a slot that is not valid
+ *  @return Nothing
+ */
+void messageIOBuffer_linkSlot(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint32_t slotId){
+  BUFFER_STRUCT_TYPEDEF *slot = &buffer->slot[slotId];
+  
+  slot->command = slot->buffer[UART_PACKAGE_POSITION_CMD_BYTE];
+  messageIOBuffer_listAppend(buffer, &buffer->oldestSlot, MESSAGE_IO_BUFFER_LIST_AGE, (uint8_t) slotId);
+  messageIOBuffer_listAppend(buffer, &buffer->oldestSlotWithCommand[slot->command], MESSAGE_IO_BUFFER_LIST_COMMAND, (uint8_t) slotId);
+  buffer->freeSlots &= ~(((uint32_t) 1) << slotId);
+  buffer->usedSlots += 1;
+  slot->valid = TRUE;
+}
+
+/** @brief This method will mark a slot as not valid and remove it from the
+ *         age list and from the list of its command byte.
+ *  @param *buffer Pointer to the MIOB
+ *  @param slotId The ID of the slot
+ *  @return Nothing
+ */
+void messageIOBuffer_unlinkSlot(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint32_t slotId){
+  BUFFER_STRUCT_TYPEDEF *slot = &buffer->slot[slotId];
+  
+  // Is it linked at all?
+  if (slot->valid == FALSE){
+    // No, nothing to do
+    return;
+  }
+  
+  messageIOBuffer_listRemove(buffer, &buffer->oldestSlot, MESSAGE_IO_BUFFER_LIST_AGE, (uint8_t) slotId);
+  messageIOBuffer_listRemove(buffer, &buffer->oldestSlotWithCommand[slot->command], MESSAGE_IO_BUFFER_LIST_COMMAND, (uint8_t) slotId);
+  buffer->freeSlots |= ((uint32_t) 1) << slotId;
+  buffer->usedSlots -= 1;
+  slot->valid = FALSE;
+}
+
+/** @brief This method will reset a single slot to the default values. It does
+ *         not unlink the slot from its MIOB, use it to set up slots only.
  *  @param *slot Pointer to the slot you want to reset.
  *  @return Nothing
  */
 void messageIOBuffer_resetSlot(BUFFER_STRUCT_TYPEDEF *slot){
-  slot->timer.flag_active = TIMER_FLAG_INACTIVE;
+  timerHandler_timerStop(&slot->timer);
   slot->timer.time_targetTime = 0;
   slot->timer.time_waitTime = 0;
   slot->transmissionCount = 0;
   slot->usedLength = 0;
-  slot->age = 0;
+  slot->command = 0;
+  for (int list = 0; list < MESSAGE_IO_BUFFER_LIST_COUNT; list++){
+    slot->older[list] = MESSAGE_IO_BUFFER_NO_SLOT;
+    slot->newer[list] = MESSAGE_IO_BUFFER_NO_SLOT;
+  }
   slot->valid = FALSE;
 }
 
@@ -113,6 +228,30 @@ bool messageIOBuffer_addByteToBuffer_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT
   return TRUE;
 }
 
+/** @brief This method will add several bytes to a specific slot in one step.
+ *         Nothing is added if they don't fit all.
+ *  @param *buffer Pointer to the MIOB
+ *  @param slotId The ID of the slot you want to add the bytes to
+ *  @param *bytes The bytes you want to add
+ *  @param length The count of bytes
+ *  @return TRUE if OK, FALSE else
+ */
+bool messageIOBuffer_addBytesToBuffer_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer,  uint32_t slotId, const uint8_t *bytes, uint32_t length){
+  if (buffer->slotCount <= slotId){
+    return FALSE;
+  }
+  
+  if ((buffer->maxBufferLength - buffer->slot[slotId].usedLength) < length){
+    return FALSE;
+  }
+  
+  memcpy(&buffer->slot[slotId].buffer[buffer->slot[slotId].usedLength], bytes, length);
+  
+  buffer->slot[slotId].usedLength += length;
+  
+  return TRUE;
+}
+
 /** @brief This method will peek at a byte at the buffer within a specific slot
  *  @param *buffer Pointer to the MIOB
  *  @param slotId The ID of the slot you want to get a byte from
@@ -132,8 +271,7 @@ int messageIOBuffer_byteAtPositionInBuffer_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_
 }
 
 /** @brief This method will handle a retransmission of a message in a specific
- *         slot. It will increase the "age" of all messages by and afterwards
- *         set the age of the specific message to 1.
+ *         slot. The message becomes the newest one.
  *  @param *buffer Pointer to the MIOB
  *  @param slotId The ID of the slot you want to edit
  *  @param time The actual time (to reset the timeout-timer)
@@ -141,29 +279,21 @@ int messageIOBuffer_byteAtPositionInBuffer_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_
  *  @return TRUE if it was successful, FALSE else
  */
 bool messageIOBuffer_setValuesRetransmit_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer,  uint32_t slotId, uint32_t time, uint32_t timeoutTime){
-  if (buffer->slotCount < slotId){
+  if (buffer->slotCount <= slotId){
     return FALSE;
   }
   
-  uint32_t counter = 0;
+  // Move it behind the newest message
+  messageIOBuffer_unlinkSlot(buffer, slotId);
+  messageIOBuffer_linkSlot(buffer, slotId);
   
-  while(counter < buffer->slotCount){
-
-    if (buffer->slot[counter].valid == TRUE){
-      buffer->slot[counter].age += 1;
-    }
-    
-    counter++;
-  }
-  
-  buffer->slot[slotId].valid = TRUE;
-  buffer->slot[slotId].age = 1;
   timerHandler_timerStart(&(buffer->slot[slotId].timer), time, timeoutTime);
   return TRUE;
 }
 
-/** @brief This method will validate a slot. It will increase the age of all
- *         other slots with valid messages by 1. The new message will be set to
+/** @brief This method will validate a slot. It becomes the newest message
+ *         and is listed under the command byte it holds now, so the command
+ *         byte must not change afterwards. The new message will be set to
  *         0 transmissions and have its timeout timer started.
  *  @param *buffer Pointer to the MIOB
  *  @param slotId The ID of the slot you want to edit
@@ -172,23 +302,14 @@ bool messageIOBuffer_setValuesRetransmit_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_ST
  *  @return TRUE if it was successful, FALSE else
  */
 bool messageIOBuffer_validateMessage_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer,  uint32_t slotId, uint32_t time, uint32_t timeoutTime){
-  if (buffer->slotCount < slotId){
+  if (buffer->slotCount <= slotId){
     return FALSE;
   }
   
-  uint32_t counter = 0;
-  
-  while(counter < buffer->slotCount){
-
-    if (buffer->slot[counter].valid == TRUE){
-      buffer->slot[counter].age += 1;
-    }
-    
-    counter++;
-  }
+  // A slot validated again is moved behind the newest message
+  messageIOBuffer_unlinkSlot(buffer, slotId);
+  messageIOBuffer_linkSlot(buffer, slotId);
   
-  buffer->slot[slotId].valid = TRUE;
-  buffer->slot[slotId].age = 1;
   timerHandler_timerStart(&(buffer->slot[slotId].timer), time, timeoutTime);
   buffer->slot[slotId].transmissionCount = 0;
   return TRUE;
@@ -231,16 +352,14 @@ bool messageIOBuffer_setMessageLength_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUC
   return TRUE;
 }
 
-/** @brief This method will reset the specific slot and decrease all other 
- *         message ages by 1. WARNING: YOU MIGHT GET A PROBLEM IF YOU TRY TO
- *         DELETE THE OLDEST MESSAGES AS THE NEWER ONES MIGHT TURN AROUND <0
- *         BE SURE TO KNOW WHAT YOU ARE DOING!
+/** @brief This method will reset the specific slot and unlink it, the order
+ *         of all other messages stays as it is.
  *  @param *buffer Pointer to the MIOB
  *  @param slotId The ID of the slot you want to delete
  *  @return TRUE if it worked, FALSE else
  */
 bool messageIOBuffer_deleteMessage_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer,  uint32_t slotId){
-  if (buffer->slotCount < slotId){
+  if (buffer->slotCount <= slotId){
     return FALSE;
   }
   
@@ -248,23 +367,14 @@ bool messageIOBuffer_deleteMessage_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_T
     return FALSE;
   }
   
-  uint32_t counter = 0;
-  
-  while(counter < buffer->slotCount){
-    if (buffer->slot[counter].age > buffer->slot[slotId].age){
-      buffer->slot[counter].age -= 1;
-    }
-    
-    counter++;
-  }
-  
+  messageIOBuffer_unlinkSlot(buffer, slotId);
   messageIOBuffer_resetSlot(&buffer->slot[slotId]);
   
   return TRUE;
 }
 
-/** @brief This method will reset the slot with the highest age. It will NOT
- *         touch other messages!
+/** @brief This method will reset the oldest slot. It will NOT touch other
+ *         messages!
  *  @param *buffer Pointer to the MIOB
  *  @return TRUE if it worked, FALSE else
  */
@@ -272,6 +382,7 @@ bool messageIOBuffer_deleteMessage_oldest(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYP
   int32_t temp = messageIOBuffer_getSlotIdOldestElement(buffer);
   
   if (temp >= 0){
+    messageIOBuffer_unlinkSlot(buffer, temp);
     messageIOBuffer_resetSlot(&buffer->slot[temp]);
     return TRUE;
   }
@@ -361,19 +472,10 @@ int32_t messageIOBuffer_resetMessageTimeout_bySlotID(MESSAGE_INPUT_OUTPUT_BUFFER
  *  @return -1 if there is no valid slot, slotID else.
  */
 int32_t messageIOBuffer_getSlotIdOldestElement(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer){
-  uint32_t counter = 0;
-  int32_t temp = 0;
-  int32_t retVal = -1;
-  
-  while (counter < buffer->slotCount){
-    if (buffer->slot[counter].age > temp){
-      temp = buffer->slot[counter].age;
-      retVal = counter;
-    }
-    
-    counter++;
+  if (buffer->oldestSlot == MESSAGE_IO_BUFFER_NO_SLOT){
+    return -1;
   }
-  return retVal;
+  return buffer->oldestSlot;
 }
 
 /** @brief This method will increase the transmission count of a message by 1.
@@ -410,20 +512,18 @@ bool messageIOBuffer_isSlotValid_bySlotID(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYP
  *  @return >= 0 for a free slot, -1 if full
  */
 int32_t messageIOBuffer_getFreeSlot(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer){
-  uint32_t temp = 0;
+  uint32_t lowestFree = buffer->freeSlots & (~buffer->freeSlots + 1);
   
-  while(temp < buffer->slotCount){
-    if (buffer->slot[temp].valid == FALSE){
-      return temp;
-    }
-    
-    temp += 1;
+  if (lowestFree == 0){
+    return MESSAGE_IO_BUFFER_EOF;
   }
   
-  return MESSAGE_IO_BUFFER_EOF;
+  // The lowest free slot, as it was found by a scan from slot 0 on
+  return messageIOBuffer_bitPosition[(lowestFree * 0x077CB531UL) >> 27];
 }
 
-/** @brief This method will clear all the slots.
+/** @brief This method will clear all the slots and set up the free slots and
+ *         the lists. Call it once the slots are assigned, before the first use.
  *  @param *buffer Pointer to the MIOB
  *  @return Nothing
  */
@@ -434,23 +534,22 @@ void messageIOBuffer_clearAllSlots(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *b
     messageIOBuffer_resetSlot(&buffer->slot[counter]);
     counter += 1;
   }
+  
+  if (buffer->slotCount >= MESSAGE_IO_BUFFER_MAX_SLOTCOUNT){
+    buffer->freeSlots = 0xFFFFFFFF;
+  }else{
+    buffer->freeSlots = (((uint32_t) 1) << buffer->slotCount) - 1;
+  }
+  buffer->usedSlots = 0;
+  buffer->oldestSlot = MESSAGE_IO_BUFFER_NO_SLOT;
+  memset(buffer->oldestSlotWithCommand, MESSAGE_IO_BUFFER_NO_SLOT, sizeof(buffer->oldestSlotWithCommand));
 }
 
 /** @brief This method will return the count of used messages
  *  @return The count of used slots.
  */
 uint32_t messageIOBuffer_countOfSlotsUsed(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer){
-  uint32_t counter = 0;
-  uint32_t temp = 0;
-  
-  while(counter < buffer->slotCount){
-    if (buffer->slot[counter].valid == TRUE){
-      temp += 1;
-    }
-    
-    counter += 1;
-  }
-  return temp;
+  return buffer->usedSlots;
 }
 
 /** @brief This method check the MIOB whether there is a message with a specific
@@ -460,44 +559,23 @@ uint32_t messageIOBuffer_countOfSlotsUsed(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYP
  *  @return TRUE == there is at least 1, FALSE if there is none
  */
 bool messageIOBuffer_doesMessageWithCommandExist(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint8_t cmd){
-  uint32_t counter = 0;
-   
-  while(counter < buffer->slotCount){
-    if (buffer->slot[counter].valid == TRUE){
-      if (buffer->slot[counter].buffer[UART_PACKAGE_POSITION_CMD_BYTE] == cmd){
-        return TRUE;
-      }
-    }
-    counter += 1;
+  if (buffer->oldestSlotWithCommand[cmd] == MESSAGE_IO_BUFFER_NO_SLOT){
+    return FALSE;
   }
-  
-  return FALSE;
+  return TRUE;
 }
 
-/** @brief This method reset the timer for the given Slot-ID.
- *         It will check if the message slot is valid and active!
+/** @brief This method will return the id of the oldest slot with a specific
+ *         command byte.
  *  @param *buffer Pointer to the MIOB
- *  @param slotId The slot ID you want to modify
- *  @param time The actual time
- *  @return -1 if not valid, transmissionCount else (count of transmissions)
+ *  @param cmd The cmd you want to check for
+ *  @return -1 if there is no such message, slotID else
  */
 int32_t messageIOBuffer_getOldestSlotWithCommand(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint8_t cmd){
-  int32_t temp = -1;
-  uint32_t counter = 0;
-  int32_t age = 0;
-  
-  while(counter < buffer->slotCount){
-    if (buffer->slot[counter].buffer[UART_PACKAGE_POSITION_CMD_BYTE] == cmd){
-      if (buffer->slot[counter].age > age){
-        temp = counter;
-        age = buffer->slot[counter].age;
-      }
-    }
-    
-    counter++;
+  if (buffer->oldestSlotWithCommand[cmd] == MESSAGE_IO_BUFFER_NO_SLOT){
+    return -1;
   }
-  
-  return temp;
+  return buffer->oldestSlotWithCommand[cmd];
 }
 
 /** @brief This method will return the pointer to the buffer of the MIOB slot
@@ -517,53 +595,42 @@ uint8_t* messageIOBuffer_getBuffer_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_T
  *  @return -1 if there is no message at all, >= 0 else
  */
 int32_t messageIOBuffer_getSlotIdNewestMessage(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer){
-  int32_t counter = 0;
-  uint32_t temp = 0xFFFFFFFF;
-  int32_t retVal = -1;
-  
-  while(counter < buffer->slotCount){
-    if (buffer->slot[counter].valid == TRUE){
-      if (buffer->slot[counter].age < temp){
-        retVal = counter;
-        temp = buffer->slot[counter].age;
-      }
-    }
-    
-    counter += 1;
+  if (buffer->oldestSlot == MESSAGE_IO_BUFFER_NO_SLOT){
+    return -1;
   }
-  
-  return retVal;
+  // The age list is circular, the newest is right in front of the oldest
+  return buffer->slot[buffer->oldestSlot].older[MESSAGE_IO_BUFFER_LIST_AGE];
 }
 
 #if TEST_MESSAGEIOBUFFER >= 1
 
+/** \brief messageIOBuffer_testSlots The slots of the test, their timers have
+  *        to be stopped before they are left behind.
+  */
+static BUFFER_STRUCT_TYPEDEF messageIOBuffer_testSlots[MESSAGEIOBUFFER_TEST_SLOTCOUNT];
+
 void messageIOBuffer_slotInit(BUFFER_STRUCT_TYPEDEF *slot, uint8_t *buffer){
-  slot->transmissionCount = 0;
-  slot->usedLength = 0;
+  messageIOBuffer_resetSlot(slot);
   slot->buffer = buffer;
-  slot->age = 0;
-  slot->valid = FALSE;
 }
 
 void messageIOBuffer_reset(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *miob){
   miob->maxBufferLength = MESSAGEIOBUFFER_TEST_BUFFERSIZE;
   miob->slotCount = MESSAGEIOBUFFER_TEST_SLOTCOUNT;
-  for (int i = 0; i < MESSAGEIOBUFFER_TEST_SLOTCOUNT; i++){
-    miob->slot[i].transmissionCount = 0;
-    miob->slot[i].usedLength = 0;
-    miob->slot[i].age = 0;
-    miob->slot[i].valid = FALSE;
-  }
+  messageIOBuffer_clearAllSlots(miob);
 }
 
 int messageIOBuffer_testsuiteReturner(int retVal){
+  for (uint32_t i = 0; i < MESSAGEIOBUFFER_TEST_SLOTCOUNT; i++){
+    timerHandler_timerStop(&messageIOBuffer_testSlots[i].timer);
+  }
   return retVal;
 }
 
 int messageIOBuffer_testsuite(){
   uint32_t i;
   uint8_t bufferArrays[MESSAGEIOBUFFER_TEST_SLOTCOUNT][MESSAGEIOBUFFER_TEST_BUFFERSIZE];
-  BUFFER_STRUCT_TYPEDEF slots[MESSAGEIOBUFFER_TEST_SLOTCOUNT];
+  BUFFER_STRUCT_TYPEDEF *slots = messageIOBuffer_testSlots;
   
   for (i = 0; i < MESSAGEIOBUFFER_TEST_SLOTCOUNT; i++){
     messageIOBuffer_slotInit(&slots[i], bufferArrays[i]);
@@ -605,6 +672,11 @@ int messageIOBuffer_testsuite(){
       return messageIOBuffer_testsuiteReturner(-1);
     }
   }
+  for (i = 0; i < MESSAGEIOBUFFER_TEST_BUFFERSIZE; i++){
+    if (myBuf[i] != (uint8_t) (i & 0xFF)){
+      return messageIOBuffer_testsuiteReturner(-1);
+    }
+  }
   for (i = 0; i < MESSAGEIOBUFFER_TEST_BUFFERSIZE >> 1; i++){
     if (messageIOBuffer_addByteToBuffer_bySlotId(&miob, 5, (uint8_t) (i & 0xFF)) != TRUE){
       return messageIOBuffer_testsuiteReturner(-1);
@@ -1092,6 +1164,94 @@ int messageIOBuffer_testsuite(){
     return messageIOBuffer_testsuiteReturner(-1);
   }
   
-  return 0;
+  // Add several bytes at once: they go behind the ones already there, and
+  // nothing is added if they don't fit all
+  messageIOBuffer_clearAllSlots(&miob);
+  if (messageIOBuffer_addByteToBuffer_bySlotId(&miob, 0, 0x02) != TRUE){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if (messageIOBuffer_addBytesToBuffer_bySlotId(&miob, 0, bufferArrays[1], 3) != TRUE){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if (miob.slot[0].usedLength != 4 || bufferArrays[0][3] != bufferArrays[1][2]){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if (messageIOBuffer_addBytesToBuffer_bySlotId(&miob, 0, bufferArrays[1], MESSAGEIOBUFFER_TEST_BUFFERSIZE - 3) != FALSE){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if (miob.slot[0].usedLength != 4){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if (messageIOBuffer_addBytesToBuffer_bySlotId(&miob, MESSAGEIOBUFFER_TEST_SLOTCOUNT, bufferArrays[1], 1) != FALSE){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  
+  // Fill all slots from the last to the first, even slots hold 0x50 and odd
+  // slots 0x51, then take messages out of the middle of the lists
+  messageIOBuffer_clearAllSlots(&miob);
+  for (i = MESSAGEIOBUFFER_TEST_SLOTCOUNT; i > 0; i--){
+    if (messageIOBuffer_getFreeSlot(&miob) != 0){
+      return messageIOBuffer_testsuiteReturner(-1);
+    }
+    bufferArrays[i - 1][UART_PACKAGE_POSITION_CMD_BYTE] = 0x50 + ((i - 1) & 0x01);
+    if (messageIOBuffer_validateMessage_bySlotId(&miob, i - 1, 1000, 1000) != TRUE){
+      return messageIOBuffer_testsuiteReturner(-1);
+    }
+  }
+  if ((messageIOBuffer_getFreeSlot(&miob) != MESSAGE_IO_BUFFER_EOF) || (messageIOBuffer_countOfSlotsUsed(&miob) != MESSAGEIOBUFFER_TEST_SLOTCOUNT)){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if ((messageIOBuffer_getSlotIdOldestElement(&miob) != MESSAGEIOBUFFER_TEST_SLOTCOUNT - 1) || (messageIOBuffer_getSlotIdNewestMessage(&miob) != 0)){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  // The oldest of each command is the highest slot holding it
+  if ((messageIOBuffer_getOldestSlotWithCommand(&miob, 0x50) != (MESSAGEIOBUFFER_TEST_SLOTCOUNT - 1) - ((MESSAGEIOBUFFER_TEST_SLOTCOUNT - 1) & 0x01)) || (messageIOBuffer_getOldestSlotWithCommand(&miob, 0x51) != (MESSAGEIOBUFFER_TEST_SLOTCOUNT - 1) - (MESSAGEIOBUFFER_TEST_SLOTCOUNT & 0x01))){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  // Delete slot 4 and 5 out of the middle, they are the free ones now
+  if ((messageIOBuffer_deleteMessage_bySlotId(&miob, 4) != TRUE) || (messageIOBuffer_deleteMessage_bySlotId(&miob, 5) != TRUE)){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if ((messageIOBuffer_getFreeSlot(&miob) != 4) || (messageIOBuffer_countOfSlotsUsed(&miob) != MESSAGEIOBUFFER_TEST_SLOTCOUNT - 2)){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  // A retransmission makes the oldest message the newest one
+  if (messageIOBuffer_setValuesRetransmit_bySlotId(&miob, MESSAGEIOBUFFER_TEST_SLOTCOUNT - 1, 2000, 1000) != TRUE){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if ((messageIOBuffer_getSlotIdOldestElement(&miob) != MESSAGEIOBUFFER_TEST_SLOTCOUNT - 2) || (messageIOBuffer_getSlotIdNewestMessage(&miob) != MESSAGEIOBUFFER_TEST_SLOTCOUNT - 1)){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  // Walk down the ages: the slots come from the highest to the lowest, 4 and 5
+  // are gone and the retransmitted one comes last
+  for (i = MESSAGEIOBUFFER_TEST_SLOTCOUNT - 1; i > 0; i--){
+    if ((i - 1 == 4) || (i - 1 == 5)){
+      continue;
+    }
+    if (messageIOBuffer_getSlotIdOldestElement(&miob) != (int32_t) (i - 1)){
+      return messageIOBuffer_testsuiteReturner(-1);
+    }
+    // The oldest of its command must be the oldest of all at the same time
+    if (messageIOBuffer_getOldestSlotWithCommand(&miob, 0x50 + ((i - 1) & 0x01)) != (int32_t) (i - 1)){
+      return messageIOBuffer_testsuiteReturner(-1);
+    }
+    if (messageIOBuffer_deleteMessage_oldest(&miob) != TRUE){
+      return messageIOBuffer_testsuiteReturner(-1);
+    }
+  }
+  if ((messageIOBuffer_getSlotIdOldestElement(&miob) != MESSAGEIOBUFFER_TEST_SLOTCOUNT - 1) || (messageIOBuffer_countOfSlotsUsed(&miob) != 1)){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if (messageIOBuffer_doesMessageWithCommandExist(&miob, 0x50 + ((MESSAGEIOBUFFER_TEST_SLOTCOUNT - 2) & 0x01)) != FALSE){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if (messageIOBuffer_deleteMessage_oldest(&miob) != TRUE){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  if ((messageIOBuffer_getSlotIdOldestElement(&miob) != -1) || (messageIOBuffer_getSlotIdNewestMessage(&miob) != -1) || (messageIOBuffer_getFreeSlot(&miob) != 0)){
+    return messageIOBuffer_testsuiteReturner(-1);
+  }
+  
+  return messageIOBuffer_testsuiteReturner(0);
 }
 #endif
\ No newline at end of file
@@ -29,9 +29,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 003       | 2020-06-16    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Added messageIOBuffer_addBytesToBuffer        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | O(1) slots by free bitmap and linked lists    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -49,6 +49,26 @@
 
 /* Typedefinitions */
 
+/**
+ * @brief       The valid slots are chained into two lists, both ordered from
+ *              the oldest to the newest message:
+ *              MESSAGE_IO_BUFFER_LIST_AGE = All valid slots
+ *              MESSAGE_IO_BUFFER_LIST_COMMAND = The valid slots with the same command byte
+ *              Both are circular, so the newest entry is found at the oldest.
+ */
+typedef enum MESSAGE_IO_BUFFER_LIST_VALUES {
+  MESSAGE_IO_BUFFER_LIST_AGE                    = 0x00,
+  MESSAGE_IO_BUFFER_LIST_COMMAND                = 0x01,
+  MESSAGE_IO_BUFFER_LIST_COUNT                  = 0x02,
+} MESSAGE_IO_BUFFER_LIST_VALUES_TYPEDEF;
+
+/** @brief Slot ID that marks the end of a list */
+#define MESSAGE_IO_BUFFER_NO_SLOT               0xFF
+/** @brief The free slots are kept in a 32 bit map */
+#define MESSAGE_IO_BUFFER_MAX_SLOTCOUNT         32
+/** @brief Count of possible command bytes */
+#define MESSAGE_IO_BUFFER_COMMAND_COUNT         256
+
 /**
  * @brief       This struct typedef is the body of a slot.
  *              It holds several thing that are needed to store and handle
@@ -59,7 +79,9 @@ typedef struct BUFFER_STRUCT {
   uint8_t transmissionCount;    /**< Counter to count the transmissions */
   uint32_t usedLength;          /**< Used length of the buffer */
   uint8_t *buffer;              /**< Pointer to the buffer to store the message */
-  uint32_t age;                 /**< The age of the message */
+  uint8_t command;              /**< The command byte the message got validated with */
+  uint8_t older[MESSAGE_IO_BUFFER_LIST_COUNT]; /**< Next older slot in each list, the oldest links to the newest */
+  uint8_t newer[MESSAGE_IO_BUFFER_LIST_COUNT]; /**< Next newer slot in each list, the newest links to the oldest */
   bool valid;                   /**< Validity flag of the message slot */
 } BUFFER_STRUCT_TYPEDEF;
 
@@ -71,6 +93,10 @@ typedef struct MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT {
   uint32_t slotCount;           /**< Count of slots in this buffer */
   uint32_t maxBufferLength;     /**< Maximum length for the buffers in the slots */
   BUFFER_STRUCT_TYPEDEF *slot;  /**< Pointer array to the slots */
+  uint32_t freeSlots;           /**< Bit n is set while slot n holds no valid message */
+  uint32_t usedSlots;           /**< Count of slots with a valid message */
+  uint8_t oldestSlot;           /**< Oldest valid slot, head of the age list */
+  uint8_t oldestSlotWithCommand[MESSAGE_IO_BUFFER_COMMAND_COUNT]; /**< Oldest valid slot per command byte, head of its command list */
 } MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF;
 
 /* Variables */
@@ -80,7 +106,8 @@ typedef struct MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT {
 
 // MESSAGE-BUFFER-SLOT->BUFFER-WIDE FUNCTIONS
 
-/** @brief This method will reset a single slot to the default values.
+/** @brief This method will reset a single slot to the default values. It does
+ *         not unlink the slot from its MIOB, use it to set up slots only.
  *  @param *slot Pointer to the slot you want to reset.
  *  @return Nothing
  */
@@ -94,6 +121,16 @@ void                    messageIOBuffer_resetSlot(BUFFER_STRUCT_TYPEDEF *slot);
  */
 bool                    messageIOBuffer_addByteToBuffer_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer,  uint32_t slotId, uint8_t byte);
 
+/** @brief This method will add several bytes to a specific slot in one step.
+ *         Nothing is added if they don't fit all.
+ *  @param *buffer Pointer to the MIOB
+ *  @param slotId The ID of the slot you want to add the bytes to
+ *  @param *bytes The bytes you want to add
+ *  @param length The count of bytes
+ *  @return TRUE if OK, FALSE else
+ */
+bool                    messageIOBuffer_addBytesToBuffer_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer,  uint32_t slotId, const uint8_t *bytes, uint32_t length);
+
 /** @brief This method will peek at a byte at the buffer within a specific slot
  *  @param *buffer Pointer to the MIOB
  *  @param slotId The ID of the slot you want to get a byte from
@@ -159,8 +196,9 @@ int32_t                 messageIOBuffer_incTransmissionCount_bySlotId(MESSAGE_IN
  */
 bool                    messageIOBuffer_isSlotValid_bySlotID(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint32_t slotId);
 
-/** @brief This method will validate a slot. It will increase the age of all
- *         other slots with valid messages by 1. The new message will be set to
+/** @brief This method will validate a slot. It becomes the newest message
+ *         and is listed under the command byte it holds now, so the command
+ *         byte must not change afterwards. The new message will be set to
  *         0 transmissions and have its timeout timer started.
  *  @param *buffer Pointer to the MIOB
  *  @param slotId The ID of the slot you want to edit
@@ -170,10 +208,8 @@ bool                    messageIOBuffer_isSlotValid_bySlotID(MESSAGE_INPUT_OUTPU
  */
 bool                    messageIOBuffer_validateMessage_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer,  uint32_t slotId, uint32_t time, uint32_t timeoutTime);
 
-/** @brief This method will reset the specific slot and decrease all other 
- *         message ages by 1. WARNING: YOU MIGHT GET A PROBLEM IF YOU TRY TO
- *         DELETE THE OLDEST MESSAGES AS THE NEWER ONES MIGHT TURN AROUND <0
- *         BE SURE TO KNOW WHAT YOU ARE DOING!
+/** @brief This method will reset the specific slot and unlink it, the order
+ *         of all other messages stays as it is.
  *  @param *buffer Pointer to the MIOB
  *  @param slotId The ID of the slot you want to delete
  *  @return TRUE if it worked, FALSE else
@@ -181,8 +217,7 @@ bool                    messageIOBuffer_validateMessage_bySlotId(MESSAGE_INPUT_O
 bool                    messageIOBuffer_deleteMessage_bySlotId(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer,  uint32_t slotId);
 
 /** @brief This method will handle a retransmission of a message in a specific
- *         slot. It will increase the "age" of all messages by and afterwards
- *         set the age of the specific message to 1.
+ *         slot. The message becomes the newest one.
  *  @param *buffer Pointer to the MIOB
  *  @param slotId The ID of the slot you want to edit
  *  @param time The actual time (to reset the timeout-timer)
@@ -207,7 +242,8 @@ uint32_t                messageIOBuffer_countOfTimeoutedMessages(MESSAGE_INPUT_O
  */
 int32_t                 messageIOBuffer_getFreeSlot(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer);
 
-/** @brief This method will clear all the slots.
+/** @brief This method will clear all the slots and set up the free slots and
+ *         the lists. Call it once the slots are assigned, before the first use.
  *  @param *buffer Pointer to the MIOB
  *  @return Nothing
  */
@@ -218,8 +254,8 @@ void                    messageIOBuffer_clearAllSlots(MESSAGE_INPUT_OUTPUT_BUFFE
  */
 uint32_t                messageIOBuffer_countOfSlotsUsed(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer);
 
-/** @brief This method will reset the slot with the highest age. It will NOT
- *         touch other messages!
+/** @brief This method will reset the oldest slot. It will NOT touch other
+ *         messages!
  *  @param *buffer Pointer to the MIOB
  *  @return TRUE if it worked, FALSE else
  */
@@ -245,12 +281,11 @@ int32_t                 messageIOBuffer_getSlotIdOldestElement(MESSAGE_INPUT_OUT
  */
 bool                    messageIOBuffer_doesMessageWithCommandExist(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint8_t cmd);
 
-/** @brief This method reset the timer for the given Slot-ID.
- *         It will check if the message slot is valid and active!
+/** @brief This method will return the id of the oldest slot with a specific
+ *         command byte.
  *  @param *buffer Pointer to the MIOB
- *  @param slotId The slot ID you want to modify
- *  @param time The actual time
- *  @return -1 if not valid, transmissionCount else (count of transmissions)
+ *  @param cmd The cmd you want to check for
+ *  @return -1 if there is no such message, slotID else
  */
 int32_t                 messageIOBuffer_getOldestSlotWithCommand(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buffer, uint8_t cmd);
 
@@ -27,11 +27,19 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-17    | Tim Steinberg         | Sequenced framing, cumulative/selective ACK   |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-17    | Tim Steinberg         | Tests follow the bulk resync of the parser    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Handle frames in place, store only new ones   |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | M/C/D check by the descriptor table           |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Set up the MIOB lists on reset                |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 008       | 2026-10-18    | Tim Steinberg         | Measure round trips, back off retransmissions |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 009       | 2026-10-18    | Tim Steinberg         | Output timers start at the end of the frames  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -47,6 +55,7 @@
 #include "MessageIOBuffer.h"
 #include "UserMethods_UART.h"
 #include "Handler_NAK_Transmission.h"
+#include "Handler_RTT.h"
 #include "CRC_Software.h"
 #include "ValidMessages.h"
 #include "Logic.h"
@@ -76,9 +85,32 @@ MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF messageOutputBuffer;
 /** *@brief Buffer for the ACK message */
 uint8_t msgACK[4] = {UART_TRANSMISSION_MAGIC, UART_MSG_CMD_PACK_REC_ACK, 0x00, 0xAA ^ UART_TRANSMISSION_MAGIC ^ UART_MSG_CMD_PACK_REC_ACK};
 
+/** *@brief The framing used for transmissions */
+LOGIC_FRAMING_MODE_VALUES_TYPEDEF logicFramingMode = LOGIC_FRAMING_MODE_STOP_AND_WAIT;
+/** *@brief Sequence number of the next transmitted frame */
+uint8_t logicTxSequence = 0;
+/** *@brief Sequence number of the next expected frame */
+uint8_t logicRxSequence = 0;
+/** *@brief Frames received beyond logicRxSequence, bit 0 is logicRxSequence + 1 */
+uint8_t logicRxSelective = 0;
+/** *@brief The UART frame of each output slot whose end is not known yet */
+uint32_t logicTxFrame[LOGIC_MOB_SLOTCOUNT];
+/** *@brief Is the end of the output slot's UART frame not known yet? */
+bool logicTxFramePending[LOGIC_MOB_SLOTCOUNT];
+
 /* Function prototypes */
 void logic_slotInit(BUFFER_STRUCT_TYPEDEF *slot, uint8_t *buffer);
 uint32_t logic_getSlotOfCommand(MESSAGE_INPUT_OUTPUT_BUFFER_STRUCT_TYPEDEF *buf, uint8_t cmd, bool *found);
+uint8_t logic_getSequenceOfFrame(uint8_t *frame);
+uint32_t logic_getSlotOfSequence_outputBuffer(uint8_t sequence, bool *found);
+void logic_acknowledgeUpTo(uint8_t sequence, uint32_t time);
+void logic_sampleRoundTrip(uint32_t slotId, uint32_t time);
+void logic_frameQueued(uint32_t slotId);
+void logic_handleFrameEnds(void);
+void logic_transmitSequencedAck(void);
+bool logic_storeFrame(uint32_t time, PARSER_FRAME_STRUCT_TYPEDEF *frame);
+LOGIC_RETURN_VALUES_TYPEDEF logic_handleFrame(uint32_t time, PARSER_FRAME_STRUCT_TYPEDEF *frame);
+LOGIC_RETURN_VALUES_TYPEDEF logic_handleSequencedFrame(uint32_t time, PARSER_FRAME_STRUCT_TYPEDEF *frame);
 
 
 /* Function definitions */
@@ -118,6 +150,7 @@ void logic_reset(){
     logic_slotInit(&slotsInput[i], &bufferArraysInput[i][0]);
     messageInputBuffer.slot = slotsInput;
   }
+  messageIOBuffer_clearAllSlots(&messageInputBuffer);
   
   messageOutputBuffer.slotCount = LOGIC_MOB_SLOTCOUNT;
   messageOutputBuffer.maxBufferLength = LOGIC_MOB_BUFFERSIZE;
@@ -125,7 +158,9 @@ void logic_reset(){
   for (int i = 0; i < LOGIC_MOB_SLOTCOUNT; i++){
     logic_slotInit(&slotsOutput[i], &bufferArraysOutput[i][0]);
     messageOutputBuffer.slot = slotsOutput;
+    logicTxFramePending[i] = FALSE;
   }
+  messageIOBuffer_clearAllSlots(&messageOutputBuffer);
 }
 
 /** @brief This method will count all timed out slots of the output buffer
@@ -136,6 +171,7 @@ uint32_t logic_countOfTimeouts(uint32_t time){
   uint32_t counterSlots = 0;
   uint32_t counterTimeouts = 0;
   
+  logic_handleFrameEnds();
   while(counterSlots < messageIOBuffer_getSlotCount(&messageOutputBuffer)){
     if (messageIOBuffer_isSlotTimedOut_bySlotId(&messageOutputBuffer, counterSlots, time) == TRUE){
       counterTimeouts++;
@@ -146,7 +182,8 @@ uint32_t logic_countOfTimeouts(uint32_t time){
   return counterTimeouts;
 }
 
-/** @brief This method will handle all timeouts (by retransmitting them)
+/** @brief This method will handle all timeouts (by retransmitting them). Every
+ *         retransmission waits twice as long as the transmission before.
  *  @param time The actual time
  *  @return TRUE if all could be handled
  *  @return FALSE if there is a retransmit-overflow, meaning too often no ACK
@@ -155,6 +192,7 @@ bool logic_handleTimeouts(uint32_t time){
   uint32_t counterSlots = 0;
   uint32_t transmissionCount;
   
+  logic_handleFrameEnds();
   while(counterSlots < messageIOBuffer_getSlotCount(&messageOutputBuffer)){
     if (messageIOBuffer_isSlotTimedOut_bySlotId(&messageOutputBuffer, counterSlots, time) == FALSE){
       counterSlots++;
@@ -169,8 +207,9 @@ bool logic_handleTimeouts(uint32_t time){
         messageIOBuffer_getMessageLength_bySlotId(&messageOutputBuffer, counterSlots), 
         messageIOBuffer_getBuffer_bySlotId(&messageOutputBuffer, counterSlots)
       );
-      // Reset the timer
-      messageIOBuffer_setValuesRetransmit_bySlotId(&messageOutputBuffer, counterSlots, time, messageOutputBuffer.slot[counterSlots].timer.time_waitTime);
+      // Reset the timer, backed off
+      messageIOBuffer_setValuesRetransmit_bySlotId(&messageOutputBuffer, counterSlots, time, handlerRTT_getBackoffTimeout(messageOutputBuffer.slot[counterSlots].timer.time_waitTime));
+      logic_frameQueued(counterSlots);
     }else{
       return FALSE;
     }
@@ -187,16 +226,13 @@ bool logic_handleTimeouts(uint32_t time){
  *  @return Take a look at typedef enum LOGIC_RETURN_VALUES.
  */
 LOGIC_RETURN_VALUES_TYPEDEF logic_parseNachricht(uint32_t time){
-  int32_t temp = messageIOBuffer_getFreeSlot(&messageInputBuffer);
+  PARSER_FRAME_STRUCT_TYPEDEF frame;
   PARSER_RETURN_VALUES_TYPEDEF returnValueParser;
-  uint32_t slotIdOldestElement;
-  uint32_t transmissionLength;
+  LOGIC_RETURN_VALUES_TYPEDEF returnValue;
   
-  if (temp < 0){
-    return LOGIC_RETURN_CRITICAL_ERROR;
-  }
-  
-  returnValueParser = parser_parseMessage(time, &messageInputBuffer, temp);
+  // An ACK must find the timers started at the end of the transmissions
+  logic_handleFrameEnds();
+  returnValueParser = parser_parseFrame(time, &frame);
   
   switch(returnValueParser){
     case PARSER_RETURN_TOO_LESS_BYTES:
@@ -226,38 +262,11 @@ LOGIC_RETURN_VALUES_TYPEDEF logic_parseNachricht(uint32_t time){
       
     case PARSER_RETURN_MESSAGE_SUCCESSFULLY_RECEPTED:
       handlerNAK_resetCounter();
-      switch(messageIOBuffer_getBuffer_bySlotId(&messageInputBuffer, temp)[UART_PACKAGE_POSITION_CMD_BYTE]){
-        case UART_MSG_CMD_PACK_REC_ACK:
-          TRACE_IO_VALUES(1, "LOGIC->UART_MSG_CMD_PACK_REC_ACK\r\n"); 
-          // was there an oldest message? if not, then this ACK came without any reason
-          if (messageIOBuffer_deleteMessage_oldest(&messageOutputBuffer) == FALSE){
-            return LOGIC_RETURN_CRITICAL_ERROR;
-          }
-          messageIOBuffer_deleteMessage_bySlotId(&messageInputBuffer, temp);
-          return LOGIC_RETURN_NOTHING;
-          break;
-          
-        case UART_MSG_CMD_PACK_REC_NAK:
-          TRACE_IO_VALUES(1, "LOGIC->UART_MSG_CMD_PACK_REC_NAK\r\n"); 
-          slotIdOldestElement = messageIOBuffer_getSlotIdOldestElement(&messageOutputBuffer);
-          messageIOBuffer_resetMessageTimeout_bySlotID(&messageOutputBuffer, slotIdOldestElement, time);
-          if (messageIOBuffer_incTransmissionCount_bySlotId(&messageOutputBuffer, slotIdOldestElement) >= 3){
-            return LOGIC_RETURN_CRITICAL_ERROR;
-          }
-          transmissionLength = userMethods_uartTransmit(messageIOBuffer_getMessageLength_bySlotId(&messageOutputBuffer, slotIdOldestElement), messageIOBuffer_getBuffer_bySlotId(&messageOutputBuffer, slotIdOldestElement));
-          if (transmissionLength != messageIOBuffer_getMessageLength_bySlotId(&messageOutputBuffer, slotIdOldestElement)){
-            return LOGIC_RETURN_CRITICAL_ERROR;
-          }
-          return LOGIC_RETURN_NOTHING;
-          break;
-          
-        default:
-          TRACE_IO_VALUES(1, "LOGIC->LOGIC_RETURN_NEW_MESSAGE\r\n");
-          userMethods_uartTransmit(4, msgACK);
-          return LOGIC_RETURN_NEW_MESSAGE; 
-          break;
-          
-      }
+      // The frame is handled where it lies in the ringbuffer. Only the ones
+      // for the upper layer are copied into the input buffer
+      returnValue = logic_handleFrame(time, &frame);
+      parser_releaseFrame(&frame);
+      return returnValue;
       break;
   }
   
@@ -265,6 +274,76 @@ LOGIC_RETURN_VALUES_TYPEDEF logic_parseNachricht(uint32_t time){
   return LOGIC_RETURN_CRITICAL_ERROR;
 }
 
+/** @brief This method will copy a received frame into a free slot of the input
+ *         buffer, for the upper layer to take it from there
+ *  @param time The actual time
+ *  @param *frame The frame in the ringbuffer
+ *  @return TRUE if OK, FALSE if there is no free slot.
+ */
+bool logic_storeFrame(uint32_t time, PARSER_FRAME_STRUCT_TYPEDEF *frame){
+  int32_t temp = messageIOBuffer_getFreeSlot(&messageInputBuffer);
+  
+  if (temp < 0){
+    return FALSE;
+  }
+  return parser_storeFrame(frame, time, &messageInputBuffer, (uint32_t) temp);
+}
+
+/** @brief This method will handle a received frame: clear the output frame
+ *         upon ACK, retransmit upon NAK and ACK the data frames
+ *  @param time The actual time
+ *  @param *frame The frame in the ringbuffer
+ *  @return Take a look at typedef enum LOGIC_RETURN_VALUES.
+ */
+LOGIC_RETURN_VALUES_TYPEDEF logic_handleFrame(uint32_t time, PARSER_FRAME_STRUCT_TYPEDEF *frame){
+  uint32_t slotIdOldestElement;
+  uint32_t transmissionLength;
+  
+  // Does the frame carry a sequence number?
+  if (parser_frameByte(frame, 0) == UART_AWAITING_MAGIC_SEQUENCED){
+    // Yes
+    return logic_handleSequencedFrame(time, frame);
+  }
+  switch(parser_frameByte(frame, UART_PACKAGE_POSITION_CMD_BYTE)){
+    case UART_MSG_CMD_PACK_REC_ACK:
+      TRACE_IO_VALUES(1, "LOGIC->UART_MSG_CMD_PACK_REC_ACK\r\n"); 
+      if (messageIOBuffer_countOfSlotsUsed(&messageOutputBuffer) > 0){
+        logic_sampleRoundTrip(messageIOBuffer_getSlotIdOldestElement(&messageOutputBuffer), time);
+      }
+      // was there an oldest message? if not, then this ACK came without any reason
+      if (messageIOBuffer_deleteMessage_oldest(&messageOutputBuffer) == FALSE){
+        return LOGIC_RETURN_CRITICAL_ERROR;
+      }
+      return LOGIC_RETURN_NOTHING;
+      break;
+      
+    case UART_MSG_CMD_PACK_REC_NAK:
+      TRACE_IO_VALUES(1, "LOGIC->UART_MSG_CMD_PACK_REC_NAK\r\n"); 
+      slotIdOldestElement = messageIOBuffer_getSlotIdOldestElement(&messageOutputBuffer);
+      messageIOBuffer_resetMessageTimeout_bySlotID(&messageOutputBuffer, slotIdOldestElement, time);
+      if (messageIOBuffer_incTransmissionCount_bySlotId(&messageOutputBuffer, slotIdOldestElement) >= 3){
+        return LOGIC_RETURN_CRITICAL_ERROR;
+      }
+      transmissionLength = userMethods_uartTransmit(messageIOBuffer_getMessageLength_bySlotId(&messageOutputBuffer, slotIdOldestElement), messageIOBuffer_getBuffer_bySlotId(&messageOutputBuffer, slotIdOldestElement));
+      if (transmissionLength != messageIOBuffer_getMessageLength_bySlotId(&messageOutputBuffer, slotIdOldestElement)){
+        return LOGIC_RETURN_CRITICAL_ERROR;
+      }
+      logic_frameQueued(slotIdOldestElement);
+      return LOGIC_RETURN_NOTHING;
+      break;
+      
+    default:
+      TRACE_IO_VALUES(1, "LOGIC->LOGIC_RETURN_NEW_MESSAGE\r\n");
+      // The upper layer takes it from the input buffer
+      if (logic_storeFrame(time, frame) == FALSE){
+        return LOGIC_RETURN_CRITICAL_ERROR;
+      }
+      userMethods_uartTransmit(4, msgACK);
+      return LOGIC_RETURN_NEW_MESSAGE; 
+      break;
+  }
+}
+
 /** @brief This method will see if the M/C/D bytes of your message are OK
  *  @param magicByte The byte containing your magic
  *  @param cmdByte The byte containing your command
@@ -274,24 +353,10 @@ LOGIC_RETURN_VALUES_TYPEDEF logic_parseNachricht(uint32_t time){
 bool logic_areMCDBytesValid(uint8_t magicByte, uint8_t cmdByte, uint8_t dataLengthByte){
   bool retVal = FALSE;
   
-  uint32_t colcount     = messageParamValidity_transmission_getColCount();
-  uint32_t rowcount     = messageParamValidity_transmission_getRowCount();
-  uint8_t **bufPtr      = messageParamValidity_transmission_getPointerToBuffer();
-  uint32_t mover;
-  
   if (magicByte == (uint8_t) UART_TRANSMISSION_MAGIC){
-    for (uint32_t i = (uint32_t) 0; i < rowcount; i++){
-      mover = i * colcount;
-      if (((uint8_t*) bufPtr)[mover] == cmdByte){
-        /* It is contained*/ 
-        
-        /* Check if the data length is in the correct interval as well */
-        if ((dataLengthByte >= ((uint8_t*) bufPtr)[mover + 1]) && (dataLengthByte <= ((uint8_t*) bufPtr)[mover + 2])){
-          /* It is correct */
-          retVal = TRUE;
-          break;
-        }
-      }
+    // The CMD-Byte indexes its descriptor directly
+    if (messageParamValidity_isValid(MESSAGE_DESCRIPTOR_FLAG_TRANSMISSION, cmdByte, dataLengthByte) != 0){
+      retVal = TRUE;
     }
   }
   
@@ -325,13 +390,22 @@ LOGIC_RETURN_VALUES_TYPEDEF logic_transmitMessage(uint8_t cmd, uint32_t lengthPa
     return LOGIC_RETURN_CRITICAL_ERROR;
   }
   
-  messageIOBuffer_addByteToBuffer_bySlotId(&messageOutputBuffer, temp, UART_TRANSMISSION_MAGIC);
+  if (logicFramingMode == LOGIC_FRAMING_MODE_SEQUENCED){
+    messageIOBuffer_addByteToBuffer_bySlotId(&messageOutputBuffer, temp, UART_TRANSMISSION_MAGIC_SEQUENCED);
+  }else{
+    messageIOBuffer_addByteToBuffer_bySlotId(&messageOutputBuffer, temp, UART_TRANSMISSION_MAGIC);
+  }
   messageIOBuffer_addByteToBuffer_bySlotId(&messageOutputBuffer, temp, cmd);
   messageIOBuffer_addByteToBuffer_bySlotId(&messageOutputBuffer, temp, length);
   for (uint32_t i = (uint32_t) 0; i < length; i++){
     messageIOBuffer_addByteToBuffer_bySlotId(&messageOutputBuffer, temp, param[i]);
   }
   buildLength = UART_PACKAGE_HEADER_SIZE + UART_PACKAGE_DATA_SIZE + length;
+  if (logicFramingMode == LOGIC_FRAMING_MODE_SEQUENCED){
+    messageIOBuffer_addByteToBuffer_bySlotId(&messageOutputBuffer, temp, logicTxSequence);
+    logicTxSequence++;
+    buildLength = buildLength + UART_PACKAGE_SEQUENCE_SIZE;
+  }
   messageIOBuffer_addByteToBuffer_bySlotId(&messageOutputBuffer, temp, 
     CRC_Software_buildCRC(
       messageIOBuffer_getBuffer_bySlotId(&messageOutputBuffer, temp), 
@@ -347,6 +421,7 @@ LOGIC_RETURN_VALUES_TYPEDEF logic_transmitMessage(uint8_t cmd, uint32_t lengthPa
   }
   
   messageIOBuffer_validateMessage_bySlotId(&messageOutputBuffer, temp, time, timeoutTime);
+  logic_frameQueued(temp);
   
   return LOGIC_RETURN_MESSAGE_SENT;
 }
@@ -365,6 +440,247 @@ void logic_resetEverything(){
   userMethods_startReception();
 }
 
+/** @brief This method will set the framing of the transmitted messages and
+ *         restart the sequence numbers on both directions. The sequence
+ *         numbers belong to the link, logic_resetEverything keeps them.
+ *  @param mode The framing to use
+ *  @return Nothing.
+ */
+void logic_setFramingMode(LOGIC_FRAMING_MODE_VALUES_TYPEDEF mode){
+  logicFramingMode = mode;
+  logicTxSequence = 0;
+  logicRxSequence = 0;
+  logicRxSelective = 0;
+}
+
+/** @brief This method will return the sequence number of a sequenced frame
+ *  @param *frame Pointer to the frame
+ *  @return The sequence number, it sits between the data and the CRC.
+ */
+uint8_t logic_getSequenceOfFrame(uint8_t *frame){
+  return frame[UART_PACKAGE_POSITION_FIRST_PARAM_BYTE + frame[UART_PACKAGE_POSITION_DATA_LENGTH_BYTE]];
+}
+
+/** @brief This method will look for the output slot holding the frame with
+ *         the given sequence number
+ *  @param sequence The sequence number
+ *  @param *found The pointer to a bool where the function can put the result
+ *  @return The slotID, found tells you if it is valid
+ */
+uint32_t logic_getSlotOfSequence_outputBuffer(uint8_t sequence, bool *found){
+  uint32_t slotId;
+  uint8_t *frame;
+  
+  *found = FALSE;
+  for (slotId = 0; slotId < messageIOBuffer_getSlotCount(&messageOutputBuffer); slotId++){
+    if (messageOutputBuffer.slot[slotId].valid == FALSE){
+      continue;
+    }
+    frame = messageIOBuffer_getBuffer_bySlotId(&messageOutputBuffer, slotId);
+    if ((frame[0] == UART_TRANSMISSION_MAGIC_SEQUENCED) && (logic_getSequenceOfFrame(frame) == sequence)){
+      *found = TRUE;
+      return slotId;
+    }
+  }
+  return 0;
+}
+
+/** @brief This method will clear all output frames up to and including the
+ *         given sequence number (cumulative ACK)
+ *  @param sequence The sequence number of the last frame the peer got in order
+ *  @param time The actual time
+ *  @return Nothing.
+ */
+void logic_acknowledgeUpTo(uint8_t sequence, uint32_t time){
+  uint32_t slotId;
+  uint8_t *frame;
+  
+  for (slotId = 0; slotId < messageIOBuffer_getSlotCount(&messageOutputBuffer); slotId++){
+    if (messageOutputBuffer.slot[slotId].valid == FALSE){
+      continue;
+    }
+    frame = messageIOBuffer_getBuffer_bySlotId(&messageOutputBuffer, slotId);
+    if (frame[0] != UART_TRANSMISSION_MAGIC_SEQUENCED){
+      continue;
+    }
+    // Is the frame at or before the acknowledged one (modulo 256)?
+    if ((uint8_t) (sequence - logic_getSequenceOfFrame(frame)) < 0x80){
+      // Yes, only the named frame was ACKed right now, the ones before maybe long ago
+      if (logic_getSequenceOfFrame(frame) == sequence){
+        logic_sampleRoundTrip(slotId, time);
+      }
+      messageIOBuffer_deleteMessage_bySlotId(&messageOutputBuffer, slotId);
+    }
+  }
+}
+
+/** @brief This method will measure the round trip of an ACKed output frame.
+ *         Retransmitted frames are left out, their ACK can belong to any of
+ *         their transmissions.
+ *  @param slotId The slot of the ACKed frame
+ *  @param time The actual time
+ *  @return Nothing.
+ */
+void logic_sampleRoundTrip(uint32_t slotId, uint32_t time){
+  if (messageOutputBuffer.slot[slotId].transmissionCount == 0){
+    handlerRTT_sample(HANDLER_RTT_CLASS_LINK, messageOutputBuffer.slot[slotId].timer.time_startTime, time);
+  }
+}
+
+/** @brief This method will note the UART frame just queued for an output
+ *         slot. Its timer runs from the queueing until the frame left.
+ *  @param slotId The slot of the frame
+ *  @return Nothing.
+ */
+void logic_frameQueued(uint32_t slotId){
+  logicTxFrame[slotId] = userMethods_uartGetLastFrame();
+  logicTxFramePending[slotId] = TRUE;
+}
+
+/** @brief This method will restart the timers of the output slots whose
+ *         frames left the UART by now, from the tick they left. So neither a
+ *         queue in front of them nor the transmission itself counts to the
+ *         timeout and the round trip.
+ *  @return Nothing.
+ */
+void logic_handleFrameEnds(void){
+  uint32_t slotId;
+  uint32_t frameEnd;
+  
+  for (slotId = 0; slotId < LOGIC_MOB_SLOTCOUNT; slotId++){
+    if (logicTxFramePending[slotId] == FALSE){
+      continue;
+    }
+    // Was the slot ACKed in the meantime?
+    if (messageOutputBuffer.slot[slotId].valid == FALSE){
+      // Yes
+      logicTxFramePending[slotId] = FALSE;
+      continue;
+    }
+    frameEnd = messageOutputBuffer.slot[slotId].timer.time_startTime;
+    if (userMethods_uartGetFrameEnd(logicTxFrame[slotId], &frameEnd) == TRUE){
+      timerHandler_timerRestart(&(messageOutputBuffer.slot[slotId].timer), frameEnd);
+      logicTxFramePending[slotId] = FALSE;
+    }
+  }
+}
+
+/** @brief This method will transmit the ACK for the received sequenced
+ *         frames. It is a selective ACK as long as there is a gap.
+ *  @return Nothing.
+ */
+void logic_transmitSequencedAck(void){
+  uint8_t frame[UART_PACKAGE_HEADER_SIZE + UART_PACKAGE_DATA_SIZE + 1 + UART_PACKAGE_SEQUENCE_SIZE + UART_PACKAGE_CRC_SIZE];
+  uint32_t length = 0;
+  
+  frame[length++] = UART_TRANSMISSION_MAGIC_SEQUENCED;
+  if (logicRxSelective == 0){
+    frame[length++] = UART_MSG_CMD_PACK_REC_ACK;
+    frame[length++] = 0x00;
+  }else{
+    frame[length++] = UART_MSG_CMD_PACK_REC_SACK;
+    frame[length++] = 0x01;
+    frame[length++] = logicRxSelective;
+  }
+  // The last frame received in order
+  frame[length++] = (uint8_t) (logicRxSequence - 1);
+  frame[length] = CRC_Software_buildCRC(frame, length);
+  length++;
+  userMethods_uartTransmit(length, frame);
+}
+
+/** @brief This method will handle a received frame with sequence number: 
+ *         clear the ACKed output frames, retransmit upon NAK, drop
+ *         duplicates and ACK the data frames
+ *  @param time The actual time
+ *  @param *frame The frame in the ringbuffer
+ *  @return Take a look at typedef enum LOGIC_RETURN_VALUES.
+ */
+LOGIC_RETURN_VALUES_TYPEDEF logic_handleSequencedFrame(uint32_t time, PARSER_FRAME_STRUCT_TYPEDEF *frame){
+  // The sequence number sits between the data and the CRC
+  uint8_t sequence = parser_frameByte(frame, UART_PACKAGE_POSITION_FIRST_PARAM_BYTE + parser_frameByte(frame, UART_PACKAGE_POSITION_DATA_LENGTH_BYTE));
+  uint8_t distance;
+  uint8_t selective;
+  uint32_t slotIdOutput;
+  uint32_t transmissionLength;
+  bool found;
+  
+  switch(parser_frameByte(frame, UART_PACKAGE_POSITION_CMD_BYTE)){
+    case UART_MSG_CMD_PACK_REC_ACK:
+      TRACE_IO_VALUES(1, "LOGIC->UART_MSG_CMD_PACK_REC_ACK SEQUENCED\r\n"); 
+      logic_acknowledgeUpTo(sequence, time);
+      return LOGIC_RETURN_NOTHING;
+      break;
+      
+    case UART_MSG_CMD_PACK_REC_SACK:
+      TRACE_IO_VALUES(1, "LOGIC->UART_MSG_CMD_PACK_REC_SACK\r\n"); 
+      logic_acknowledgeUpTo(sequence, time);
+      // Bit n stands for the frame sequence + 1 + n
+      selective = parser_frameByte(frame, UART_PACKAGE_POSITION_FIRST_PARAM_BYTE);
+      for (distance = 1; selective != 0; distance++, selective >>= 1){
+        if ((selective & 0x01) == 0){
+          continue;
+        }
+        slotIdOutput = logic_getSlotOfSequence_outputBuffer((uint8_t) (sequence + distance), &found);
+        if (found == TRUE){
+          messageIOBuffer_deleteMessage_bySlotId(&messageOutputBuffer, slotIdOutput);
+        }
+      }
+      return LOGIC_RETURN_NOTHING;
+      break;
+      
+    case UART_MSG_CMD_PACK_REC_NAK:
+      TRACE_IO_VALUES(1, "LOGIC->UART_MSG_CMD_PACK_REC_NAK SEQUENCED\r\n"); 
+      // The NAK names the frame the peer misses
+      slotIdOutput = logic_getSlotOfSequence_outputBuffer(sequence, &found);
+      if (found == FALSE){
+        return LOGIC_RETURN_NOTHING;
+      }
+      messageIOBuffer_resetMessageTimeout_bySlotID(&messageOutputBuffer, slotIdOutput, time);
+      if (messageIOBuffer_incTransmissionCount_bySlotId(&messageOutputBuffer, slotIdOutput) >= 3){
+        return LOGIC_RETURN_CRITICAL_ERROR;
+      }
+      transmissionLength = userMethods_uartTransmit(messageIOBuffer_getMessageLength_bySlotId(&messageOutputBuffer, slotIdOutput), messageIOBuffer_getBuffer_bySlotId(&messageOutputBuffer, slotIdOutput));
+      if (transmissionLength != messageIOBuffer_getMessageLength_bySlotId(&messageOutputBuffer, slotIdOutput)){
+        return LOGIC_RETURN_CRITICAL_ERROR;
+      }
+      logic_frameQueued(slotIdOutput);
+      return LOGIC_RETURN_NOTHING;
+      break;
+      
+    default:
+      distance = (uint8_t) (sequence - logicRxSequence);
+      // Is it a retransmission of a frame we already got or too far ahead?
+      if ((distance > LOGIC_SEQUENCED_RX_WINDOW) || ((distance != 0) && ((logicRxSelective & (1 << (distance - 1))) != 0))){
+        // Yes, drop it, the ACK tells the peer where we are
+        TRACE_IO_VALUES(1, "LOGIC->DROP SEQUENCED FRAME\r\n");
+        logic_transmitSequencedAck();
+        return LOGIC_RETURN_NOTHING;
+      }
+      // No, the upper layer takes it from the input buffer
+      if (logic_storeFrame(time, frame) == FALSE){
+        return LOGIC_RETURN_CRITICAL_ERROR;
+      }
+      // Is it the next expected frame?
+      if (distance == 0){
+        // Yes, move on over all frames that came ahead of it
+        logicRxSequence++;
+        while ((logicRxSelective & 0x01) != 0){
+          logicRxSelective >>= 1;
+          logicRxSequence++;
+        }
+        logicRxSelective >>= 1;
+      }else{
+        // No, it's ahead but within the window, remember it for the selective ACK
+        logicRxSelective |= (uint8_t) (1 << (distance - 1));
+      }
+      TRACE_IO_VALUES(1, "LOGIC->LOGIC_RETURN_NEW_MESSAGE SEQUENCED\r\n");
+      logic_transmitSequencedAck();
+      return LOGIC_RETURN_NEW_MESSAGE;
+      break;
+  }
+}
+
 /** @brief This method will look into all slots of a buffer to find a message
  *  @param *buf The pointer to the message input or output buffer
  *  @param cmd The command you are looking for
@@ -454,6 +770,32 @@ int logic_testsuiteReturner(int retVal){
   return retVal;
 }
 
+void logic_testPutSequencedFrame(uint8_t cmd, uint8_t length, uint8_t *param, uint8_t sequence){
+  uint8_t frame[LOGIC_MIB_BUFFERSIZE];
+  uint32_t i;
+  uint32_t position = 0;
+  
+  frame[position++] = UART_AWAITING_MAGIC_SEQUENCED;
+  frame[position++] = cmd;
+  frame[position++] = length;
+  for (i = 0; i < length; i++){
+    frame[position++] = param[i];
+  }
+  frame[position++] = sequence;
+  frame[position] = CRC_Software_buildCRC(frame, position);
+  position++;
+  for (i = 0; i < position; i++){
+    ringbufferWrapper_putByte(frame[i]);
+  }
+}
+
+void logic_testPutAck(){
+  ringbufferWrapper_putByte(UART_AWAITING_MAGIC);
+  ringbufferWrapper_putByte(UART_MSG_CMD_PACK_REC_ACK);
+  ringbufferWrapper_putByte(0x00);
+  ringbufferWrapper_putByte(0xAA ^ UART_AWAITING_MAGIC ^ UART_MSG_CMD_PACK_REC_ACK);
+}
+
 int logic_checkResetConditions(){
   int i;
   
@@ -477,7 +819,7 @@ int logic_checkResetConditions(){
     if (&messageInputBuffer.slot[i] != &slotsInput[i]){
       return -1;
     }
-    if (messageInputBuffer.slot[i].age != 0){
+    if ((messageInputBuffer.freeSlots & (((uint32_t) 1) << i)) == 0){
       return -1;
     }
     if (messageInputBuffer.slot[i].transmissionCount != 0){
@@ -507,7 +849,7 @@ int logic_checkResetConditions(){
     if (&messageOutputBuffer.slot[i] != &slotsOutput[i]){
       return -1;
     }
-    if (messageOutputBuffer.slot[i].age != 0){
+    if ((messageOutputBuffer.freeSlots & (((uint32_t) 1) << i)) == 0){
       return -1;
     }
     if (messageOutputBuffer.slot[i].transmissionCount != 0){
@@ -540,6 +882,7 @@ int logic_checkResetConditions(){
  */
 int logic_testsuite(){
   uint32_t i;
+  uint32_t rtt;
   uint8_t testParam[256];
   
   for (i = 0; i < 256; i++){
@@ -580,22 +923,11 @@ int logic_testsuite(){
   if (logic_parseNachricht(0) != LOGIC_RETURN_NEW_MESSAGE){
     return logic_testsuiteReturner(-1);
   }
-  // We try a parse and this will 1.) let us transmit a nak and 2.) drop a byte
+  // We try a parse and this will 1.) let us transmit a nak and 2.) drop the
+  // 4 bytes up to the next magic
   if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING_NAK){
     return logic_testsuiteReturner(-1);
   }
-  // We try a parse again. We're in failure mode, ergo don't send NAK und just drop 2nd byte
-  if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING){
-    return logic_testsuiteReturner(-1);
-  }
-  // We try a parse again. We're in failure mode, ergo don't send NAK und just drop 3rd byte
-  if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING){
-    return logic_testsuiteReturner(-1);
-  }
-  // We try a parse again. We're in failure mode, ergo don't send NAK und just drop 4th byte
-  if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING){
-    return logic_testsuiteReturner(-1);
-  }
   // Now we reached the 2nd correct msg, this must lead to a success
   if (logic_parseNachricht(0) != LOGIC_RETURN_NEW_MESSAGE){
     return logic_testsuiteReturner(-1);
@@ -660,7 +992,7 @@ int logic_testsuite(){
     return logic_testsuiteReturner(-1);
   }
   
-  // Do a handle, thus inc transmissionCount to 2
+  // Do a handle, thus inc transmissionCount to 2, the timeout doubles to 2000
   if (logic_handleTimeouts(10000) != TRUE){
     return logic_testsuiteReturner(-1);
   }
@@ -670,14 +1002,14 @@ int logic_testsuite(){
   if (logic_countOfTimeouts(10000) != 0){
     return logic_testsuiteReturner(-1);
   }
-  if (logic_countOfTimeouts(11000) != 0){
+  if (logic_countOfTimeouts(12000) != 0){
     return logic_testsuiteReturner(-1);
   }
-  if (logic_countOfTimeouts(11001) != 1){
+  if (logic_countOfTimeouts(12001) != 1){
     return logic_testsuiteReturner(-1);
   }
   
-  // Do a handle, thus inc transmissionCount to 3
+  // Do a handle, thus inc transmissionCount to 3, the timeout doubles to 4000
   if (logic_handleTimeouts(100000) != TRUE){
     return logic_testsuiteReturner(-1);
   }
@@ -687,10 +1019,10 @@ int logic_testsuite(){
   if (logic_countOfTimeouts(100000) != 0){
     return logic_testsuiteReturner(-1);
   }
-  if (logic_countOfTimeouts(101000) != 0){
+  if (logic_countOfTimeouts(104000) != 0){
     return logic_testsuiteReturner(-1);
   }
-  if (logic_countOfTimeouts(101001) != 1){
+  if (logic_countOfTimeouts(104001) != 1){
     return logic_testsuiteReturner(-1);
   }
   
@@ -818,18 +1150,101 @@ int logic_testsuite(){
   if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING_NAK){
     return logic_testsuiteReturner(-1);
   }
-  // 16 error-message-bytes, 1 is out due to NAK, but now 15 times "Nothing" must follow up
-  for (i = 0; i < 15; i++){
-    // Since we ignore time at this, a timeout in integrity does not happen...
-    if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING){
-      return logic_testsuiteReturner(-1);
-    }
-  }
+  // The resync skipped the 16 error-message-bytes at once, the magics of the
+  // wrong DL and wrong CMD message have no valid header behind them
   // The last bytes are a good message, thus must result in a new message event
   if (logic_parseNachricht(0) != LOGIC_RETURN_NEW_MESSAGE){
     return logic_testsuiteReturner(-1);
   }
   
+  // Sequenced framing: three messages in flight at once
+  logic_resetEverything();
+  logic_setFramingMode(LOGIC_FRAMING_MODE_SEQUENCED);
+  for (i = 0; i < 3; i++){
+    if (logic_transmitMessage(UART_MSG_CMD_HCI_COMMAND, 1, testParam, 0, 1000) != LOGIC_RETURN_MESSAGE_SENT){
+      return logic_testsuiteReturner(-2);
+    }
+  }
+  if (logic_countOfMessagesInOutputbuffer() != 3){
+    return logic_testsuiteReturner(-2);
+  }
+  // The peer got #0 in order and #2 ahead, #1 stays
+  testParam[0] = 0x02;
+  logic_testPutSequencedFrame(UART_MSG_CMD_PACK_REC_SACK, 1, testParam, 0);
+  if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING){
+    return logic_testsuiteReturner(-3);
+  }
+  if (logic_countOfMessagesInOutputbuffer() != 1){
+    return logic_testsuiteReturner(-3);
+  }
+  if (logic_getSequenceOfFrame(messageIOBuffer_getBuffer_bySlotId(&messageOutputBuffer, 1)) != 1){
+    return logic_testsuiteReturner(-3);
+  }
+  // The cumulative ACK of #2 clears the rest
+  logic_testPutSequencedFrame(UART_MSG_CMD_PACK_REC_ACK, 0, testParam, 2);
+  if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING){
+    return logic_testsuiteReturner(-4);
+  }
+  if (logic_countOfMessagesInOutputbuffer() != 0){
+    return logic_testsuiteReturner(-4);
+  }
+  
+  // Reception: #0, its retransmission, #2 ahead of #1, then #1
+  testParam[0] = 0x01;
+  logic_testPutSequencedFrame(UART_MSG_CMD_HCI_COMMAND_RESPONSE, 1, testParam, 0);
+  if (logic_parseNachricht(0) != LOGIC_RETURN_NEW_MESSAGE){
+    return logic_testsuiteReturner(-5);
+  }
+  logic_testPutSequencedFrame(UART_MSG_CMD_HCI_COMMAND_RESPONSE, 1, testParam, 0);
+  if (logic_parseNachricht(0) != LOGIC_RETURN_NOTHING){
+    return logic_testsuiteReturner(-6);
+  }
+  if (logic_countOfMessagesInInputbuffer() != 1){
+    return logic_testsuiteReturner(-6);
+  }
+  logic_testPutSequencedFrame(UART_MSG_CMD_HCI_COMMAND_RESPONSE, 1, testParam, 2);
+  if (logic_parseNachricht(0) != LOGIC_RETURN_NEW_MESSAGE){
+    return logic_testsuiteReturner(-7);
+  }
+  if ((logicRxSequence != 1) || (logicRxSelective != 0x01)){
+    return logic_testsuiteReturner(-7);
+  }
+  logic_testPutSequencedFrame(UART_MSG_CMD_HCI_COMMAND_RESPONSE, 1, testParam, 1);
+  if (logic_parseNachricht(0) != LOGIC_RETURN_NEW_MESSAGE){
+    return logic_testsuiteReturner(-8);
+  }
+  if ((logicRxSequence != 3) || (logicRxSelective != 0x00)){
+    return logic_testsuiteReturner(-8);
+  }
+  if (logic_countOfMessagesInInputbuffer() != 3){
+    return logic_testsuiteReturner(-8);
+  }
+  
+  logic_setFramingMode(LOGIC_FRAMING_MODE_STOP_AND_WAIT);
+  logic_resetEverything();
+  
+  // The ACK of a retransmitted message is no round trip measurement
+  rtt = handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_LINK);
+  if (logic_transmitMessage(UART_MSG_CMD_HCI_COMMAND, 1, testParam, 50000, 1000) != LOGIC_RETURN_MESSAGE_SENT){
+    return logic_testsuiteReturner(-9);
+  }
+  if (logic_handleTimeouts(51001) != TRUE){
+    return logic_testsuiteReturner(-9);
+  }
+  logic_testPutAck();
+  if ((logic_parseNachricht(51010) != LOGIC_RETURN_NOTHING) || (handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_LINK) != rtt)){
+    return logic_testsuiteReturner(-9);
+  }
+  // The ACK of a message sent once is, srtt moves 1/8 towards it
+  if (logic_transmitMessage(UART_MSG_CMD_HCI_COMMAND, 1, testParam, 60000, 1000) != LOGIC_RETURN_MESSAGE_SENT){
+    return logic_testsuiteReturner(-10);
+  }
+  logic_testPutAck();
+  if ((logic_parseNachricht(60000 + rtt + 800) != LOGIC_RETURN_NOTHING) || (handlerRTT_getSmoothedRTT(HANDLER_RTT_CLASS_LINK) != (rtt + 100))){
+    return logic_testsuiteReturner(-10);
+  }
+  logic_resetEverything();
+  
   return 0;
 }
 #endif
\ No newline at end of file
@@ -27,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-17    | Tim Steinberg         | Added the sequenced framing mode              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -61,6 +61,16 @@ typedef enum LOGIC_RETURN_VALUES {
   LOGIC_RETURN_CRITICAL_ERROR           = 0xFF, /**< A critical error occured */
 } LOGIC_RETURN_VALUES_TYPEDEF;
 
+/** *@brief The framing of the transmitted messages
+  * STOP_AND_WAIT  = plain frames, an ACK clears the oldest message
+  * SEQUENCED      = frames with sequence number, several of them in flight,
+  *                  cumulative and selective ACKs clear them by number
+  */
+typedef enum LOGIC_FRAMING_MODE_VALUES {
+  LOGIC_FRAMING_MODE_STOP_AND_WAIT      = 0x00, /**< One message in flight, ACK clears the oldest */
+  LOGIC_FRAMING_MODE_SEQUENCED          = 0x01, /**< Up to LOGIC_MOB_SLOTCOUNT messages in flight */
+} LOGIC_FRAMING_MODE_VALUES_TYPEDEF;
+
 /* Variables */
 
 /* Function definitions */
@@ -117,6 +127,14 @@ LOGIC_RETURN_VALUES_TYPEDEF     logic_transmitMessage(uint8_t cmd, uint32_t leng
  */
 void                            logic_resetEverything();
 
+/** @brief This method will set the framing of the transmitted messages and
+ *         restart the sequence numbers on both directions. The sequence
+ *         numbers belong to the link, logic_resetEverything keeps them.
+ *  @param mode The framing to use
+ *  @return Nothing.
+ */
+void                            logic_setFramingMode(LOGIC_FRAMING_MODE_VALUES_TYPEDEF mode);
+
 /** @brief This method will look into all slots of the input buffer to find your
  *         message.
  *  @param cmd The command you are looking for
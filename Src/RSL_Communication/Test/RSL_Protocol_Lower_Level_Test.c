@@ -26,13 +26,13 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-05-19    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Failures end the host build with an error     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Run the RingbufferWrapper testsuite again     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Run the Handler_RTT testsuite                 |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Run the UART_RSL testsuite                    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -41,12 +41,15 @@
 #include "Test_Selector.h"
 #include "Debug.h"
 
-#include "userMethods_UART.h"
+#include "UserMethods_UART.h"
+#include "DMA.h"
+#include "UART_RSL.h"
 #include "Ringbuffer.h"
 #include "RingbufferWrapper.h"
 #include "CRC_Software.h"
 #include "Handler_Timer.h"
 #include "Handler_NAK_Transmission.h"
+#include "Handler_RTT.h"
 #include "Parser.h"
 #include "MessageIOBuffer.h"
 #include "Logic.h"
@@ -66,7 +69,23 @@ void rslProtocolTestsuite_testsLowerLevel(){
   retVal = userMethods_testsuite();
   TRACE_TEST_VALUES(1, "TEST UserMethods_UART.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_DMA >= 1
+  retVal = dma_testsuite();
+  TRACE_TEST_VALUES(1, "TEST DMA.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_UART_RSL >= 1
+  retVal = uart_rsl_testsuite();
+  TRACE_TEST_VALUES(1, "TEST UART_RSL.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -74,15 +93,15 @@ void rslProtocolTestsuite_testsLowerLevel(){
   retVal = ringbufferTestsuite();
   TRACE_TEST_VALUES(1, "TEST Ringbuffer.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
-#if TEST_RECEPTION_BUFFER >= 1
+#if TEST_RINGBUFFER_WRAPPER >= 1
   retVal = ringbufferWrapper_testsuite();
   TRACE_TEST_VALUES(1, "TEST RingbufferWrapper.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -90,7 +109,7 @@ void rslProtocolTestsuite_testsLowerLevel(){
   retVal = CRC_Software_testsuite();
   TRACE_TEST_VALUES(1, "TEST CRC_Software.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -98,7 +117,7 @@ void rslProtocolTestsuite_testsLowerLevel(){
   retVal = timerHandler_testsuite();
   TRACE_TEST_VALUES(1, "TEST Handler_Timer.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -106,7 +125,15 @@ void rslProtocolTestsuite_testsLowerLevel(){
   retVal = handlerNAK_testsuite();
   TRACE_TEST_VALUES(1, "TEST Handler_NAK_Transmission.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
+  }
+#endif
+  
+#if TEST_HANDLER_RTT >= 1
+  retVal = handlerRTT_testsuite();
+  TRACE_TEST_VALUES(1, "TEST Handler_RTT.c %i", retVal);
+  if (retVal < 0){
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -114,7 +141,7 @@ void rslProtocolTestsuite_testsLowerLevel(){
   retVal = parser_testsuite();
   TRACE_TEST_VALUES(1, "TEST Parser.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -122,7 +149,7 @@ void rslProtocolTestsuite_testsLowerLevel(){
   retVal = messageIOBuffer_testsuite();
   TRACE_TEST_VALUES(1, "TEST MessageIOBuffer.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -130,7 +157,7 @@ void rslProtocolTestsuite_testsLowerLevel(){
   retVal = logic_testsuite();
   TRACE_TEST_VALUES(1, "TEST Logic.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
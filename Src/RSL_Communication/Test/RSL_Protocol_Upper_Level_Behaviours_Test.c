@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-03    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Failures end the host build with an error     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Renamed UART reception start                  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -61,14 +61,14 @@ void rslProtocolTestsuite_testsUpperLevel_behaviours(){
   
 #if TEST_GROUP_UPPER_LEVEL_BEHAVIOURS_ACTIVE >= 1
   int32_t retVal;
-  Uart_Rsl_StartReception();
+  uart_rsl_startReception();
 #endif 
   
 #if TEST_BEHAVIOUR_CONTROLLER >= 1
   retVal = behaviourController_testsuite();
   TRACE_TEST_VALUES(1, "TEST BehaviourController.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -80,7 +80,7 @@ void rslProtocolTestsuite_testsUpperLevel_behaviours(){
   retVal = behaviourV115_pairing_testsuite();
   TRACE_TEST_VALUES(1, "TEST BehaviourV115_Pairing.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -88,7 +88,7 @@ void rslProtocolTestsuite_testsUpperLevel_behaviours(){
   retVal = behaviourV115_alert_testsuite();
   TRACE_TEST_VALUES(1, "TEST BehaviourV115_Alert.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -96,7 +96,7 @@ void rslProtocolTestsuite_testsUpperLevel_behaviours(){
   retVal = behaviourV115_battery_testsuite();
   TRACE_TEST_VALUES(1, "TEST BehaviourV115_Battery.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -104,7 +104,7 @@ void rslProtocolTestsuite_testsUpperLevel_behaviours(){
   retVal = behaviourV115_error_testsuite();
   TRACE_TEST_VALUES(1, "TEST BehaviourV115_Error.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -112,7 +112,7 @@ void rslProtocolTestsuite_testsUpperLevel_behaviours(){
   retVal = behaviourV115_resetAlert_testsuite();
   TRACE_TEST_VALUES(1, "TEST BehaviourV115_ResetAlert.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -120,7 +120,7 @@ void rslProtocolTestsuite_testsUpperLevel_behaviours(){
   retVal = behaviourV115_resetAlert_testsuite();
   TRACE_TEST_VALUES(1, "TEST BehaviourV115_ResetAlert.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-02    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Failures end the host build with an error     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -71,7 +71,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_start_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_Start.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -79,7 +79,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_sleep_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_Sleep.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -87,7 +87,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_pairing_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_Pairing.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -95,7 +95,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_char_alert_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_CharAlert.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -103,7 +103,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_char_battery_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_CharBattery.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -111,7 +111,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_char_error_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_CharError.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -119,7 +119,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_bc_start_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_BC_Start.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -127,7 +127,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_bc_end_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_BC_End.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -135,7 +135,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_bc_wait_to_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_BC_Wait_TO.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -143,7 +143,7 @@ void rslProtocolTestsuite_testsUpperLevel_steps(){
   retVal = behaviourStep_removePD_v115_main_test();
   TRACE_TEST_VALUES(1, "TEST BehaviourStepV115_RemovePD.c %i", retVal);
   if (retVal < 0){
-    do{}while(1);
+    TEST_FAILURE_HALT();
   }
 #endif
   
@@ -25,54 +25,148 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-05-19    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Added TEST_EEPROM_LOG                         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Tests can be selected from the build          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Added TEST_HANDLER_RTT                        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Added TEST_UART_RSL                           |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Added TEST_CRC                                |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Added TEST_APP_868MHZ_MESSAGEBUILDER          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 008       | 2026-10-18    | Tim Steinberg         | Added TEST_S2LP                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 009       | 2026-10-18    | Tim Steinberg         | Added TEST_APP_868MHZ                         |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 010       | 2026-10-18    | Tim Steinberg         | Added TEST_LPTIM                              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
 
 // Let this rest here, else it will always complain about "undefined functions"
-#define TEST_USERMETHODS_UART                           0
-#define TEST_RINGBUFFER                                 0
-#define TEST_RINGBUFFER_WRAPPER                         0
-#define TEST_CRC_SOFTWARE                               0
-#define TEST_HANDLER_TIMER                              0
-#define TEST_HANDLER_NAK_TRANSMISSION                   0
-#define TEST_PARSER                                     0
-#define TEST_MESSAGEIOBUFFER                            0
-#define TEST_LOGIC                                      0
-
-#define TEST_GROUP_LOWER_LEVEL_ACTIVE                   ( (TEST_USERMETHODS_UART >= 1) || (TEST_RINGBUFFER >= 1) || (TEST_RINGBUFFER_WRAPPER >= 1) || (TEST_CRC_SOFTWARE >= 1) || (TEST_HANDLER_TIMER >= 1) || (TEST_HANDLER_NAK_TRANSMISSION >= 1) || (TEST_PARSER >= 1) || (TEST_MESSAGEIOBUFFER >= 1) || (TEST_LOGIC >= 1) )
-
-#define TEST_BEHAVIOURSTEP_START_V115                   0
-#define TEST_BEHAVIOURSTEP_SLEEP_V115                   0
-#define TEST_BEHAVIOURSTEP_PAIRING_V115                 0
-#define TEST_BEHAVIOURSTEP_CHAR_ALERT_V115              0
-#define TEST_BEHAVIOURSTEP_CHAR_BATTERY_V115            0
-#define TEST_BEHAVIOURSTEP_CHAR_ERROR_V115              0
-#define TEST_BEHAVIOURSTEP_BC_START_V115                0
-#define TEST_BEHAVIOURSTEP_BC_END_V115                  0
-#define TEST_BEHAVIOURSTEP_BC_WAIT_TO_V115              0
-#define TEST_BEHAVIOURSTEP_REMOVEPD_V115                0
+// A build can switch single tests on from outside (-DTEST_X=1), the host build does
+#ifndef TEST_USERMETHODS_UART
+  #define TEST_USERMETHODS_UART                          0
+#endif
+#ifndef TEST_DMA
+  #define TEST_DMA                                       0
+#endif
+#ifndef TEST_UART_RSL
+  #define TEST_UART_RSL                                  0
+#endif
+#ifndef TEST_RINGBUFFER
+  #define TEST_RINGBUFFER                                0
+#endif
+#ifndef TEST_RINGBUFFER_WRAPPER
+  #define TEST_RINGBUFFER_WRAPPER                        0
+#endif
+#ifndef TEST_CRC_SOFTWARE
+  #define TEST_CRC_SOFTWARE                              0
+#endif
+#ifndef TEST_HANDLER_TIMER
+  #define TEST_HANDLER_TIMER                             0
+#endif
+#ifndef TEST_HANDLER_NAK_TRANSMISSION
+  #define TEST_HANDLER_NAK_TRANSMISSION                  0
+#endif
+#ifndef TEST_HANDLER_RTT
+  #define TEST_HANDLER_RTT                               0
+#endif
+#ifndef TEST_PARSER
+  #define TEST_PARSER                                    0
+#endif
+#ifndef TEST_MESSAGEIOBUFFER
+  #define TEST_MESSAGEIOBUFFER                           0
+#endif
+#ifndef TEST_LOGIC
+  #define TEST_LOGIC                                     0
+#endif
+#define TEST_GROUP_LOWER_LEVEL_ACTIVE                   ( (TEST_USERMETHODS_UART >= 1) || (TEST_DMA >= 1) || (TEST_UART_RSL >= 1) || (TEST_RINGBUFFER >= 1) || (TEST_RINGBUFFER_WRAPPER >= 1) || (TEST_CRC_SOFTWARE >= 1) || (TEST_HANDLER_TIMER >= 1) || (TEST_HANDLER_NAK_TRANSMISSION >= 1) || (TEST_HANDLER_RTT >= 1) || (TEST_PARSER >= 1) || (TEST_MESSAGEIOBUFFER >= 1) || (TEST_LOGIC >= 1) )
 
+#ifndef TEST_BEHAVIOURSTEP_START_V115
+  #define TEST_BEHAVIOURSTEP_START_V115                  0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_SLEEP_V115
+  #define TEST_BEHAVIOURSTEP_SLEEP_V115                  0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_PAIRING_V115
+  #define TEST_BEHAVIOURSTEP_PAIRING_V115                0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_CHAR_ALERT_V115
+  #define TEST_BEHAVIOURSTEP_CHAR_ALERT_V115             0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_CHAR_BATTERY_V115
+  #define TEST_BEHAVIOURSTEP_CHAR_BATTERY_V115           0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_CHAR_ERROR_V115
+  #define TEST_BEHAVIOURSTEP_CHAR_ERROR_V115             0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_BC_START_V115
+  #define TEST_BEHAVIOURSTEP_BC_START_V115               0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_BC_END_V115
+  #define TEST_BEHAVIOURSTEP_BC_END_V115                 0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_BC_WAIT_TO_V115
+  #define TEST_BEHAVIOURSTEP_BC_WAIT_TO_V115             0
+#endif
+#ifndef TEST_BEHAVIOURSTEP_REMOVEPD_V115
+  #define TEST_BEHAVIOURSTEP_REMOVEPD_V115               0
+#endif
 #define TEST_GROUP_UPPER_LEVEL_STEPS_ACTIVE             ( (TEST_BEHAVIOURSTEP_REMOVEPD_V115 >= 1) || (TEST_BEHAVIOURSTEP_BC_WAIT_TO_V115 >= 1) || (TEST_BEHAVIOURSTEP_BC_END_V115 >= 1) || (TEST_BEHAVIOURSTEP_BC_START_V115 >= 1) || (TEST_BEHAVIOURSTEP_CHAR_ERROR_V115 >= 1) || (TEST_BEHAVIOURSTEP_CHAR_BATTERY_V115 >= 1) || (TEST_BEHAVIOURSTEP_CHAR_ALERT_V115 >= 1) || (TEST_BEHAVIOURSTEP_PAIRING_V115 >= 1) || (TEST_BEHAVIOURSTEP_SLEEP_V115 >= 1) || (TEST_BEHAVIOURSTEP_START_V115 >= 1) )                    
 
-#define TEST_BEHAVIOUR_CONTROLLER                       0
-                                                        
-#define TEST_BEHAVIOUR_PAIRING_V115                     0
-#define TEST_BEHAVIOUR_ALERT_V115                       0
-#define TEST_BEHAVIOUR_BATTERY_V115                     0
-#define TEST_BEHAVIOUR_ERROR_V115                       0
-#define TEST_BEHAVIOUR_RESETALERT_V115                  0
-#define TEST_BEHAVIOUR_SETALLCHARACTERISTICS_V115       0
-
+#ifndef TEST_BEHAVIOUR_CONTROLLER
+  #define TEST_BEHAVIOUR_CONTROLLER                      0
+#endif
+#ifndef TEST_BEHAVIOUR_PAIRING_V115
+  #define TEST_BEHAVIOUR_PAIRING_V115                    0
+#endif
+#ifndef TEST_BEHAVIOUR_ALERT_V115
+  #define TEST_BEHAVIOUR_ALERT_V115                      0
+#endif
+#ifndef TEST_BEHAVIOUR_BATTERY_V115
+  #define TEST_BEHAVIOUR_BATTERY_V115                    0
+#endif
+#ifndef TEST_BEHAVIOUR_ERROR_V115
+  #define TEST_BEHAVIOUR_ERROR_V115                      0
+#endif
+#ifndef TEST_BEHAVIOUR_RESETALERT_V115
+  #define TEST_BEHAVIOUR_RESETALERT_V115                 0
+#endif
+#ifndef TEST_BEHAVIOUR_SETALLCHARACTERISTICS_V115
+  #define TEST_BEHAVIOUR_SETALLCHARACTERISTICS_V115      0
+#endif
 #define TEST_GROUP_UPPER_LEVEL_BEHAVIOURS_ACTIVE        ( (TEST_BEHAVIOUR_SETALLCHARACTERISTICS_V115 >= 1) || (TEST_BEHAVIOUR_RESETALERT_V115 >= 1) || (TEST_BEHAVIOUR_ERROR_V115 >= 1) || (TEST_BEHAVIOUR_BATTERY_V115 >= 1) || (TEST_BEHAVIOUR_ALERT_V115 >= 1) || (TEST_BEHAVIOUR_PAIRING_V115 >= 1) || (TEST_BEHAVIOUR_CONTROLLER >= 1) )
 
+#ifndef TEST_APP_868MHZ_SEQUENCER
+  #define TEST_APP_868MHZ_SEQUENCER                      0
+#endif
+#ifndef TEST_FLASHCHECK
+  #define TEST_FLASHCHECK                                0
+#endif
+#ifndef TEST_EEPROM_LOG
+  #define TEST_EEPROM_LOG                                0
+#endif
+#ifndef TEST_CRC
+  #define TEST_CRC                                       0
+#endif
+#ifndef TEST_APP_868MHZ_MESSAGEBUILDER
+  #define TEST_APP_868MHZ_MESSAGEBUILDER                 0
+#endif
+#ifndef TEST_S2LP
+  #define TEST_S2LP                                      0
+#endif
+#ifndef TEST_APP_868MHZ
+  #define TEST_APP_868MHZ                                0
+#endif
+#ifndef TEST_LPTIM
+  #define TEST_LPTIM                                     0
+#endif
+#define TEST_GROUP_APPLICATION_ACTIVE                   ( (TEST_APP_868MHZ_SEQUENCER >= 1) || (TEST_FLASHCHECK >= 1) || (TEST_EEPROM_LOG >= 1) || (TEST_CRC >= 1) || (TEST_APP_868MHZ_MESSAGEBUILDER >= 1) || (TEST_S2LP >= 1) || (TEST_APP_868MHZ >= 1) || (TEST_LPTIM >= 1) )
+
 #if TEST_GROUP_LOWER_LEVEL_ACTIVE >= 1
   //#warning TEST MAY TAKE UP TO 10 SECONDS
 #endif
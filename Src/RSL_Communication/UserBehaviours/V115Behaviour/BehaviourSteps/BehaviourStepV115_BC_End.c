@@ -28,9 +28,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-23    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Exit function stops the timeout               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Includes the HAL, test waits for the backoff  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include "stm32l0xx_hal.h"
 #include "MasterDefine.h"
 #include "Message_Definitions.h"
 #include "BehaviourDefines.h"
@@ -51,6 +52,7 @@
 
 #include "UserMethods_Characteristics.h"
 #include "UserMethods_UART.h"
+#include "Handler_RTT.h"
 
 /* Typedefinitions */
 /* Typedefinitions */
@@ -70,10 +72,18 @@ typedef enum BEHAVIOURSTEP_BC_END_V115_STATEMACHINE {
 
 /* Variables */
 BEHAVIOURSTEP_BC_END_V115_STATEMACHINE_TYPEDEF behaviourStep_bc_end_v115_internalState = BEHAVIOURSTEP_BC_END_V115_STATEMACHINE_SEND_BROADCAST_END;
+static TIMER_STRUCT_TYPEDEF timerTimeout;
 
 /* Function definitions */
+/** @brief The controller leaves the step, its timeout must not stay in
+ *         the timer queue.
+ *  @return Nothing.
+ */
+void behaviourStep_bc_end_v115_exit(void){
+  timerHandler_timerStop(&timerTimeout);
+}
+
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_bc_end_v115_main(bool init){
-  static TIMER_STRUCT_TYPEDEF timerTimeout;
   bool found;
   uint32_t temp;
   
@@ -188,13 +198,13 @@ int behaviourStep_bc_end_v115_main_test(){
   if (behaviourStep_bc_end_v115_internalState != BEHAVIOURSTEP_BC_END_V115_STATEMACHINE_SEND_BROADCAST_END_WAIT_ACK){ return behaviourStep_bc_end_v115_testFail(-1); }
   if (behaviourStep_bc_end_v115_compareReception(expectedTransmission, 4) != TRUE){ return behaviourStep_bc_end_v115_testFail(-1); }
   
-  HAL_Delay(BEHAVIOURSTEP_BC_END_V115_TIMER_WAIT_TIME_TO_ACK_END_BROADCASTING + 1);
+  HAL_Delay(handlerRTT_getBackoffTimeout(BEHAVIOURSTEP_BC_END_V115_TIMER_WAIT_TIME_TO_ACK_END_BROADCASTING) + 1);
   
   if (behaviourStep_bc_end_v115_main(FALSE) != BEHAVIOUR_STEP_RETURN_NOTHING){ return behaviourStep_bc_end_v115_testFail(-1); }
   if (behaviourStep_bc_end_v115_internalState != BEHAVIOURSTEP_BC_END_V115_STATEMACHINE_SEND_BROADCAST_END_WAIT_ACK){ return behaviourStep_bc_end_v115_testFail(-1); }
   if (behaviourStep_bc_end_v115_compareReception(expectedTransmission, 4) != TRUE){ return behaviourStep_bc_end_v115_testFail(-1); }
   
-  HAL_Delay(BEHAVIOURSTEP_BC_END_V115_TIMER_WAIT_TIME_TO_ACK_END_BROADCASTING + 1);
+  HAL_Delay(handlerRTT_getBackoffTimeout(handlerRTT_getBackoffTimeout(BEHAVIOURSTEP_BC_END_V115_TIMER_WAIT_TIME_TO_ACK_END_BROADCASTING)) + 1);
   
   if (behaviourStep_bc_end_v115_main(FALSE) != BEHAVIOUR_STEP_RETURN_CRITICAL_ABORT){ return behaviourStep_bc_end_v115_testFail(-1); }
   if (behaviourStep_bc_end_v115_internalState != BEHAVIOURSTEP_BC_END_V115_STATEMACHINE_NO_NEXT_STATE_FAIL){ return behaviourStep_bc_end_v115_testFail(-1); }
@@ -28,7 +28,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-23    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Exit function stops the timeout               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -55,6 +55,7 @@
 
 /* Function definitions */
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_bc_end_v115_main(bool init);
+void behaviourStep_bc_end_v115_exit(void);
 
 #if TEST_BEHAVIOURSTEP_BC_END_V115 >= 1
 
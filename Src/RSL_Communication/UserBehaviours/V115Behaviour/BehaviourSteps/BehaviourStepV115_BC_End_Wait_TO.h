@@ -31,7 +31,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-23    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Exit function stops the timeout               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -58,6 +58,7 @@
 
 /* Function definitions */
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_bc_end_wait_to_v115_main(bool init);
+void behaviourStep_bc_end_wait_to_v115_exit(void);
 
 #if TEST_BEHAVIOURSTEP_BC_END_WAIT_TO_V115 >= 1
 
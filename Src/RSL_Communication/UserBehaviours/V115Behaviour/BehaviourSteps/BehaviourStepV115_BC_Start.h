@@ -27,7 +27,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-23    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Exit function stops the timeout               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -54,6 +54,7 @@
 
 /* Function definitions */
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_bc_start_v115_main(bool init);
+void behaviourStep_bc_start_v115_exit(void);
 
 #if TEST_BEHAVIOURSTEP_BC_START_V115 >= 1
 
@@ -31,9 +31,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-29    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Exit function stops the timeout               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Includes the HAL                              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -46,6 +46,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include "stm32l0xx_hal.h"
 #include "MasterDefine.h"
 #include "Message_Definitions.h"
 #include "BehaviourDefines.h"
@@ -74,10 +75,18 @@ typedef enum BEHAVIOURSTEP_BC_WAIT_TO_V115_STATEMACHINE {
 
 /* Variables */
 BEHAVIOURSTEP_BC_WAIT_TO_V115_STATEMACHINE_TYPEDEF behaviourStep_bc_wait_to_v115_internalState = BEHAVIOURSTEP_BC_WAIT_TO_V115_STATEMACHINE_START_BC_TIMER;
+static TIMER_STRUCT_TYPEDEF timerTimeout;
 
 /* Function definitions */
+/** @brief The controller leaves the step, its timeout must not stay in
+ *         the timer queue.
+ *  @return Nothing.
+ */
+void behaviourStep_bc_end_wait_to_v115_exit(void){
+  timerHandler_timerStop(&timerTimeout);
+}
+
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_bc_end_wait_to_v115_main(bool init){
-  static TIMER_STRUCT_TYPEDEF timerTimeout;
   bool found;
   uint32_t temp;
   
@@ -27,11 +27,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-23    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Timeouts follow the measured round trips      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Exit function stops the timeout               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Includes the HAL, test waits for the backoff  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -42,14 +42,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include "stm32l0xx_hal.h"
 #include "MasterDefine.h"
 #include "Message_Definitions.h"
 #include "BehaviourDefines.h"
 #include "Logic.h"
 #include "Handler_Timer.h"
+#include "Handler_RTT.h"
 
 #include "UserMethods_Characteristics.h"
 #include "UserMethods_UART.h"
+#include "Handler_RTT.h"
 
 /* Typedefinitions */
 typedef enum BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE {
@@ -63,15 +66,24 @@ typedef enum BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE {
   BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_NO_NEXT_STATE_FAIL                 = 0xFF,
 } BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_TYPEDEF;
 
-#define BEHAVIOURSTEP_CHAR_BATTERY_V115_TIMER_WAIT_TIME_TO_CHAR_UP_ANSWER         1500
-#define BEHAVIOURSTEP_CHAR_BATTERY_V115_TIMEOUTTIME_CHAR_UPDATE_OK                1000
+// Both follow the measured round trip times of the RSL10, see Handler_RTT
+#define BEHAVIOURSTEP_CHAR_BATTERY_V115_TIMER_WAIT_TIME_TO_CHAR_UP_ANSWER         handlerRTT_getTimeout(HANDLER_RTT_CLASS_CHARACTERISTIC)
+#define BEHAVIOURSTEP_CHAR_BATTERY_V115_TIMEOUTTIME_CHAR_UPDATE_OK                handlerRTT_getTimeout(HANDLER_RTT_CLASS_LINK)
 
 /* Variables */
 BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_TYPEDEF behaviourStep_char_battery_v115_internalState = BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_SEND_CHAR_UP_BATTERY;
+static TIMER_STRUCT_TYPEDEF timerTimeout;
 
 /* Function definitions */
+/** @brief The controller leaves the step, its timeout must not stay in
+ *         the timer queue.
+ *  @return Nothing.
+ */
+void behaviourStep_char_battery_v115_exit(void){
+  timerHandler_timerStop(&timerTimeout);
+}
+
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_char_battery_v115_main(bool init){
-  static TIMER_STRUCT_TYPEDEF timerTimeout;
   bool found;
   uint32_t temp;
   uint8_t batteryChar;
@@ -123,12 +135,14 @@ BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_char_battery_v115_main(bool i
   if (behaviourStep_char_battery_v115_internalState == BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_CHECK_FOR_MESSAGE_PAIRING_ANSWER){
     temp = logic_getSlotOfCommand_inputBuffer(UART_MSG_CMD_CHAR_ACK, &found);
     if (found){
+      handlerRTT_sample(HANDLER_RTT_CLASS_CHARACTERISTIC, timerTimeout.time_startTime, userMethods_characteristics_getTime());
       logic_deletePaketFromInputBuffer(temp);
       behaviourStep_char_battery_v115_internalState = BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_NO_NEXT_STATE_OK;
       return BEHAVIOUR_STEP_RETURN_NEXT_BEHAVIOUR_STEP;
     }
     temp = logic_getSlotOfCommand_inputBuffer(UART_MSG_CMD_CHAR_NAK, &found);
     if (found){
+      handlerRTT_sample(HANDLER_RTT_CLASS_CHARACTERISTIC, timerTimeout.time_startTime, userMethods_characteristics_getTime());
       logic_deletePaketFromInputBuffer(temp);
       behaviourStep_char_battery_v115_internalState = BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_NO_NEXT_STATE_FAIL;
       return BEHAVIOUR_STEP_RETURN_REDO;
@@ -190,13 +204,13 @@ int behaviourStep_char_battery_v115_main_test(){
   if (behaviourStep_char_battery_v115_internalState != BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_SEND_CHAR_UP_BATTERY_WAIT_ACK){ return behaviourStep_char_battery_v115_testFail(-1); }
   if (behaviourStep_char_battery_v115_compareReception(expectedTransmission, 5) != TRUE){ return behaviourStep_char_battery_v115_testFail(-1); }
 
-  HAL_Delay(BEHAVIOURSTEP_CHAR_BATTERY_V115_TIMEOUTTIME_CHAR_UPDATE_OK + 1);
+  HAL_Delay(handlerRTT_getBackoffTimeout(BEHAVIOURSTEP_CHAR_BATTERY_V115_TIMEOUTTIME_CHAR_UPDATE_OK) + 1);
   
   if (behaviourStep_char_battery_v115_main(FALSE) != BEHAVIOUR_STEP_RETURN_NOTHING){ return behaviourStep_char_battery_v115_testFail(-1); }
   if (behaviourStep_char_battery_v115_internalState != BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_SEND_CHAR_UP_BATTERY_WAIT_ACK){ return behaviourStep_char_battery_v115_testFail(-1); }
   if (behaviourStep_char_battery_v115_compareReception(expectedTransmission, 5) != TRUE){ return behaviourStep_char_battery_v115_testFail(-1); }
 
-  HAL_Delay(BEHAVIOURSTEP_CHAR_BATTERY_V115_TIMEOUTTIME_CHAR_UPDATE_OK + 1);
+  HAL_Delay(handlerRTT_getBackoffTimeout(handlerRTT_getBackoffTimeout(BEHAVIOURSTEP_CHAR_BATTERY_V115_TIMEOUTTIME_CHAR_UPDATE_OK)) + 1);
   
   if (behaviourStep_char_battery_v115_main(FALSE) != BEHAVIOUR_STEP_RETURN_CRITICAL_ABORT){ return behaviourStep_char_battery_v115_testFail(-1); }
   if (behaviourStep_char_battery_v115_internalState != BEHAVIOURSTEP_CHAR_BATTERY_V115_STATEMACHINE_NO_NEXT_STATE_FAIL){ return behaviourStep_char_battery_v115_testFail(-1); }
@@ -26,9 +26,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-23    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Exit function stops the timeout               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Includes the HAL, test waits for the backoff  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -41,6 +41,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include "stm32l0xx_hal.h"
 #include "MasterDefine.h"
 #include "Message_Definitions.h"
 #include "BehaviourDefines.h"
@@ -49,6 +50,7 @@
 
 #include "UserMethods_Characteristics.h"
 #include "UserMethods_UART.h"
+#include "Handler_RTT.h"
 
 /* Typedefinitions */
 typedef enum BEHAVIOURSTEP_CHAR_REMOVEPD_V115_STATEMACHINE {
@@ -67,10 +69,18 @@ typedef enum BEHAVIOURSTEP_CHAR_REMOVEPD_V115_STATEMACHINE {
 
 /* Variables */
 BEHAVIOURSTEP_REMOVEPD_V115_STATEMACHINE_TYPEDEF behaviourStep_removePD_v115_internalState = BEHAVIOURSTEP_REMOVEPD_V115_STATEMACHINE_SEND_REMOVEPD;
+static TIMER_STRUCT_TYPEDEF timerTimeout;
 
 /* Function definitions */
+/** @brief The controller leaves the step, its timeout must not stay in
+ *         the timer queue.
+ *  @return Nothing.
+ */
+void behaviourStep_removePD_v115_exit(void){
+  timerHandler_timerStop(&timerTimeout);
+}
+
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_removePD_v115_main(bool init){
-  static TIMER_STRUCT_TYPEDEF timerTimeout;
   bool found;
   uint32_t temp;
   
@@ -164,7 +174,7 @@ bool behaviourStep_removePD_v115_compareReception(uint8_t *buf, uint32_t len){
 }
 
 int behaviourStep_removePD_v115_main_test(){
-  userMethods_characteristics_setAlert();
+  userMethods_characteristics_setAlert(1);
   uint8_t expectedTransmission[] = {UART_TRANSMISSION_MAGIC, UART_MSG_CMD_REMOVE_PAIRED_DEVICE, 0x00, 0xAA ^ UART_TRANSMISSION_MAGIC ^ UART_MSG_CMD_REMOVE_PAIRED_DEVICE ^ 0x00};
   userMethods_txRegisterCallbackForTransmission(behaviourStep_removePD_v115_uartFuncCallback);
   
@@ -181,13 +191,13 @@ int behaviourStep_removePD_v115_main_test(){
   if (behaviourStep_removePD_v115_internalState != BEHAVIOURSTEP_REMOVEPD_V115_STATEMACHINE_SEND_REMOVEPD_WAIT_ACK){ return behaviourStep_removePD_v115_testFail(-1); }
   if (behaviourStep_removePD_v115_compareReception(expectedTransmission, 4) != TRUE){ return behaviourStep_removePD_v115_testFail(-1); }
 
-  HAL_Delay(BEHAVIOURSTEP_REMOVEPD_V115_TIMEOUTTIME_REMOVEPD_ACK + 1);
+  HAL_Delay(handlerRTT_getBackoffTimeout(BEHAVIOURSTEP_REMOVEPD_V115_TIMEOUTTIME_REMOVEPD_ACK) + 1);
   
   if (behaviourStep_removePD_v115_main(FALSE) != BEHAVIOUR_STEP_RETURN_NOTHING){ return behaviourStep_removePD_v115_testFail(-1); }
   if (behaviourStep_removePD_v115_internalState != BEHAVIOURSTEP_REMOVEPD_V115_STATEMACHINE_SEND_REMOVEPD_WAIT_ACK){ return behaviourStep_removePD_v115_testFail(-1); }
   if (behaviourStep_removePD_v115_compareReception(expectedTransmission, 4) != TRUE){ return behaviourStep_removePD_v115_testFail(-1); }
 
-  HAL_Delay(BEHAVIOURSTEP_REMOVEPD_V115_TIMEOUTTIME_REMOVEPD_ACK + 1);
+  HAL_Delay(handlerRTT_getBackoffTimeout(handlerRTT_getBackoffTimeout(BEHAVIOURSTEP_REMOVEPD_V115_TIMEOUTTIME_REMOVEPD_ACK)) + 1);
   
   if (behaviourStep_removePD_v115_main(FALSE) != BEHAVIOUR_STEP_RETURN_CRITICAL_ABORT){ return behaviourStep_removePD_v115_testFail(-1); }
   if (behaviourStep_removePD_v115_internalState != BEHAVIOURSTEP_REMOVEPD_V115_STATEMACHINE_NO_NEXT_STATE_FAIL){ return behaviourStep_removePD_v115_testFail(-1); }
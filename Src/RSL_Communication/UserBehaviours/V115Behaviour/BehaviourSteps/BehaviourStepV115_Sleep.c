@@ -26,9 +26,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-18    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Exit function stops the timeout               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Includes the HAL, test waits for the backoff  |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -41,6 +41,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include "stm32l0xx_hal.h"
 #include "MasterDefine.h"
 #include "Message_Definitions.h"
 #include "BehaviourDefines.h"
@@ -52,6 +53,7 @@
 
 #include "UserMethods_Characteristics.h"
 #include "UserMethods_UART.h"
+#include "Handler_RTT.h"
 
 /* Typedefinitions */
 typedef enum BEHAVIOURSTEP_SLEEP_V115_STATEMACHINE {
@@ -70,10 +72,18 @@ typedef enum BEHAVIOURSTEP_SLEEP_V115_STATEMACHINE {
 
 /* Variables */
 BEHAVIOURSTEP_SLEEP_V115_STATEMACHINE_TYPEDEF behaviourStep_sleep_v115_internalState = BEHAVIOURSTEP_SLEEP_V115_STATEMACHINE_SETUP_SEND_GO_TO_SLEEP;
+static TIMER_STRUCT_TYPEDEF timerTimeout;
 
 /* Function definitions */
+/** @brief The controller leaves the step, its timeout must not stay in
+ *         the timer queue.
+ *  @return Nothing.
+ */
+void behaviourStep_sleep_v115_exit(void){
+  timerHandler_timerStop(&timerTimeout);
+}
+
 BEHAVIOUR_STEP_RETURN_VALUES_TYPEDEF behaviourStep_sleep_v115_main(bool init){
-  static TIMER_STRUCT_TYPEDEF timerTimeout;
   bool found;
   uint32_t temp;
   
@@ -185,13 +195,13 @@ int behaviourStep_sleep_v115_main_test(){
   if (behaviourStep_sleep_v115_internalState != BEHAVIOURSTEP_SLEEP_V115_STATEMACHINE_SETUP_WAIT_FOR_ACK){ return behaviourStep_sleep_v115_testFail(-1); }
   if (behaviourStep_sleep_v115_compareReception(expectedTransmission, 4) != TRUE){ return behaviourStep_sleep_v115_testFail(-1); }
   
-  HAL_Delay(BEHAVIOURSTEP_SLEEP_V115_TIMEOUTTIME_GO_TO_SLEEP + 1);
+  HAL_Delay(handlerRTT_getBackoffTimeout(BEHAVIOURSTEP_SLEEP_V115_TIMEOUTTIME_GO_TO_SLEEP) + 1);
   
   if (behaviourStep_sleep_v115_main(FALSE) != BEHAVIOUR_STEP_RETURN_NOTHING){ return behaviourStep_sleep_v115_testFail(-1); }
   if (behaviourStep_sleep_v115_internalState != BEHAVIOURSTEP_SLEEP_V115_STATEMACHINE_SETUP_WAIT_FOR_ACK){ return behaviourStep_sleep_v115_testFail(-1); }
   if (behaviourStep_sleep_v115_compareReception(expectedTransmission, 4) != TRUE){ return behaviourStep_sleep_v115_testFail(-1); }
   
-  HAL_Delay(BEHAVIOURSTEP_SLEEP_V115_TIMEOUTTIME_GO_TO_SLEEP + 1);
+  HAL_Delay(handlerRTT_getBackoffTimeout(handlerRTT_getBackoffTimeout(BEHAVIOURSTEP_SLEEP_V115_TIMEOUTTIME_GO_TO_SLEEP)) + 1);
   
   if (behaviourStep_sleep_v115_main(FALSE) != BEHAVIOUR_STEP_RETURN_CRITICAL_ABORT){ return behaviourStep_sleep_v115_testFail(-1); }
   if (behaviourStep_sleep_v115_internalState != BEHAVIOURSTEP_SLEEP_V115_STATEMACHINE_NO_NEXT_STATE_FAIL){ return behaviourStep_sleep_v115_testFail(-1); }
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Sequence is const                             |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -46,7 +46,7 @@
 /* Variables */
 
 /* Function definitions */
-BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF* behaviourV115_alertBase_prepare_and_get_struct(void);
+const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF* behaviourV115_alertBase_prepare_and_get_struct(void);
 
 #if TEST_BEHAVIOUR_ALERT_V115 >= 1
   int behaviourV115_alertBase_testsuite(void);
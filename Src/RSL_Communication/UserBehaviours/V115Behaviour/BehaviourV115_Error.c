@@ -25,11 +25,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-06-25    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Const step table for the behaviour controller |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Exit functions of the steps                   |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Test includes the HAL                         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -56,486 +56,71 @@
 /* Typedefinitions / Prototypes */
 
 /* Variables */
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_doNothing(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_Action_A(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_Action_B(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_Action_C(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_Action_D(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_loadNextStep(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_redo(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_abort(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_criticalAbort(void);
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_doNothing(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_Action_A(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_Action_B(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_Action_C(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_Action_D(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_loadNextStep(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_redo(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_abort(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_criticalAbort(void);
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_doNothing(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_Action_A(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_Action_B(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_Action_C(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_Action_D(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_loadNextStep(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_redo(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_abort(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_criticalAbort(void);
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_doNothing(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_Action_A(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_Action_B(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_Action_C(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_Action_D(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_loadNextStep(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_redo(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_abort(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_criticalAbort(void);
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_doNothing(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_Action_A(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_Action_B(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_Action_C(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_Action_D(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_loadNextStep(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_redo(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_abort(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_criticalAbort(void);
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_doNothing(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_Action_A(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_Action_B(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_Action_C(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_Action_D(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_loadNextStep(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_redo(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_abort(void);
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_criticalAbort(void);
-
-/* Variables */
-BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF behaviourV115_error = {
-  .initializingBehaviour = BEHAVIOUR_SEQUENCING_STEP_START,
-  .numberOfActualBehaviour = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED,
-  .initNext = FALSE,
-  .stepsOfSequence = {
-    {
-      .behaviourMainFunction                     = behaviourStep_start_v115_main,
-      .behaviourCallbackFunctionNothing          = behaviourV115_error_start_doNothing,
-      .behaviourCallbackFunctionAction_A         = behaviourV115_error_sleep_Action_A,
-      .behaviourCallbackFunctionAction_B         = behaviourV115_error_sleep_Action_B,
-      .behaviourCallbackFunctionAction_C         = behaviourV115_error_sleep_Action_C,
-      .behaviourCallbackFunctionAction_D         = behaviourV115_error_sleep_Action_D,
-      .behaviourCallbackFunctionNextBehaviour    = behaviourV115_error_start_loadNextStep,
-      .behaviourCallbackFunctionRedo             = behaviourV115_error_start_redo,
-      .behaviourCallbackFunctionAbort            = behaviourV115_error_start_abort,
-      .behaviourCallbackFunctionCriticalAbort    = behaviourV115_error_start_criticalAbort
-    },
-    {
-      .behaviourMainFunction                     = behaviourStep_char_error_v115_main,
-      .behaviourCallbackFunctionNothing          = behaviourV115_error_updateCharacteristic_doNothing,
-      .behaviourCallbackFunctionAction_A         = behaviourV115_error_updateCharacteristic_Action_A,
-      .behaviourCallbackFunctionAction_B         = behaviourV115_error_updateCharacteristic_Action_B,
-      .behaviourCallbackFunctionAction_C         = behaviourV115_error_updateCharacteristic_Action_C,
-      .behaviourCallbackFunctionAction_D         = behaviourV115_error_updateCharacteristic_Action_D,
-      .behaviourCallbackFunctionNextBehaviour    = behaviourV115_error_updateCharacteristic_loadNextStep,
-      .behaviourCallbackFunctionRedo             = behaviourV115_error_updateCharacteristic_redo,
-      .behaviourCallbackFunctionAbort            = behaviourV115_error_updateCharacteristic_abort,
-      .behaviourCallbackFunctionCriticalAbort    = behaviourV115_error_updateCharacteristic_criticalAbort,
-    },
-    {
-      .behaviourMainFunction                     = behaviourStep_bc_start_v115_main,
-      .behaviourCallbackFunctionNothing          = behaviourV115_error_startBC_doNothing,
-      .behaviourCallbackFunctionAction_A         = behaviourV115_error_startBC_Action_A,
-      .behaviourCallbackFunctionAction_B         = behaviourV115_error_startBC_Action_B,
-      .behaviourCallbackFunctionAction_C         = behaviourV115_error_startBC_Action_C,
-      .behaviourCallbackFunctionAction_D         = behaviourV115_error_startBC_Action_D,
-      .behaviourCallbackFunctionNextBehaviour    = behaviourV115_error_startBC_loadNextStep,
-      .behaviourCallbackFunctionRedo             = behaviourV115_error_startBC_redo,
-      .behaviourCallbackFunctionAbort            = behaviourV115_error_startBC_abort,
-      .behaviourCallbackFunctionCriticalAbort    = behaviourV115_error_startBC_criticalAbort,
-    },
-    {
-      .behaviourMainFunction                     = behaviourStep_bc_end_wait_to_v115_main,
-      .behaviourCallbackFunctionNothing          = behaviourV115_error_endBCWaitTO_doNothing,
-      .behaviourCallbackFunctionAction_A         = behaviourV115_error_endBCWaitTO_Action_A,
-      .behaviourCallbackFunctionAction_B         = behaviourV115_error_endBCWaitTO_Action_B,
-      .behaviourCallbackFunctionAction_C         = behaviourV115_error_endBCWaitTO_Action_C,
-      .behaviourCallbackFunctionAction_D         = behaviourV115_error_endBCWaitTO_Action_D,
-      .behaviourCallbackFunctionNextBehaviour    = behaviourV115_error_endBCWaitTO_loadNextStep,
-      .behaviourCallbackFunctionRedo             = behaviourV115_error_endBCWaitTO_redo,
-      .behaviourCallbackFunctionAbort            = behaviourV115_error_endBCWaitTO_abort,
-      .behaviourCallbackFunctionCriticalAbort    = behaviourV115_error_endBCWaitTO_criticalAbort,
-    },
-    {
-      .behaviourMainFunction                     = behaviourStep_bc_end_v115_main,
-      .behaviourCallbackFunctionNothing          = behaviourV115_error_endBC_doNothing,
-      .behaviourCallbackFunctionAction_A         = behaviourV115_error_endBC_Action_A,
-      .behaviourCallbackFunctionAction_B         = behaviourV115_error_endBC_Action_B,
-      .behaviourCallbackFunctionAction_C         = behaviourV115_error_endBC_Action_C,
-      .behaviourCallbackFunctionAction_D         = behaviourV115_error_endBC_Action_D,
-      .behaviourCallbackFunctionNextBehaviour    = behaviourV115_error_endBC_loadNextStep,
-      .behaviourCallbackFunctionRedo             = behaviourV115_error_endBC_redo,
-      .behaviourCallbackFunctionAbort            = behaviourV115_error_endBC_abort,
-      .behaviourCallbackFunctionCriticalAbort    = behaviourV115_error_endBC_criticalAbort,
-    },
-    {
-      .behaviourMainFunction                     = behaviourStep_sleep_v115_main,
-      .behaviourCallbackFunctionNothing          = behaviourV115_error_sleep_doNothing,
-      .behaviourCallbackFunctionAction_A         = behaviourV115_error_sleep_Action_A,
-      .behaviourCallbackFunctionAction_B         = behaviourV115_error_sleep_Action_B,
-      .behaviourCallbackFunctionAction_C         = behaviourV115_error_sleep_Action_C,
-      .behaviourCallbackFunctionAction_D         = behaviourV115_error_sleep_Action_D,
-      .behaviourCallbackFunctionNextBehaviour    = behaviourV115_error_sleep_loadNextStep,
-      .behaviourCallbackFunctionRedo             = behaviourV115_error_sleep_redo,
-      .behaviourCallbackFunctionAbort            = behaviourV115_error_sleep_abort,
-      .behaviourCallbackFunctionCriticalAbort    = behaviourV115_error_sleep_criticalAbort,
-    },
+const BEHAVIOUR_STEP_DESCRIPTOR_STRUCT_TYPEDEF behaviourV115_error_steps[] = {
+  // BEHAVIOUR_SEQUENCING_STEP_START: Error -> Start
+  {
+    .behaviourMainFunction   = behaviourStep_start_v115_main,
+    .behaviourExitFunction   = behaviourStep_start_v115_exit,
+    .transitionNextBehaviour = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_1),
+    .transitionRedo          = BEHAVIOUR_TRANSITION_RELOAD(3),
+    .transitionCriticalAbort = BEHAVIOUR_TRANSITION_CRITICAL,
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_1: Error -> Update Characteristic
+  {
+    .behaviourMainFunction   = behaviourStep_char_error_v115_main,
+    .behaviourExitFunction   = behaviourStep_char_error_v115_exit,
+    .transitionNextBehaviour = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_2),
+    .transitionRedo          = BEHAVIOUR_TRANSITION_RELOAD(3),
+    .transitionCriticalAbort = BEHAVIOUR_TRANSITION_CRITICAL,
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_2: Error -> Start Broadcast
+  {
+    .behaviourMainFunction   = behaviourStep_bc_start_v115_main,
+    .behaviourExitFunction   = behaviourStep_bc_start_v115_exit,
+    .transitionNextBehaviour = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_3),
+    .transitionRedo          = BEHAVIOUR_TRANSITION_RELOAD(3),
+    .transitionCriticalAbort = BEHAVIOUR_TRANSITION_CRITICAL,
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_3: Error -> WaitBCEndTO
+  {
+    .behaviourMainFunction   = behaviourStep_bc_end_wait_to_v115_main,
+    .behaviourExitFunction   = behaviourStep_bc_end_wait_to_v115_exit,
+    .transitionAction_A      = BEHAVIOUR_TRANSITION_ACTION(userMethods_characteristics_setTransmissionState_Done),
+    .transitionAction_B      = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_4),
+    .transitionNextBehaviour = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_5),
+    .transitionRedo          = BEHAVIOUR_TRANSITION_RELOAD(3),
+    .transitionCriticalAbort = BEHAVIOUR_TRANSITION_CRITICAL,
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_4: Error -> EndBC
+  {
+    .behaviourMainFunction   = behaviourStep_bc_end_v115_main,
+    .behaviourExitFunction   = behaviourStep_bc_end_v115_exit,
+    .transitionAction_A      = BEHAVIOUR_TRANSITION_ACTION(userMethods_characteristics_setTransmissionState_Done),
+    .transitionNextBehaviour = BEHAVIOUR_TRANSITION_LOAD_STEP(BEHAVIOUR_SEQUENCING_STEP_5),
+    .transitionRedo          = BEHAVIOUR_TRANSITION_RELOAD(3),
+    .transitionCriticalAbort = BEHAVIOUR_TRANSITION_CRITICAL,
+  },
+  // BEHAVIOUR_SEQUENCING_STEP_5: Error -> Sleep
+  {
+    .behaviourMainFunction   = behaviourStep_sleep_v115_main,
+    .behaviourExitFunction   = behaviourStep_sleep_v115_exit,
+    .transitionNextBehaviour = BEHAVIOUR_TRANSITION_FINISHED,
+    .transitionCriticalAbort = BEHAVIOUR_TRANSITION_CRITICAL,
   },
 };
 
-uint32_t error_start_retry_counter;
-uint32_t error_updateCharacteristic_retry_counter;
-uint32_t error_startBC_retry_counter;
-uint32_t error_BCWaitTO_retry_counter;
-uint32_t error_endBC_retry_counter;
-uint32_t error_sleep_retry_counter;
+const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF behaviourV115_error = {
+  .initializingBehaviour = BEHAVIOUR_SEQUENCING_STEP_START,
+  .numberOfSteps = BEHAVIOUR_STEP_COUNT(behaviourV115_error_steps),
+  .stepsOfSequence = behaviourV115_error_steps,
+};
 
 /* Function definitions */
-BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF* behaviourV115_error_prepare_and_get_struct(){
-  error_start_retry_counter = 0;
-  error_updateCharacteristic_retry_counter = 0;
-  error_startBC_retry_counter = 0;
-  error_BCWaitTO_retry_counter = 0;
-  error_endBC_retry_counter = 0;
-  error_sleep_retry_counter = 0;
+const BEHAVIOUR_CONTROLLER_CALL_STRUCT_TYPEDEF* behaviourV115_error_prepare_and_get_struct(){
   userMethods_characteristics_setTransmissionState_None();
   return &behaviourV115_error;
 }
 
-//==============================//
-//  Battery -> Start            //
-//==============================//
-
-// Used to tell behaviourcontroller, that nothing is to do right now. Called because no message yet and such
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_doNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_Action_A(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_Action_B(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_Action_C(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_Action_D(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Used to tell behaviourcontroller, that the next step has to be loaded
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_loadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_1};
-}
-
-// Used to tell behaviourcontroller, that something went wrong and should repeat the whole process
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_redo(){
-  error_start_retry_counter++;
-  if (error_start_retry_counter < 3){
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }else{
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// If the RSL10 answers nothing at all, wrong messages or spams "READY AFTER BOOT UP OK" -> something is wrong
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_start_criticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-//===================================//
-//  Battery -> Update Characteristic //
-//===================================//
-
-// Used to tell behaviourcontroller, that nothing is to do right now. Called because no message yet and such
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_doNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_updateCharacteristic_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_Action_A(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_updateCharacteristic_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_Action_B(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_updateCharacteristic_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_Action_C(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_updateCharacteristic_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_Action_D(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Used to tell behaviourcontroller, that the next step has to be loaded
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_loadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_2};
-}
-
-// Used to tell behaviourcontroller, that something went wrong and should repeat the whole process
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_redo(){
-  error_updateCharacteristic_retry_counter++;
-  if (error_updateCharacteristic_retry_counter < 3){
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }else{
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }
-}
-
-// Not used by behaviourStep_updateCharacteristic_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// If the RSL10 answers nothing at all, wrong messages or spams "READY AFTER BOOT UP OK" -> something is wrong
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_updateCharacteristic_criticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-//==============================//
-//  Battery -> Start Broadcast  //
-//==============================//
-
-// Used to tell behaviourcontroller, that nothing is to do right now. Called because no message yet and such
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_doNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_Action_A(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_Action_B(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_Action_C(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_Action_D(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Used to tell behaviourcontroller, that the next step has to be loaded
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_loadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_3};
-}
-
-// Used to tell behaviourcontroller, that something went wrong and should repeat the whole process
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_redo(){
-  error_startBC_retry_counter++;
-  if (error_startBC_retry_counter < 3){
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }else{
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }
-}
-
-// Not used by behaviourStep_startBC_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// If the RSL10 answers nothing at all, wrong messages or spams "READY AFTER BOOT UP OK" -> something is wrong
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_startBC_criticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-//==============================//
-//  Battery -> WaitBCEndTO      //
-//==============================//
-
-// Used to tell behaviourcontroller, that nothing is to do right now. Called because no message yet and such
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_doNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_Action_A(){
-  userMethods_characteristics_setTransmissionState_Done();
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_Action_B(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_4};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_Action_C(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_Action_D(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Used to tell behaviourcontroller, that the next step has to be loaded
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_loadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_5};
-}
-
-// Used to tell behaviourcontroller, that something went wrong and should repeat the whole process
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_redo(){
-  error_BCWaitTO_retry_counter++;
-  if (error_BCWaitTO_retry_counter < 3){
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }else{
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }
-}
-
-// Not used by behaviourStep_endBCWait_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// If the RSL10 answers nothing at all, wrong messages or spams "READY AFTER BOOT UP OK" -> something is wrong
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBCWaitTO_criticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-//==============================//
-//  Battery -> EndBC            //
-//==============================//
-
-// Used to tell behaviourcontroller, that nothing is to do right now. Called because no message yet and such
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_doNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_Action_A(){
-  userMethods_characteristics_setTransmissionState_Done();
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_Action_B(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_Action_C(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_Action_D(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Used to tell behaviourcontroller, that the next step has to be loaded
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_loadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_LOAD_NEXT_BEHAVIOUR_STEP, .nextStep = BEHAVIOUR_SEQUENCING_STEP_5};
-}
-
-// Used to tell behaviourcontroller, that something went wrong and should repeat the whole process
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_redo(){
-  error_endBC_retry_counter++;
-  if (error_endBC_retry_counter < 3){
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RELOAD_BEHAVIOUR, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }else{
-    return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-  }
-}
-
-// Not used by behaviourStep_endBCWait_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// If the RSL10 answers nothing at all, wrong messages or spams "READY AFTER BOOT UP OK" -> something is wrong
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_endBC_criticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-//==============================//
-//  Battery -> Sleep            //
-//==============================//
-
-// Used to tell behaviourcontroller, that nothing is to do right now. Called because no message yet and such
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_doNothing(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_Action_A(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_Action_B(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_Action_C(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_start_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_Action_D(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Used to tell the behaviourcontroller, that the actual step ended. In this case this was the last behaviourstep
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_loadNextStep(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_FINISHED_BEHAVIOUR, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_sleep_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_redo(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-// Not used by behaviourStep_sleep_v115_main
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_abort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_DO_NOTHING, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
-BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_criticalAbort(){
-  return (BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF){.command = BEHAVIOUR_CONTROLLER_RETURN_CRITICAL, .nextStep = BEHAVIOUR_SEQUENCING_STEP_UNDEFINED};
-}
-
 
 #if TEST_BEHAVIOUR_ERROR_V115 >= 1
 
@@ -544,6 +129,7 @@ BEHAVIOUR_CONTROLLER_COMMAND_STRUCT_TYPEDEF behaviourV115_error_sleep_criticalAb
 #include "Message_Definitions.h"
 #include "BehaviourController.h"
 #include "Logic.h"
+#include "stm32l0xx_hal.h"
 
 uint8_t *behaviourV115_error_testBuffer;
 uint32_t behaviourV115_error_lengthBuffer;
@@ -27,9 +27,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Persist the round trip time baseline          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Critical sections                             |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -42,6 +42,7 @@
 #include <inttypes.h>
 #include "UserMethods_Characteristics.h"
 #include "Watchdog.h"
+#include "EEPROM_ApplicationMapped.h"
 
 #include "stm32l0xx_hal.h"
 /* Typedefinitions */
@@ -108,6 +109,24 @@ void userMethods_characteristics_waitTime(uint32_t waitTime){
   return;
 }
 
+/** @brief This method will lock out the interrupts, e.g. while a list the
+ *         interrupts work on too gets changed. Critical sections may nest.
+ *  @return The former interrupt mask, give it to exitCritical.
+ */
+uint32_t userMethods_characteristics_enterCritical(void){
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+}
+
+/** @brief This method will end a critical section of enterCritical
+ *  @param primask The interrupt mask enterCritical returned
+ *  @return Nothing.
+ */
+void userMethods_characteristics_exitCritical(uint32_t primask){
+  __set_PRIMASK(primask);
+}
+
 /***********************************************
  *  FUNCTIONGROUP CHARACTERISTIC ALERT
  ***********************************************/
@@ -229,3 +248,23 @@ USERMETHODS_CHARACTERISTICS_TRANSMISSION_STATE_TYPEDEF userMethods_characteristi
   return userMethods_characteristics_transmissionState;
 }
 
+/***********************************************
+ *  FUNCTIONGROUP ROUND TRIP TIME
+ ***********************************************/
+
+/** @brief This method will read the persisted round trip time baseline.
+ *  @param *baseline Pointer where to put the baseline.
+ *  @return TRUE if there is one, FALSE else.
+ */
+bool userMethods_characteristics_loadRttBaseline(uint32_t *baseline){
+  return eeprom_getRttBaseline(baseline);
+}
+
+/** @brief This method will persist the round trip time baseline.
+ *  @param baseline The baseline.
+ *  @return Nothing.
+ */
+void userMethods_characteristics_storeRttBaseline(uint32_t baseline){
+  eeprom_setRttBaseline(baseline);
+}
+
@@ -27,9 +27,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments & doxygen commentaries         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Persist the round trip time baseline          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Critical sections                             |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include "MasterDefine.h"
 
 /* Typedefinitions */
 
@@ -98,6 +99,18 @@ uint32_t userMethods_characteristics_getTime(void);
  */
 void userMethods_characteristics_waitTime(uint32_t waitTime);
 
+/** @brief This method will lock out the interrupts, e.g. while a list the
+ *         interrupts work on too gets changed. Critical sections may nest.
+ *  @return The former interrupt mask, give it to exitCritical.
+ */
+uint32_t userMethods_characteristics_enterCritical(void);
+
+/** @brief This method will end a critical section of enterCritical
+ *  @param primask The interrupt mask enterCritical returned
+ *  @return Nothing.
+ */
+void userMethods_characteristics_exitCritical(uint32_t primask);
+
 /***********************************************
  *  FUNCTIONGROUP CHARACTERISTIC ALERT
  ***********************************************/
@@ -191,4 +204,20 @@ void userMethods_characteristics_setTransmissionState_Done(void);
  */
 USERMETHODS_CHARACTERISTICS_TRANSMISSION_STATE_TYPEDEF userMethods_characteristics_getTransmissionState(void);
 
+/***********************************************
+ *  FUNCTIONGROUP ROUND TRIP TIME
+ ***********************************************/
+
+/** @brief This method will read the persisted round trip time baseline.
+ *  @param *baseline Pointer where to put the baseline.
+ *  @return TRUE if there is one, FALSE else.
+ */
+bool userMethods_characteristics_loadRttBaseline(uint32_t *baseline);
+
+/** @brief This method will persist the round trip time baseline.
+ *  @param baseline The baseline.
+ *  @return Nothing.
+ */
+void userMethods_characteristics_storeRttBaseline(uint32_t baseline);
+
 #endif
\ No newline at end of file
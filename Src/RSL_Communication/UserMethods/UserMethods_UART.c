@@ -27,11 +27,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments, test and the debug CB         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Queued transmission and its callback          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Byte feed for tests, note instead of #warning |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Note the tick a frame left the UART           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -47,6 +47,7 @@
 #include "RingbufferWrapper.h"
 #include "Parser.h"
 #include "UserMethods_UART.h"
+#include "UserMethods_Characteristics.h"
 #include "UART_RSL.h"
 
 #include "stm32l0xx_hal.h"
@@ -58,43 +59,123 @@
   */
 uartCallback debugCallbackTransmission  = NULL;
 
+/** \brief userMethodsUartFrameEndTime, userMethodsUartFrameEndNumber
+  *        The ticks the last frames left the UART at, indexed by their number
+  *        modulo UART_RSL_TX_FRAMES. The number is kept along to tell a stale
+  *        entry from the one asked for.
+  */
+static uint32_t userMethodsUartFrameEndTime[UART_RSL_TX_FRAMES];
+static uint32_t userMethodsUartFrameEndNumber[UART_RSL_TX_FRAMES];
+
 /* Function definitions */
 
 /** @brief This method will be called when the stack wants to transfer bytes.
+ *         The bytes get queued and the method returns at once, so the stack
+ *         keeps parsing while they leave. The buffer may be reused right away.
  *  @param lengthBuffer is the count of bytes to transmit.
  *  @param *buffer is the pointer to the position within the byte field to be transmitted.
- *  @return The count of bytes that was transmitted.
+ *  @return The count of bytes that was queued for transmission.
  */
 uint32_t userMethods_uartTransmit(uint32_t lengthBuffer, uint8_t *buffer){
 #if TEST_ACTIVATE_UART_CALLBACK == 1
   if (debugCallbackTransmission != NULL){
     debugCallbackTransmission(buffer, lengthBuffer);
   }
-  #warning THE UART WILL SEND NOTHING DUE TO TEST MODE BEING ACTIVE
+  // THE UART WILL SEND NOTHING DUE TO TEST MODE BEING ACTIVE
+  return lengthBuffer;
 #else
-  uart_rsl_transmit(lengthBuffer, buffer);
+  return uart_rsl_transmit(lengthBuffer, buffer);
+#endif
+}
+
+/** @brief This method will give the number of the frame queued last by
+ *         userMethods_uartTransmit, to ask for the end of its transmission
+ *         later on.
+ *  @return The number of the frame.
+ */
+uint32_t userMethods_uartGetLastFrame(void){
+  return uart_rsl_getFrameHead() - 1;
+}
+
+/** @brief This method will tell if a queued frame left the UART and when.
+ *  @param frame The number of the frame, see userMethods_uartGetLastFrame
+ *  @param *time Gets the tick the frame left the UART. It stays as it is if
+ *         that is not known (test mode, frame dropped or too long ago).
+ *  @return TRUE if the frame is out of the queue, FALSE if it still waits.
+ */
+bool userMethods_uartGetFrameEnd(uint32_t frame, uint32_t *time){
+#if TEST_ACTIVATE_UART_CALLBACK == 1
+  // THE UART WILL SEND NOTHING DUE TO TEST MODE BEING ACTIVE
+  return TRUE;
+#else
+  uint32_t primask;
+  
+  // Is the frame still in the queue?
+  if ((int32_t) (uart_rsl_getFrameTail() - frame) <= 0){
+    // Yes
+    return FALSE;
+  }
+  // No, the interrupt must not write the entry while it is read
+  primask = userMethods_characteristics_enterCritical();
+  if (userMethodsUartFrameEndNumber[frame % UART_RSL_TX_FRAMES] == frame){
+    *time = userMethodsUartFrameEndTime[frame % UART_RSL_TX_FRAMES];
+  }
+  userMethods_characteristics_exitCritical(primask);
+  return TRUE;
 #endif
-  return lengthBuffer;
 }
 
-/** @brief This method must be called by the user, if a byte was recepted.
- *         The function will reset an onging integrity timer and push the byte
- *         in the reception buffer. It will start another reception.
+/** @brief This method must be called by the user, if the UART completed a
+ *         transmission (transmission complete interrupt). It hands the next
+ *         queued bytes to the UART and notes when a frame left it.
+ *  @param time is the actual tick (-> HAL_GetTick() )
+ *  @return Nothing.
+ */
+void userMethods_uartTransmissionCallback(uint32_t time){
+  uint32_t frame;
+  
+  // Did a whole frame leave the UART?
+  if (uart_rsl_transmissionCompleted() == TRUE){
+    // Yes, it is the one before the tail
+    frame = uart_rsl_getFrameTail() - 1;
+    userMethodsUartFrameEndTime[frame % UART_RSL_TX_FRAMES] = time;
+    userMethodsUartFrameEndNumber[frame % UART_RSL_TX_FRAMES] = frame;
+  }
+}
+
+/** @brief This method must be called by the user, if bytes were recepted
+ *         (DMA half / full transfer or idle line). The function will reset an
+ *         onging integrity timer and push all new bytes in the reception
+ *         buffer. The reception keeps running in the background.
  *  @param time is the actual tick (-> HAL_GetTick() )
  *  @return Nothing.
  */
 void userMethods_uartReceptionCallback(uint32_t time){
-  parser_timerMessageIntegrityStartISP(time);
-  ringbufferWrapper_putByte(uart_rsl_getReceptedByte());
-  uart_rsl_startReception();
+  uint8_t *bytes;
+  uint32_t length;
+  
+  length = uart_rsl_getReceptedBytes(&bytes);
+  // Are there new bytes?
+  if (length > 0){
+    // Yes
+    parser_timerMessageIntegrityStartISP(time);
+  }
+  // A wrapped around DMA buffer comes in two parts
+  while (length > 0){
+    ringbufferWrapper_putBytes(bytes, length);
+    uart_rsl_releaseReceptedBytes(length);
+    length = uart_rsl_getReceptedBytes(&bytes);
+  }
 }
 
 /** @brief This method must be called by the user, if there was a uart error.
- *         This function will start another reception.
+ *         This function will fetch the bytes recepted so far and start
+ *         another reception, if the error stopped it.
  *  @param time is the actual tick (-> HAL_GetTick() )
  *  @return Nothing.
  */
 void userMethods_uartError(uint32_t time){
+  userMethods_uartReceptionCallback(time);
   parser_timerMessageIntegrityStartISP(time);
   uart_rsl_startReception();
 }
@@ -119,6 +200,11 @@ void userMethods_txRegisterCallbackForTransmission(uartCallback func){
   debugCallbackTransmission = func;
 }
 
+void userMethods_uartReceivedByte(uint32_t time, uint8_t byte){
+  parser_timerMessageIntegrityStartISP(time);
+  ringbufferWrapper_putBytes(&byte, 1);
+}
+
 #endif
 
 #if TEST_USERMETHODS_UART >= 1
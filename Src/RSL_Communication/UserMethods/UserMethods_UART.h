@@ -27,11 +27,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 002       | 2020-06-15    | Tim Steinberg         | Added comments, test and the debug CB         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Queued transmission and its callback          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | userMethods_uartReceivedByte for tests        |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Note the tick a frame left the UART           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
@@ -44,6 +44,7 @@
 #include <stdlib.h>
 #include <inttypes.h>
 #include "Test_Selector.h"
+#include "MasterDefine.h"
 
 /* Typedefinitions */
 /**
@@ -58,22 +59,49 @@ typedef void(*uartCallback)(uint8_t*, uint32_t len);
 /* Function definitions */
 
 /** @brief This method will be called when the stack wants to transfer bytes.
+ *         The bytes get queued and the method returns at once, so the stack
+ *         keeps parsing while they leave. The buffer may be reused right away.
  *  @param lengthBuffer is the count of bytes to transmit.
  *  @param *buffer is the pointer to the position within the byte field to be transmitted.
- *  @return The count of bytes that was transmitted.
+ *  @return The count of bytes that was queued for transmission.
  */
 uint32_t userMethods_uartTransmit(uint32_t lengthBuffer, uint8_t *buffer);
 
-/** @brief This method must be called by the user, if a byte was recepted.
- *         The function will reset an onging integrity timer and push the byte
- *         in the reception buffer. It will start another reception.
+/** @brief This method will give the number of the frame queued last by
+ *         userMethods_uartTransmit, to ask for the end of its transmission
+ *         later on.
+ *  @return The number of the frame.
+ */
+uint32_t userMethods_uartGetLastFrame(void);
+
+/** @brief This method will tell if a queued frame left the UART and when.
+ *  @param frame The number of the frame, see userMethods_uartGetLastFrame
+ *  @param *time Gets the tick the frame left the UART. It stays as it is if
+ *         that is not known (test mode, frame dropped or too long ago).
+ *  @return TRUE if the frame is out of the queue, FALSE if it still waits.
+ */
+bool userMethods_uartGetFrameEnd(uint32_t frame, uint32_t *time);
+
+/** @brief This method must be called by the user, if the UART completed a
+ *         transmission (transmission complete interrupt). It hands the next
+ *         queued bytes to the UART and notes when a frame left it.
+ *  @param time is the actual tick (-> HAL_GetTick() )
+ *  @return Nothing.
+ */
+void userMethods_uartTransmissionCallback(uint32_t time);
+
+/** @brief This method must be called by the user, if bytes were recepted
+ *         (DMA half / full transfer or idle line). The function will reset an
+ *         onging integrity timer and push all new bytes in the reception
+ *         buffer. The reception keeps running in the background.
  *  @param time is the actual tick (-> HAL_GetTick() )
  *  @return Nothing.
  */
 void userMethods_uartReceptionCallback(uint32_t time);
 
 /** @brief This method must be called by the user, if there was a uart error.
- *         This function will start another reception.
+ *         This function will fetch the bytes recepted so far and start
+ *         another reception, if the error stopped it.
  *  @param time is the actual tick (-> HAL_GetTick() )
  *  @return Nothing.
  */
@@ -95,6 +123,14 @@ void userMethods_startReception();
  *  @return Nothing.
  */
 void userMethods_txRegisterCallbackForTransmission(uartCallback func);
+
+/** @brief This will be used by tests to feed a byte as if the RSL module had
+ *         sent it. It takes the same path as the DMA reception.
+ *  @param time is the actual tick (-> HAL_GetTick() )
+ *  @param byte is the recepted byte.
+ *  @return Nothing.
+ */
+void userMethods_uartReceivedByte(uint32_t time, uint8_t byte);
 #endif
 
 #if TEST_USERMETHODS_UART >= 1
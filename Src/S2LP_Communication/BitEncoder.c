@@ -0,0 +1,207 @@
+/**
+  ******************************************************************************
+  * @file       BitEncoder.c
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Packed bit encoder (HDLC stuffing, NRZ-I) of 869MHz
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | Several bits at once                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "MasterDefine.h"
+#include "BitEncoder.h"
+
+/* Typedefinitions / Prototypes */
+// Entry of the stuffing table for a byte that holds a full run of 1s itself
+#define BITENCODER_STUFFING_RUN_INSIDE                  0xFF
+
+/* Variables */
+
+/** \brief bitEncoder_stuffingTable The count of leading 1s (upper nibble) and
+  *        trailing 1s (lower nibble) of every byte value, MSB first.
+  *        BITENCODER_STUFFING_RUN_INSIDE if the byte holds a run of 5 1s.
+  */
+static const uint8_t bitEncoder_stuffingTable[256] = {
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFF,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xFF,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFF,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x14,
+  0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0xFF,
+  0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x14,
+  0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0x10, 0x13, 0x10, 0x11, 0x10, 0x12, 0x10, 0x11, 0xFF, 0xFF,
+  0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0x23, 0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0x24,
+  0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0x23, 0x20, 0x21, 0x20, 0x22, 0x20, 0x21, 0x20, 0xFF,
+  0x30, 0x31, 0x30, 0x32, 0x30, 0x31, 0x30, 0x33, 0x30, 0x31, 0x30, 0x32, 0x30, 0x31, 0x30, 0x34,
+  0x40, 0x41, 0x40, 0x42, 0x40, 0x41, 0x40, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/* Function definitions */
+
+void bitEncoder_init(BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t *words, uint32_t countOfWords){
+  encoder->words = words;
+  encoder->countOfWords = countOfWords;
+  encoder->countOfBitsUsed = 0;
+}
+
+bool bitEncoder_appendBits(BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t value, uint32_t count){
+  uint32_t index;
+  uint32_t offset;
+  
+  if (count == 0){
+    return TRUE;
+  }
+  // Does it fit in?
+  if ((count > 32) || ((encoder->countOfWords << 5) - encoder->countOfBitsUsed < count)){
+    // No
+    return FALSE;
+  }
+  // Left align the bits, this drops everything above them
+  value <<= (32 - count);
+  index = encoder->countOfBitsUsed >> 5;
+  offset = encoder->countOfBitsUsed & 0x1F;
+  // Does it start a new word?
+  if (offset == 0){
+    // Yes, the bits behind the used ones are 0 then as well
+    encoder->words[index] = value;
+  }else{
+    // No, fill up the word and spill the rest into the next one
+    encoder->words[index] |= value >> offset;
+    if (offset + count > 32){
+      encoder->words[index + 1] = value << (32 - offset);
+    }
+  }
+  encoder->countOfBitsUsed += count;
+  return TRUE;
+}
+
+bool bitEncoder_appendStuffed(BITENCODER_STRUCT_TYPEDEF *encoder, const uint8_t *bytes, uint32_t countOfBytes, uint8_t *countOfOnes){
+  uint8_t ones = *countOfOnes;
+  uint8_t entry;
+  uint8_t bit;
+  
+  for (uint32_t i = 0; i < countOfBytes; i++){
+    entry = bitEncoder_stuffingTable[bytes[i]];
+    // Does the byte complete a run of 1s?
+    if ((entry != BITENCODER_STUFFING_RUN_INSIDE) && ((ones + (entry >> 4)) < BITENCODER_STUFFING_RUN_LENGTH)){
+      // No, it goes in as a whole and the field ends with its trailing 1s
+      if (bitEncoder_appendBits(encoder, bytes[i], 8) == FALSE){
+        return FALSE;
+      }
+      ones = entry & 0x0F;
+      continue;
+    }
+    // Yes, go through it bit by bit
+    for (bit = 0x80; bit > 0; bit >>= 1){
+      if ((bytes[i] & bit) == 0){
+        if (bitEncoder_appendBits(encoder, 0, 1) == FALSE){
+          return FALSE;
+        }
+        ones = 0;
+        continue;
+      }
+      if (bitEncoder_appendBits(encoder, 1, 1) == FALSE){
+        return FALSE;
+      }
+      ones++;
+      if (ones == BITENCODER_STUFFING_RUN_LENGTH){
+        // Plug in the filling 0
+        if (bitEncoder_appendBits(encoder, 0, 1) == FALSE){
+          return FALSE;
+        }
+        ones = 0;
+      }
+    }
+  }
+  *countOfOnes = ones;
+  return TRUE;
+}
+
+void bitEncoder_nrzi(BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t firstBit, uint8_t level){
+  uint32_t position = firstBit;
+  uint32_t levelMask = (level != 0) ? 0xFFFFFFFF : 0x00000000;
+  uint32_t index;
+  uint32_t mask;
+  uint32_t coded;
+  
+  while (position < encoder->countOfBitsUsed){
+    index = position >> 5;
+    // The bits of this word that get coded
+    mask = 0xFFFFFFFF >> (position & 0x1F);
+    if (encoder->countOfBitsUsed - (index << 5) < 32){
+      mask &= ~(0xFFFFFFFF >> (encoder->countOfBitsUsed & 0x1F));
+    }
+    // Every 0 toggles the level, so the level of a bit is the parity of the
+    // 0s up to it. The shifts sum that parity up over the whole word at once.
+    coded = ~encoder->words[index] & mask;
+    coded ^= coded >> 1;
+    coded ^= coded >> 2;
+    coded ^= coded >> 4;
+    coded ^= coded >> 8;
+    coded ^= coded >> 16;
+    coded = (coded ^ levelMask) & mask;
+    encoder->words[index] = (encoder->words[index] & ~mask) | coded;
+    // The last coded bit is the level in front of the next word
+    levelMask = ((coded & (mask & (~mask + 1))) != 0) ? 0xFFFFFFFF : 0x00000000;
+    position = (index + 1) << 5;
+  }
+}
+
+uint8_t bitEncoder_getBit(const BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t position){
+  if (position >= encoder->countOfBitsUsed){
+    return 0;
+  }
+  return (uint8_t) ((encoder->words[position >> 5] >> (31 - (position & 0x1F))) & 0x01);
+}
+
+uint32_t bitEncoder_getBits(const BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t position, uint32_t count){
+  uint32_t index = position >> 5;
+  uint64_t window;
+  
+  if ((count == 0) || (count > 32) || (position >= encoder->countOfBitsUsed)){
+    return 0;
+  }
+  // Both words the bits may be spread over, the first one on top
+  window = ((uint64_t) encoder->words[index]) << 32;
+  if (index + 1 < encoder->countOfWords){
+    window |= encoder->words[index + 1];
+  }
+  return (uint32_t) ((window << (position & 0x1F)) >> (64 - count));
+}
@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file       BitEncoder.h
+  * @author     Tim Steinberg
+  * @date       18.10.2026
+  * @brief      Packed bit encoder (HDLC stuffing, NRZ-I) of 869MHz
+  ******************************************************************************
+  * Redistribution in source and binary forms, with or without modification,
+  * are not permitted. Use in source code needs the written approval of the author.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  ******************************************************************************
+  *~~~
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | Version   | Date          | Author                | Comments and changes                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 001       | 2026-10-18    | Tim Steinberg         | Initial version / skeleton of file            |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 002       | 2026-10-18    | Tim Steinberg         | Several bits at once                          |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * |           |               |                       |                                               |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  *~~~
+  */
+
+#ifndef __BITENCODER_H
+#define __BITENCODER_H
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "MasterDefine.h"
+
+/* Typedefinitions */
+
+/**
+ * @brief A field of bits packed into words. The bits are sent MSB first, so
+ *        bit 0 of the field is bit 31 of words[0]. The bits behind
+ *        countOfBitsUsed are always 0. No timing is stored with the bits,
+ *        every bit is sent for the same length.
+ */
+typedef struct BITENCODER_STRUCT {
+  uint32_t *words;              /**< The storage of the bits */
+  uint32_t countOfWords;        /**< The length of the storage in words */
+  uint32_t countOfBitsUsed;     /**< The count of bits in the field */
+} BITENCODER_STRUCT_TYPEDEF;
+
+// The count of words needed to store a count of bits
+#define BITENCODER_WORDS_FOR_BITS(bits)                 (((bits) + 31) >> 5)
+
+// HDLC puts a 0 behind this count of consecutive 1s
+#define BITENCODER_STUFFING_RUN_LENGTH                  5
+
+/* Variables */
+
+/* Function declarations */
+
+/** @brief This method will set up an empty field on a given storage.
+ *  @param *encoder The field.
+ *  @param *words The storage of the bits.
+ *  @param countOfWords The length of the storage in words.
+ *  @return Nothing.
+ */
+void bitEncoder_init(BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t *words, uint32_t countOfWords);
+
+/** @brief This method will append the lower bits of a value, the highest of
+ *         them is sent first.
+ *  @param *encoder The field.
+ *  @param value The bits, right aligned.
+ *  @param count The count of bits to append, 0 to 32.
+ *  @return TRUE upon success, FALSE if the storage is too short.
+ */
+bool bitEncoder_appendBits(BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t value, uint32_t count);
+
+/** @brief This method will append bytes with HDLC bit stuffing. A byte that
+ *         can't complete a run of 1s is appended as a whole.
+ *  @param *encoder The field.
+ *  @param *bytes The bytes, each sent MSB first.
+ *  @param countOfBytes The count of bytes.
+ *  @param *countOfOnes The count of 1s the field ends with, carried from one
+ *         call to the next. Start with 0.
+ *  @return TRUE upon success, FALSE if the storage is too short.
+ */
+bool bitEncoder_appendStuffed(BITENCODER_STRUCT_TYPEDEF *encoder, const uint8_t *bytes, uint32_t countOfBytes, uint8_t *countOfOnes);
+
+/** @brief This method will NRZ-I code the field from a bit on to its end in
+ *         place. A 0 toggles the level, a 1 keeps it. This is the coding of
+ *         nrz_i() with SIGN_ZERO for a level of 1.
+ *  @param *encoder The field.
+ *  @param firstBit The first bit to code, the bits in front stay as they are.
+ *  @param level The level in front of the first bit, 0 or 1.
+ *  @return Nothing.
+ */
+void bitEncoder_nrzi(BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t firstBit, uint8_t level);
+
+/** @brief This method will give a bit of the field.
+ *  @param *encoder The field.
+ *  @param position The position of the bit.
+ *  @return 0 or 1, 0 behind the used bits.
+ */
+uint8_t bitEncoder_getBit(const BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t position);
+
+/** @brief This method will give several bits of the field at once.
+ *  @param *encoder The field.
+ *  @param position The position of the first bit.
+ *  @param count The count of bits, 32 at most.
+ *  @return The bits, the first one in the highest of the count bits, 0 behind
+ *          the used bits.
+ */
+uint32_t bitEncoder_getBits(const BITENCODER_STRUCT_TYPEDEF *encoder, uint32_t position, uint32_t count);
+
+#endif
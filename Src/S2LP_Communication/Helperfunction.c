@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-09    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | initializeBitfield copies bytes, not bits     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Fixed the bit test of initializeBitfield      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -82,19 +82,20 @@ void flipBitInPosition(uint8_t *array, uint32_t position){
 #include "App_868MHz_MessageBuilder.h"
 
 void initializeBitfield(uint8_t *arrayWithBits, uint32_t bitCount, bitfield *bits, uint16_t timeZero, uint16_t timeOne){
-  for (uint32_t i = 0; i < bitCount; i++){
+  // One entry holds 8 bits
+  for (uint32_t i = 0; i < ((bitCount + 7) >> 3); i++){
     bits->bitsToSend[i].bitfield = arrayWithBits[i];
   }
   bits->countOfBitsUsed = bitCount;
   
   for (uint32_t i = 0; i < bits->countOfBitsUsed; i++){
     // Is the actual bit space a 0 or 1?
-    if (bits->bitsToSend[i >> 3].bitfield >> (7 - i & 0x07) == 0){
+    if (((bits->bitsToSend[i >> 3].bitfield >> ((7 - i) & 0x07)) & 0x01) == 0){
       // It's 0
-      bits->bitsToSend[i >> 3].bitfieldTimes[7 - i & 0x07] = timeZero;
+      bits->bitsToSend[i >> 3].bitfieldTimes[(7 - i) & 0x07] = timeZero;
     }else{
       // It's 1
-      bits->bitsToSend[i >> 3].bitfieldTimes[7 - i & 0x07] = timeOne;
+      bits->bitsToSend[i >> 3].bitfieldTimes[(7 - i) & 0x07] = timeOne;
     }
   }
 }
\ No newline at end of file
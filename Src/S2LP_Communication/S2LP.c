@@ -25,32 +25,54 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Include names match the file names            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Packet mode with TX FIFO and interrupts       |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | Wakes out of STANDBY, waits on the state      |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 005       | 2026-10-18    | Tim Steinberg         | Register shadow, only changes get written     |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 006       | 2026-10-18    | Tim Steinberg         | Notes instead of #warning                     |
+  * |-----------|---------------|-----------------------|-----------------------------------------------|
+  * | 007       | 2026-10-18    | Tim Steinberg         | Shut down if it does not get READY            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   *~~~
   */
 
 /* Includes */
+#include <string.h>
 #include "stm32l0xx_hal.h"
-#include "Masterdefine.h"
+#include "MasterDefine.h"
 #include "GPIO.h"
 #include "Watchdog.h"
 #include "S2LP_Configuration.h"
 #include "EEPROM_ApplicationMapped.h"
 #include "Led.h"
 #include "SPI.h"
+#include "S2LP.h"
+
+#if (TEST_S2LP >= 1) && defined(HOST_BUILD)
+#include "Debug.h"
+#include "HAL_Sim.h"
+#include "S2LP_Sim.h"
+#endif
 
 /* Typedefinitions / Prototypes */
 extern SPI_HandleTypeDef hspi1;
 
 void S2LP_SpiWriteRegisters(uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBuffer);
 void S2LP_SpiReadRegisters(uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBuffer);
+void S2LP_SpiCommandStrobes(uint8_t cCommandCode);
+
+/**
+ * @brief The power states the driver keeps the S2LP in.
+ */
+typedef enum S2LP_POWER_VALUES {
+  S2LP_POWER_OFF                                = 0x00, /**< SDN high, the registers are lost */
+  S2LP_POWER_RETAINED                           = 0x01, /**< STANDBY, the registers are kept, clock and SPI are off */
+  S2LP_POWER_ACTIVE                             = 0x02, /**< READY or above */
+} S2LP_POWER_VALUES_TYPEDEF;
 
 /** @defgroup SPI_Headers
 * @{
@@ -62,6 +84,31 @@ void S2LP_SpiReadRegisters(uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBuf
 
 #define LINEAR_FIFO_ADDRESS 0xFF  /*!< Linear FIFO address*/
 
+#define PCKTCTRL1_ADDRESS     0x30 /*!< TX source of the packet handler*/
+#define PCKTLEN1_ADDRESS      0x31 /*!< Packet length, high byte*/
+#define TX_FIFO_STATUS_ADDRESS 0x8F /*!< Count of bytes in the TX FIFO*/
+#define IRQ_STATUS3_ADDRESS   0xFA /*!< First of the four IRQ_STATUS registers*/
+#define MC_STATE0_ADDRESS     0x8E /*!< State of the main controller*/
+
+#define MC_STATE0_XO_ON       0x01 /*!< The oscillator runs*/
+#define MC_STATE_READY        0x00 /*!< MC_STATE0 >> 1 in READY*/
+#define MC_STATE_STANDBY      0x02 /*!< MC_STATE0 >> 1 in STANDBY*/
+#define MC_STATE_LOCKON       0x0C /*!< MC_STATE0 >> 1 with the synthesizer locked*/
+#define MC_STATE_TX           0x5C /*!< MC_STATE0 >> 1 in TX*/
+
+// The longest wait for a state, the fixed delays took about as long before
+#define S2LP_STATE_TIMEOUT_MS 15
+// The longest SPI transfer, a full FIFO takes < 1 ms
+#define S2LP_SPI_TIMEOUT_MS   10
+
+// The registers below this address are the configuration, only a reset of
+// the chip changes them. The status registers above and the FIFO are volatile
+// and always read from the chip
+#define S2LP_SHADOW_SIZE      0x80
+// Up to this many unchanged registers between two changed ones are written
+// along, a new transaction costs the two header bytes and a CS cycle
+#define S2LP_SHADOW_MAX_GAP   2
+
 /** @defgroup SPI_Private_Macros
 * @{
 */
@@ -73,6 +120,14 @@ void S2LP_SpiReadRegisters(uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBuf
 /* Variables */
 uint8_t S2LP_ErrorCode[2];
 
+// The mode of the last power up, the shutdown releases its pins
+static S2LP_MODE_VALUES_TYPEDEF s2lpMode = S2LP_MODE_DIRECT_GPIO;
+static S2LP_POWER_VALUES_TYPEDEF s2lpPower = S2LP_POWER_OFF;
+// The configuration registers as the chip holds them, a bit of
+// s2lpShadowKnown is set once the register got written or read
+static uint8_t s2lpShadow[S2LP_SHADOW_SIZE];
+static uint8_t s2lpShadowKnown[S2LP_SHADOW_SIZE / 8];
+
 void S2LP_ZeroArray(uint8_t *array, uint32_t length){
   for (int i = 0; i < length; i++){
     array[i] = 0;
@@ -80,14 +135,24 @@ void S2LP_ZeroArray(uint8_t *array, uint32_t length){
 }
 
 /* Function definitions */
-void S2LP_PowerUp(void)
-{ 
-  uint8_t addr;
-  uint8_t noOfBytes;
-  uint8_t *bytearr;
-  uint8_t eepromArr[12];
-  uint8_t readArr[255];
+static void S2LP_ShadowInvalidate(void){
+  memset(s2lpShadowKnown, 0, sizeof(s2lpShadowKnown));
+}
+
+static bool S2LP_ShadowHolds(uint8_t address, uint8_t value){
+  return (((s2lpShadowKnown[address >> 3] & (1 << (address & 0x07))) != 0) && (s2lpShadow[address] == value)) ? TRUE : FALSE;
+}
+
+static void S2LP_ShadowUpdate(uint8_t address, uint8_t count, uint8_t *values){
+  uint8_t i;
   
+  for (i = 0; i < count; i++){
+    s2lpShadow[address + i] = values[i];
+    s2lpShadowKnown[(address + i) >> 3] |= (1 << ((address + i) & 0x07));
+  }
+}
+
+static void S2LP_ClockOn(void){
   switch(eeprom_getS2LP_ClocksourceSelector()){
     case CLOCKTYPE_SELECTOR_TCXO:
       gpio_tcxo_on(); // TCXO enable!
@@ -102,41 +167,84 @@ void S2LP_PowerUp(void)
       led_red();
       break;
   }
+}
+
+static void S2LP_ClockOff(void){
+  switch(eeprom_getS2LP_ClocksourceSelector()){
+    case CLOCKTYPE_SELECTOR_TCXO:
+      gpio_tcxo_off(); // TCXO enable!
+      break;
+      
+    case CLOCKTYPE_SELECTOR_XTAL:
+      gpio_xtal_off(); // XTAL enable!
+      break;
+      
+    default:
+      gpio_ledOutputMode();
+      led_red();
+      break;
+  }
+}
+
+/** @brief Polls the main controller until it reached the state. READY also
+ *         needs the oscillator to run.
+ *  @param state The MC_STATE_x to wait for.
+ *  @return TRUE if reached, FALSE after S2LP_STATE_TIMEOUT_MS.
+ */
+static bool S2LP_WaitForState(uint8_t state){
+  uint32_t start = HAL_GetTick();
+  uint8_t mcState0[1];
   
-  HAL_Delay(10);
-  gpio_s2lp_pinCS_init();
-  gpio_s2lp_pinShutdown_setToRunmode();
-  HAL_Delay(1);
-  
-  bytearr = S2LP_getConfigBlock_A(&addr, &noOfBytes);
-  S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
+  do{
+    S2LP_SpiReadRegisters(MC_STATE0_ADDRESS, 1, mcState0);
+    if (((mcState0[0] >> 1) == state) && ((state != MC_STATE_READY) || ((mcState0[0] & MC_STATE0_XO_ON) != 0))){
+      return TRUE;
+    }
+  }while((HAL_GetTick() - start) < S2LP_STATE_TIMEOUT_MS);
+  return FALSE;
+}
+
+/** @brief Writes the blocks that differ between the modes.
+ *  @param mode The mode to configure.
+ *  @return Nothing.
+ */
+static void S2LP_WriteModeBlocks(S2LP_MODE_VALUES_TYPEDEF mode){
+  uint8_t addr;
+  uint8_t noOfBytes;
+  uint8_t *bytearr;
   
-  S2LP_ZeroArray(readArr, 255);
-  S2LP_SpiReadRegisters(addr, noOfBytes, readArr);
+  // Is GPIO2 the nIRQ of the packet handler?
+  if (mode == S2LP_MODE_PACKET_FIFO){
+    // Yes
+    bytearr = S2LP_getConfigBlock_PacketGpio(&addr, &noOfBytes);
+    S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
+    bytearr = S2LP_getConfigBlock_PacketPacket(&addr, &noOfBytes);
+    S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
+    bytearr = S2LP_getConfigBlock_PacketFifo(&addr, &noOfBytes);
+    S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
+    bytearr = S2LP_getConfigBlock_PacketIrq(&addr, &noOfBytes);
+    S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
+  }else{
+    // No, the modulation input
+    bytearr = S2LP_getConfigBlock_A(&addr, &noOfBytes);
+    S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
+    bytearr = S2LP_getConfigBlock_D(&addr, &noOfBytes);
+    S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
+  }
+}
+
+/** @brief Writes the synthesizer and the PA power out of the EEPROM.
+ *  @return Nothing.
+ */
+static void S2LP_WriteEepromBlocks(void){
+  uint8_t eepromArr[9];
   
   // Block B is residing in eeprom -> read and build array from there
   eepromArr[0] = eeprom_getS2LP_Synth3();
   eepromArr[1] = eeprom_getS2LP_Synth2();
   eepromArr[2] = eeprom_getS2LP_Synth1();
   eepromArr[3] = eeprom_getS2LP_Synth0();
-  noOfBytes = 4;
-  addr = 0x05;
-  S2LP_SpiWriteRegisters(addr, noOfBytes, eepromArr);
-  
-  S2LP_ZeroArray(readArr, 255);
-  S2LP_SpiReadRegisters(addr, noOfBytes, readArr);
-  
-  bytearr = S2LP_getConfigBlock_C(&addr, &noOfBytes);
-  S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
-  
-  S2LP_ZeroArray(readArr, 255);
-  S2LP_SpiReadRegisters(addr, noOfBytes, readArr);
-  
-  bytearr = S2LP_getConfigBlock_D(&addr, &noOfBytes);
-  S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
-  
-  S2LP_ZeroArray(readArr, 255);
-  S2LP_SpiReadRegisters(addr, noOfBytes, readArr);
+  S2LP_SpiWriteRegisters(0x05, 4, eepromArr);
   
   // Block E is residing in eeprom -> read and build array from there
   eepromArr[0] = eeprom_getS2LP_OutputPower8();
@@ -148,36 +256,111 @@ void S2LP_PowerUp(void)
   eepromArr[6] = eeprom_getS2LP_OutputPower2();
   eepromArr[7] = eeprom_getS2LP_OutputPower1();
   eepromArr[8] = eeprom_getS2LP_OutputPower0();
-  noOfBytes = 9;
-  addr = 0x5A;
-  S2LP_SpiWriteRegisters(addr, noOfBytes, eepromArr);
-  
-  S2LP_ZeroArray(readArr, 255);
-  S2LP_SpiReadRegisters(addr, noOfBytes, readArr);
-  
-  gpio_s2lp_signalGPO2Output_init();
-  
+  S2LP_SpiWriteRegisters(0x5A, 9, eepromArr);
+}
+
+/** @brief Releases the pins and the clock of the S2LP.
+ *  @return Nothing.
+ */
+static void S2LP_ReleasePins(void){
+  if (s2lpMode == S2LP_MODE_PACKET_FIFO){
+    gpio_s2lp_signalGPO2Irq_deInit();
+  }else{
+    gpio_s2lp_signalGPO2Output_deInit();
+  }
+  S2LP_ClockOff();
 }
 
 void S2LP_Shutdown(void)
 {
   gpio_s2lp_pinShutdown_setToShutdown();
-  gpio_s2lp_signalGPO2Output_deInit();
   gpio_s2lp_pinCS_deInit();
-  switch(eeprom_getS2LP_ClocksourceSelector()){
-    case CLOCKTYPE_SELECTOR_TCXO:
-      gpio_tcxo_off(); // TCXO enable!
-      break;
-      
-    case CLOCKTYPE_SELECTOR_XTAL:
-      gpio_xtal_off(); // XTAL enable!
-      break;
-      
-    default:
-      gpio_ledOutputMode();
-      led_red();
-      break;
+  S2LP_ReleasePins();
+  s2lpPower = S2LP_POWER_OFF;
+  S2LP_ShadowInvalidate();
+}
+
+/** @brief Brings the S2LP to READY with the configuration of the mode. Out of
+ *         STANDBY the shadow leaves out what the registers hold already, else
+ *         the chip gets powered up and fully configured.
+ *  @param mode The mode to configure.
+ *  @return TRUE if configured, FALSE if it didn't get READY and is shut down.
+ */
+bool S2LP_PowerUp(S2LP_MODE_VALUES_TYPEDEF mode)
+{ 
+  uint8_t addr;
+  uint8_t noOfBytes;
+  uint8_t *bytearr;
+  bool retained = (s2lpPower == S2LP_POWER_RETAINED) ? TRUE : FALSE;
+  
+  S2LP_ClockOn();
+  gpio_s2lp_pinCS_init();
+  
+  // Is the S2LP still active from the last power up?
+  if (s2lpPower == S2LP_POWER_ACTIVE){
+    // Yes, leave TX first
+    S2LP_SpiCommandStrobes(COMMAND_SABORT);
+    retained = TRUE;
+  }
+  // Are the registers kept?
+  if (retained == TRUE){
+    S2LP_SpiCommandStrobes(COMMAND_READY);
+    // The status bytes show the state before the strobe, a chip that got
+    // reset in between would show READY with its reset values
+    if (((s2lpPower == S2LP_POWER_RETAINED) && ((S2LP_ErrorCode[1] >> 1) != MC_STATE_STANDBY)) || (S2LP_WaitForState(MC_STATE_READY) == FALSE)){
+      // No, start over with a power cycle
+      gpio_s2lp_pinShutdown_setToShutdown();
+      retained = FALSE;
+    }
+  }
+  if (retained == FALSE){
+    S2LP_ShadowInvalidate();
+    gpio_s2lp_pinShutdown_setToRunmode();
+    // The chip goes to READY by itself once the oscillator runs
+    if (S2LP_WaitForState(MC_STATE_READY) == FALSE){
+      // The configuration would not stick, the next power up starts cold again
+      S2LP_Shutdown();
+      return FALSE;
+    }
+  }
+  
+  bytearr = S2LP_getConfigBlock_C(&addr, &noOfBytes);
+  S2LP_SpiWriteRegisters(addr, noOfBytes, bytearr);
+  S2LP_WriteEepromBlocks();
+  S2LP_WriteModeBlocks(mode);
+  s2lpMode = mode;
+  s2lpPower = S2LP_POWER_ACTIVE;
+  
+  if (mode == S2LP_MODE_PACKET_FIFO){
+    gpio_s2lp_signalGPO2Irq_init();
+  }else{
+    gpio_s2lp_signalGPO2Output_init();
+  }
+  return TRUE;
+}
+
+/** @brief Puts the S2LP into STANDBY, which keeps the registers. If it does
+ *         not get there it is shut down.
+ *  @return Nothing.
+ */
+static void S2LP_Standby(void){
+  // TX ends with SABORT, a lock with READY, both are ignored in READY
+  S2LP_SpiCommandStrobes(COMMAND_SABORT);
+  S2LP_SpiCommandStrobes(COMMAND_READY);
+  // STANDBY is only entered out of READY
+  if (S2LP_WaitForState(MC_STATE_READY) == FALSE){
+    S2LP_Shutdown();
+    return;
+  }
+  S2LP_SpiCommandStrobes(COMMAND_STANDBY);
+  if (S2LP_WaitForState(MC_STATE_STANDBY) == FALSE){
+    S2LP_Shutdown();
+    return;
   }
+  // The pulled up CS keeps the chip deselected
+  gpio_s2lp_pinCS_setToRetention();
+  S2LP_ReleasePins();
+  s2lpPower = S2LP_POWER_RETAINED;
 }
 
 void S2LP_CS_LOW(void)
@@ -190,40 +373,83 @@ void S2LP_CS_HIGH(void)
   gpio_s2lp_pinCS_setToSilence();    // SPI1 CS HIGH ! 
 }
 
-/**
-* @brief  Write single or multiple registers.
-* @param  cRegAddress: base register's address to be write
-* @param  cNbBytes: number of registers and bytes to be write
-* @param  pcBuffer: pointer to the buffer of values have to be written into registers
-* @retval Device status
-*/
-void S2LP_SpiWriteRegisters(uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBuffer)
+/** @brief One transaction on the bus, the status bytes go to S2LP_ErrorCode.
+ *  @param header WRITE_HEADER or READ_HEADER
+ *  @param cRegAddress The first register
+ *  @param cNbBytes The count of registers
+ *  @param pcBuffer The values to write or the buffer to read into
+ *  @return Nothing.
+ */
+static void S2LP_SpiTransfer(uint8_t header, uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBuffer)
 {
-  HAL_StatusTypeDef hstd = HAL_OK;
-  uint8_t tx_buff[2] = {WRITE_HEADER, cRegAddress};
-  uint8_t rx_buff[255];
+  uint8_t tx_buff[2] = {header, cRegAddress};
   
   //__disable_irq();     // SPI_ENTER_CRITICAL
   
   /* Puts the SPI chip select low to start the transaction */
   S2LP_CS_LOW();
   
-  hstd |= HAL_SPI_TransmitReceive(&hspi1, tx_buff, rx_buff, 2, 1000);
-  hstd |= HAL_SPI_TransmitReceive(&hspi1, pcBuffer, &rx_buff[2], cNbBytes, 1000);
+  HAL_SPI_TransmitReceive(&hspi1, tx_buff, S2LP_ErrorCode, 2, S2LP_SPI_TIMEOUT_MS);
+  // Is it a read?
+  if (header == READ_HEADER){
+    // Yes, the S2LP ignores MOSI meanwhile, so the buffer clocks itself like HAL_SPI_Receive does
+    HAL_SPI_TransmitReceive(&hspi1, pcBuffer, pcBuffer, cNbBytes, S2LP_SPI_TIMEOUT_MS);
+  }else{
+    HAL_SPI_Transmit(&hspi1, pcBuffer, cNbBytes, S2LP_SPI_TIMEOUT_MS);
+  }
   
   /* Puts the SPI chip select high to end the transaction */
   S2LP_CS_HIGH();
   
   //__enable_irq();      // SPI_EXIT_CRITICAL();
-      
-  S2LP_ErrorCode[0] = rx_buff[0];
-  S2LP_ErrorCode[1] = rx_buff[1];
+}
+
+/**
+* @brief  Write single or multiple registers. Configuration registers the
+*         shadow knows with the same value are left out, the changed ones
+*         are written in as few bursts as possible.
+* @param  cRegAddress: base register's address to be write
+* @param  cNbBytes: number of registers and bytes to be write
+* @param  pcBuffer: pointer to the buffer of values have to be written into registers
+* @retval Device status
+*/
+void S2LP_SpiWriteRegisters(uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBuffer)
+{
+  uint8_t i = 0;
+  uint8_t start;
+  uint8_t end;
   
-  return;
+  // Is it the FIFO or a status register?
+  if ((cRegAddress == LINEAR_FIFO_ADDRESS) || (((uint32_t) cRegAddress + cNbBytes) > S2LP_SHADOW_SIZE)){
+    // Yes, nothing to compare with
+    S2LP_SpiTransfer(WRITE_HEADER, cRegAddress, cNbBytes, pcBuffer);
+    return;
+  }
+  
+  while (i < cNbBytes){
+    // Is the register up to date?
+    if (S2LP_ShadowHolds(cRegAddress + i, pcBuffer[i]) == TRUE){
+      // Yes
+      i++;
+      continue;
+    }
+    // Take the following changes into the burst as long as the gaps are short
+    start = i;
+    end = i + 1;
+    for (i = end; (i < cNbBytes) && ((i - end) <= S2LP_SHADOW_MAX_GAP); i++){
+      if (S2LP_ShadowHolds(cRegAddress + i, pcBuffer[i]) == FALSE){
+        end = i + 1;
+      }
+    }
+    S2LP_SpiTransfer(WRITE_HEADER, cRegAddress + start, end - start, &pcBuffer[start]);
+    S2LP_ShadowUpdate(cRegAddress + start, end - start, &pcBuffer[start]);
+    i = end;
+  }
 }
 
 /**
-* @brief  Read single or multiple registers.
+* @brief  Read single or multiple registers. Configuration registers the
+*         shadow knows all of are not read from the chip.
 * @param  cRegAddress: base register's address to be read
 * @param  cNbBytes: number of registers and bytes to be read
 * @param  pcBuffer: pointer to the buffer of registers' values read
@@ -231,20 +457,25 @@ void S2LP_SpiWriteRegisters(uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBu
 */
 void S2LP_SpiReadRegisters(uint8_t cRegAddress, uint8_t cNbBytes, uint8_t* pcBuffer)
 {
-  uint8_t tx_buff[255] = {READ_HEADER, cRegAddress};
-  uint8_t rx_buff[2];
+  uint8_t i;
+  bool cached = (((uint32_t) cRegAddress + cNbBytes) <= S2LP_SHADOW_SIZE) ? TRUE : FALSE;
   
-  //__disable_irq();     // SPI_ENTER_CRITICAL
-  S2LP_CS_LOW();
-  HAL_SPI_TransmitReceive(&hspi1, tx_buff, rx_buff, 2, 1000);
-  HAL_SPI_TransmitReceive(&hspi1, tx_buff, pcBuffer, cNbBytes, 1000);  
-  S2LP_CS_HIGH();
-  //__enable_irq();      // SPI_EXIT_CRITICAL();
-    
-  S2LP_ErrorCode[0] = rx_buff[0];
-  S2LP_ErrorCode[1] = rx_buff[1];
+  // Does the shadow know them all?
+  for (i = 0; (cached == TRUE) && (i < cNbBytes); i++){
+    if ((s2lpShadowKnown[(cRegAddress + i) >> 3] & (1 << ((cRegAddress + i) & 0x07))) == 0){
+      cached = FALSE;
+    }
+  }
+  if (cached == TRUE){
+    // Yes
+    memcpy(pcBuffer, &s2lpShadow[cRegAddress], cNbBytes);
+    return;
+  }
   
-  return;
+  S2LP_SpiTransfer(READ_HEADER, cRegAddress, cNbBytes, pcBuffer);
+  if (((uint32_t) cRegAddress + cNbBytes) <= S2LP_SHADOW_SIZE){
+    S2LP_ShadowUpdate(cRegAddress, cNbBytes, pcBuffer);
+  }
 }
 
 /**
@@ -260,13 +491,18 @@ void S2LP_SpiCommandStrobes(uint8_t cCommandCode)
   
   //__disable_irq();     // SPI_ENTER_CRITICAL
   S2LP_CS_LOW();
-  hstd |= HAL_SPI_TransmitReceive(&hspi1, tx_buff, rx_buff, 2, 1000);  
+  hstd |= HAL_SPI_TransmitReceive(&hspi1, tx_buff, rx_buff, 2, S2LP_SPI_TIMEOUT_MS);  
   S2LP_CS_HIGH();
   //__enable_irq();      // SPI_EXIT_CRITICAL();
   
   S2LP_ErrorCode[0] = rx_buff[0];
   S2LP_ErrorCode[1] = rx_buff[1];
   
+  // The soft reset puts the registers back to their reset values
+  if (cCommandCode == COMMAND_SRES){
+    S2LP_ShadowInvalidate();
+  }
+  
   return;
 }
 
@@ -291,7 +527,7 @@ void S2LP_SetRegistersCWMode(void)
 */
 void S2LP_ResetRegistersCWMode(void)
 {
-#warning "THIS FUNCTION SEEMS TO BE PART OF THE S87 AS WE DONT HAVE 25KBPS!"
+// THIS FUNCTION SEEMS TO BE PART OF THE S87 AS WE DONT HAVE 25KBPS!
   uint8_t tmp[1];
   // MOD2
   // In normal mode, restore 25kbps baudrate
@@ -316,7 +552,7 @@ void S2LP_setLowPower(uint8_t lowPower)
 {
   uint8_t S2LPReg[2];
 
-#warning "TELEALARM DOES LOCK THE SPI HERE. AS WE DON'T HAVE ANY PARALLEL PROCESSES, WE SHOULD NOT NEED THAT"
+// TELEALARM DOES LOCK THE SPI HERE. AS WE DON'T HAVE ANY PARALLEL PROCESSES, WE SHOULD NOT NEED THAT
   if(lowPower)
   {
 //    S2LPReg[0] = 0x45;                                                          // -20dBm
@@ -333,7 +569,7 @@ void S2LP_setLowPower(uint8_t lowPower)
     S2LPReg[0] = 0x27;
     S2LP_SpiWriteRegisters(0x62, 1, S2LPReg);                                   // Set max power 14dBm 
   }
-#warning "TELEALARM DOES UNLOCK THE SPI HERE. AS WE DON'T HAVE ANY PARALLEL PROCESSES, WE SHOULD NOT NEED THAT"
+// TELEALARM DOES UNLOCK THE SPI HERE. AS WE DON'T HAVE ANY PARALLEL PROCESSES, WE SHOULD NOT NEED THAT
 }
 
 /****************************************************************************************/
@@ -347,9 +583,9 @@ void S2LP_setLowPower(uint8_t lowPower)
 
 void S2LP_setFreq(uint8_t *f)
 {
-#warning "TELEALARM DOES LOCK THE SPI HERE. AS WE DON'T HAVE ANY PARALLEL PROCESSES, WE SHOULD NOT NEED THAT"
+// TELEALARM DOES LOCK THE SPI HERE. AS WE DON'T HAVE ANY PARALLEL PROCESSES, WE SHOULD NOT NEED THAT
   S2LP_SpiWriteRegisters(0x05, 4, f);
-#warning "TELEALARM DOES UNLOCK THE SPI HERE. AS WE DON'T HAVE ANY PARALLEL PROCESSES, WE SHOULD NOT NEED THAT"
+// TELEALARM DOES UNLOCK THE SPI HERE. AS WE DON'T HAVE ANY PARALLEL PROCESSES, WE SHOULD NOT NEED THAT
 }
 
 uint8_t S2LP_isError()
@@ -358,20 +594,21 @@ uint8_t S2LP_isError()
 }
 
 void S2LP_SendCommandStrobes(void){
-  HAL_Delay(10);
-  S2LP_SpiCommandStrobes(0x62);
-  HAL_Delay(1);
-  S2LP_SpiCommandStrobes(0x66);
-  HAL_Delay(1);
-  S2LP_SpiCommandStrobes(0x60);
-  HAL_Delay(1);
+  // S2LP_PowerUp left the chip in READY
+  S2LP_SpiCommandStrobes(COMMAND_LOCKTX);
+  S2LP_WaitForState(MC_STATE_LOCKON);
+  S2LP_SpiCommandStrobes(COMMAND_TX);
+  S2LP_WaitForState(MC_STATE_TX);
 }
 
-void S2LP_SetConfig_CWActiveMode(void){  
+bool S2LP_SetConfig_CWActiveMode(void){  
   SPI_S2LP_Init();
-  S2LP_PowerUp();
+  if (S2LP_PowerUp(S2LP_MODE_DIRECT_GPIO) == FALSE){
+    return FALSE;
+  }
   S2LP_SetRegistersCWMode();
   S2LP_SendCommandStrobes();
+  return TRUE;
 }
 
 void S2LP_SetConfig_CWInactiveMode(void){
@@ -380,13 +617,209 @@ void S2LP_SetConfig_CWInactiveMode(void){
   SPI_S2LP_DeInit();
 }
 
-void S2LP_SetConfig_WorkingMode(void){  
+bool S2LP_SetConfig_WorkingMode(void){  
   SPI_S2LP_Init();
-  S2LP_PowerUp();
+  if (S2LP_PowerUp(S2LP_MODE_DIRECT_GPIO) == FALSE){
+    return FALSE;
+  }
   S2LP_SendCommandStrobes();
+  return TRUE;
 }
 
 void S2LP_SetConfig_SleepMode(void){
-  S2LP_Shutdown();
+  if (s2lpPower == S2LP_POWER_ACTIVE){
+    S2LP_Standby();
+  }
   SPI_S2LP_DeInit();
 }
+
+void S2LP_SetConfig_OffMode(void){
+  if (s2lpPower != S2LP_POWER_OFF){
+    S2LP_Shutdown();
+  }
+  SPI_S2LP_DeInit();
+}
+
+bool S2LP_SetConfig_PacketMode(void){
+  SPI_S2LP_Init();
+  // The TX strobe locks the synthesizer by itself, so READY is enough
+  return S2LP_PowerUp(S2LP_MODE_PACKET_FIFO);
+}
+
+void S2LP_SetPacketLength(uint16_t length){
+  uint8_t tmp[2];
+  
+  tmp[0] = (uint8_t) (length >> 8);
+  tmp[1] = (uint8_t) (length & 0xFF);
+  S2LP_SpiWriteRegisters(PCKTLEN1_ADDRESS, 2, tmp);
+}
+
+void S2LP_WriteTxFifo(uint8_t *data, uint8_t count){
+  S2LP_SpiWriteRegisters(LINEAR_FIFO_ADDRESS, count, data);
+}
+
+uint8_t S2LP_GetTxFifoCount(void){
+  uint8_t tmp[1];
+  
+  S2LP_SpiReadRegisters(TX_FIFO_STATUS_ADDRESS, 1, tmp);
+  return tmp[0];
+}
+
+uint32_t S2LP_GetIrqStatus(void){
+  uint8_t tmp[4];
+  
+  S2LP_SpiReadRegisters(IRQ_STATUS3_ADDRESS, 4, tmp);
+  return (((uint32_t) tmp[0]) << 24) | (((uint32_t) tmp[1]) << 16) | (((uint32_t) tmp[2]) << 8) | tmp[3];
+}
+
+void S2LP_FlushTxFifo(void){
+  S2LP_SpiCommandStrobes(COMMAND_FLUSHTXFIFO);
+}
+
+void S2LP_StartTx(void){
+  S2LP_SpiCommandStrobes(COMMAND_TX);
+}
+
+void S2LP_AbortTx(void){
+  S2LP_SpiCommandStrobes(COMMAND_SABORT);
+}
+
+#if TEST_S2LP >= 1
+
+int S2LP_testsuite(){
+#if defined(HOST_BUILD)
+  S2LP_SIM_STATISTICS_STRUCT_TYPEDEF statistics;
+  uint64_t startNs;
+  uint32_t coldUs;
+  uint32_t warmUs;
+  uint8_t synth3;
+  uint8_t synth[4];
+  uint8_t mcState0[1];
+  
+  // Out of shutdown everything gets written
+  S2LP_SetConfig_OffMode();
+  if (s2lpSim_getState() != S2LP_SIM_STATE_SHUTDOWN){
+    return -1;
+  }
+  s2lpSim_resetStatistics();
+  startNs = halSim_getTimeNs();
+  S2LP_SetConfig_PacketMode();
+  coldUs = (uint32_t) ((halSim_getTimeNs() - startNs) / 1000);
+  s2lpSim_getStatistics(&statistics);
+  if ((s2lpSim_getState() != S2LP_SIM_STATE_READY) || ((s2lpSim_getRegister(MC_STATE0_ADDRESS) & MC_STATE0_XO_ON) == 0) || (statistics.powerUps != 1)){
+    S2LP_SetConfig_OffMode();
+    return -2;
+  }
+  synth3 = s2lpSim_getRegister(0x05);
+  
+  // The sleep keeps the registers
+  S2LP_SetConfig_SleepMode();
+  if (s2lpSim_getState() != S2LP_SIM_STATE_STANDBY){
+    S2LP_SetConfig_OffMode();
+    return -3;
+  }
+  
+  // Waking up into the same mode writes nothing
+  s2lpSim_resetStatistics();
+  startNs = halSim_getTimeNs();
+  S2LP_SetConfig_PacketMode();
+  warmUs = (uint32_t) ((halSim_getTimeNs() - startNs) / 1000);
+  s2lpSim_getStatistics(&statistics);
+  if ((s2lpSim_getState() != S2LP_SIM_STATE_READY) || (statistics.powerUps != 0) || (statistics.registerWrites != 0)){
+    S2LP_SetConfig_OffMode();
+    return -4;
+  }
+  if ((s2lpSim_getRegister(0x05) != synth3) || ((s2lpSim_getRegister(PCKTCTRL1_ADDRESS) & 0x0C) != 0x00)){
+    S2LP_SetConfig_OffMode();
+    return -5;
+  }
+  if ((warmUs >= 1000) || (warmUs >= coldUs)){
+    S2LP_SetConfig_OffMode();
+    return -6;
+  }
+  
+  // Another mode only writes the blocks of that mode, TX of the working mode
+  // is left by the sleep
+  S2LP_SetConfig_SleepMode();
+  s2lpSim_resetStatistics();
+  S2LP_SetConfig_WorkingMode();
+  s2lpSim_getStatistics(&statistics);
+  if ((s2lpSim_getState() != S2LP_SIM_STATE_TX) || (statistics.powerUps != 0) || (statistics.registerWrites > 2) || ((s2lpSim_getRegister(PCKTCTRL1_ADDRESS) & 0x0C) != 0x08)){
+    S2LP_SetConfig_OffMode();
+    return -7;
+  }
+  
+  // The configuration comes out of the shadow and the same values don't get
+  // written again, the state is read from the chip every time
+  S2LP_setLowPower(0);
+  s2lpSim_resetStatistics();
+  S2LP_SpiReadRegisters(0x05, 4, synth);
+  S2LP_setFreq(synth);
+  S2LP_setLowPower(0);
+  S2LP_SpiReadRegisters(MC_STATE0_ADDRESS, 1, mcState0);
+  s2lpSim_getStatistics(&statistics);
+  if ((synth[0] != synth3) || (statistics.transactions != 1) || (statistics.registerWrites != 0) || (statistics.registerReads != 1) || ((mcState0[0] >> 1) != MC_STATE_TX)){
+    S2LP_SetConfig_OffMode();
+    return -9;
+  }
+  
+  // Changes with a short gap go in one burst, a lone change alone
+  s2lpSim_resetStatistics();
+  synth[0]++;
+  synth[3]++;
+  S2LP_setFreq(synth);
+  synth[0]--;
+  S2LP_setFreq(synth);
+  s2lpSim_getStatistics(&statistics);
+  if ((statistics.transactions != 2) || (statistics.registerWrites != 5) || (s2lpSim_getRegister(0x08) != synth[3]) || (s2lpSim_getRegister(0x05) != synth3)){
+    S2LP_SetConfig_OffMode();
+    return -10;
+  }
+  
+  S2LP_SetConfig_SleepMode();
+  if (s2lpSim_getState() != S2LP_SIM_STATE_STANDBY){
+    S2LP_SetConfig_OffMode();
+    return -8;
+  }
+  S2LP_SetConfig_OffMode();
+  
+  // A chip that does not get READY is shut down instead of configured
+  s2lpSim_breakXo(1);
+  s2lpSim_resetStatistics();
+  if ((S2LP_SetConfig_PacketMode() != FALSE) || (s2lpSim_getState() != S2LP_SIM_STATE_SHUTDOWN)){
+    s2lpSim_breakXo(0);
+    S2LP_SetConfig_OffMode();
+    return -11;
+  }
+  s2lpSim_getStatistics(&statistics);
+  S2LP_SetConfig_OffMode();
+  s2lpSim_breakXo(0);
+  if ((statistics.powerUps != 1) || (statistics.registerWrites != 0)){
+    return -12;
+  }
+  
+  // The shadow got dropped with it, the next power up writes everything
+  s2lpSim_resetStatistics();
+  if ((S2LP_SetConfig_PacketMode() != TRUE) || (s2lpSim_getRegister(0x05) != synth3)){
+    S2LP_SetConfig_OffMode();
+    return -13;
+  }
+  
+  // A chip that lost its oscillator does not get to STANDBY out of READY
+  s2lpSim_breakXo(1);
+  s2lpSim_brownOutIn(1000);
+  halSim_advanceNs(2000);
+  S2LP_SetConfig_SleepMode();
+  s2lpSim_breakXo(0);
+  if (s2lpSim_getState() != S2LP_SIM_STATE_SHUTDOWN){
+    S2LP_SetConfig_OffMode();
+    return -14;
+  }
+  S2LP_SetConfig_OffMode();
+  
+  TRACE_TEST_VALUES(1, "S2LP POWER UP COLD %i US, WARM %i US", (int) coldUs, (int) warmUs);
+#endif
+  return 0;
+}
+
+#endif
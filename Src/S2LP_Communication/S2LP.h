@@ -25,11 +25,11 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Packet mode with TX FIFO and interrupts       |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | Added S2LP_SetConfig_OffMode and the test     |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 004       | 2026-10-18    | Tim Steinberg         | SetConfig tells if the S2LP got READY         |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -40,15 +40,95 @@
 #define __S2LP_H
 
 /* Includes */
+#include <inttypes.h>
+#include "Test_Selector.h"
+#include "MasterDefine.h"
 
 /* Typedefinitions */
 
+/**
+ * @brief How the S2LP gets the bits to send.
+ */
+typedef enum S2LP_MODE_VALUES {
+  S2LP_MODE_DIRECT_GPIO                         = 0x00, /**< The MCU modulates through GPIO2 */
+  S2LP_MODE_PACKET_FIFO                         = 0x01, /**< The packet handler sends the TX FIFO, GPIO2 is nIRQ */
+} S2LP_MODE_VALUES_TYPEDEF;
+
+// Size of the TX FIFO in bytes
+#define S2LP_TX_FIFO_SIZE                               128
+
+// Interrupts of IRQ_STATUS, enabled by the packet mode configuration
+#define S2LP_IRQ_TX_DATA_SENT                           0x00000004
+#define S2LP_IRQ_TX_FIFO_ERROR                          0x00000020
+#define S2LP_IRQ_TX_FIFO_ALMOST_EMPTY                   0x00000100
+
 /* Variables */
 
 /* Function definitions */
-void S2LP_SetConfig_CWActiveMode(void);
+/** @brief Powers the S2LP up and starts to send a carrier.
+ *  @return TRUE if it sends, FALSE if it didn't get READY and is shut down.
+ */
+bool S2LP_SetConfig_CWActiveMode(void);
 void S2LP_SetConfig_CWInactiveMode(void);
-void S2LP_SetConfig_WorkingMode(void);
+
+/** @brief Powers the S2LP up for S2LP_MODE_DIRECT_GPIO and puts it to TX.
+ *  @return TRUE if it is in TX, FALSE if it didn't get READY and is shut down.
+ */
+bool S2LP_SetConfig_WorkingMode(void);
+
+/** @brief Puts the S2LP into STANDBY. It keeps its registers there, so the
+ *         next power up only writes what changed.
+ *  @return Nothing.
+ */
 void S2LP_SetConfig_SleepMode(void);
 
+/** @brief Shuts the S2LP down, the registers are lost. The next power up
+ *         configures it completely.
+ *  @return Nothing.
+ */
+void S2LP_SetConfig_OffMode(void);
+
+/** @brief Powers the S2LP up for S2LP_MODE_PACKET_FIFO and puts it to READY.
+ *         S2LP_SetConfig_SleepMode powers it down again.
+ *  @return TRUE if it is READY, FALSE if it didn't get there and is shut down.
+ */
+bool S2LP_SetConfig_PacketMode(void);
+
+/** @brief Sets the count of payload bytes of the next packet
+ *  @param length The count of bytes
+ *  @return Nothing.
+ */
+void S2LP_SetPacketLength(uint16_t length);
+
+/** @brief Writes bytes into the TX FIFO
+ *  @param *data The bytes
+ *  @param count The count of bytes, S2LP_TX_FIFO_SIZE at most
+ *  @return Nothing.
+ */
+void S2LP_WriteTxFifo(uint8_t *data, uint8_t count);
+
+/** @brief Reads the count of bytes waiting in the TX FIFO
+ *  @return The count.
+ */
+uint8_t S2LP_GetTxFifoCount(void);
+
+/** @brief Reads the interrupt status, the S2LP clears it and releases nIRQ
+ *         by that
+ *  @return The S2LP_IRQ_x bits that are set.
+ */
+uint32_t S2LP_GetIrqStatus(void);
+
+void S2LP_FlushTxFifo(void);
+void S2LP_StartTx(void);
+void S2LP_AbortTx(void);
+
+#if TEST_S2LP >= 1
+
+/** @brief This method is the test for this unit
+ *  @return The returnvalue. 0 == OK, <0 == FAILURE
+ */
+int S2LP_testsuite();
+
+#endif
+
 #endif
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Configuration of the packet mode              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -85,6 +85,31 @@ uint8_t S2LP_configuration_GPIO_MODE_BlockE[] = {
 };
 
 
+// The packet handler sends the TX FIFO, the MCU only refills it
+uint8_t S2LP_configuration_PACKET_MODE_BlockGpio[] = {
+  0x02, // 0x02 GPIO2Conf -> GPIO2_CONF nIRQ, Output low power
+};
+
+uint8_t S2LP_configuration_PACKET_MODE_BlockPacket[] = {
+  0x00, // 0x2B PCKTCTRL6 -> No sync word
+  0x04, // 0x2C PCKTCTRL5 -> Preamble of 4 pairs = 0x55
+  0x00, // 0x2D PCKTCTRL4 -> No length field, no address
+  0x00, // 0x2E PCKTCTRL3 -> Basic packet, preamble "0101"
+  0x00, // 0x2F PCKTCTRL2 -> Fixed length, no manchester
+  0x00, // 0x30 PCKTCTRL1 -> TX from FIFO, no CRC, no whitening
+};
+
+uint8_t S2LP_configuration_PACKET_MODE_BlockFifo[] = {
+  0x30, // 0x3F FIFO_CONFIG0 -> TX almost empty at 48 bytes
+};
+
+uint8_t S2LP_configuration_PACKET_MODE_BlockIrq[] = {
+  0x00, // 0x50 IRQ_MASK3
+  0x00, // 0x51 IRQ_MASK2
+  0x01, // 0x52 IRQ_MASK1 -> TX FIFO almost empty
+  0x24, // 0x53 IRQ_MASK0 -> TX FIFO error, TX data sent
+};
+
 uint8_t* S2LP_getConfigBlock_A(uint8_t *addr, uint8_t *noBytes){
   *addr         = 0x02;
   *noBytes      = 1;
@@ -115,3 +140,27 @@ uint8_t* S2LP_getConfigBlock_E(uint8_t *addr, uint8_t *noBytes){
   return        S2LP_configuration_GPIO_MODE_BlockE;
 }
 
+uint8_t* S2LP_getConfigBlock_PacketGpio(uint8_t *addr, uint8_t *noBytes){
+  *addr         = 0x02;
+  *noBytes      = 1;
+  return        S2LP_configuration_PACKET_MODE_BlockGpio;
+}
+
+uint8_t* S2LP_getConfigBlock_PacketPacket(uint8_t *addr, uint8_t *noBytes){
+  *addr         = 0x2B;
+  *noBytes      = 6;
+  return        S2LP_configuration_PACKET_MODE_BlockPacket;
+}
+
+uint8_t* S2LP_getConfigBlock_PacketFifo(uint8_t *addr, uint8_t *noBytes){
+  *addr         = 0x3F;
+  *noBytes      = 1;
+  return        S2LP_configuration_PACKET_MODE_BlockFifo;
+}
+
+uint8_t* S2LP_getConfigBlock_PacketIrq(uint8_t *addr, uint8_t *noBytes){
+  *addr         = 0x50;
+  *noBytes      = 4;
+  return        S2LP_configuration_PACKET_MODE_BlockIrq;
+}
+
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-12-10    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Configuration of the packet mode              |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -52,5 +52,9 @@ uint8_t* S2LP_getConfigBlock_B(uint8_t *addr, uint8_t *noBytes);
 uint8_t* S2LP_getConfigBlock_C(uint8_t *addr, uint8_t *noBytes);
 uint8_t* S2LP_getConfigBlock_D(uint8_t *addr, uint8_t *noBytes);
 uint8_t* S2LP_getConfigBlock_E(uint8_t *addr, uint8_t *noBytes);
+uint8_t* S2LP_getConfigBlock_PacketGpio(uint8_t *addr, uint8_t *noBytes);
+uint8_t* S2LP_getConfigBlock_PacketPacket(uint8_t *addr, uint8_t *noBytes);
+uint8_t* S2LP_getConfigBlock_PacketFifo(uint8_t *addr, uint8_t *noBytes);
+uint8_t* S2LP_getConfigBlock_PacketIrq(uint8_t *addr, uint8_t *noBytes);
 
 #endif
\ No newline at end of file
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-07    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Load test in one ADC batch                    |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -99,7 +99,7 @@
 uint16_t batterylevel_mV(void){
   uint16_t calValue;
   
-  calValue = adcBlocking_getBatteryVoltage_fourOutOfSixAveragedLinearizedOffsetted();
+  calValue = adcBlocking_getBatteryVoltageLinearizedOffsetted();
   
   return calValue;
 }
@@ -180,6 +180,8 @@ uint16_t batterylevel_measureWithLoad(void){
   uint64_t sum = 0;
   
   S2LP_SetConfig_WorkingMode();
+  // All 6000 measurements in one batch, the ADC stays configured in between
+  adc_acquisition_open();
   for (int i = 0; i < 750; i++){
     setOutputToHigh();
     for (int j = 0; j < 4; j++){
@@ -190,6 +192,7 @@ uint16_t batterylevel_measureWithLoad(void){
       sum += batterylevel_getPercentage();
     }
   }
+  adc_acquisition_close();
   
   sum /= (750*8);
   
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-30    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Short STOP between awake activities           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -180,3 +180,29 @@ void runmode_sleep(uint32_t timeInSeconds){
   // Go to sleep
   rtc_setWakeUpInSeconds(timeInSeconds);
 }
+
+void runmode_sleep_stopForMilliseconds(uint32_t timeInMilliseconds){
+  // Suspend Clocking, the tick does not count the time in STOP
+  HAL_SuspendTick();
+  
+  // Enable Ultra low power mode
+  HAL_PWREx_EnableUltraLowPower();
+  
+  // Enable the fast wake up from Ultra low power mode
+  HAL_PWREx_EnableFastWakeUp();
+  
+  // Select MSI as system clock source after Wake Up from Stop mode
+  __HAL_RCC_WAKEUPSTOP_CLK_CONFIG(RCC_STOP_WAKEUPCLOCK_MSI);
+  
+  // Feed the barky
+  watchdog_feed();
+  
+  // Go to stop mode, the pins and the clock gating stay as they are
+  rtc_setWakeUpInMilliseconds(timeInMilliseconds);
+  
+  // Feed the barky
+  watchdog_feed();
+  
+  // Resume Clocking
+  HAL_ResumeTick();
+}
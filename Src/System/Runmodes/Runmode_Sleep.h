@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       |               | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Short STOP between awake activities           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -51,4 +51,13 @@ void runmode_sleep_prepare(void);
 
 void runmode_sleep(uint32_t timeInSeconds);
 
+/** @brief This method will stop the core for a short time between two
+ *         activities of the awake mode. The pins, peripherals and the
+ *         watchdog stay as they are, the RTC wakes the core up on the MSI.
+ *         Restore the clock tree of the awake mode afterwards.
+ *  @param timeInMilliseconds The time to stop
+ *  @return Nothing.
+ */
+void runmode_sleep_stopForMilliseconds(uint32_t timeInMilliseconds);
+
 #endif
\ No newline at end of file
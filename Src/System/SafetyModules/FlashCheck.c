@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-30    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Incremental scan over several wakes           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -45,13 +45,20 @@
 #include "EEPROM_ApplicationMapped.h"
 #include "EEPROM_Map.h"
 #include "CRC.h"
+#include "FlashCheck.h"
+#include "Test_Selector.h"
 
 /* Typedefinitions / Prototypes */
 #define LEESYS_FLASH_START     0x08000000
 #define LEESYS_FLASH_END       0x0800FFFF
 #define LEESYS_FLASH_SIZE      ((LEESYS_FLASH_END - LEESYS_FLASH_START) >> 2)
+#define LEESYS_FLASH_PAGE_SIZE (128 >> 2)
 
 /* Variables */
+// State of the incremental scan, kept in RAM through the STOP mode. A reset
+// starts it over from the first page
+static uint32_t flashCheck_scanPosition = 0;
+static uint32_t flashCheck_scanCrc = CRC_CRC32_MPEG2_INIT;
 
 /* Function definitions */
 uint32_t flashCheck_BuildFlashCRC(void){
@@ -68,7 +75,86 @@ bool flashCheck_CheckFlashCRC(void){
   }
 }
 
+void flashCheck_ScanRestart(void){
+  flashCheck_scanPosition = 0;
+  flashCheck_scanCrc = CRC_CRC32_MPEG2_INIT;
+}
+
+/** @brief Adds the next pages of the flash to the running CRC.
+ *  @param pageBudget The count of pages to check.
+ *  @return TRUE, if the pass is complete.
+ */
+static bool flashCheck_ScanAdvance(uint32_t pageBudget){
+  uint32_t words = pageBudget * LEESYS_FLASH_PAGE_SIZE;
+  
+  // The last page is one word short, see LEESYS_FLASH_SIZE
+  if (words > (LEESYS_FLASH_SIZE - flashCheck_scanPosition)){
+    words = LEESYS_FLASH_SIZE - flashCheck_scanPosition;
+  }
+  flashCheck_scanCrc = crc_calcCrc32_MPEG2_continue(flashCheck_scanCrc, ((uint32_t*) LEESYS_FLASH_START) + flashCheck_scanPosition, words);
+  flashCheck_scanPosition += words;
+  
+  if (flashCheck_scanPosition < LEESYS_FLASH_SIZE){
+    return FALSE;
+  }
+  return TRUE;
+}
+
+FLASHCHECK_SCAN_RESULT_VALUES_TYPEDEF flashCheck_ScanStep(uint32_t pageBudget){
+  uint32_t crcEEPValue;
+  
+  // Is the pass complete?
+  if (flashCheck_ScanAdvance(pageBudget) == FALSE){
+    // No
+    return FLASHCHECK_SCAN_ONGOING;
+  }
+  
+  // Yes, give the verdict and start the next pass
+  crcEEPValue = eeprom_getFlashCRC();
+  if (flashCheck_scanCrc == crcEEPValue){
+    flashCheck_ScanRestart();
+    return FLASHCHECK_SCAN_PASSED;
+  }
+  flashCheck_ScanRestart();
+  return FLASHCHECK_SCAN_FAILED;
+}
+
 bool flashCheck_UpdateEEPROMCRC(void){
   uint32_t crcResult = flashCheck_BuildFlashCRC();
   return eeprom_setFlashCRC(crcResult);
-}
\ No newline at end of file
+}
+
+#if TEST_FLASHCHECK >= 1
+int flashCheck_testsuite(){
+  uint32_t steps = 0;
+  uint32_t crcFull = flashCheck_BuildFlashCRC();
+  
+  // A pass in small pieces must end up with the CRC of the whole flash
+  flashCheck_ScanRestart();
+  do{
+    steps++;
+  }while(flashCheck_ScanAdvance(7) == FALSE);
+  if (flashCheck_scanCrc != crcFull){
+    return -1;
+  }
+  // 512 pages in steps of 7
+  if (steps != 74){
+    return -2;
+  }
+  
+  // The verdict comes with the last step only and the scan starts over
+  flashCheck_ScanRestart();
+  steps = 0;
+  while (flashCheck_ScanStep(FLASHCHECK_PAGES_PER_WAKE) == FLASHCHECK_SCAN_ONGOING){
+    steps++;
+  }
+  if (steps != ((512 / FLASHCHECK_PAGES_PER_WAKE) - 1)){
+    return -3;
+  }
+  if (flashCheck_scanPosition != 0){
+    return -4;
+  }
+  
+  return 0;
+}
+#endif
\ No newline at end of file
@@ -25,7 +25,7 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-11-30    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-17    | Tim Steinberg         | Incremental scan over several wakes           |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -41,13 +41,28 @@
 
 /* Includes */
 #include "MasterDefine.h"
+#include "Test_Selector.h"
 
 /* Typedefinitions */
+// Pages of 128 byte checked per wake: 64 KB are done after 16 wakes (~5 min)
+#define FLASHCHECK_PAGES_PER_WAKE               32
+
+typedef enum FLASHCHECK_SCAN_RESULT_VALUES {
+  FLASHCHECK_SCAN_ONGOING                       = 0x00, /**< Pass not complete yet */
+  FLASHCHECK_SCAN_PASSED                        = 0x01, /**< Pass complete, CRC matches the EEPROM */
+  FLASHCHECK_SCAN_FAILED                        = 0x02, /**< Pass complete, CRC differs */
+} FLASHCHECK_SCAN_RESULT_VALUES_TYPEDEF;
 
 /* Variables */
 
 /* Function definitions */
 bool flashCheck_CheckFlashCRC(void);
 bool flashCheck_UpdateEEPROMCRC(void);
+void flashCheck_ScanRestart(void);
+FLASHCHECK_SCAN_RESULT_VALUES_TYPEDEF flashCheck_ScanStep(uint32_t pageBudget);
+
+#if TEST_FLASHCHECK >= 1
+int flashCheck_testsuite();
+#endif
 
 #endif
\ No newline at end of file
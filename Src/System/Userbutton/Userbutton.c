@@ -25,9 +25,9 @@
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * | 001       | 2020-07-06    | Tim Steinberg         | Initial version / skeleton of file            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 002       | 2026-10-18    | Tim Steinberg         | Press time measured in one ADC batch          |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
-  * |           |               |                       |                                               |
+  * | 003       | 2026-10-18    | Tim Steinberg         | No press without a battery voltage            |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
   * |           |               |                       |                                               |
   * |-----------|---------------|-----------------------|-----------------------------------------------|
@@ -153,14 +153,17 @@ SYSTEMBOOT_SOURCE_BUTTON_TYPEDEF UserButtonMeasurePresstime(void){
   // Move button into free mode to allow for a slow rise of voltage
   gpio_userButtonMeasureMode();
   HAL_Delay(5);
-  adcBattery            = adcBlocking_getBatteryVoltage_fourOutOfSixAveragedLinearizedOffsetted();
+  // Keep the ADC configured for the whole press
+  adc_acquisition_open();
+  adcBattery            = adc_acquisition_getBatteryVoltage();
   adcBatteryPressed     = UserButtonGetLevel(adcBattery, 1331, 11);//(uint16_t) ((adcBattery * 1331) >> 11); // Have less than 64,99% of the battery voltage on the ADC pin to register pressed
   adcBatteryReleased    = UserButtonGetLevel(adcBattery, 1741, 11);//(uint16_t) ((adcBattery * 1741) >> 11); // Have more than 85,00% of the battery voltage on the ADC pin to register released
   
   // Do measurement to check the press state again
-  adcMeasurement = adcBlocking_getButtonVoltage_fourOutOfSixAveraged();
-  // If measurement indicating NO press, then this was a glitch
-  if (adcMeasurement < adcBatteryPressed){
+  adcMeasurement = adc_acquisition_getButtonVoltage();
+  // If measurement indicating NO press, then this was a glitch. Without the
+  // battery voltage there are no levels to compare with
+  if ((adcBattery != ADC_ACQUISITION_FAILED) && (adcMeasurement < adcBatteryPressed)){
     do{
       // Watchdog feeding
       watchdog_feed();
@@ -179,9 +182,10 @@ SYSTEMBOOT_SOURCE_BUTTON_TYPEDEF UserButtonMeasurePresstime(void){
         buttonAction = SYSTEMBOOT_SOURCE_BUTTON_BARRELROLL;//SYSTEMBOOT_SOURCE_BUTTON_EMERGENCY;
         led_green();
       }
-      adcMeasurement = adcBlocking_getButtonVoltage_fourOutOfSixAveraged();
+      adcMeasurement = adc_acquisition_getButtonVoltage();
     }while(adcMeasurement < adcBatteryReleased);
   }
+  adc_acquisition_close();
   
   // Restrict button to prevent a new restart action finished
   gpio_userButtonUnarmedMode();
@@ -536,6 +536,18 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart){
   }
 }
 
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart){
+  if (huart == &huart1){
+    userMethods_uartTransmissionCallback(HAL_GetTick());
+  }
+}
+
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart){
+  if (huart == &huart1){
+    userMethods_uartReceptionCallback(HAL_GetTick());
+  }
+}
+
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart){
   if (huart == &huart1){
     userMethods_uartReceptionCallback(HAL_GetTick());
@@ -22,6 +22,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 /* USER CODE BEGIN Includes */
+#include "DMA.h"
 
 /* USER CODE END Includes */
 
@@ -320,6 +321,7 @@ void HAL_UART_MspInit(UART_HandleTypeDef* huart)
     HAL_NVIC_SetPriority(USART1_IRQn, 0, 0);
     HAL_NVIC_EnableIRQ(USART1_IRQn);
   /* USER CODE BEGIN USART1_MspInit 1 */
+    dma_rsl_init(huart);
 
   /* USER CODE END USART1_MspInit 1 */
   }
@@ -378,6 +380,7 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* huart)
     /* USART1 interrupt DeInit */
     HAL_NVIC_DisableIRQ(USART1_IRQn);
   /* USER CODE BEGIN USART1_MspDeInit 1 */
+    dma_rsl_deInit(huart);
 
   /* USER CODE END USART1_MspDeInit 1 */
   }